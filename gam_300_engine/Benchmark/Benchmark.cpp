@@ -0,0 +1,270 @@
+/**
+ * @file Benchmark.cpp
+ * @brief Implementation of the benchmark harness for the game engine.
+ * @details Times registered benchmark cases over several samples, writes the
+ *          results as JSON and compares them against a stored baseline.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Benchmark.h"
+#include "../gam_300_engine/Manager/ECSManager.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace gam300 {
+
+    // Destination of benchmarkSink(), volatile so stores to it are never removed
+    static volatile uint64_t s_benchmark_sink = 0;
+
+    // Escape a string for a JSON string literal
+    static std::string escapeJson(const std::string& text) {
+        std::string escaped;
+        escaped.reserve(text.size());
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                escaped += '\\';
+            }
+            escaped += c;
+        }
+        return escaped;
+    }
+
+    // Construct a runner with default settings
+    BenchmarkRunner::BenchmarkRunner() :
+        m_baseline_quick(false),
+        m_quick(false),
+        m_samples(BENCHMARK_SAMPLES_DEFAULT) {
+    }
+
+    // Register a benchmark case
+    void BenchmarkRunner::add(const BenchmarkCase& benchmark_case) {
+        m_cases.push_back(benchmark_case);
+    }
+
+    // Get the registered cases
+    const std::vector<BenchmarkCase>& BenchmarkRunner::getCases() const {
+        return m_cases;
+    }
+
+    // Run reduced sizes with fewer samples
+    void BenchmarkRunner::setQuick(bool quick) {
+        m_quick = quick;
+        m_samples = quick ? BENCHMARK_SAMPLES_QUICK : BENCHMARK_SAMPLES_DEFAULT;
+    }
+
+    // Set the number of timed samples per case
+    void BenchmarkRunner::setSamples(int samples) {
+        m_samples = samples < 1 ? 1 : samples;
+    }
+
+    // Only run cases whose name contains a string
+    void BenchmarkRunner::setFilter(const std::string& filter) {
+        m_filter = filter;
+    }
+
+    // Time one case
+    BenchmarkResult BenchmarkRunner::runCase(const BenchmarkCase& benchmark_case) const {
+        BenchmarkResult result;
+        result.name = benchmark_case.name;
+        result.ops = m_quick ? std::max<std::size_t>(1, benchmark_case.ops / BENCHMARK_QUICK_DIVISOR) : benchmark_case.ops;
+        result.samples = m_samples;
+
+        std::vector<double> sample_ns;
+        sample_ns.reserve(m_samples);
+
+        // Sample -1 is an untimed warm-up
+        for (int sample = -1; sample < m_samples; ++sample) {
+            if (benchmark_case.setup) {
+                benchmark_case.setup(result.ops);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            benchmark_case.run(result.ops);
+            auto end = std::chrono::steady_clock::now();
+
+            if (sample >= 0) {
+                sample_ns.push_back(static_cast<double>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+            }
+
+            // Validate the state left by the last sample before it is torn down
+            if (sample == m_samples - 1 && benchmark_case.validate) {
+                result.valid = benchmark_case.validate(result.message);
+            }
+
+            if (benchmark_case.teardown) {
+                benchmark_case.teardown();
+            }
+        }
+
+        std::sort(sample_ns.begin(), sample_ns.end());
+        double sum = 0.0;
+        for (double ns : sample_ns) {
+            sum += ns;
+        }
+
+        result.min_ns = sample_ns.front();
+        result.max_ns = sample_ns.back();
+        result.mean_ns = sum / static_cast<double>(sample_ns.size());
+        result.median_ns = sample_ns[sample_ns.size() / 2];
+        result.ns_per_op = result.median_ns / static_cast<double>(result.ops);
+
+        return result;
+    }
+
+    // Run all registered cases that match the filter
+    int BenchmarkRunner::run() {
+        m_results.clear();
+        int failures = 0;
+
+        printf("%-36s %10s %14s %14s %14s\n", "benchmark", "ops", "median us", "min us", "ns/op");
+        for (const BenchmarkCase& benchmark_case : m_cases) {
+            if (!m_filter.empty() && benchmark_case.name.find(m_filter) == std::string::npos) {
+                continue;
+            }
+
+            BenchmarkResult result = runCase(benchmark_case);
+            printf("%-36s %10zu %14.1f %14.1f %14.2f%s\n",
+                result.name.c_str(), result.ops, result.median_ns / 1000.0, result.min_ns / 1000.0,
+                result.ns_per_op, result.valid ? "" : "  INVALID");
+
+            if (!result.valid) {
+                printf("    validation failed: %s\n", result.message.c_str());
+                failures++;
+            }
+
+            m_results.push_back(result);
+        }
+
+        return failures;
+    }
+
+    // Get the results of the last run
+    const std::vector<BenchmarkResult>& BenchmarkRunner::getResults() const {
+        return m_results;
+    }
+
+    // Write the results of the last run as JSON
+    bool BenchmarkRunner::writeJson(const std::string& filename) const {
+        std::ofstream file(filename);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        file << "{\n";
+        file << "  \"suite\": \"gam300\",\n";
+        file << "  \"quick\": " << (m_quick ? "true" : "false") << ",\n";
+        file << "  \"samples\": " << m_samples << ",\n";
+        file << "  \"results\": [\n";
+        for (std::size_t i = 0; i < m_results.size(); ++i) {
+            const BenchmarkResult& result = m_results[i];
+            file << "    { \"name\": \"" << escapeJson(result.name) << "\""
+                << ", \"ops\": " << result.ops
+                << ", \"samples\": " << result.samples
+                << ", \"min_ns\": " << result.min_ns
+                << ", \"median_ns\": " << result.median_ns
+                << ", \"mean_ns\": " << result.mean_ns
+                << ", \"max_ns\": " << result.max_ns
+                << ", \"ns_per_op\": " << result.ns_per_op
+                << ", \"valid\": " << (result.valid ? "true" : "false");
+            if (!result.valid) {
+                file << ", \"message\": \"" << escapeJson(result.message) << "\"";
+            }
+            file << " }" << (i + 1 < m_results.size() ? "," : "") << "\n";
+        }
+        file << "  ]\n";
+        file << "}\n";
+
+        return true;
+    }
+
+    // Load a baseline written by writeJson()
+    bool BenchmarkRunner::loadBaseline(const std::string& filename) {
+        std::ifstream file(filename);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        const std::string content = buffer.str();
+
+        m_baseline.clear();
+        size_t quick_pos = content.find("\"quick\"");
+        m_baseline_quick = quick_pos != std::string::npos &&
+            content.compare(content.find(':', quick_pos) + 1, 5, " true") == 0;
+
+        // Each result object holds its name before its ns/op
+        size_t pos = content.find("\"results\"");
+        while (pos != std::string::npos) {
+            size_t name_key = content.find("\"name\"", pos);
+            if (name_key == std::string::npos) break;
+            size_t name_start = content.find('"', content.find(':', name_key));
+            size_t name_end = content.find('"', name_start + 1);
+            size_t value_key = content.find("\"ns_per_op\"", name_end);
+            if (name_start == std::string::npos || name_end == std::string::npos || value_key == std::string::npos) {
+                break;
+            }
+
+            std::string name = content.substr(name_start + 1, name_end - name_start - 1);
+            m_baseline[name] = std::strtod(content.c_str() + content.find(':', value_key) + 1, nullptr);
+            pos = value_key;
+        }
+
+        return !m_baseline.empty();
+    }
+
+    // Compare the last run against the loaded baseline and print a report
+    int BenchmarkRunner::compareBaseline(double threshold_percent) const {
+        if (m_baseline_quick != m_quick) {
+            printf("warning: baseline was recorded as a %s run, this is a %s run\n",
+                m_baseline_quick ? "quick" : "full", m_quick ? "quick" : "full");
+        }
+
+        printf("\n%-36s %14s %14s %9s  %s\n", "benchmark", "ns/op", "baseline", "change", "status");
+        int regressions = 0;
+        for (const BenchmarkResult& result : m_results) {
+            auto it = m_baseline.find(result.name);
+            if (it == m_baseline.end() || it->second <= 0.0) {
+                printf("%-36s %14.2f %14s %9s  %s\n", result.name.c_str(), result.ns_per_op, "-", "-", "new");
+                continue;
+            }
+
+            double change = (result.ns_per_op - it->second) / it->second * 100.0;
+            BaselineStatus status = BaselineStatus::OK;
+            if (change > threshold_percent) {
+                status = BaselineStatus::REGRESSED;
+                regressions++;
+            }
+            else if (change < -threshold_percent) {
+                status = BaselineStatus::IMPROVED;
+            }
+
+            printf("%-36s %14.2f %14.2f %+8.1f%%  %s\n", result.name.c_str(), result.ns_per_op, it->second, change,
+                status == BaselineStatus::REGRESSED ? "REGRESSED" : status == BaselineStatus::IMPROVED ? "improved" : "ok");
+        }
+
+        printf("%d regression(s) over the %.1f%% threshold\n", regressions, threshold_percent);
+        return regressions;
+    }
+
+    // Keep a value alive so the optimizer can't remove the work producing it
+    void benchmarkSink(uint64_t value) {
+        s_benchmark_sink = s_benchmark_sink + value;
+    }
+
+    // Restart the ECS so a sample starts from an empty world
+    void resetBenchmarkWorld() {
+        EM.shutDown();
+        EM.startUp();
+    }
+
+} // end of namespace gam300
@@ -0,0 +1,185 @@
+/**
+ * @file Benchmark.h
+ * @brief Declaration of the benchmark harness for the game engine.
+ * @details Times registered benchmark cases over several samples, writes the
+ *          results as JSON and compares them against a stored baseline.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __BENCHMARK_H__
+#define __BENCHMARK_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gam300 {
+
+    // Timed samples taken per case in a full run.
+    constexpr int BENCHMARK_SAMPLES_DEFAULT = 15;
+
+    // Timed samples taken per case in a quick run.
+    constexpr int BENCHMARK_SAMPLES_QUICK = 3;
+
+    // Quick runs divide the operation count of each case by this.
+    constexpr std::size_t BENCHMARK_QUICK_DIVISOR = 10;
+
+    // Slowdown in percent over the baseline that counts as a regression.
+    constexpr double BENCHMARK_THRESHOLD_DEFAULT = 10.0;
+
+    /**
+     * @brief A single benchmark.
+     * @details setup() and teardown() run around every sample and are not timed,
+     *          run() is timed and must perform 'ops' operations. validate() runs
+     *          after the last sample and checks the work produced the right result.
+     */
+    struct BenchmarkCase {
+        std::string name;                                   // Unique name, "group/case"
+        std::size_t ops = 1;                                // Operations performed by one run() in a full run
+        std::function<void(std::size_t)> setup;             // Prepare a sample of 'ops' operations (optional)
+        std::function<void(std::size_t)> run;               // The timed work
+        std::function<void()> teardown;                     // Clean up after a sample (optional)
+        std::function<bool(std::string&)> validate;         // Check the result, fill in a message on failure (optional)
+    };
+
+    // Timing of one benchmark case.
+    struct BenchmarkResult {
+        std::string name;           // Case name
+        std::size_t ops = 0;        // Operations per sample
+        int samples = 0;            // Number of timed samples
+        double min_ns = 0.0;        // Fastest sample
+        double median_ns = 0.0;     // Median sample
+        double mean_ns = 0.0;       // Mean sample
+        double max_ns = 0.0;        // Slowest sample
+        double ns_per_op = 0.0;     // Median sample divided by ops
+        bool valid = true;          // False if validation failed
+        std::string message;        // Validation failure message
+    };
+
+    // Outcome of comparing one result against the baseline.
+    enum class BaselineStatus {
+        OK,             // Within the threshold
+        IMPROVED,       // Faster than the baseline by more than the threshold
+        REGRESSED,      // Slower than the baseline by more than the threshold
+        NEW             // Not present in the baseline
+    };
+
+    /**
+     * @brief Registers, runs and reports benchmark cases.
+     */
+    class BenchmarkRunner {
+
+    private:
+        std::vector<BenchmarkCase> m_cases;                     // Registered cases in registration order
+        std::vector<BenchmarkResult> m_results;                 // Results of the last run
+        std::unordered_map<std::string, double> m_baseline;     // Baseline ns/op by case name
+        bool m_baseline_quick;                                  // True if the baseline was recorded in quick mode
+        bool m_quick;                                           // Run reduced sizes and fewer samples
+        int m_samples;                                          // Timed samples per case
+        std::string m_filter;                                   // Only run cases whose name contains this
+
+        // Time one case.
+        BenchmarkResult runCase(const BenchmarkCase& benchmark_case) const;
+
+    public:
+        /**
+         * @brief Construct a runner with default settings.
+         */
+        BenchmarkRunner();
+
+        /**
+         * @brief Register a benchmark case.
+         * @param benchmark_case The case to add.
+         */
+        void add(const BenchmarkCase& benchmark_case);
+
+        /**
+         * @brief Get the registered cases.
+         * @return Reference to the cases.
+         */
+        const std::vector<BenchmarkCase>& getCases() const;
+
+        /**
+         * @brief Run reduced sizes with fewer samples.
+         * @param quick True for a quick run.
+         */
+        void setQuick(bool quick);
+
+        /**
+         * @brief Set the number of timed samples per case.
+         * @param samples Number of samples (at least 1).
+         */
+        void setSamples(int samples);
+
+        /**
+         * @brief Only run cases whose name contains a string.
+         * @param filter The string to match (empty runs everything).
+         */
+        void setFilter(const std::string& filter);
+
+        /**
+         * @brief Run all registered cases that match the filter.
+         * @return Number of cases that failed validation.
+         */
+        int run();
+
+        /**
+         * @brief Get the results of the last run.
+         * @return Reference to the results.
+         */
+        const std::vector<BenchmarkResult>& getResults() const;
+
+        /**
+         * @brief Write the results of the last run as JSON.
+         * @param filename Path of the file to write.
+         * @return True if the file was written, false otherwise.
+         */
+        bool writeJson(const std::string& filename) const;
+
+        /**
+         * @brief Load a baseline written by writeJson().
+         * @param filename Path of the baseline file.
+         * @return True if the baseline was read, false otherwise.
+         */
+        bool loadBaseline(const std::string& filename);
+
+        /**
+         * @brief Compare the last run against the loaded baseline and print a report.
+         * @param threshold_percent Slowdown in percent that counts as a regression.
+         * @return Number of regressed cases.
+         */
+        int compareBaseline(double threshold_percent) const;
+    };
+
+    /**
+     * @brief Keep a value alive so the optimizer can't remove the work producing it.
+     * @param value The value to consume.
+     */
+    void benchmarkSink(uint64_t value);
+
+    /**
+     * @brief Restart the ECS so a sample starts from an empty world.
+     */
+    void resetBenchmarkWorld();
+
+    // Benchmark suites, each registers its cases with the runner.
+    void registerEcsBenchmarks(BenchmarkRunner& runner);
+    void registerSceneBenchmarks(BenchmarkRunner& runner);
+    void registerLogBenchmarks(BenchmarkRunner& runner);
+    void registerInputBenchmarks(BenchmarkRunner& runner);
+    void registerMathBenchmarks(BenchmarkRunner& runner);
+    void registerFastMathBenchmarks(BenchmarkRunner& runner);
+    void registerTransformBenchmarks(BenchmarkRunner& runner);
+    void registerSpatialBenchmarks(BenchmarkRunner& runner);
+    void registerBroadphaseBenchmarks(BenchmarkRunner& runner);
+    void registerPhysicsBenchmarks(BenchmarkRunner& runner);
+
+} // end of namespace gam300
+#endif // __BENCHMARK_H__
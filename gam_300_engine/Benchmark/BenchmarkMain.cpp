@@ -0,0 +1,158 @@
+/**
+ * @file BenchmarkMain.cpp
+ * @brief Entry point of the engine benchmark suite.
+ * @details Starts the engine managers without a window, runs every benchmark
+ *          case and optionally compares the results against a baseline.
+ *
+ *          Usage: gam300_benchmark [options]
+ *            --quick               reduced sizes and fewer samples (used by ctest)
+ *            --samples=N           timed samples per case
+ *            --filter=TEXT         only run cases whose name contains TEXT
+ *            --list                print the case names and exit
+ *            --output=FILE         write the results as JSON
+ *            --baseline=FILE       compare against results written by --output
+ *            --threshold=PERCENT   slowdown that counts as a regression (default 10)
+ *
+ *          Exits with 1 if a case fails validation or regresses past the threshold.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Benchmark.h"
+#include "../gam_300_engine/Manager/LogManager.h"
+#include "../gam_300_engine/Manager/JobManager.h"
+#include "../gam_300_engine/Manager/ProfileManager.h"
+#include "../gam_300_engine/Manager/InputManager.h"
+#include "../gam_300_engine/Manager/ECSManager.h"
+#include "../gam_300_engine/Manager/SerialisationManager.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// Start the managers the benchmarks use, in the same order as the GameManager
+static int startEngine() {
+    if (LM.startUp()) {
+        return -1;
+    }
+
+    // Per-entity INFO messages would dominate the ECS timings
+    LM.setLogLevel(gam300::LogLevel::WARNING);
+
+    if (JM.startUp() || PM.startUp() || IM.startUp() || EM.startUp() || SEM.startUp()) {
+        LM.writeLog(gam300::LogLevel::ERROR_LEVEL, "BenchmarkMain - Failed to start the engine managers");
+        return -1;
+    }
+
+    // Summaries would land in the middle of timed samples
+    PM.setSummaryInterval(0);
+    return 0;
+}
+
+// Shut the managers down in reverse order
+static void shutDownEngine() {
+    SEM.shutDown();
+    EM.shutDown();
+    IM.shutDown();
+    PM.shutDown();
+    JM.shutDown();
+    LM.shutDown();
+}
+
+int main(int argc, char* argv[]) {
+    gam300::BenchmarkRunner runner;
+    std::string output_file;
+    std::string baseline_file;
+    double threshold = gam300::BENCHMARK_THRESHOLD_DEFAULT;
+    bool list_only = false;
+    int samples = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--quick") == 0) {
+            runner.setQuick(true);
+        }
+        else if (strcmp(argv[i], "--list") == 0) {
+            list_only = true;
+        }
+        else if (strncmp(argv[i], "--samples=", 10) == 0) {
+            samples = atoi(argv[i] + 10);
+        }
+        else if (strncmp(argv[i], "--filter=", 9) == 0) {
+            runner.setFilter(argv[i] + 9);
+        }
+        else if (strncmp(argv[i], "--output=", 9) == 0) {
+            output_file = argv[i] + 9;
+        }
+        else if (strncmp(argv[i], "--baseline=", 11) == 0) {
+            baseline_file = argv[i] + 11;
+        }
+        else if (strncmp(argv[i], "--threshold=", 12) == 0) {
+            threshold = atof(argv[i] + 12);
+        }
+        else {
+            printf("Unknown option '%s'\n", argv[i]);
+            return 1;
+        }
+    }
+
+    // Applied after --quick so an explicit count wins
+    if (samples > 0) {
+        runner.setSamples(samples);
+    }
+
+    gam300::registerEcsBenchmarks(runner);
+    gam300::registerSceneBenchmarks(runner);
+    gam300::registerLogBenchmarks(runner);
+    gam300::registerInputBenchmarks(runner);
+    gam300::registerMathBenchmarks(runner);
+    gam300::registerFastMathBenchmarks(runner);
+    gam300::registerTransformBenchmarks(runner);
+    gam300::registerSpatialBenchmarks(runner);
+    gam300::registerBroadphaseBenchmarks(runner);
+    gam300::registerPhysicsBenchmarks(runner);
+
+    if (list_only) {
+        for (const gam300::BenchmarkCase& benchmark_case : runner.getCases()) {
+            printf("%s\n", benchmark_case.name.c_str());
+        }
+        return 0;
+    }
+
+    if (startEngine()) {
+        printf("ERROR: Failed to start the engine\n");
+        return 1;
+    }
+
+    int failures = runner.run();
+    shutDownEngine();
+
+    if (!output_file.empty()) {
+        if (runner.writeJson(output_file)) {
+            printf("Results written to %s\n", output_file.c_str());
+        }
+        else {
+            printf("ERROR: Failed to write %s\n", output_file.c_str());
+            failures++;
+        }
+    }
+
+    int regressions = 0;
+    if (!baseline_file.empty()) {
+        if (runner.loadBaseline(baseline_file)) {
+            regressions = runner.compareBaseline(threshold);
+        }
+        else {
+            printf("ERROR: Failed to read baseline %s\n", baseline_file.c_str());
+            failures++;
+        }
+    }
+
+    if (failures > 0) {
+        printf("%d benchmark(s) failed validation\n", failures);
+    }
+
+    return (failures > 0 || regressions > 0) ? 1 : 0;
+}
@@ -0,0 +1,501 @@
+/**
+ * @file BroadphaseBenchmarks.cpp
+ * @brief Benchmarks for the dynamic AABB tree and the BroadphaseSystem.
+ * @details Times inserting boxes of widely varying size into a tree, moving all of
+ *          them a little, and finding the overlapping pairs, at 10k, 100k and 200k
+ *          proxies, BroadphaseSystem updates after all or a few transforms
+ *          changed, and line of sight rays and sphere casts one at a time against
+ *          submitted in batches. Trees are checked with DynamicAABBTree::validate(),
+ *          pairs against a scan of every box around a sample of proxies, and hits
+ *          against a scan of every box for a sample of rays.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Benchmark.h"
+#include "../gam_300_engine/Manager/ECSManager.h"
+#include "../gam_300_engine/System/BroadphaseSystem.h"
+#include "../gam_300_engine/System/TransformSystem.h"
+#include "../gam_300_engine/Utility/DynamicAABBTree.h"
+#include "../gam_300_engine/Utility/Random.h"
+#include "../gam_300_engine/Utility/RayPacket.h"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace gam300 {
+
+    // Proxy counts of the tree cases
+    static const std::size_t BROADPHASE_BENCH_SIZES[] = { 10000, 100000, 200000 };
+
+    // Entities of the system cases, kept down by the cost of creating them
+    static const std::size_t BROADPHASE_BENCH_SYSTEM_ENTITIES = 20000;
+
+    // World volume per box, the world grows with the box count to keep the density
+    static const float BROADPHASE_BENCH_VOLUME_PER_BOX = 16.0f;
+
+    // Half extents range over a factor of 16, spread evenly on a log scale
+    static const float BROADPHASE_BENCH_MIN_HALF_EXTENT = 0.25f;
+    static const float BROADPHASE_BENCH_HALF_EXTENT_RANGE = 16.0f;
+
+    // Largest step a box takes per sample along each axis, about a frame's movement
+    static const float BROADPHASE_BENCH_STEP = 0.05f;
+
+    // Proxies whose pairs are checked against a scan of every box
+    static const std::size_t BROADPHASE_BENCH_CHECKED_PROXIES = 100;
+
+    // Every Nth entity moves in the few-moved system case
+    static const std::size_t BROADPHASE_BENCH_MOVE_INTERVAL = 97;
+
+    // Rays cast from each agent in turn at several targets, one ray per entity in the world
+    static const std::size_t BROADPHASE_BENCH_RAYS_PER_AGENT = 8;
+
+    // Furthest an agent looks, and the radius of the sphere casts
+    static const float BROADPHASE_BENCH_SIGHT_RANGE = 24.0f;
+    static const float BROADPHASE_BENCH_CAST_RADIUS = 0.5f;
+
+    // Rays checked against a scan of every box
+    static const std::size_t BROADPHASE_BENCH_CHECKED_RAYS = 256;
+
+    // Tree under test, its boxes and the pairs found
+    static DynamicAABBTree s_tree;
+    static std::vector<AABB> s_boxes;
+    static std::vector<int32_t> s_proxies;
+    static std::vector<Vector3D> s_steps;
+    static std::vector<int32_t> s_search;
+    static std::vector<ProxyPair> s_pairs;
+    static float s_world_size = 0.0f;
+
+    // Inputs of the benchmarks, a new stream per sample would repeat them
+    static RandomStream s_stream(4711);
+
+    // Systems under test
+    static std::shared_ptr<TransformSystem> s_transform_system;
+    static std::shared_ptr<BroadphaseSystem> s_broadphase_system;
+    static std::vector<EntityID> s_ids;
+    static std::vector<TransformComponent*> s_transforms;
+    static std::size_t s_expected_updates = 0;
+    static std::vector<Ray> s_rays;
+    static std::vector<RayHit> s_hits;
+
+    // Random box in a world sized for count boxes
+    static AABB randomBox() {
+        Vector3D center(s_stream.nextFloat(0.0f, s_world_size), s_stream.nextFloat(0.0f, s_world_size),
+            s_stream.nextFloat(0.0f, s_world_size));
+        float half = BROADPHASE_BENCH_MIN_HALF_EXTENT * std::pow(BROADPHASE_BENCH_HALF_EXTENT_RANGE, s_stream.nextFloat());
+        return AABB::fromCenter(center, Vector3D(half, half, half * s_stream.nextFloat(0.5f, 1.0f)));
+    }
+
+    // Random step of a box
+    static Vector3D randomStep() {
+        return Vector3D(s_stream.nextFloat(-BROADPHASE_BENCH_STEP, BROADPHASE_BENCH_STEP),
+            s_stream.nextFloat(-BROADPHASE_BENCH_STEP, BROADPHASE_BENCH_STEP),
+            s_stream.nextFloat(-BROADPHASE_BENCH_STEP, BROADPHASE_BENCH_STEP));
+    }
+
+    // Pick count boxes in a world sized for them
+    static void generateBoxes(std::size_t count) {
+        s_world_size = std::cbrt(BROADPHASE_BENCH_VOLUME_PER_BOX * static_cast<float>(count));
+        s_boxes.resize(count);
+        for (AABB& box : s_boxes) {
+            box = randomBox();
+        }
+    }
+
+    // Build a tree of count boxes, all of them still marked as moved
+    static void populateTree(std::size_t count) {
+        generateBoxes(count);
+        s_tree.clear();
+        s_proxies.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            s_proxies[i] = s_tree.createProxy(s_boxes[i], static_cast<EntityID>(i + 1));
+        }
+    }
+
+    // Check the tree's structure and that every fat box holds its box
+    static bool checkTree(std::string& message) {
+        if (!s_tree.validate()) {
+            message = "tree failed validation";
+            return false;
+        }
+        if (s_tree.getProxyCount() != s_boxes.size()) {
+            message = "tree holds " + std::to_string(s_tree.getProxyCount()) + " proxies, expected " +
+                std::to_string(s_boxes.size());
+            return false;
+        }
+        for (std::size_t i = 0; i < s_boxes.size(); ++i) {
+            if (!s_tree.getFatAABB(s_proxies[i]).contains(s_boxes[i])) {
+                message = "fat box of proxy " + std::to_string(s_proxies[i]) + " doesn't hold its box";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Compare the pairs of the first few proxies with a scan of every fat box
+    static bool checkPairs(std::string& message) {
+        std::vector<ProxyPair> sorted = s_pairs;
+        std::sort(sorted.begin(), sorted.end());
+        if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+            message = "a pair was reported twice";
+            return false;
+        }
+        for (std::size_t i = 0; i < s_proxies.size() && i < BROADPHASE_BENCH_CHECKED_PROXIES; ++i) {
+            int32_t proxy = s_proxies[i];
+            std::size_t expected = 0;
+            for (int32_t other : s_proxies) {
+                expected += other != proxy && s_tree.getFatAABB(proxy).overlaps(s_tree.getFatAABB(other));
+            }
+            std::size_t found = static_cast<std::size_t>(std::count_if(sorted.begin(), sorted.end(), [proxy](const ProxyPair& pair) {
+                return pair.first == proxy || pair.second == proxy;
+            }));
+            if (found != expected) {
+                message = "proxy " + std::to_string(proxy) + " is in " + std::to_string(found) + " pairs, a scan finds " +
+                    std::to_string(expected);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Label of a proxy count, e.g. "10k"
+    static std::string sizeLabel(std::size_t count) {
+        return std::to_string(count / 1000) + "k";
+    }
+
+    // Reset the world and create entities with boxes spread over it, with the tree up to date
+    static void populateSystem(std::size_t count) {
+        resetBenchmarkWorld();
+        s_transform_system = EM.registerSystem<TransformSystem>();
+        s_broadphase_system = EM.registerSystem<BroadphaseSystem>();
+
+        generateBoxes(count);
+        s_ids.clear();
+        s_transforms.clear();
+        s_ids.reserve(count);
+        s_transforms.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            EntityID id = EM.createEntity().get_id();
+            TransformComponent* transform = EM.addComponent<TransformComponent>(id);
+            BoundsComponent* bounds = EM.addComponent<BoundsComponent>(id);
+            Vector3D half = s_boxes[i].getHalfExtents();
+            transform->setPosition(s_boxes[i].getCenter());
+            bounds->setLocalBounds(AABB(-half, half));
+            s_ids.push_back(id);
+            s_transforms.push_back(transform);
+        }
+
+        // First full refit outside the timed run
+        s_transform_system->update(0.0f);
+        s_broadphase_system->update(0.0f);
+    }
+
+    // Move every interval-th entity and compute the new world matrices
+    static void moveSystemEntities(std::size_t interval) {
+        s_expected_updates = 0;
+        for (std::size_t i = interval - 1; i < s_transforms.size(); i += interval) {
+            s_transforms[i]->setPosition(s_transforms[i]->getPosition() + randomStep());
+            s_expected_updates++;
+        }
+        s_transform_system->update(0.0f);
+    }
+
+    // Check world boxes against the transforms and the pairs of a few entities against a scan
+    static bool checkSystem(std::string& message) {
+        const DynamicAABBTree& tree = s_broadphase_system->get_tree();
+        if (!tree.validate()) {
+            message = "tree failed validation";
+            return false;
+        }
+        for (std::size_t i = 0; i < s_ids.size(); ++i) {
+            AABB bounds;
+            Vector3D half = s_boxes[i].getHalfExtents();
+            AABB expected = AABB(-half, half).transformed(s_transforms[i]->getWorldMatrix());
+            if (!s_broadphase_system->get_world_bounds(s_ids[i], bounds) || bounds.min.x != expected.min.x ||
+                bounds.min.y != expected.min.y || bounds.min.z != expected.min.z || bounds.max.x != expected.max.x ||
+                bounds.max.y != expected.max.y || bounds.max.z != expected.max.z) {
+                message = "world box of entity " + std::to_string(s_ids[i]) + " doesn't match its world matrix";
+                return false;
+            }
+        }
+        if (s_broadphase_system->get_updated_count() != s_expected_updates) {
+            message = "refit " + std::to_string(s_broadphase_system->get_updated_count()) + " boxes, expected " +
+                std::to_string(s_expected_updates);
+            return false;
+        }
+
+        // Fat boxes aren't visible by entity, so look them up through a query around each world box
+        const std::vector<EntityPair>& pairs = s_broadphase_system->get_pairs();
+        for (std::size_t i = 0; i < s_ids.size() && i < BROADPHASE_BENCH_CHECKED_PROXIES; ++i) {
+            AABB bounds;
+            s_broadphase_system->get_world_bounds(s_ids[i], bounds);
+            int32_t proxy = AABB_TREE_NULL_NODE;
+            tree.query(bounds, [&](int32_t candidate) {
+                if (tree.getEntity(candidate) == s_ids[i]) {
+                    proxy = candidate;
+                    return false;
+                }
+                return true;
+            });
+            // Fat boxes reach at most a few margins and the predicted move past the world box
+            const float slack = 5.0f * AABB_TREE_DEFAULT_MARGIN + AABB_TREE_DISPLACEMENT_MULTIPLIER * BROADPHASE_BENCH_STEP;
+            if (proxy == AABB_TREE_NULL_NODE || !bounds.fattened(slack).contains(tree.getFatAABB(proxy))) {
+                message = "fat box of entity " + std::to_string(s_ids[i]) + " is missing or oversized";
+                return false;
+            }
+            std::size_t expected = 0;
+            tree.query(tree.getFatAABB(proxy), [&](int32_t other) {
+                expected += other != proxy;
+                return true;
+            });
+            EntityID id = s_ids[i];
+            std::size_t found = static_cast<std::size_t>(std::count_if(pairs.begin(), pairs.end(), [id](const EntityPair& pair) {
+                return pair.first == id || pair.second == id;
+            }));
+            if (found != expected) {
+                message = "entity " + std::to_string(id) + " is in " + std::to_string(found) + " pairs, expected " +
+                    std::to_string(expected);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Line of sight rays from random agents to random targets in range, a sphere cast if radius is set
+    static void generateRays(std::size_t count, float radius) {
+        s_rays.resize(count);
+        Vector3D agent;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (i % BROADPHASE_BENCH_RAYS_PER_AGENT == 0) {
+                agent = Vector3D(s_stream.nextFloat(0.0f, s_world_size), s_stream.nextFloat(0.0f, s_world_size),
+                    s_stream.nextFloat(0.0f, s_world_size));
+            }
+            Vector3D offset(s_stream.nextFloat(-1.0f, 1.0f), s_stream.nextFloat(-1.0f, 1.0f), s_stream.nextFloat(-1.0f, 1.0f));
+            s_rays[i].origin = agent;
+            s_rays[i].direction = offset * BROADPHASE_BENCH_SIGHT_RANGE;
+            s_rays[i].max_distance = 1.0f;
+            s_rays[i].radius = radius;
+        }
+        s_hits.assign(count, RayHit());
+    }
+
+    // Reset the world with count entities to cast at and pick as many rays
+    static void populateRays(std::size_t count, float radius) {
+        populateSystem(count);
+        generateRays(count, radius);
+    }
+
+    // Cast the rays one at a time
+    static void castSingleRays() {
+        for (std::size_t i = 0; i < s_rays.size(); ++i) {
+            RayHit& hit = s_hits[i];
+            hit = RayHit();
+            s_broadphase_system->raycast(s_rays[i].origin, s_rays[i].direction, s_rays[i].max_distance, hit.entity, hit.distance);
+        }
+    }
+
+    // Check a sample of the hits against a scan of every world box, and thin rays against raycast()
+    static bool checkRays(std::string& message) {
+        for (std::size_t i = 0; i < s_rays.size() && i < BROADPHASE_BENCH_CHECKED_RAYS; ++i) {
+            const Ray& ray = s_rays[i];
+            const Vector3D inverse(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+            RayHit expected;
+            for (EntityID id : s_ids) {
+                AABB bounds;
+                s_broadphase_system->get_world_bounds(id, bounds);
+                float distance = 0.0f;
+                const bool hit = ray.radius > 0.0f
+                    ? RayPacket::sweepSphere(bounds, ray.origin, ray.direction, ray.radius, ray.max_distance, distance)
+                    : bounds.intersectRay(ray.origin, inverse, ray.max_distance, distance);
+                if (hit && (expected.entity == INVALID_ENTITY_ID || distance < expected.distance ||
+                    (distance == expected.distance && id < expected.entity))) {
+                    expected.entity = id;
+                    expected.distance = distance;
+                }
+            }
+            if (s_hits[i].entity != expected.entity || std::abs(s_hits[i].distance - expected.distance) > 1e-5f) {
+                message = "ray " + std::to_string(i) + " hit entity " + std::to_string(s_hits[i].entity) + " at " +
+                    std::to_string(s_hits[i].distance) + ", a scan finds entity " + std::to_string(expected.entity) + " at " +
+                    std::to_string(expected.distance);
+                return false;
+            }
+        }
+
+        // Thin rays in a batch go through the same slab test as single ones, so the hits match bit for bit
+        if (s_rays.empty() || s_rays[0].radius > 0.0f) {
+            return true;
+        }
+        std::vector<RayHit> batch = s_hits;
+        castSingleRays();
+        for (std::size_t i = 0; i < s_rays.size(); ++i) {
+            if (batch[i].entity != s_hits[i].entity || batch[i].distance != s_hits[i].distance) {
+                message = "ray " + std::to_string(i) + " hit entity " + std::to_string(batch[i].entity) + " at " +
+                    std::to_string(batch[i].distance) + " in a batch and entity " + std::to_string(s_hits[i].entity) + " at " +
+                    std::to_string(s_hits[i].distance) + " alone";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Check sphere casts against a box's face, edge and corner at known distances, then a sample against a scan
+    static bool checkSphereCasts(std::string& message) {
+        const AABB box(Vector3D(-1.0f, -1.0f, -1.0f), Vector3D(1.0f, 1.0f, 1.0f));
+        const float r = BROADPHASE_BENCH_CAST_RADIUS;
+        const struct {
+            Vector3D origin;
+            Vector3D direction;
+            float expected;
+        } cases[] = {
+            { Vector3D(3.0f, 0.0f, 0.0f), Vector3D(-1.0f, 0.0f, 0.0f), 2.0f - r },
+            { Vector3D(3.0f, 3.0f, 0.0f), Vector3D(-1.0f, -1.0f, 0.0f).normalize(), 2.0f * std::sqrt(2.0f) - r },
+            { Vector3D(3.0f, 3.0f, 3.0f), Vector3D(-1.0f, -1.0f, -1.0f).normalize(), 2.0f * std::sqrt(3.0f) - r },
+        };
+        for (const auto& test : cases) {
+            float distance = 0.0f;
+            if (!RayPacket::sweepSphere(box, test.origin, test.direction, r, 10.0f, distance) ||
+                std::abs(distance - test.expected) > 1e-4f) {
+                message = "sphere cast from (" + std::to_string(test.origin.x) + ", " + std::to_string(test.origin.y) + ", " +
+                    std::to_string(test.origin.z) + ") hit at " + std::to_string(distance) + ", expected " +
+                    std::to_string(test.expected);
+                return false;
+            }
+        }
+
+        // Passing the corner diagonally misses the rounded box, though it crosses the grown one
+        float distance = 0.0f;
+        if (RayPacket::sweepSphere(box, Vector3D(1.4f, 1.4f, 3.0f), Vector3D(0.0f, 0.0f, -1.0f), r, 10.0f, distance)) {
+            message = "sphere cast past a corner hit at " + std::to_string(distance);
+            return false;
+        }
+        return checkRays(message);
+    }
+
+    // Add a system update case that moves every interval-th entity before each sample
+    static void addSystemCase(BenchmarkRunner& runner, const std::string& name, std::size_t interval) {
+        BenchmarkCase update;
+        update.name = name;
+        update.ops = BROADPHASE_BENCH_SYSTEM_ENTITIES;
+        update.setup = [interval](std::size_t n) {
+            populateSystem(n);
+            moveSystemEntities(interval);
+        };
+        update.run = [](std::size_t) {
+            s_broadphase_system->update(0.0f);
+        };
+        update.validate = checkSystem;
+        runner.add(update);
+    }
+
+    // Register the broadphase benchmarks
+    void registerBroadphaseBenchmarks(BenchmarkRunner& runner) {
+        for (std::size_t size : BROADPHASE_BENCH_SIZES) {
+            BenchmarkCase insert;
+            insert.name = "broadphase/tree_insert_" + sizeLabel(size);
+            insert.ops = size;
+            insert.setup = [](std::size_t n) {
+                generateBoxes(n);
+                s_tree.clear();
+                s_proxies.resize(n);
+            };
+            insert.run = [](std::size_t n) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    s_proxies[i] = s_tree.createProxy(s_boxes[i], static_cast<EntityID>(i + 1));
+                }
+                benchmarkSink(static_cast<uint64_t>(s_tree.getHeight()));
+            };
+            insert.validate = checkTree;
+            runner.add(insert);
+
+            BenchmarkCase refit;
+            refit.name = "broadphase/tree_refit_" + sizeLabel(size);
+            refit.ops = size;
+            refit.setup = [](std::size_t n) {
+                populateTree(n);
+                s_tree.clearMovedProxies();
+                s_steps.resize(n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    s_steps[i] = randomStep();
+                    s_boxes[i] = AABB(s_boxes[i].min + s_steps[i], s_boxes[i].max + s_steps[i]);
+                }
+            };
+            refit.run = [](std::size_t n) {
+                uint64_t reinserted = 0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    reinserted += s_tree.moveProxy(s_proxies[i], s_boxes[i], s_steps[i]);
+                }
+                benchmarkSink(reinserted);
+            };
+            refit.validate = checkTree;
+            runner.add(refit);
+
+            BenchmarkCase pairs;
+            pairs.name = "broadphase/tree_pairs_" + sizeLabel(size);
+            pairs.ops = size;
+            pairs.setup = [](std::size_t n) {
+                // Every proxy is new, so searching around all of them finds every pair
+                populateTree(n);
+                s_search = s_tree.getMovedProxies();
+            };
+            pairs.run = [](std::size_t) {
+                s_pairs.clear();
+                s_tree.findPairs(std::span<const int32_t>(s_search), s_pairs);
+                benchmarkSink(s_pairs.size());
+            };
+            pairs.validate = checkPairs;
+            runner.add(pairs);
+        }
+
+        addSystemCase(runner, "broadphase/system_update_all", 1);
+        addSystemCase(runner, "broadphase/system_update_few", BROADPHASE_BENCH_MOVE_INTERVAL);
+
+        // The same rays one raycast() at a time, then in a batch
+        BenchmarkCase single;
+        single.name = "broadphase/raycast_single";
+        single.ops = BROADPHASE_BENCH_SYSTEM_ENTITIES;
+        single.setup = [](std::size_t n) {
+            populateRays(n, 0.0f);
+        };
+        single.run = [](std::size_t) {
+            castSingleRays();
+            benchmarkSink(s_hits.back().entity);
+        };
+        single.validate = checkRays;
+        runner.add(single);
+
+        BenchmarkCase batch;
+        batch.name = "broadphase/raycast_batch";
+        batch.ops = BROADPHASE_BENCH_SYSTEM_ENTITIES;
+        batch.setup = [](std::size_t n) {
+            populateRays(n, 0.0f);
+        };
+        batch.run = [](std::size_t) {
+            std::span<const RayHit> hits = s_broadphase_system->submit_raycasts(s_rays);
+            s_hits.assign(hits.begin(), hits.end());
+            benchmarkSink(s_hits.back().entity);
+        };
+        batch.validate = checkRays;
+        runner.add(batch);
+
+        BenchmarkCase spheres;
+        spheres.name = "broadphase/spherecast_batch";
+        spheres.ops = BROADPHASE_BENCH_SYSTEM_ENTITIES;
+        spheres.setup = [](std::size_t n) {
+            populateRays(n, BROADPHASE_BENCH_CAST_RADIUS);
+        };
+        spheres.run = [](std::size_t) {
+            std::span<const RayHit> hits = s_broadphase_system->submit_raycasts(s_rays);
+            s_hits.assign(hits.begin(), hits.end());
+            benchmarkSink(s_hits.back().entity);
+        };
+        spheres.validate = checkSphereCasts;
+        runner.add(spheres);
+    }
+
+} // end of namespace gam300
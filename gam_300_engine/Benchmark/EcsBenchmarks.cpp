@@ -0,0 +1,448 @@
+/**
+ * @file EcsBenchmarks.cpp
+ * @brief Benchmarks for the Entity Component System.
+ * @details Covers entity create/destroy, component add/remove/get, view
+ *          construction and iteration, system update dispatch and iteration,
+ *          and system membership changes.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Benchmark.h"
+#include "../gam_300_engine/Manager/ECSManager.h"
+#include "../gam_300_engine/Component/ComponentView.h"
+#include <cmath>
+#include <string>
+#include <utility>
+
+namespace gam300 {
+
+    // Position used by the ECS benchmarks
+    class BenchPosition : public Component {
+    public:
+        float x = 0.0f, y = 0.0f, z = 0.0f;
+        void init(EntityID entity_id) override { m_owner_id = entity_id; }
+        void update(float /*dt*/) override {}
+    };
+
+    // Velocity used by the ECS benchmarks
+    class BenchVelocity : public Component {
+    public:
+        float x = 1.0f, y = 2.0f, z = 3.0f;
+        void init(EntityID entity_id) override { m_owner_id = entity_id; }
+        void update(float /*dt*/) override {}
+    };
+
+    // Integrates velocity into position the way engine systems look up components
+    class BenchMovementSystem : public ComponentSystem<BenchPosition, BenchVelocity> {
+    public:
+        BenchMovementSystem() : ComponentSystem<BenchPosition, BenchVelocity>("BenchMovementSystem") {}
+        bool init(SystemManager& /*system_manager*/) override { return true; }
+        void shutdown() override {}
+
+        void update(float dt) override {
+            m_dt = dt;
+            for (EntityID entity_id : m_entities) {
+                process_entity(entity_id);
+            }
+        }
+
+        void process_entity(EntityID entity_id) override {
+            BenchPosition* position = CM.get_component<BenchPosition>(entity_id);
+            BenchVelocity* velocity = CM.get_component<BenchVelocity>(entity_id);
+            position->x += velocity->x * m_dt;
+            position->y += velocity->y * m_dt;
+            position->z += velocity->z * m_dt;
+        }
+
+    private:
+        float m_dt = 0.0f;
+    };
+
+    // Ways BenchIterationSystem walks its entities
+    enum class BenchIteration { LOOKUP, FOR_EACH, FOR_EACH_SORTED };
+
+    // Same work as BenchMovementSystem, iterating the way the current case asks for
+    class BenchIterationSystem : public ComponentSystem<BenchPosition, BenchVelocity> {
+    public:
+        BenchIterationSystem() : ComponentSystem<BenchPosition, BenchVelocity>("BenchIterationSystem") {}
+        bool init(SystemManager& /*system_manager*/) override { return true; }
+        void shutdown() override {}
+
+        void set_iteration(BenchIteration iteration) {
+            m_iteration = iteration;
+            set_storage_order(iteration == BenchIteration::FOR_EACH_SORTED);
+        }
+
+        void update(float dt) override {
+            if (m_iteration == BenchIteration::LOOKUP) {
+                // The InputSystem pattern: look each component up by entity ID
+                m_dt = dt;
+                for (EntityID entity_id : m_entities) {
+                    process_entity(entity_id);
+                }
+                return;
+            }
+
+            for_each([dt](EntityID, BenchPosition& position, BenchVelocity& velocity) {
+                position.x += velocity.x * dt;
+                position.y += velocity.y * dt;
+                position.z += velocity.z * dt;
+            });
+        }
+
+        void process_entity(EntityID entity_id) override {
+            BenchPosition* position = CM.get_component<BenchPosition>(entity_id);
+            BenchVelocity* velocity = CM.get_component<BenchVelocity>(entity_id);
+            position->x += velocity->x * m_dt;
+            position->y += velocity->y * m_dt;
+            position->z += velocity->z * m_dt;
+        }
+
+    private:
+        BenchIteration m_iteration = BenchIteration::LOOKUP;
+        float m_dt = 0.0f;
+    };
+
+    // Marker component, one type per N, so the churn cases can register many unrelated systems
+    template<int N>
+    class BenchTag : public Component {
+    public:
+        void init(EntityID entity_id) override { m_owner_id = entity_id; }
+        void update(float /*dt*/) override {}
+    };
+
+    // System requiring one marker component, stands in for the systems a game registers
+    template<int N>
+    class BenchTagSystem : public ComponentSystem<BenchTag<N>> {
+    public:
+        BenchTagSystem() : ComponentSystem<BenchTag<N>>("BenchTagSystem" + std::to_string(N)) {}
+        bool init(SystemManager& /*system_manager*/) override { return true; }
+        void shutdown() override {}
+        void update(float /*dt*/) override {}
+        void process_entity(EntityID /*entity_id*/) override {}
+    };
+
+    // Register one BenchTagSystem per index
+    template<int... N>
+    static void registerBenchTagSystems(std::integer_sequence<int, N...>) {
+        (EM.registerSystem<BenchTagSystem<N>>(), ...);
+    }
+
+    // Number of unrelated systems registered by the churn cases
+    static const int ECS_BENCH_TAG_SYSTEMS = 24;
+
+    // Number of entities each ECS case works on in a full run
+    static const std::size_t ECS_BENCH_ENTITIES = 5000;
+
+    // Number of system updates per sample of the dispatch case
+    static const std::size_t ECS_BENCH_UPDATES = 10;
+
+    // Fixed step fed to the systems
+    static const float ECS_BENCH_DT = 1.0f / 90.0f;
+
+    // Entities created by the last setup
+    static std::vector<EntityID> s_entities;
+
+    // View built by the setup of the iteration case
+    static std::unique_ptr<ComponentView<BenchPosition, BenchVelocity>> s_view;
+
+    // Reset the world and create entities, optionally with components
+    static void populate(std::size_t count, bool with_position, bool with_velocity) {
+        resetBenchmarkWorld();
+        s_entities.clear();
+        s_entities.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            EntityID id = EM.createEntity().get_id();
+            if (with_position) EM.addComponent<BenchPosition>(id);
+            if (with_velocity) EM.addComponent<BenchVelocity>(id);
+            s_entities.push_back(id);
+        }
+    }
+
+    // Create entities whose velocities are added in a scrambled order, so the system's
+    // entity order doesn't match the order their positions are stored in
+    static void populateIteration(std::size_t count, BenchIteration iteration) {
+        populate(count, true, false);
+        std::shared_ptr<BenchIterationSystem> system = EM.registerSystem<BenchIterationSystem>();
+        system->set_iteration(iteration);
+
+        // Stepping by a prime visits every entity once in a scattered order
+        const std::size_t stride = 7919;
+        for (std::size_t i = 0; i < s_entities.size(); ++i) {
+            EM.addComponent<BenchVelocity>(s_entities[(i * stride) % s_entities.size()]);
+        }
+
+        // Sort outside the timed updates, the way a game would after loading
+        if (iteration == BenchIteration::FOR_EACH_SORTED) {
+            system->sort_by_storage();
+        }
+    }
+
+    // Check every entity moved by exactly one velocity step per update
+    static bool validateIteration(std::string& message) {
+        const float expected = 1.0f * ECS_BENCH_DT * static_cast<float>(ECS_BENCH_UPDATES);
+        for (EntityID id : s_entities) {
+            BenchPosition* position = EM.getComponent<BenchPosition>(id);
+            if (!position || std::fabs(position->x - expected) > 1e-4f) {
+                message = "system didn't update every entity exactly once per update";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Register the ECS benchmarks
+    void registerEcsBenchmarks(BenchmarkRunner& runner) {
+        BenchmarkCase create_entity;
+        create_entity.name = "ecs/create_entity";
+        create_entity.ops = ECS_BENCH_ENTITIES;
+        create_entity.setup = [](std::size_t) { resetBenchmarkWorld(); };
+        create_entity.run = [](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                EM.createEntity();
+            }
+        };
+        create_entity.validate = [](std::string& message) {
+            if (EM.getAllEntities().empty()) {
+                message = "no entities were created";
+                return false;
+            }
+            return true;
+        };
+        runner.add(create_entity);
+
+        BenchmarkCase destroy_entity;
+        destroy_entity.name = "ecs/destroy_entity";
+        destroy_entity.ops = ECS_BENCH_ENTITIES;
+        destroy_entity.setup = [](std::size_t n) { populate(n, true, false); };
+        destroy_entity.run = [](std::size_t) {
+            for (EntityID id : s_entities) {
+                EM.destroyEntity(id);
+            }
+        };
+        destroy_entity.validate = [](std::string& message) {
+            if (!EM.getAllEntities().empty() || CM.get_pool_size(get_component_type_id<BenchPosition>()) != 0) {
+                message = "entities or components left after destroying every entity";
+                return false;
+            }
+            return true;
+        };
+        runner.add(destroy_entity);
+
+        BenchmarkCase add_component;
+        add_component.name = "component/add";
+        add_component.ops = ECS_BENCH_ENTITIES;
+        add_component.setup = [](std::size_t n) { populate(n, false, false); };
+        add_component.run = [](std::size_t) {
+            for (EntityID id : s_entities) {
+                EM.addComponent<BenchPosition>(id);
+            }
+        };
+        add_component.validate = [](std::string& message) {
+            if (CM.get_pool_size(get_component_type_id<BenchPosition>()) != s_entities.size()) {
+                message = "component pool size doesn't match the entity count";
+                return false;
+            }
+            return true;
+        };
+        runner.add(add_component);
+
+        BenchmarkCase remove_component;
+        remove_component.name = "component/remove";
+        remove_component.ops = ECS_BENCH_ENTITIES;
+        remove_component.setup = [](std::size_t n) { populate(n, true, false); };
+        remove_component.run = [](std::size_t) {
+            for (EntityID id : s_entities) {
+                EM.removeComponent<BenchPosition>(id);
+            }
+        };
+        remove_component.validate = [](std::string& message) {
+            if (CM.get_pool_size(get_component_type_id<BenchPosition>()) != 0) {
+                message = "components left after removing them all";
+                return false;
+            }
+            return true;
+        };
+        runner.add(remove_component);
+
+        BenchmarkCase get_component;
+        get_component.name = "component/get";
+        get_component.ops = ECS_BENCH_ENTITIES;
+        get_component.setup = [](std::size_t n) { populate(n, true, false); };
+        get_component.run = [](std::size_t) {
+            uint64_t found = 0;
+            for (EntityID id : s_entities) {
+                found += EM.getComponent<BenchPosition>(id) != nullptr;
+            }
+            benchmarkSink(found);
+        };
+        get_component.validate = [](std::string& message) {
+            for (EntityID id : s_entities) {
+                BenchPosition* position = EM.getComponent<BenchPosition>(id);
+                if (!position || position->get_owner() != id) {
+                    message = "component lookup returned the wrong component";
+                    return false;
+                }
+            }
+            return true;
+        };
+        runner.add(get_component);
+
+        BenchmarkCase view_build;
+        view_build.name = "view/build";
+        view_build.ops = ECS_BENCH_ENTITIES;
+        view_build.setup = [](std::size_t n) { populate(n, true, true); };
+        view_build.run = [](std::size_t) {
+            auto view = create_view<BenchPosition, BenchVelocity>();
+            benchmarkSink(view.size());
+        };
+        view_build.validate = [](std::string& message) {
+            if (create_view<BenchPosition, BenchVelocity>().size() != s_entities.size()) {
+                message = "view doesn't contain every entity";
+                return false;
+            }
+            return true;
+        };
+        runner.add(view_build);
+
+        BenchmarkCase view_each;
+        view_each.name = "view/each";
+        view_each.ops = ECS_BENCH_ENTITIES;
+        view_each.setup = [](std::size_t n) {
+            populate(n, true, true);
+            s_view = std::make_unique<ComponentView<BenchPosition, BenchVelocity>>();
+        };
+        view_each.run = [](std::size_t) {
+            s_view->each([](EntityID, BenchPosition& position, BenchVelocity& velocity) {
+                position.x += velocity.x * ECS_BENCH_DT;
+                position.y += velocity.y * ECS_BENCH_DT;
+                position.z += velocity.z * ECS_BENCH_DT;
+            });
+        };
+        view_each.teardown = []() { s_view.reset(); };
+        runner.add(view_each);
+
+        BenchmarkCase system_update;
+        system_update.name = "system/update_dispatch";
+        system_update.ops = ECS_BENCH_ENTITIES * ECS_BENCH_UPDATES;
+        system_update.setup = [](std::size_t n) {
+            populate(n / ECS_BENCH_UPDATES, true, true);
+            EM.registerSystem<BenchMovementSystem>();
+            // Entities created before the system was registered have to be matched again
+            for (const Entity& entity : EM.getAllEntities()) {
+                SM.entity_components_changed(entity);
+            }
+        };
+        system_update.run = [](std::size_t) {
+            for (std::size_t i = 0; i < ECS_BENCH_UPDATES; ++i) {
+                EM.updateSystems(ECS_BENCH_DT);
+            }
+        };
+        system_update.validate = [](std::string& message) {
+            const float expected = 1.0f * ECS_BENCH_DT * static_cast<float>(ECS_BENCH_UPDATES);
+            for (EntityID id : s_entities) {
+                BenchPosition* position = EM.getComponent<BenchPosition>(id);
+                if (!position || std::fabs(position->x - expected) > 1e-4f) {
+                    message = "system didn't update every entity exactly once per update";
+                    return false;
+                }
+            }
+            return true;
+        };
+        runner.add(system_update);
+
+        const std::pair<const char*, BenchIteration> iteration_cases[] = {
+            { "system/iterate_lookup", BenchIteration::LOOKUP },
+            { "system/iterate_for_each", BenchIteration::FOR_EACH },
+            { "system/iterate_for_each_sorted", BenchIteration::FOR_EACH_SORTED },
+        };
+        for (const auto& iteration_case : iteration_cases) {
+            BenchmarkCase iterate;
+            iterate.name = iteration_case.first;
+            iterate.ops = ECS_BENCH_ENTITIES * ECS_BENCH_UPDATES;
+            BenchIteration iteration = iteration_case.second;
+            iterate.setup = [iteration](std::size_t n) { populateIteration(n / ECS_BENCH_UPDATES, iteration); };
+            iterate.run = [](std::size_t) {
+                for (std::size_t i = 0; i < ECS_BENCH_UPDATES; ++i) {
+                    EM.updateSystems(ECS_BENCH_DT);
+                }
+            };
+            iterate.validate = validateIteration;
+            runner.add(iterate);
+        }
+
+        BenchmarkCase membership_churn;
+        membership_churn.name = "system/membership_churn";
+        membership_churn.ops = ECS_BENCH_ENTITIES;
+        membership_churn.setup = [](std::size_t n) {
+            resetBenchmarkWorld();
+            registerBenchTagSystems(std::make_integer_sequence<int, ECS_BENCH_TAG_SYSTEMS>());
+            EM.registerSystem<BenchMovementSystem>();
+            s_entities.clear();
+            for (std::size_t i = 0; i < n; ++i) {
+                EntityID id = EM.createEntity().get_id();
+                EM.addComponent<BenchPosition>(id);
+                EM.addComponent<BenchVelocity>(id);
+                s_entities.push_back(id);
+            }
+        };
+        membership_churn.run = [](std::size_t) {
+            // Each entity leaves the system and joins it again, in creation order
+            for (EntityID id : s_entities) {
+                EM.removeComponent<BenchVelocity>(id);
+                EM.addComponent<BenchVelocity>(id);
+            }
+        };
+        membership_churn.validate = [](std::string& message) {
+            std::shared_ptr<BenchMovementSystem> system = SM.get_system<BenchMovementSystem>();
+            if (!system || system->get_entities().size() != s_entities.size()) {
+                message = "system membership doesn't match the entities with both components";
+                return false;
+            }
+            for (EntityID id : s_entities) {
+                if (!system->has_entity(id)) {
+                    message = "entity missing from the system after rejoining it";
+                    return false;
+                }
+            }
+            return true;
+        };
+        runner.add(membership_churn);
+
+        BenchmarkCase batched_add;
+        batched_add.name = "system/batched_add";
+        batched_add.ops = ECS_BENCH_ENTITIES;
+        batched_add.setup = [](std::size_t n) {
+            populate(n, false, false);
+            registerBenchTagSystems(std::make_integer_sequence<int, ECS_BENCH_TAG_SYSTEMS>());
+            EM.registerSystem<BenchMovementSystem>();
+        };
+        batched_add.run = [](std::size_t) {
+            // Systems see each entity once both components are in place
+            EM.beginComponentBatch();
+            for (EntityID id : s_entities) {
+                EM.addComponent<BenchPosition>(id);
+                EM.addComponent<BenchVelocity>(id);
+                EM.addComponent<BenchTag<0>>(id);
+            }
+            EM.endComponentBatch();
+        };
+        batched_add.validate = [](std::string& message) {
+            std::shared_ptr<BenchMovementSystem> movement = SM.get_system<BenchMovementSystem>();
+            std::shared_ptr<BenchTagSystem<0>> tagged = SM.get_system<BenchTagSystem<0>>();
+            std::shared_ptr<BenchTagSystem<1>> untagged = SM.get_system<BenchTagSystem<1>>();
+            if (!movement || !tagged || !untagged || movement->get_entities().size() != s_entities.size() ||
+                tagged->get_entities().size() != s_entities.size() || !untagged->get_entities().empty()) {
+                message = "system membership is wrong after the batch ended";
+                return false;
+            }
+            return true;
+        };
+        runner.add(batched_add);
+    }
+
+} // end of namespace gam300
@@ -0,0 +1,266 @@
+/**
+ * @file FastMathBenchmarks.cpp
+ * @brief Benchmarks for the approximate math functions.
+ * @details Times sine and cosine, atan2, exp and inverse square root from the
+ *          standard library against the MathUtils approximations, one value per
+ *          call and batched. Each batched case checks the worst error over its
+ *          sample and over a sweep of the documented input range against the
+ *          double precision result, and that the batch matches the scalar version.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Benchmark.h"
+#include "../gam_300_engine/Utility/MathUtils.h"
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace gam300 {
+
+    // Values per sample in a full run
+    static const std::size_t FASTMATH_BENCH_VALUES = 100000;
+
+    // Seed of the inputs
+    static const uint64_t FASTMATH_BENCH_SEED = 4242;
+
+    // Largest errors accepted, a little above the ones documented in MathUtils.h
+    static const double FASTMATH_SINCOS_TOLERANCE = 1.2e-7;     // Absolute
+    static const double FASTMATH_ATAN2_TOLERANCE = 3.5e-7;      // Radians
+    static const double FASTMATH_INVSQRT_TOLERANCE = 4e-7;      // Relative, the hardware estimate varies by CPU
+    static const double FASTMATH_EXP_TOLERANCE = 1.2e-7;        // Relative
+
+    // Inputs and outputs
+    static std::vector<float> s_inputs_a;
+    static std::vector<float> s_inputs_b;
+    static std::vector<float> s_outputs_a;
+    static std::vector<float> s_outputs_b;
+
+    // Fill the inputs with values in [min, max)
+    static void populateInputs(std::size_t count, float min, float max) {
+        RandomStream stream(FASTMATH_BENCH_SEED);
+        s_inputs_a.resize(count);
+        s_inputs_b.resize(count);
+        s_outputs_a.assign(count, 0.0f);
+        s_outputs_b.assign(count, 0.0f);
+        stream.fillUniform(s_inputs_a, min, max);
+        stream.fillUniform(s_inputs_b, min, max);
+    }
+
+    // Set up a batched case, which runs with the approximations selected
+    static void populateFast(std::size_t count, float min, float max) {
+        populateInputs(count, min, max);
+        MathUtils::setPrecision(MathPrecision::FAST);
+    }
+
+    // Put the default precision back
+    static void restorePrecision() {
+        MathUtils::setPrecision(MathPrecision::EXACT);
+    }
+
+    // Fail with a message naming the function if an error is above its tolerance
+    static bool checkError(const char* function, double error, double tolerance, std::string& message) {
+        if (error > tolerance) {
+            message = std::string(function) + " error " + std::to_string(error) + " is above " + std::to_string(tolerance);
+            return false;
+        }
+        return true;
+    }
+
+    // Worst sine and cosine error of the batch output and a sweep of [-8192, 8192]
+    static bool checkSinCos(std::string& message) {
+        double error = 0.0;
+        for (std::size_t i = 0; i < s_inputs_a.size(); ++i) {
+            float sine, cosine;
+            MathUtils::fastSinCos(s_inputs_a[i], sine, cosine);
+            if (sine != s_outputs_a[i] || cosine != s_outputs_b[i]) {
+                message = "batched sinCos differs from fastSinCos at index " + std::to_string(i);
+                return false;
+            }
+            error = std::max(error, std::abs(sine - std::sin(static_cast<double>(s_inputs_a[i]))));
+            error = std::max(error, std::abs(cosine - std::cos(static_cast<double>(s_inputs_a[i]))));
+        }
+        for (float x = -8192.0f; x <= 8192.0f; x += 0.0173f) {
+            error = std::max(error, std::abs(MathUtils::fastSin(x) - std::sin(static_cast<double>(x))));
+            error = std::max(error, std::abs(MathUtils::fastCos(x) - std::cos(static_cast<double>(x))));
+        }
+        return checkError("sinCos", error, FASTMATH_SINCOS_TOLERANCE, message);
+    }
+
+    // Worst atan2 error of the batch output and of points around circles of several radii
+    static bool checkAtan2(std::string& message) {
+        double error = 0.0;
+        for (std::size_t i = 0; i < s_inputs_a.size(); ++i) {
+            float angle = MathUtils::fastAtan2(s_inputs_a[i], s_inputs_b[i]);
+            if (angle != s_outputs_a[i]) {
+                message = "batched atan2 differs from fastAtan2 at index " + std::to_string(i);
+                return false;
+            }
+            error = std::max(error, std::abs(angle - std::atan2(static_cast<double>(s_inputs_a[i]), static_cast<double>(s_inputs_b[i]))));
+        }
+        for (float radius : { 1e-3f, 1.0f, 1e5f }) {
+            for (float a = -3.2f; a < 3.2f; a += 1e-4f) {
+                float y = radius * std::sin(a);
+                float x = radius * std::cos(a);
+                error = std::max(error, std::abs(MathUtils::fastAtan2(y, x) - std::atan2(static_cast<double>(y), static_cast<double>(x))));
+            }
+        }
+        if (MathUtils::fastAtan2(0.0f, 0.0f) != 0.0f) {
+            message = "fastAtan2(0, 0) isn't 0";
+            return false;
+        }
+        return checkError("atan2", error, FASTMATH_ATAN2_TOLERANCE, message);
+    }
+
+    // Worst relative inverse square root error of the batch output and of a sweep of [1e-30, 1e30]
+    static bool checkInvSqrt(std::string& message) {
+        double error = 0.0;
+        for (std::size_t i = 0; i < s_inputs_a.size(); ++i) {
+            if (MathUtils::fastInvSqrt(s_inputs_a[i]) != s_outputs_a[i]) {
+                message = "batched invSqrt differs from fastInvSqrt at index " + std::to_string(i);
+                return false;
+            }
+            double expected = 1.0 / std::sqrt(static_cast<double>(s_inputs_a[i]));
+            error = std::max(error, std::abs(s_outputs_a[i] - expected) / expected);
+        }
+        for (float x = 1e-30f; x < 1e30f; x *= 1.0007f) {
+            double expected = 1.0 / std::sqrt(static_cast<double>(x));
+            error = std::max(error, std::abs(MathUtils::fastInvSqrt(x) - expected) / expected);
+        }
+        return checkError("invSqrt", error, FASTMATH_INVSQRT_TOLERANCE, message);
+    }
+
+    // Worst relative exp error of the batch output and of a sweep of [-87, 88]
+    static bool checkExp(std::string& message) {
+        double error = 0.0;
+        for (std::size_t i = 0; i < s_inputs_a.size(); ++i) {
+            if (MathUtils::fastExp(s_inputs_a[i]) != s_outputs_a[i]) {
+                message = "batched exp differs from fastExp at index " + std::to_string(i);
+                return false;
+            }
+            double expected = std::exp(static_cast<double>(s_inputs_a[i]));
+            error = std::max(error, std::abs(s_outputs_a[i] - expected) / expected);
+        }
+        for (float x = -87.0f; x <= 88.0f; x += 1e-3f) {
+            double expected = std::exp(static_cast<double>(x));
+            error = std::max(error, std::abs(MathUtils::fastExp(x) - expected) / expected);
+        }
+        return checkError("exp", error, FASTMATH_EXP_TOLERANCE, message);
+    }
+
+    // Register the approximate math benchmarks
+    void registerFastMathBenchmarks(BenchmarkRunner& runner) {
+        BenchmarkCase sincos_libm;
+        sincos_libm.name = "fastmath/sincos_libm";
+        sincos_libm.ops = FASTMATH_BENCH_VALUES;
+        sincos_libm.setup = [](std::size_t n) { populateInputs(n, -100.0f, 100.0f); };
+        sincos_libm.run = [](std::size_t) {
+            for (std::size_t i = 0; i < s_inputs_a.size(); ++i) {
+                s_outputs_a[i] = std::sin(s_inputs_a[i]);
+                s_outputs_b[i] = std::cos(s_inputs_a[i]);
+            }
+            benchmarkSink(static_cast<uint64_t>(s_outputs_a.back() * 1000.0f));
+        };
+        runner.add(sincos_libm);
+
+        BenchmarkCase sincos_fast;
+        sincos_fast.name = "fastmath/sincos_fast";
+        sincos_fast.ops = FASTMATH_BENCH_VALUES;
+        sincos_fast.setup = [](std::size_t n) { populateInputs(n, -100.0f, 100.0f); };
+        sincos_fast.run = [](std::size_t) {
+            for (std::size_t i = 0; i < s_inputs_a.size(); ++i) {
+                MathUtils::fastSinCos(s_inputs_a[i], s_outputs_a[i], s_outputs_b[i]);
+            }
+            benchmarkSink(static_cast<uint64_t>(s_outputs_a.back() * 1000.0f));
+        };
+        runner.add(sincos_fast);
+
+        BenchmarkCase sincos_batch;
+        sincos_batch.name = "fastmath/sincos_batch";
+        sincos_batch.ops = FASTMATH_BENCH_VALUES;
+        sincos_batch.setup = [](std::size_t n) { populateFast(n, -100.0f, 100.0f); };
+        sincos_batch.run = [](std::size_t) {
+            MathUtils::sinCos(s_inputs_a, s_outputs_a, s_outputs_b);
+            benchmarkSink(static_cast<uint64_t>(s_outputs_a.back() * 1000.0f));
+        };
+        sincos_batch.teardown = restorePrecision;
+        sincos_batch.validate = checkSinCos;
+        runner.add(sincos_batch);
+
+        BenchmarkCase atan2_libm;
+        atan2_libm.name = "fastmath/atan2_libm";
+        atan2_libm.ops = FASTMATH_BENCH_VALUES;
+        atan2_libm.setup = [](std::size_t n) { populateInputs(n, -10.0f, 10.0f); };
+        atan2_libm.run = [](std::size_t) {
+            for (std::size_t i = 0; i < s_inputs_a.size(); ++i) {
+                s_outputs_a[i] = std::atan2(s_inputs_a[i], s_inputs_b[i]);
+            }
+            benchmarkSink(static_cast<uint64_t>(s_outputs_a.back() * 1000.0f));
+        };
+        runner.add(atan2_libm);
+
+        BenchmarkCase atan2_batch;
+        atan2_batch.name = "fastmath/atan2_batch";
+        atan2_batch.ops = FASTMATH_BENCH_VALUES;
+        atan2_batch.setup = [](std::size_t n) { populateFast(n, -10.0f, 10.0f); };
+        atan2_batch.run = [](std::size_t) {
+            MathUtils::atan2(s_inputs_a, s_inputs_b, s_outputs_a);
+            benchmarkSink(static_cast<uint64_t>(s_outputs_a.back() * 1000.0f));
+        };
+        atan2_batch.teardown = restorePrecision;
+        atan2_batch.validate = checkAtan2;
+        runner.add(atan2_batch);
+
+        BenchmarkCase invsqrt_libm;
+        invsqrt_libm.name = "fastmath/invsqrt_libm";
+        invsqrt_libm.ops = FASTMATH_BENCH_VALUES;
+        invsqrt_libm.setup = [](std::size_t n) { populateInputs(n, 0.001f, 1000.0f); };
+        invsqrt_libm.run = [](std::size_t) {
+            for (std::size_t i = 0; i < s_inputs_a.size(); ++i) {
+                s_outputs_a[i] = 1.0f / std::sqrt(s_inputs_a[i]);
+            }
+            benchmarkSink(static_cast<uint64_t>(s_outputs_a.back() * 1000.0f));
+        };
+        runner.add(invsqrt_libm);
+
+        BenchmarkCase invsqrt_batch;
+        invsqrt_batch.name = "fastmath/invsqrt_batch";
+        invsqrt_batch.ops = FASTMATH_BENCH_VALUES;
+        invsqrt_batch.setup = [](std::size_t n) { populateFast(n, 0.001f, 1000.0f); };
+        invsqrt_batch.run = [](std::size_t) {
+            MathUtils::invSqrt(s_inputs_a, s_outputs_a);
+            benchmarkSink(static_cast<uint64_t>(s_outputs_a.back() * 1000.0f));
+        };
+        invsqrt_batch.teardown = restorePrecision;
+        invsqrt_batch.validate = checkInvSqrt;
+        runner.add(invsqrt_batch);
+
+        BenchmarkCase exp_libm;
+        exp_libm.name = "fastmath/exp_libm";
+        exp_libm.ops = FASTMATH_BENCH_VALUES;
+        exp_libm.setup = [](std::size_t n) { populateInputs(n, -20.0f, 20.0f); };
+        exp_libm.run = [](std::size_t) {
+            for (std::size_t i = 0; i < s_inputs_a.size(); ++i) {
+                s_outputs_a[i] = std::exp(s_inputs_a[i]);
+            }
+            benchmarkSink(static_cast<uint64_t>(s_outputs_a.back()));
+        };
+        runner.add(exp_libm);
+
+        BenchmarkCase exp_batch;
+        exp_batch.name = "fastmath/exp_batch";
+        exp_batch.ops = FASTMATH_BENCH_VALUES;
+        exp_batch.setup = [](std::size_t n) { populateFast(n, -20.0f, 20.0f); };
+        exp_batch.run = [](std::size_t) {
+            MathUtils::exp(s_inputs_a, s_outputs_a);
+            benchmarkSink(static_cast<uint64_t>(s_outputs_a.back()));
+        };
+        exp_batch.teardown = restorePrecision;
+        exp_batch.validate = checkExp;
+        runner.add(exp_batch);
+    }
+
+} // end of namespace gam300
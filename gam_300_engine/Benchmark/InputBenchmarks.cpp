@@ -0,0 +1,465 @@
+/**
+ * @file InputBenchmarks.cpp
+ * @brief Benchmarks for input dispatch.
+ * @details Feeds key events through the InputManager event queue and measures the
+ *          cost of draining it and of the InputSystem dispatching the results to
+ *          entity input mappings.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Benchmark.h"
+#include "../gam_300_engine/Manager/ECSManager.h"
+#include "../gam_300_engine/Manager/InputManager.h"
+#include "../gam_300_engine/System/InputSystem.h"
+#include <filesystem>
+#include <vector>
+
+namespace gam300 {
+
+    // Number of entities with input mappings in a full run
+    static const std::size_t INPUT_BENCH_ENTITIES = 1000;
+
+    // Frames simulated per sample
+    static const std::size_t INPUT_BENCH_FRAMES = 20;
+
+    // Key state queries and updates per sample in a full run
+    static const std::size_t INPUT_BENCH_QUERIES = 100000;
+
+    // Events queued per frame by the event drain case, half presses and half releases
+    static const std::size_t INPUT_BENCH_EVENTS_PER_FRAME = 64;
+
+    // Number of press callbacks fired during the last sample
+    static uint64_t s_press_count = 0;
+
+    // Number of entities created by the last setup
+    static std::size_t s_input_entities = 0;
+
+    // Press callbacks fired while the replayed session was recorded
+    static uint64_t s_recorded_press_count = 0;
+
+    // Simulation steps of each frame of the last replay
+    static std::vector<int> s_replayed_steps;
+
+    // Press callbacks fired so far after each step, while recording and while replaying
+    static std::vector<uint64_t> s_recorded_step_presses;
+    static std::vector<uint64_t> s_replayed_step_presses;
+
+    // Input recording written and replayed by the replay case
+    static std::string getBenchRecordingFile() {
+        return (std::filesystem::temp_directory_path() / "gam300_bench_input.rec").string();
+    }
+
+    // Reset the world and create entities mapped like the player in Game.scn
+    static void populateInput(std::size_t count) {
+        resetBenchmarkWorld();
+        EM.registerSystem<InputSystem>();
+        s_press_count = 0;
+        s_input_entities = count;
+
+        InputCallback on_press = [](void*, EntityID, ActionID) { s_press_count++; };
+        for (std::size_t i = 0; i < count; ++i) {
+            EntityID id = EM.createEntity().get_id();
+            InputComponent* input = EM.addComponent<InputComponent>(id);
+            input->mapKeyPress("move_up", GLFW_KEY_W, on_press);
+            input->mapKeyPress("move_down", GLFW_KEY_S, on_press);
+            input->mapKeyPress("move_left", GLFW_KEY_A, on_press);
+            input->mapKeyPress("move_right", GLFW_KEY_D, on_press);
+            input->mapMousePress("primary_action", GLFW_MOUSE_BUTTON_LEFT, on_press);
+            input->mapMousePress("secondary_action", GLFW_MOUSE_BUTTON_RIGHT, on_press);
+        }
+
+        // Start every sample with nothing held
+        IM.injectKeyEvent(GLFW_KEY_W, GLFW_RELEASE);
+        IM.update();
+        IM.update();
+    }
+
+    // Reset the world and create entities sharing one context bound like the player in Game.scn
+    static void populateContextInput(std::size_t count) {
+        resetBenchmarkWorld();
+        EM.registerSystem<InputSystem>();
+        s_press_count = 0;
+        s_input_entities = count;
+
+        ContextID gameplay = IM.createContext("bench_gameplay", 0);
+        IM.bindContextAction(gameplay, "move_up", GLFW_KEY_W, InputActionType::PRESS);
+        IM.bindContextAction(gameplay, "move_down", GLFW_KEY_S, InputActionType::PRESS);
+        IM.bindContextAction(gameplay, "move_left", GLFW_KEY_A, InputActionType::PRESS);
+        IM.bindContextAction(gameplay, "move_right", GLFW_KEY_D, InputActionType::PRESS);
+        IM.bindContextAction(gameplay, "primary_action", MOUSE_BUTTON_INPUT_OFFSET + GLFW_MOUSE_BUTTON_LEFT, InputActionType::PRESS);
+        IM.bindContextAction(gameplay, "secondary_action", MOUSE_BUTTON_INPUT_OFFSET + GLFW_MOUSE_BUTTON_RIGHT, InputActionType::PRESS);
+        IM.setContextEnabled(gameplay, true);
+
+        // A menu layered on top that swallows W while it is enabled
+        ContextID menu = IM.createContext("bench_menu", 10);
+        IM.bindContextAction(menu, "menu_up", GLFW_KEY_W, InputActionType::PRESS);
+        IM.setContextEnabled(menu, false);
+
+        InputCallback on_press = [](void*, EntityID, ActionID) { s_press_count++; };
+        for (std::size_t i = 0; i < count; ++i) {
+            EntityID id = EM.createEntity().get_id();
+            InputComponent* input = EM.addComponent<InputComponent>(id);
+            input->addContext(gameplay);
+            input->addContext(menu);
+            input->setContextCallback(on_press);
+        }
+
+        // Start every sample with nothing held
+        IM.injectKeyEvent(GLFW_KEY_W, GLFW_RELEASE);
+        IM.update();
+        IM.update();
+    }
+
+    // Per-entity position moved by the shared axes in the axis case
+    static std::vector<float> s_axis_positions;
+
+    // Reset the positions and define the axes Game.scn uses for movement and looking
+    static void populateAxes(std::size_t count) {
+        s_axis_positions.assign(count * 2, 0.0f);
+        IM.createKeyAxis("move_x", GLFW_KEY_A, GLFW_KEY_D);
+        IM.createKeyAxis("move_y", GLFW_KEY_S, GLFW_KEY_W);
+        IM.createAxis("look_x", InputAxisSource::MOUSE_DELTA_X, 0.5f);
+
+        // Hold W and D, nothing else
+        IM.injectCursorEvent(0.0, 0.0);
+        IM.injectKeyEvent(GLFW_KEY_W, GLFW_PRESS);
+        IM.injectKeyEvent(GLFW_KEY_D, GLFW_PRESS);
+        IM.update();
+    }
+
+    // Run frames where every entity moves by the axis values, the way a movement system reads them
+    static void runAxisFrames() {
+        AxisID move_x = IM.findAxis("move_x");
+        AxisID move_y = IM.findAxis("move_y");
+        AxisID look_x = IM.findAxis("look_x");
+        float look = 0.0f;
+
+        for (std::size_t frame = 0; frame < INPUT_BENCH_FRAMES; ++frame) {
+            IM.injectCursorEvent(2.0 * (frame + 1), 0.0);
+            IM.update();
+
+            const float* axes = IM.getAxisValues();
+            float dx = axes[move_x];
+            float dy = axes[move_y];
+            for (std::size_t i = 0; i < s_axis_positions.size(); i += 2) {
+                s_axis_positions[i] += dx;
+                s_axis_positions[i + 1] += dy;
+            }
+            look += axes[look_x];
+        }
+        benchmarkSink(static_cast<uint64_t>(look));
+    }
+
+    // Run frames of input dispatch, optionally tapping W every other frame
+    static void runInputFrames(bool tap_key) {
+        for (std::size_t frame = 0; frame < INPUT_BENCH_FRAMES; ++frame) {
+            if (tap_key) {
+                IM.injectKeyEvent(GLFW_KEY_W, frame % 2 == 0 ? GLFW_PRESS : GLFW_RELEASE);
+            }
+            IM.update();
+            EM.updateSystems(1.0f / 90.0f);
+        }
+    }
+
+    // Run frames that each press and release W before the update sees it
+    static void runTapFrames() {
+        for (std::size_t frame = 0; frame < INPUT_BENCH_FRAMES; ++frame) {
+            IM.injectKeyEvent(GLFW_KEY_W, GLFW_PRESS);
+            IM.injectKeyEvent(GLFW_KEY_W, GLFW_RELEASE);
+            IM.update();
+            EM.updateSystems(1.0f / 90.0f);
+        }
+    }
+
+    // Simulation steps of a recorded frame, some frames run none and some two like an uncapped loop
+    static int getBenchFrameSteps(std::size_t frame) {
+        return frame % 5 == 1 ? 0 : (frame % 5 == 3 ? 2 : 1);
+    }
+
+    // Run the steps of one frame the way the game loop does, refreshing input before each,
+    // optionally tapping S between steps as another thread might
+    static void runSteps(int steps, std::vector<uint64_t>& step_presses, bool tap_between = false) {
+        for (int step = 0; step < steps; ++step) {
+            if (tap_between && step > 0) {
+                IM.injectKeyEvent(GLFW_KEY_S, GLFW_PRESS);
+                IM.injectKeyEvent(GLFW_KEY_S, GLFW_RELEASE);
+            }
+            IM.update();
+            EM.updateSystems(1.0f / 90.0f);
+            step_presses.push_back(s_press_count);
+        }
+        IM.endFrame(steps);
+    }
+
+    // Record a session of taps, held keys, clicks and cursor movement, then reset the callbacks
+    static void recordInputSession() {
+        s_recorded_step_presses.clear();
+        IM.startRecording(getBenchRecordingFile(), 11111);
+        for (std::size_t frame = 0; frame < INPUT_BENCH_FRAMES; ++frame) {
+            IM.injectKeyEvent(GLFW_KEY_W, GLFW_PRESS);
+            IM.injectKeyEvent(GLFW_KEY_W, GLFW_RELEASE);
+            IM.injectKeyEvent(GLFW_KEY_D, frame % 4 == 0 ? GLFW_PRESS : GLFW_RELEASE);
+            IM.injectMouseButtonEvent(GLFW_MOUSE_BUTTON_LEFT, frame % 3 == 0 ? GLFW_PRESS : GLFW_RELEASE);
+            IM.injectCursorEvent(static_cast<double>(frame), 2.0 * frame);
+            runSteps(getBenchFrameSteps(frame), s_recorded_step_presses, true);
+        }
+        IM.stopRecording();
+
+        s_recorded_press_count = s_press_count;
+        s_press_count = 0;
+    }
+
+    // Register the input benchmarks
+    void registerInputBenchmarks(BenchmarkRunner& runner) {
+        BenchmarkCase dispatch_idle;
+        dispatch_idle.name = "input/dispatch_idle";
+        dispatch_idle.ops = INPUT_BENCH_ENTITIES * INPUT_BENCH_FRAMES;
+        dispatch_idle.setup = [](std::size_t n) { populateInput(n / INPUT_BENCH_FRAMES); };
+        dispatch_idle.run = [](std::size_t) { runInputFrames(false); };
+        dispatch_idle.validate = [](std::string& message) {
+            if (s_press_count != 0) {
+                message = "callbacks fired without any input";
+                return false;
+            }
+            return true;
+        };
+        runner.add(dispatch_idle);
+
+        BenchmarkCase dispatch_press;
+        dispatch_press.name = "input/dispatch_press";
+        dispatch_press.ops = INPUT_BENCH_ENTITIES * INPUT_BENCH_FRAMES;
+        dispatch_press.setup = [](std::size_t n) { populateInput(n / INPUT_BENCH_FRAMES); };
+        dispatch_press.run = [](std::size_t) { runInputFrames(true); };
+        dispatch_press.validate = [](std::string& message) {
+            // W is pressed on every other frame and mapped once per entity
+            uint64_t expected = static_cast<uint64_t>(s_input_entities) * (INPUT_BENCH_FRAMES / 2);
+            if (s_press_count != expected) {
+                message = "expected " + std::to_string(expected) + " press callbacks, got " + std::to_string(s_press_count);
+                return false;
+            }
+            return true;
+        };
+        runner.add(dispatch_press);
+
+        BenchmarkCase dispatch_tap;
+        dispatch_tap.name = "input/dispatch_tap";
+        dispatch_tap.ops = INPUT_BENCH_ENTITIES * INPUT_BENCH_FRAMES;
+        dispatch_tap.setup = [](std::size_t n) { populateInput(n / INPUT_BENCH_FRAMES); };
+        dispatch_tap.run = [](std::size_t) { runTapFrames(); };
+        dispatch_tap.validate = [](std::string& message) {
+            // A press and release inside one frame must still reach every entity
+            uint64_t expected = static_cast<uint64_t>(s_input_entities) * INPUT_BENCH_FRAMES;
+            if (s_press_count != expected) {
+                message = "expected " + std::to_string(expected) + " press callbacks, got " + std::to_string(s_press_count);
+                return false;
+            }
+            return true;
+        };
+        runner.add(dispatch_tap);
+
+        BenchmarkCase dispatch_context;
+        dispatch_context.name = "input/dispatch_context";
+        dispatch_context.ops = INPUT_BENCH_ENTITIES * INPUT_BENCH_FRAMES;
+        dispatch_context.setup = [](std::size_t n) { populateContextInput(n / INPUT_BENCH_FRAMES); };
+        dispatch_context.run = [](std::size_t) { runInputFrames(true); };
+        dispatch_context.validate = [](std::string& message) {
+            // The shared bindings are evaluated once and reach every entity that uses them
+            uint64_t expected = static_cast<uint64_t>(s_input_entities) * (INPUT_BENCH_FRAMES / 2);
+            if (s_press_count != expected) {
+                message = "expected " + std::to_string(expected) + " context callbacks, got " + std::to_string(s_press_count);
+                return false;
+            }
+
+            // With the menu enabled W must only reach the menu
+            ContextID menu = IM.findContext("bench_menu");
+            IM.setContextEnabled(menu, true);
+            IM.injectKeyEvent(GLFW_KEY_W, GLFW_PRESS);
+            IM.injectKeyEvent(GLFW_KEY_W, GLFW_RELEASE);
+            IM.update();
+            IM.setContextEnabled(menu, false);
+            const std::vector<InputContextEvent>& events = IM.getContextEvents();
+            if (events.size() != 1 || events[0].context != menu) {
+                message = "a consuming higher priority context did not block the gameplay binding";
+                return false;
+            }
+            return true;
+        };
+        dispatch_context.teardown = []() {
+            // Later cases don't pay for contexts they don't use
+            IM.setContextEnabled(IM.findContext("bench_gameplay"), false);
+            IM.setContextEnabled(IM.findContext("bench_menu"), false);
+        };
+        runner.add(dispatch_context);
+
+        BenchmarkCase axis_read;
+        axis_read.name = "input/axis_read";
+        axis_read.ops = INPUT_BENCH_ENTITIES * INPUT_BENCH_FRAMES;
+        axis_read.setup = [](std::size_t n) { populateAxes(n / INPUT_BENCH_FRAMES); };
+        axis_read.run = [](std::size_t) { runAxisFrames(); };
+        axis_read.validate = [](std::string& message) {
+            // W and D held for every frame, the cursor moved 2 pixels per frame at half sensitivity
+            float expected = static_cast<float>(INPUT_BENCH_FRAMES);
+            if (s_axis_positions.empty() || s_axis_positions[0] != expected || s_axis_positions.back() != expected) {
+                message = "key axes did not move the entities by one unit per frame";
+                return false;
+            }
+            if (IM.getAxisValue(IM.findAxis("look_x")) != 1.0f) {
+                message = "mouse axis read " + std::to_string(IM.getAxisValue(IM.findAxis("look_x"))) + ", expected 1";
+                return false;
+            }
+            if (IM.getAxisValue(MOUSE_DELTA_X_AXIS) != 2.0f || IM.getAxisValue(MOUSE_DELTA_Y_AXIS) != 0.0f) {
+                message = "built-in mouse delta axes read " + std::to_string(IM.getAxisValue(MOUSE_DELTA_X_AXIS)) + ", " +
+                    std::to_string(IM.getAxisValue(MOUSE_DELTA_Y_AXIS)) + ", expected 2, 0";
+                return false;
+            }
+            return true;
+        };
+        axis_read.teardown = []() {
+            IM.injectKeyEvent(GLFW_KEY_W, GLFW_RELEASE);
+            IM.injectKeyEvent(GLFW_KEY_D, GLFW_RELEASE);
+            IM.update();
+            IM.update();
+        };
+        runner.add(axis_read);
+
+        BenchmarkCase replay;
+        replay.name = "input/replay";
+        replay.ops = INPUT_BENCH_ENTITIES * INPUT_BENCH_FRAMES;
+        replay.setup = [](std::size_t n) {
+            populateInput(n / INPUT_BENCH_FRAMES);
+            recordInputSession();
+        };
+        replay.run = [](std::size_t) {
+            s_press_count = 0;
+            IM.startReplay(getBenchRecordingFile());
+            s_replayed_steps.clear();
+            s_replayed_step_presses.clear();
+            while (IM.isReplaying()) {
+                s_replayed_steps.push_back(IM.getReplayFrameSteps());
+                runSteps(s_replayed_steps.back(), s_replayed_step_presses);
+            }
+        };
+        replay.validate = [](std::string& message) {
+            // Frames replay with the steps they were recorded with
+            for (std::size_t frame = 0; frame < INPUT_BENCH_FRAMES; ++frame) {
+                if (s_replayed_steps.size() != INPUT_BENCH_FRAMES || s_replayed_steps[frame] != getBenchFrameSteps(frame)) {
+                    message = "replayed frames don't run the steps they were recorded with";
+                    return false;
+                }
+            }
+
+            // The replay must drive exactly the callbacks the live session did, on the same steps
+            if (s_replayed_step_presses != s_recorded_step_presses) {
+                message = "replayed presses land on different steps than recorded";
+                return false;
+            }
+            if (s_recorded_press_count == 0 || s_press_count != s_recorded_press_count) {
+                message = "replay fired " + std::to_string(s_press_count) + " press callbacks, recording fired " +
+                    std::to_string(s_recorded_press_count);
+                return false;
+            }
+            if (IM.getReplayFixedStep() != 11111 || IM.getMouseX() != INPUT_BENCH_FRAMES - 1) {
+                message = "replayed fixed step or cursor position differs from the recording";
+                return false;
+            }
+            return true;
+        };
+        replay.teardown = []() {
+            // Release whatever the recording left held
+            IM.injectKeyEvent(GLFW_KEY_D, GLFW_RELEASE);
+            IM.injectMouseButtonEvent(GLFW_MOUSE_BUTTON_LEFT, GLFW_RELEASE);
+            IM.update();
+            IM.update();
+        };
+        runner.add(replay);
+
+        BenchmarkCase event_drain;
+        event_drain.name = "input/event_drain";
+        event_drain.ops = INPUT_BENCH_QUERIES;
+        event_drain.run = [](std::size_t n) {
+            for (std::size_t queued = 0; queued < n; queued += INPUT_BENCH_EVENTS_PER_FRAME) {
+                for (std::size_t i = 0; i < INPUT_BENCH_EVENTS_PER_FRAME / 2; ++i) {
+                    int key = GLFW_KEY_A + static_cast<int>(i % 26);
+                    IM.injectKeyEvent(key, GLFW_PRESS);
+                    IM.injectKeyEvent(key, GLFW_RELEASE);
+                }
+                IM.update();
+            }
+        };
+        event_drain.validate = [](std::string& message) {
+            // Every key of the last frame was tapped, so it is both pressed and released but not held
+            if (IM.getFrameEvents().size() != INPUT_BENCH_EVENTS_PER_FRAME) {
+                message = "expected " + std::to_string(INPUT_BENCH_EVENTS_PER_FRAME) + " events in the last frame, got " +
+                    std::to_string(IM.getFrameEvents().size());
+                return false;
+            }
+            if (!IM.isKeyJustPressed(GLFW_KEY_A) || !IM.isKeyJustReleased(GLFW_KEY_A) || IM.isKeyPressed(GLFW_KEY_A)) {
+                message = "a key tapped within one frame lost an edge";
+                return false;
+            }
+            return true;
+        };
+        event_drain.teardown = []() { IM.update(); };
+        runner.add(event_drain);
+
+        BenchmarkCase state_update;
+        state_update.name = "input/state_update";
+        state_update.ops = INPUT_BENCH_QUERIES;
+        state_update.setup = [](std::size_t) {
+            // A handful of keys held so the update has state to diff
+            IM.injectKeyEvent(GLFW_KEY_W, GLFW_PRESS);
+            IM.injectKeyEvent(GLFW_KEY_LEFT_SHIFT, GLFW_PRESS);
+            IM.injectKeyEvent(GLFW_KEY_SPACE, GLFW_PRESS);
+        };
+        state_update.run = [](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                IM.injectKeyEvent(GLFW_KEY_E, i % 2 == 0 ? GLFW_PRESS : GLFW_RELEASE);
+                IM.update();
+            }
+        };
+        state_update.validate = [](std::string& message) {
+            // The last iteration released E after pressing it the frame before
+            if (!IM.isKeyPressed(GLFW_KEY_W) || !IM.isKeyJustReleased(GLFW_KEY_E) || IM.isKeyJustPressed(GLFW_KEY_W)) {
+                message = "key state edges are wrong after the update";
+                return false;
+            }
+            return true;
+        };
+        state_update.teardown = []() {
+            IM.injectKeyEvent(GLFW_KEY_W, GLFW_RELEASE);
+            IM.injectKeyEvent(GLFW_KEY_LEFT_SHIFT, GLFW_RELEASE);
+            IM.injectKeyEvent(GLFW_KEY_SPACE, GLFW_RELEASE);
+            IM.injectKeyEvent(GLFW_KEY_E, GLFW_RELEASE);
+            IM.update();
+            IM.update();
+        };
+        runner.add(state_update);
+
+        BenchmarkCase key_query;
+        key_query.name = "input/key_query";
+        key_query.ops = INPUT_BENCH_QUERIES;
+        key_query.setup = [](std::size_t) {
+            IM.injectKeyEvent(GLFW_KEY_W, GLFW_PRESS);
+            IM.update();
+        };
+        key_query.run = [](std::size_t n) {
+            uint64_t held = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                int key = GLFW_KEY_SPACE + static_cast<int>(i % (GLFW_KEY_LAST - GLFW_KEY_SPACE));
+                held += IM.isKeyPressed(key) + IM.isKeyJustPressed(key);
+            }
+            benchmarkSink(held);
+        };
+        key_query.teardown = []() {
+            IM.injectKeyEvent(GLFW_KEY_W, GLFW_RELEASE);
+            IM.update();
+            IM.update();
+        };
+        runner.add(key_query);
+    }
+
+} // end of namespace gam300
@@ -0,0 +1,79 @@
+/**
+ * @file LogBenchmarks.cpp
+ * @brief Benchmarks for the LogManager.
+ * @details Measures formatted log throughput, the cost of messages filtered out
+ *          by the log level, and writes that flush after every line.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Benchmark.h"
+#include "../gam_300_engine/Manager/LogManager.h"
+
+namespace gam300 {
+
+    // Number of log lines written per sample in a full run
+    static const std::size_t LOG_BENCH_LINES = 20000;
+
+    // Lines written per sample by the flushing case, which is much slower
+    static const std::size_t LOG_BENCH_FLUSHED_LINES = 2000;
+
+    // Log level the harness ran with before a case changed it
+    static LogLevel s_previous_level = LogLevel::WARNING;
+
+    // Register the logging benchmarks
+    void registerLogBenchmarks(BenchmarkRunner& runner) {
+        BenchmarkCase write_info;
+        write_info.name = "log/write";
+        write_info.ops = LOG_BENCH_LINES;
+        write_info.setup = [](std::size_t) {
+            s_previous_level = LM.getLogLevel();
+            LM.setLogLevel(LogLevel::INFO);
+        };
+        write_info.run = [](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                LM.writeLog("LogBenchmarks - entity %d moved to (%.2f, %.2f)", static_cast<int>(i), 1.5f, -2.25f);
+            }
+        };
+        write_info.teardown = []() { LM.setLogLevel(s_previous_level); };
+        runner.add(write_info);
+
+        BenchmarkCase write_filtered;
+        write_filtered.name = "log/write_filtered";
+        write_filtered.ops = LOG_BENCH_LINES;
+        write_filtered.setup = [](std::size_t) {
+            s_previous_level = LM.getLogLevel();
+            LM.setLogLevel(LogLevel::INFO);
+        };
+        write_filtered.run = [](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                LM.writeLog(LogLevel::DEBUG, "LogBenchmarks - entity %d moved to (%.2f, %.2f)", static_cast<int>(i), 1.5f, -2.25f);
+            }
+        };
+        write_filtered.teardown = []() { LM.setLogLevel(s_previous_level); };
+        runner.add(write_filtered);
+
+        BenchmarkCase write_flushed;
+        write_flushed.name = "log/write_flushed";
+        write_flushed.ops = LOG_BENCH_FLUSHED_LINES;
+        write_flushed.setup = [](std::size_t) {
+            s_previous_level = LM.getLogLevel();
+            LM.setLogLevel(LogLevel::INFO);
+            LM.setFlush(true);
+        };
+        write_flushed.run = [](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                LM.writeLog("LogBenchmarks - entity %d moved to (%.2f, %.2f)", static_cast<int>(i), 1.5f, -2.25f);
+            }
+        };
+        write_flushed.teardown = []() {
+            LM.setFlush(false);
+            LM.setLogLevel(s_previous_level);
+        };
+        runner.add(write_flushed);
+    }
+
+} // end of namespace gam300
@@ -0,0 +1,625 @@
+/**
+ * @file MathBenchmarks.cpp
+ * @brief Benchmarks for the vector math.
+ * @details Compares per-vector Vector3D loops against the VectorBatch operations
+ *          for integration, normalization, dot products and interpolation, and
+ *          checks every batch operation against the Vector3D result. Also times
+ *          Matrix4 multiplication against glm and per-transform against batched
+ *          matrix composition, checking the matrix and quaternion math against glm,
+ *          and the per-call and bulk random streams against a per-call std::mt19937.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Benchmark.h"
+#include "../gam_300_engine/Utility/MathUtils.h"
+#include "../gam_300_engine/Utility/Transform.h"
+#include "../gam_300_engine/Utility/VectorBatch.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/matrix.hpp>
+#include <cmath>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace gam300 {
+
+    // Passes over the vectors per sample, the vectors stay cache resident between passes
+    static const std::size_t MATH_BENCH_PASSES = 16;
+
+    // Vectors processed per sample in a full run
+    static const std::size_t MATH_BENCH_OPS = 4096 * MATH_BENCH_PASSES;
+
+    // Every Nth generated vector is zero, to cover the normalize special case
+    static const std::size_t MATH_BENCH_ZERO_INTERVAL = 97;
+
+    // Transforms composed per sample in a full run
+    static const std::size_t MATH_BENCH_TRANSFORMS = 100000;
+
+    // Matrix products per sample in a full run
+    static const std::size_t MATH_BENCH_MATRICES = 100000;
+
+    // Random floats per sample in a full run
+    static const std::size_t MATH_BENCH_RANDOMS = 100000;
+
+    // Seed of the random cases
+    static const uint64_t MATH_BENCH_SEED = 20250101;
+
+    // Inputs and outputs in both layouts
+    static std::vector<Vector3D> s_vectors_a;
+    static std::vector<Vector3D> s_vectors_b;
+    static std::vector<Vector3D> s_vectors_out;
+    static std::vector<float> s_scalars_out;
+    static Vector3Buffer s_batch_a;
+    static Vector3Buffer s_batch_b;
+    static Vector3Buffer s_batch_out;
+
+    // Transforms and matrices in both layouts
+    static std::vector<Transform> s_transforms;
+    static Vector3Buffer s_transform_positions;
+    static Vector3Buffer s_transform_scales;
+    static std::vector<float> s_rotation_x;
+    static std::vector<float> s_rotation_y;
+    static std::vector<float> s_rotation_z;
+    static std::vector<float> s_rotation_w;
+    static std::vector<Matrix4> s_matrices_a;
+    static std::vector<Matrix4> s_matrices_b;
+    static std::vector<Matrix4> s_matrices_out;
+    static std::vector<glm::mat4> s_glm_a;
+    static std::vector<glm::mat4> s_glm_b;
+    static std::vector<glm::mat4> s_glm_out;
+
+    // Output of the random cases
+    static std::vector<float> s_randoms;
+
+    // Deterministic value in [-100, 100)
+    static float nextMathValue(uint32_t& state) {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / static_cast<float>(1u << 24) * 200.0f - 100.0f;
+    }
+
+    // Fill both layouts with the same vectors
+    static void populateVectors(std::size_t count) {
+        s_vectors_a.resize(count);
+        s_vectors_b.resize(count);
+        s_vectors_out.assign(count, Vector3D());
+        s_scalars_out.assign(count, 0.0f);
+        s_batch_a.resize(count);
+        s_batch_b.resize(count);
+        s_batch_out.resize(count);
+
+        uint32_t state = 12345;
+        for (std::size_t i = 0; i < count; ++i) {
+            Vector3D a(nextMathValue(state), nextMathValue(state), nextMathValue(state));
+            Vector3D b(nextMathValue(state), nextMathValue(state), nextMathValue(state));
+            if (i % MATH_BENCH_ZERO_INTERVAL == 0) {
+                a = Vector3D::ZERO;
+            }
+            s_vectors_a[i] = a;
+            s_vectors_b[i] = b;
+            s_batch_a.set(i, a);
+            s_batch_b.set(i, b);
+        }
+    }
+
+    // True if two floats match to within a relative tolerance
+    static bool closeEnough(float expected, float actual) {
+        return std::abs(expected - actual) <= 1e-5f * (1.0f + std::abs(expected));
+    }
+
+    // True if two vectors match to within a relative tolerance
+    static bool closeEnough(const Vector3D& expected, const Vector3D& actual) {
+        return closeEnough(expected.x, actual.x) && closeEnough(expected.y, actual.y) && closeEnough(expected.z, actual.z);
+    }
+
+    // Compare the batch output against the per-vector results
+    static bool checkBatchOutput(const char* operation, std::string& message) {
+        for (std::size_t i = 0; i < s_vectors_out.size(); ++i) {
+            if (!closeEnough(s_vectors_out[i], s_batch_out.get(i))) {
+                message = std::string(operation) + " differs from Vector3D at index " + std::to_string(i);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Run every batch operation on counts that leave a remainder after the SIMD loop
+    static bool checkBatchEdgeCases(std::string& message) {
+        for (std::size_t count = 0; count <= 19; ++count) {
+            populateVectors(count);
+            Vector3Array out = s_batch_out.view();
+
+            VectorBatch::add(s_batch_a.view(), s_batch_b.view(), out, count);
+            for (std::size_t i = 0; i < count; ++i) {
+                s_vectors_out[i] = s_vectors_a[i] + s_vectors_b[i];
+            }
+            if (!checkBatchOutput("add", message)) {
+                return false;
+            }
+
+            VectorBatch::scale(s_batch_a.view(), -0.5f, out, count);
+            for (std::size_t i = 0; i < count; ++i) {
+                s_vectors_out[i] = s_vectors_a[i] * -0.5f;
+            }
+            if (!checkBatchOutput("scale", message)) {
+                return false;
+            }
+
+            VectorBatch::lerp(s_batch_a.view(), s_batch_b.view(), 1.5f, out, count);
+            for (std::size_t i = 0; i < count; ++i) {
+                s_vectors_out[i] = Vector3D::lerp(s_vectors_a[i], s_vectors_b[i], 1.5f);
+            }
+            if (!checkBatchOutput("lerp", message)) {
+                return false;
+            }
+
+            VectorBatch::dot(s_batch_a.view(), s_batch_b.view(), s_scalars_out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) {
+                if (!closeEnough(Vector3D::dot(s_vectors_a[i], s_vectors_b[i]), s_scalars_out[i])) {
+                    message = "dot differs from Vector3D at index " + std::to_string(i) + " of " + std::to_string(count);
+                    return false;
+                }
+            }
+
+            // In place, with a zero vector at index 0
+            VectorBatch::normalize(s_batch_a.view(), s_batch_a.view(), count);
+            for (std::size_t i = 0; i < count; ++i) {
+                s_vectors_out[i] = s_vectors_a[i].normalize();
+                s_batch_out.set(i, s_batch_a.get(i));
+            }
+            if (!checkBatchOutput("in place normalize", message)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Fill both transform layouts with the same random transforms
+    static void populateTransforms(std::size_t count) {
+        s_transforms.resize(count);
+        s_transform_positions.resize(count);
+        s_transform_scales.resize(count);
+        s_rotation_x.resize(count);
+        s_rotation_y.resize(count);
+        s_rotation_z.resize(count);
+        s_rotation_w.resize(count);
+        s_matrices_out.assign(count, Matrix4());
+
+        uint32_t state = 54321;
+        for (std::size_t i = 0; i < count; ++i) {
+            Vector3D position(nextMathValue(state), nextMathValue(state), nextMathValue(state));
+            Vector3D angles(nextMathValue(state) * 0.05f, nextMathValue(state) * 0.05f, nextMathValue(state) * 0.05f);
+            Vector3D scale(1.0f + nextMathValue(state) * 0.005f, 1.0f + nextMathValue(state) * 0.005f, 1.0f + nextMathValue(state) * 0.005f);
+            Quaternion rotation = Quaternion::fromEuler(angles);
+
+            s_transforms[i] = Transform(position, rotation, scale);
+            s_transform_positions.set(i, position);
+            s_transform_scales.set(i, scale);
+            s_rotation_x[i] = rotation.x;
+            s_rotation_y[i] = rotation.y;
+            s_rotation_z[i] = rotation.z;
+            s_rotation_w[i] = rotation.w;
+        }
+    }
+
+    // Fill both matrix layouts with the same transform matrices
+    static void populateMatrices(std::size_t count) {
+        populateTransforms(count);
+        s_matrices_a.resize(count);
+        s_matrices_b.resize(count);
+        s_glm_a.resize(count);
+        s_glm_b.resize(count);
+        s_glm_out.assign(count, glm::mat4(1.0f));
+        for (std::size_t i = 0; i < count; ++i) {
+            s_matrices_a[i] = s_transforms[i].toMatrix();
+            s_matrices_b[i] = s_transforms[count - 1 - i].toMatrix();
+            s_glm_a[i] = s_matrices_a[i].toGlm();
+            s_glm_b[i] = s_matrices_b[i].toGlm();
+        }
+    }
+
+    // True if two matrices match to within a relative tolerance, looser than for vectors as inverses lose precision
+    static bool closeEnough(const Matrix4& expected, const Matrix4& actual) {
+        for (int i = 0; i < 16; ++i) {
+            if (std::abs(expected.m[i] - actual.m[i]) > 1e-4f * (1.0f + std::abs(expected.m[i]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Check the matrix and quaternion operations against glm
+    static bool checkAgainstGlm(std::string& message) {
+        populateMatrices(64);
+        for (std::size_t i = 0; i < s_transforms.size(); ++i) {
+            const Transform& transform = s_transforms[i];
+            glm::quat rotation = transform.rotation.toGlm();
+            glm::vec3 position(transform.position.x, transform.position.y, transform.position.z);
+            glm::vec3 scale(transform.scale.x, transform.scale.y, transform.scale.z);
+
+            glm::mat4 trs = glm::translate(glm::mat4(1.0f), position) * glm::mat4_cast(rotation) * glm::scale(glm::mat4(1.0f), scale);
+            if (!closeEnough(Matrix4(trs), transform.toMatrix())) {
+                message = "Transform::toMatrix differs from glm at index " + std::to_string(i);
+                return false;
+            }
+            if (!closeEnough(Matrix4(s_glm_a[i] * s_glm_b[i]), s_matrices_a[i] * s_matrices_b[i])) {
+                message = "Matrix4 multiply differs from glm at index " + std::to_string(i);
+                return false;
+            }
+            if (!closeEnough(Matrix4(glm::inverse(s_glm_a[i])), s_matrices_a[i].inverse())) {
+                message = "Matrix4::inverse differs from glm at index " + std::to_string(i);
+                return false;
+            }
+
+            Vector3D point(1.0f, -2.0f, 3.0f);
+            glm::vec3 rotated = rotation * glm::vec3(point.x, point.y, point.z);
+            if (!closeEnough(Vector3D(rotated.x, rotated.y, rotated.z), transform.rotation.rotate(point)) ||
+                !closeEnough(transform.toMatrix().transformPoint(point), transform.transformPoint(point))) {
+                message = "Quaternion::rotate or Transform::transformPoint differs from glm at index " + std::to_string(i);
+                return false;
+            }
+
+            const Quaternion& other = s_transforms[s_transforms.size() - 1 - i].rotation;
+            glm::quat expected = glm::slerp(rotation, other.toGlm(), 0.3f);
+            Quaternion actual = Quaternion::slerp(transform.rotation, other, 0.3f);
+            // q and -q are the same rotation
+            float sign = glm::dot(expected, actual.toGlm()) < 0.0f ? -1.0f : 1.0f;
+            if (!closeEnough(Vector3D(expected.x, expected.y, expected.z) * sign, Vector3D(actual.x, actual.y, actual.z)) ||
+                !closeEnough(expected.w * sign, actual.w)) {
+                message = "Quaternion::slerp differs from glm at index " + std::to_string(i);
+                return false;
+            }
+        }
+
+        Vector3D angles(0.3f, -1.2f, 2.0f);
+        Quaternion euler = Quaternion::fromEuler(angles);
+        if (Quaternion(glm::quat(glm::vec3(angles.x, angles.y, angles.z))) != euler) {
+            message = "Quaternion::fromEuler differs from glm";
+            return false;
+        }
+        return true;
+    }
+
+    // Check the random streams: value ranges, repeatability from a seed and fill
+    // lengths that end part way through a step of the fill lanes
+    static bool checkRandomStreams(std::string& message) {
+        double sum = 0.0;
+        for (float value : s_randoms) {
+            if (!(value >= 0.0f && value < 1.0f)) {
+                message = "fillUniform produced " + std::to_string(value) + ", outside [0, 1)";
+                return false;
+            }
+            sum += value;
+        }
+        double mean = s_randoms.empty() ? 0.5 : sum / static_cast<double>(s_randoms.size());
+        if (std::abs(mean - 0.5) > 0.02) {
+            message = "fillUniform mean is " + std::to_string(mean) + ", expected about 0.5";
+            return false;
+        }
+
+        // A shorter fill from the same state is a prefix of a longer one
+        float full[64];
+        RandomStream reference(MATH_BENCH_SEED);
+        reference.fillUniform(full);
+        for (std::size_t count = 0; count <= 19; ++count) {
+            float partial[19];
+            RandomStream stream(MATH_BENCH_SEED);
+            stream.fillUniform(std::span<float>(partial, count));
+            for (std::size_t i = 0; i < count; ++i) {
+                if (partial[i] != full[i]) {
+                    message = "fill of " + std::to_string(count) + " differs from a longer fill at index " + std::to_string(i);
+                    return false;
+                }
+            }
+        }
+
+        // Same seed, same values; ranged fills follow the unit fill
+        RandomStream a(MATH_BENCH_SEED);
+        RandomStream b(MATH_BENCH_SEED);
+        float ranged[64];
+        b.fillUniform(ranged, -3.0f, 5.0f);
+        for (std::size_t i = 0; i < 64; ++i) {
+            if (a.nextU64() != b.nextU64()) {
+                message = "streams with the same seed diverged";
+                return false;
+            }
+            if (std::abs(ranged[i] - (-3.0f + 8.0f * full[i])) > 1e-5f || ranged[i] < -3.0f || ranged[i] >= 5.0f) {
+                message = "ranged fill doesn't match the unit fill at index " + std::to_string(i);
+                return false;
+            }
+        }
+        RandomStream jumped(MATH_BENCH_SEED);
+        jumped.jump();
+        if (jumped.nextU64() == RandomStream(MATH_BENCH_SEED).nextU64()) {
+            message = "jump() didn't move the stream";
+            return false;
+        }
+
+        // Integers stay in range, including the widest range and a single value
+        RandomStream ints(MATH_BENCH_SEED);
+        int counts[10] = {};
+        for (int i = 0; i < 10000; ++i) {
+            int value = ints.nextInt(0, 9);
+            if (value < 0 || value > 9 || ints.nextInt(7, 7) != 7) {
+                message = "nextInt out of range";
+                return false;
+            }
+            counts[value]++;
+            ints.nextInt(INT_MIN, INT_MAX);
+            if (ints.nextInt(-5, -3) < -5) {
+                message = "nextInt below its minimum";
+                return false;
+            }
+        }
+        for (int count : counts) {
+            if (count < 850 || count > 1150) {
+                message = "nextInt(0, 9) isn't uniform";
+                return false;
+            }
+        }
+        return true;
+    }
+
+
+    void registerMathBenchmarks(BenchmarkRunner& runner) {
+        BenchmarkCase integrate_scalar;
+        integrate_scalar.name = "math/integrate_vector3d";
+        integrate_scalar.ops = MATH_BENCH_OPS;
+        integrate_scalar.setup = [](std::size_t n) { populateVectors(n / MATH_BENCH_PASSES); };
+        integrate_scalar.run = [](std::size_t) {
+            for (std::size_t pass = 0; pass < MATH_BENCH_PASSES; ++pass) {
+                for (std::size_t i = 0; i < s_vectors_a.size(); ++i) {
+                    s_vectors_a[i] += s_vectors_b[i] * (1.0f / 90.0f);
+                }
+            }
+            benchmarkSink(static_cast<uint64_t>(s_vectors_a.back().x));
+        };
+        runner.add(integrate_scalar);
+
+        BenchmarkCase integrate_batch;
+        integrate_batch.name = "math/integrate_batch";
+        integrate_batch.ops = MATH_BENCH_OPS;
+        integrate_batch.setup = [](std::size_t n) { populateVectors(n / MATH_BENCH_PASSES); };
+        integrate_batch.run = [](std::size_t) {
+            for (std::size_t pass = 0; pass < MATH_BENCH_PASSES; ++pass) {
+                VectorBatch::addScaled(s_batch_a.view(), s_batch_b.view(), 1.0f / 90.0f, s_batch_a.view(), s_batch_a.size());
+            }
+            benchmarkSink(static_cast<uint64_t>(s_batch_a.get(s_batch_a.size() - 1).x));
+        };
+        integrate_batch.validate = [](std::string& message) {
+            // The run only moved the batch copy, the Vector3D copy still holds the start positions
+            s_vectors_out = s_vectors_a;
+            for (std::size_t pass = 0; pass < MATH_BENCH_PASSES; ++pass) {
+                for (std::size_t i = 0; i < s_vectors_out.size(); ++i) {
+                    s_vectors_out[i] += s_vectors_b[i] * (1.0f / 90.0f);
+                }
+            }
+            s_batch_out = s_batch_a;
+            if (!checkBatchOutput("addScaled", message)) {
+                return false;
+            }
+            return checkBatchEdgeCases(message);
+        };
+        runner.add(integrate_batch);
+
+        BenchmarkCase normalize_scalar;
+        normalize_scalar.name = "math/normalize_vector3d";
+        normalize_scalar.ops = MATH_BENCH_OPS;
+        normalize_scalar.setup = [](std::size_t n) { populateVectors(n / MATH_BENCH_PASSES); };
+        normalize_scalar.run = [](std::size_t) {
+            for (std::size_t pass = 0; pass < MATH_BENCH_PASSES; ++pass) {
+                for (std::size_t i = 0; i < s_vectors_a.size(); ++i) {
+                    s_vectors_out[i] = s_vectors_a[i].normalize();
+                }
+            }
+            benchmarkSink(static_cast<uint64_t>(s_vectors_out.back().x * 1000.0f));
+        };
+        runner.add(normalize_scalar);
+
+        BenchmarkCase normalize_batch;
+        normalize_batch.name = "math/normalize_batch";
+        normalize_batch.ops = MATH_BENCH_OPS;
+        normalize_batch.setup = [](std::size_t n) { populateVectors(n / MATH_BENCH_PASSES); };
+        normalize_batch.run = [](std::size_t) {
+            for (std::size_t pass = 0; pass < MATH_BENCH_PASSES; ++pass) {
+                VectorBatch::normalize(s_batch_a.view(), s_batch_out.view(), s_batch_a.size());
+            }
+            benchmarkSink(static_cast<uint64_t>(s_batch_out.get(s_batch_out.size() - 1).x * 1000.0f));
+        };
+        normalize_batch.validate = [](std::string& message) {
+            for (std::size_t i = 0; i < s_vectors_a.size(); ++i) {
+                s_vectors_out[i] = s_vectors_a[i].normalize();
+            }
+            return checkBatchOutput("normalize", message);
+        };
+        runner.add(normalize_batch);
+
+        BenchmarkCase dot_scalar;
+        dot_scalar.name = "math/dot_vector3d";
+        dot_scalar.ops = MATH_BENCH_OPS;
+        dot_scalar.setup = [](std::size_t n) { populateVectors(n / MATH_BENCH_PASSES); };
+        dot_scalar.run = [](std::size_t) {
+            for (std::size_t pass = 0; pass < MATH_BENCH_PASSES; ++pass) {
+                for (std::size_t i = 0; i < s_vectors_a.size(); ++i) {
+                    s_scalars_out[i] = Vector3D::dot(s_vectors_a[i], s_vectors_b[i]);
+                }
+            }
+            benchmarkSink(static_cast<uint64_t>(s_scalars_out.back()));
+        };
+        runner.add(dot_scalar);
+
+        BenchmarkCase dot_batch;
+        dot_batch.name = "math/dot_batch";
+        dot_batch.ops = MATH_BENCH_OPS;
+        dot_batch.setup = [](std::size_t n) { populateVectors(n / MATH_BENCH_PASSES); };
+        dot_batch.run = [](std::size_t) {
+            for (std::size_t pass = 0; pass < MATH_BENCH_PASSES; ++pass) {
+                VectorBatch::dot(s_batch_a.view(), s_batch_b.view(), s_scalars_out.data(), s_batch_a.size());
+            }
+            benchmarkSink(static_cast<uint64_t>(s_scalars_out.back()));
+        };
+        dot_batch.validate = [](std::string& message) {
+            for (std::size_t i = 0; i < s_vectors_a.size(); ++i) {
+                if (!closeEnough(Vector3D::dot(s_vectors_a[i], s_vectors_b[i]), s_scalars_out[i])) {
+                    message = "dot differs from Vector3D at index " + std::to_string(i);
+                    return false;
+                }
+            }
+            return true;
+        };
+        runner.add(dot_batch);
+
+        BenchmarkCase lerp_scalar;
+        lerp_scalar.name = "math/lerp_vector3d";
+        lerp_scalar.ops = MATH_BENCH_OPS;
+        lerp_scalar.setup = [](std::size_t n) { populateVectors(n / MATH_BENCH_PASSES); };
+        lerp_scalar.run = [](std::size_t) {
+            for (std::size_t pass = 0; pass < MATH_BENCH_PASSES; ++pass) {
+                for (std::size_t i = 0; i < s_vectors_a.size(); ++i) {
+                    s_vectors_out[i] = Vector3D::lerp(s_vectors_a[i], s_vectors_b[i], 0.25f);
+                }
+            }
+            benchmarkSink(static_cast<uint64_t>(s_vectors_out.back().x));
+        };
+        runner.add(lerp_scalar);
+
+        BenchmarkCase lerp_batch;
+        lerp_batch.name = "math/lerp_batch";
+        lerp_batch.ops = MATH_BENCH_OPS;
+        lerp_batch.setup = [](std::size_t n) { populateVectors(n / MATH_BENCH_PASSES); };
+        lerp_batch.run = [](std::size_t) {
+            for (std::size_t pass = 0; pass < MATH_BENCH_PASSES; ++pass) {
+                VectorBatch::lerp(s_batch_a.view(), s_batch_b.view(), 0.25f, s_batch_out.view(), s_batch_a.size());
+            }
+            benchmarkSink(static_cast<uint64_t>(s_batch_out.get(s_batch_out.size() - 1).x));
+        };
+        lerp_batch.validate = [](std::string& message) {
+            for (std::size_t i = 0; i < s_vectors_a.size(); ++i) {
+                s_vectors_out[i] = Vector3D::lerp(s_vectors_a[i], s_vectors_b[i], 0.25f);
+            }
+            return checkBatchOutput("lerp", message);
+        };
+        runner.add(lerp_batch);
+
+        BenchmarkCase multiply_glm;
+        multiply_glm.name = "math/matrix_multiply_glm";
+        multiply_glm.ops = MATH_BENCH_MATRICES;
+        multiply_glm.setup = [](std::size_t n) { populateMatrices(n); };
+        multiply_glm.run = [](std::size_t) {
+            for (std::size_t i = 0; i < s_glm_a.size(); ++i) {
+                s_glm_out[i] = s_glm_a[i] * s_glm_b[i];
+            }
+            benchmarkSink(static_cast<uint64_t>(s_glm_out.back()[3][0]));
+        };
+        runner.add(multiply_glm);
+
+        BenchmarkCase multiply_matrix;
+        multiply_matrix.name = "math/matrix_multiply";
+        multiply_matrix.ops = MATH_BENCH_MATRICES;
+        multiply_matrix.setup = [](std::size_t n) { populateMatrices(n); };
+        multiply_matrix.run = [](std::size_t) {
+            TransformBatch::multiplyMatrices(s_matrices_a.data(), s_matrices_b.data(), s_matrices_out.data(), s_matrices_a.size());
+            benchmarkSink(static_cast<uint64_t>(s_matrices_out.back().m[12]));
+        };
+        multiply_matrix.validate = [](std::string& message) {
+            for (std::size_t i = 0; i < s_matrices_out.size(); ++i) {
+                if (!closeEnough(Matrix4(s_glm_a[i] * s_glm_b[i]), s_matrices_out[i])) {
+                    message = "multiplyMatrices differs from glm at index " + std::to_string(i);
+                    return false;
+                }
+            }
+            return checkAgainstGlm(message);
+        };
+        runner.add(multiply_matrix);
+
+        BenchmarkCase compose_transform;
+        compose_transform.name = "math/compose_transform";
+        compose_transform.ops = MATH_BENCH_TRANSFORMS;
+        compose_transform.setup = [](std::size_t n) { populateTransforms(n); };
+        compose_transform.run = [](std::size_t) {
+            TransformBatch::composeMatrices(s_transforms.data(), s_matrices_out.data(), s_transforms.size());
+            benchmarkSink(static_cast<uint64_t>(s_matrices_out.back().m[12]));
+        };
+        runner.add(compose_transform);
+
+        BenchmarkCase compose_batch;
+        compose_batch.name = "math/compose_batch";
+        compose_batch.ops = MATH_BENCH_TRANSFORMS;
+        compose_batch.setup = [](std::size_t n) { populateTransforms(n); };
+        compose_batch.run = [](std::size_t) {
+            ConstQuaternionArray rotations{ s_rotation_x.data(), s_rotation_y.data(), s_rotation_z.data(), s_rotation_w.data() };
+            TransformBatch::composeMatrices(s_transform_positions.view(), rotations, s_transform_scales.view(),
+                s_matrices_out.data(), s_transforms.size());
+            benchmarkSink(static_cast<uint64_t>(s_matrices_out.back().m[12]));
+        };
+        compose_batch.validate = [](std::string& message) {
+            for (std::size_t i = 0; i < s_transforms.size(); ++i) {
+                if (!closeEnough(s_transforms[i].toMatrix(), s_matrices_out[i])) {
+                    message = "composeMatrices differs from Transform::toMatrix at index " + std::to_string(i);
+                    return false;
+                }
+            }
+
+            // Counts that leave a remainder after the SIMD loop
+            for (std::size_t count = 1; count <= 19; count += 3) {
+                populateTransforms(count);
+                ConstQuaternionArray rotations{ s_rotation_x.data(), s_rotation_y.data(), s_rotation_z.data(), s_rotation_w.data() };
+                TransformBatch::composeMatrices(s_transform_positions.view(), rotations, s_transform_scales.view(),
+                    s_matrices_out.data(), count);
+                for (std::size_t i = 0; i < count; ++i) {
+                    if (!closeEnough(s_transforms[i].toMatrix(), s_matrices_out[i])) {
+                        message = "composeMatrices differs at index " + std::to_string(i) + " of " + std::to_string(count);
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+        runner.add(compose_batch);
+
+        BenchmarkCase random_mt19937;
+        random_mt19937.name = "math/random_mt19937";
+        random_mt19937.ops = MATH_BENCH_RANDOMS;
+        random_mt19937.setup = [](std::size_t n) { s_randoms.assign(n, 0.0f); };
+        random_mt19937.run = [](std::size_t) {
+            // What MathUtils::random() did before, a shared engine and a distribution per call
+            static std::mt19937 engine(static_cast<unsigned int>(MATH_BENCH_SEED));
+            for (float& value : s_randoms) {
+                std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+                value = distribution(engine);
+            }
+            benchmarkSink(static_cast<uint64_t>(s_randoms.back() * 1000.0f));
+        };
+        runner.add(random_mt19937);
+
+        BenchmarkCase random_stream;
+        random_stream.name = "math/random_stream";
+        random_stream.ops = MATH_BENCH_RANDOMS;
+        random_stream.setup = [](std::size_t n) { s_randoms.assign(n, 0.0f); };
+        random_stream.run = [](std::size_t) {
+            for (float& value : s_randoms) {
+                value = MathUtils::random();
+            }
+            benchmarkSink(static_cast<uint64_t>(s_randoms.back() * 1000.0f));
+        };
+        runner.add(random_stream);
+
+        BenchmarkCase random_fill;
+        random_fill.name = "math/random_fill";
+        random_fill.ops = MATH_BENCH_RANDOMS;
+        random_fill.setup = [](std::size_t n) { s_randoms.assign(n, 0.0f); };
+        random_fill.run = [](std::size_t) {
+            MathUtils::fillUniform(s_randoms);
+            benchmarkSink(static_cast<uint64_t>(s_randoms.back() * 1000.0f));
+        };
+        random_fill.validate = checkRandomStreams;
+        runner.add(random_fill);
+    }
+
+} // end of namespace gam300
@@ -0,0 +1,327 @@
+/**
+ * @file PhysicsBenchmarks.cpp
+ * @brief Benchmarks for the PhysicsSystem.
+ * @details Times a column of boxes and a pyramid settling on the ground, one
+ *          step per op, and many small piles of mixed shapes falling at once,
+ *          one body step per op. Stacks are checked for staying upright, falling
+ *          asleep and giving the same result bit for bit when run again; piles
+ *          for nothing sinking through the ground, and for collision events that
+ *          agree with each other from step to step.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Benchmark.h"
+#include "../gam_300_engine/Manager/ECSManager.h"
+#include "../gam_300_engine/System/PhysicsSystem.h"
+#include "../gam_300_engine/Utility/MathUtils.h"
+#include "../gam_300_engine/Utility/Random.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace gam300 {
+
+    // Step of every case, the game loop's default rate
+    static const float PHYSICS_BENCH_DT = 1.0f / 60.0f;
+
+    // Seed of the scene layouts, fixed so a rerun builds the same scene
+    static const uint64_t PHYSICS_BENCH_SEED = 1234;
+
+    // Boxes in the column case and along the base of the pyramid case
+    static const int PHYSICS_BENCH_STACK_HEIGHT = 10;
+    static const int PHYSICS_BENCH_PYRAMID_BASE = 10;
+
+    // Steps the stack cases run, 10 seconds
+    static const std::size_t PHYSICS_BENCH_STACK_STEPS = 600;
+
+    // Steps after which a settled stack must be asleep
+    static const std::size_t PHYSICS_BENCH_SLEEP_STEPS = 300;
+
+    // Gap left between boxes so they drop onto each other
+    static const float PHYSICS_BENCH_GAP = 0.01f;
+
+    // Sideways jitter of the boxes as placed
+    static const float PHYSICS_BENCH_JITTER = 0.02f;
+
+    // Furthest the top box may end up from where it would rest
+    static const float PHYSICS_BENCH_TOLERANCE = 0.1f;
+
+    // Bodies of the scaling cases and the steps each is timed over
+    static const std::size_t PHYSICS_BENCH_PILE_BODIES[] = { 1000, 4000 };
+    static const std::size_t PHYSICS_BENCH_PILE_STEPS = 60;
+
+    // Bodies per pile and the distance between piles
+    static const std::size_t PHYSICS_BENCH_PILE_HEIGHT = 4;
+    static const float PHYSICS_BENCH_PILE_SPACING = 3.0f;
+
+    // Steps the collision events are followed for, long enough for the piles to settle and sleep
+    static const std::size_t PHYSICS_BENCH_EVENT_STEPS = 240;
+
+    // System under test and its bodies, in creation order
+    static std::shared_ptr<PhysicsSystem> s_physics_system;
+    static std::vector<EntityID> s_ids;
+    static std::vector<TransformComponent*> s_transforms;
+    static std::size_t s_steps_run = 0;
+
+    // Reset the world with a static ground large enough for size units either side of the origin
+    static void resetPhysicsWorld(float size) {
+        resetBenchmarkWorld();
+        s_physics_system = EM.registerSystem<PhysicsSystem>();
+        s_ids.clear();
+        s_transforms.clear();
+
+        EntityID ground = EM.createEntity().get_id();
+        EM.addComponent<TransformComponent>(ground)->setPosition(Vector3D(0.0f, -0.5f, 0.0f));
+        EM.addComponent<RigidBodyComponent>(ground)->setBodyType(BodyType::STATIC);
+        EM.addComponent<ColliderComponent>(ground)->setBox(Vector3D(size, 0.5f, size));
+    }
+
+    // Add a dynamic body, the shape set by the caller
+    static ColliderComponent* addBody(const Vector3D& position, const Quaternion& rotation) {
+        EntityID id = EM.createEntity().get_id();
+        TransformComponent* transform = EM.addComponent<TransformComponent>(id);
+        transform->setPosition(position);
+        transform->setRotation(rotation);
+        EM.addComponent<RigidBodyComponent>(id);
+        s_ids.push_back(id);
+        s_transforms.push_back(transform);
+        return EM.addComponent<ColliderComponent>(id);
+    }
+
+    // A column of unit boxes
+    static void buildStack() {
+        resetPhysicsWorld(20.0f);
+        RandomStream stream(PHYSICS_BENCH_SEED);
+        for (int i = 0; i < PHYSICS_BENCH_STACK_HEIGHT; ++i) {
+            Vector3D position(stream.nextFloat(-PHYSICS_BENCH_JITTER, PHYSICS_BENCH_JITTER),
+                0.5f + static_cast<float>(i) * (1.0f + PHYSICS_BENCH_GAP),
+                stream.nextFloat(-PHYSICS_BENCH_JITTER, PHYSICS_BENCH_JITTER));
+            addBody(position, Quaternion())->setBox(Vector3D(0.5f, 0.5f, 0.5f));
+        }
+    }
+
+    // A flat pyramid of unit boxes, each resting on two below
+    static void buildPyramid() {
+        resetPhysicsWorld(20.0f);
+        RandomStream stream(PHYSICS_BENCH_SEED);
+        for (int row = 0; row < PHYSICS_BENCH_PYRAMID_BASE; ++row) {
+            int count = PHYSICS_BENCH_PYRAMID_BASE - row;
+            for (int i = 0; i < count; ++i) {
+                Vector3D position((static_cast<float>(i) - 0.5f * static_cast<float>(count - 1)) * (1.0f + PHYSICS_BENCH_GAP) +
+                    stream.nextFloat(-PHYSICS_BENCH_JITTER, PHYSICS_BENCH_JITTER),
+                    0.5f + static_cast<float>(row) * (1.0f + PHYSICS_BENCH_GAP), 0.0f);
+                addBody(position, Quaternion())->setBox(Vector3D(0.5f, 0.5f, 0.5f));
+            }
+        }
+    }
+
+    // Piles of a box, a capsule lying down, a box and a ball on a grid
+    static void buildPiles(std::size_t body_count) {
+        std::size_t pile_count = (body_count + PHYSICS_BENCH_PILE_HEIGHT - 1) / PHYSICS_BENCH_PILE_HEIGHT;
+        std::size_t side = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<float>(pile_count))));
+        float extent = 0.5f * PHYSICS_BENCH_PILE_SPACING * static_cast<float>(side);
+        resetPhysicsWorld(extent + PHYSICS_BENCH_PILE_SPACING);
+
+        RandomStream stream(PHYSICS_BENCH_SEED);
+        const Quaternion lying = Quaternion::fromAxisAngle(Vector3D(0.0f, 0.0f, 1.0f), 0.5f * MathUtils::PI);
+        for (std::size_t i = 0; i < body_count; ++i) {
+            std::size_t pile = i / PHYSICS_BENCH_PILE_HEIGHT;
+            std::size_t level = i % PHYSICS_BENCH_PILE_HEIGHT;
+            Vector3D base(static_cast<float>(pile % side) * PHYSICS_BENCH_PILE_SPACING - extent, 0.0f,
+                static_cast<float>(pile / side) * PHYSICS_BENCH_PILE_SPACING - extent);
+            Vector3D position = base + Vector3D(stream.nextFloat(-PHYSICS_BENCH_JITTER, PHYSICS_BENCH_JITTER),
+                0.6f + 1.1f * static_cast<float>(level), stream.nextFloat(-PHYSICS_BENCH_JITTER, PHYSICS_BENCH_JITTER));
+            switch (level) {
+            case 1:
+                addBody(position, lying)->setCapsule(0.4f, 0.4f);
+                break;
+            case 3:
+                addBody(position, Quaternion())->setSphere(0.5f);
+                break;
+            default:
+                addBody(position, Quaternion())->setBox(Vector3D(0.5f, 0.5f, 0.5f));
+                break;
+            }
+        }
+    }
+
+    // Step the world a number of times
+    static void stepWorld(std::size_t steps) {
+        for (std::size_t i = 0; i < steps; ++i) {
+            s_physics_system->update(PHYSICS_BENCH_DT);
+        }
+        s_steps_run = steps;
+    }
+
+    // FNV-1a over the bits of every body's position and rotation
+    static uint64_t hashBodies() {
+        uint64_t hash = 14695981039346656037ull;
+        for (const TransformComponent* transform : s_transforms) {
+            const Vector3D& p = transform->getPosition();
+            const Quaternion& q = transform->getRotation();
+            const float values[7] = { p.x, p.y, p.z, q.x, q.y, q.z, q.w };
+            for (float value : values) {
+                uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                hash = (hash ^ bits) * 1099511628211ull;
+            }
+        }
+        return hash;
+    }
+
+    // Check nothing went through the ground or blew up
+    static bool checkBodies(std::string& message) {
+        for (std::size_t i = 0; i < s_transforms.size(); ++i) {
+            const Vector3D& p = s_transforms[i]->getPosition();
+            if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z) || p.y < 0.0f) {
+                message = "entity " + std::to_string(s_ids[i]) + " ended up at height " + std::to_string(p.y);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Check every event follows from the previous ones, then remove a box and check its pairs exit
+    static bool checkEvents(std::size_t body_count, std::string& message) {
+        buildPiles(body_count);
+        std::unordered_set<uint64_t> touching;
+        auto follow = [&touching, &message](std::size_t step) {
+            uint64_t last_key = 0;
+            for (const CollisionEvent& event : s_physics_system->get_collision_events()) {
+                const uint64_t key = (static_cast<uint64_t>(event.first) << 32) | event.second;
+                const bool known = touching.count(key) != 0;
+                if (event.first >= event.second || key <= last_key || (event.type == CollisionEventType::ENTER) == known ||
+                    !(event.approach_speed >= 0.0f)) {
+                    message = "step " + std::to_string(step) + ": unexpected event between entities " +
+                        std::to_string(event.first) + " and " + std::to_string(event.second);
+                    return false;
+                }
+                if (event.type == CollisionEventType::ENTER) {
+                    touching.insert(key);
+                }
+                else if (event.type == CollisionEventType::EXIT) {
+                    touching.erase(key);
+                }
+                last_key = key;
+            }
+            return true;
+        };
+        for (std::size_t step = 0; step < PHYSICS_BENCH_EVENT_STEPS; ++step) {
+            s_physics_system->update(PHYSICS_BENCH_DT);
+            if (!follow(step)) {
+                return false;
+            }
+        }
+
+        // Sleeping bodies rest on something, their pairs stay touching without sending STAY events
+        std::unordered_set<EntityID> resting;
+        for (uint64_t key : touching) {
+            resting.insert(static_cast<EntityID>(key >> 32));
+            resting.insert(static_cast<EntityID>(key & UINT32_MAX));
+        }
+        for (EntityID id : s_ids) {
+            if (resting.count(id) == 0 && !CM.get_component<RigidBodyComponent>(id)->isAwake()) {
+                message = "entity " + std::to_string(id) + " sleeps touching nothing after " +
+                    std::to_string(PHYSICS_BENCH_EVENT_STEPS) + " steps";
+                return false;
+            }
+        }
+
+        // Every pair the upper box of the first pile was in has to exit once it is removed
+        const EntityID removed = s_ids[2];
+        EM.destroyEntity(removed);
+        s_physics_system->update(PHYSICS_BENCH_DT);
+        if (!follow(PHYSICS_BENCH_EVENT_STEPS)) {
+            return false;
+        }
+        for (uint64_t key : touching) {
+            if (static_cast<EntityID>(key >> 32) == removed || static_cast<EntityID>(key & UINT32_MAX) == removed) {
+                message = "removed entity " + std::to_string(removed) + " still touches something";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Check the last box rests on top where it was placed, that the stack sleeps, and that a rerun matches
+    static bool checkStack(void (*build)(), float top_height, std::string& message) {
+        if (!checkBodies(message)) {
+            return false;
+        }
+        const Vector3D& top = s_transforms.back()->getPosition();
+        if (std::abs(top.y - top_height) > PHYSICS_BENCH_TOLERANCE || std::abs(top.x) > PHYSICS_BENCH_TOLERANCE ||
+            std::abs(top.z) > PHYSICS_BENCH_TOLERANCE) {
+            message = "top box at (" + std::to_string(top.x) + ", " + std::to_string(top.y) + ", " + std::to_string(top.z) +
+                "), expected it resting at height " + std::to_string(top_height);
+            return false;
+        }
+        if (s_steps_run >= PHYSICS_BENCH_SLEEP_STEPS && s_physics_system->get_awake_count() != 0) {
+            message = std::to_string(s_physics_system->get_awake_count()) + " bodies still awake after " +
+                std::to_string(s_steps_run) + " steps";
+            return false;
+        }
+
+        uint64_t hash = hashBodies();
+        std::size_t steps = s_steps_run;
+        build();
+        stepWorld(steps);
+        if (hashBodies() != hash) {
+            message = "running the same scene again gave a different result";
+            return false;
+        }
+        return true;
+    }
+
+    // Add a case stepping a stack from rest, one op per step
+    static void addStackCase(BenchmarkRunner& runner, const std::string& name, void (*build)(), float top_height) {
+        BenchmarkCase stack;
+        stack.name = name;
+        stack.ops = PHYSICS_BENCH_STACK_STEPS;
+        stack.setup = [build](std::size_t) {
+            build();
+        };
+        stack.run = [](std::size_t n) {
+            stepWorld(n);
+            benchmarkSink(s_physics_system->get_contact_count());
+        };
+        stack.validate = [build, top_height](std::string& message) {
+            return checkStack(build, top_height, message);
+        };
+        runner.add(stack);
+    }
+
+    // Register the physics benchmarks
+    void registerPhysicsBenchmarks(BenchmarkRunner& runner) {
+        addStackCase(runner, "physics/stack_" + std::to_string(PHYSICS_BENCH_STACK_HEIGHT), buildStack,
+            0.5f + static_cast<float>(PHYSICS_BENCH_STACK_HEIGHT - 1));
+        addStackCase(runner, "physics/pyramid_" + std::to_string(PHYSICS_BENCH_PYRAMID_BASE), buildPyramid,
+            0.5f + static_cast<float>(PHYSICS_BENCH_PYRAMID_BASE - 1));
+
+        // Body steps per op, so the time per op shows how the cost of a body grows with the scene
+        for (std::size_t bodies : PHYSICS_BENCH_PILE_BODIES) {
+            BenchmarkCase piles;
+            piles.name = "physics/piles_" + std::to_string(bodies / 1000) + "k";
+            piles.ops = bodies * PHYSICS_BENCH_PILE_STEPS;
+            piles.setup = [bodies](std::size_t) {
+                buildPiles(bodies);
+            };
+            piles.run = [bodies](std::size_t n) {
+                stepWorld(std::max<std::size_t>(n / bodies, 1));
+                benchmarkSink(s_physics_system->get_contact_count());
+            };
+            piles.validate = [bodies](std::string& message) {
+                return checkBodies(message) && checkEvents(bodies, message);
+            };
+            runner.add(piles);
+        }
+    }
+
+} // end of namespace gam300
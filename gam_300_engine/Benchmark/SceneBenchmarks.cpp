@@ -0,0 +1,103 @@
+/**
+ * @file SceneBenchmarks.cpp
+ * @brief Benchmarks for scene serialisation.
+ * @details Saves and loads a generated scene of entities with input mappings
+ *          through the SerialisationManager.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Benchmark.h"
+#include "../gam_300_engine/Manager/ECSManager.h"
+#include "../gam_300_engine/Manager/SerialisationManager.h"
+#include "../gam_300_engine/Component/InputComponent.h"
+#include <filesystem>
+
+namespace gam300 {
+
+    // Number of entities in the generated scene in a full run
+    static const std::size_t SCENE_BENCH_ENTITIES = 1000;
+
+    // Scene file written and read by the benchmarks
+    static std::string getBenchSceneFile() {
+        return (std::filesystem::temp_directory_path() / "gam300_bench_scene.scn").string();
+    }
+
+    // Number of entities created by the last populateScene()
+    static std::size_t s_scene_entities = 0;
+
+    // Reset the world and create entities with the same mappings as the player in Game.scn
+    static void populateScene(std::size_t count) {
+        resetBenchmarkWorld();
+        s_scene_entities = count;
+        for (std::size_t i = 0; i < count; ++i) {
+            Entity& entity = EM.createEntity("entity_" + std::to_string(i));
+            InputComponent* input = EM.addComponent<InputComponent>(entity.get_id());
+            input->mapKeyPress("move_up", GLFW_KEY_W, nullptr);
+            input->mapKeyPress("move_down", GLFW_KEY_S, nullptr);
+            input->mapKeyPress("move_left", GLFW_KEY_A, nullptr);
+            input->mapKeyPress("move_right", GLFW_KEY_D, nullptr);
+            input->mapMousePress("primary_action", GLFW_MOUSE_BUTTON_LEFT, nullptr);
+            input->mapMousePress("secondary_action", GLFW_MOUSE_BUTTON_RIGHT, nullptr);
+        }
+    }
+
+    // Check the world holds 'count' entities that each have all six mappings
+    static bool checkScene(std::size_t count, std::string& message) {
+        const auto& entities = EM.getAllEntities();
+        if (entities.size() != count) {
+            message = "expected " + std::to_string(count) + " entities, found " + std::to_string(entities.size());
+            return false;
+        }
+        for (const Entity& entity : entities) {
+            InputComponent* input = EM.getComponent<InputComponent>(entity.get_id());
+            if (!input || input->getActionMappings().size() != 6) {
+                message = "entity '" + entity.get_name() + "' lost input mappings";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Register the scene benchmarks
+    void registerSceneBenchmarks(BenchmarkRunner& runner) {
+        BenchmarkCase save_scene;
+        save_scene.name = "scene/save";
+        save_scene.ops = SCENE_BENCH_ENTITIES;
+        save_scene.setup = [](std::size_t n) { populateScene(n); };
+        save_scene.run = [](std::size_t) {
+            SEM.saveScene(getBenchSceneFile());
+        };
+        save_scene.validate = [](std::string& message) {
+            // The saved file must load back into the same world
+            resetBenchmarkWorld();
+            if (!SEM.loadScene(getBenchSceneFile())) {
+                message = "saved scene could not be loaded";
+                return false;
+            }
+            return checkScene(s_scene_entities, message);
+        };
+        runner.add(save_scene);
+
+        BenchmarkCase load_scene;
+        load_scene.name = "scene/load";
+        load_scene.ops = SCENE_BENCH_ENTITIES;
+        load_scene.setup = [](std::size_t n) {
+            // Write a scene of the right size, then load it into an empty world
+            populateScene(n);
+            SEM.saveScene(getBenchSceneFile());
+            resetBenchmarkWorld();
+        };
+        load_scene.run = [](std::size_t) {
+            SEM.loadScene(getBenchSceneFile());
+        };
+        load_scene.validate = [](std::string& message) {
+            return checkScene(s_scene_entities, message);
+        };
+        runner.add(load_scene);
+    }
+
+} // end of namespace gam300
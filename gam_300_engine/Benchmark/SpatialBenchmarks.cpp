@@ -0,0 +1,323 @@
+/**
+ * @file SpatialBenchmarks.cpp
+ * @brief Benchmarks for the spatial hash grid.
+ * @details Times moving every entity of a grid of 100k, radius, box and nearest
+ *          neighbour queries against it, and SpatialHashSystem updates after all
+ *          or a few transforms changed. Queries are checked against a scan of every
+ *          entity and system updates against the world positions.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Benchmark.h"
+#include "../gam_300_engine/Manager/ECSManager.h"
+#include "../gam_300_engine/System/SpatialHashSystem.h"
+#include "../gam_300_engine/System/TransformSystem.h"
+#include "../gam_300_engine/Utility/Random.h"
+#include "../gam_300_engine/Utility/SpatialHashGrid.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace gam300 {
+
+    // Entities in the grid of the grid cases
+    static const std::size_t SPATIAL_BENCH_ENTITIES = 100000;
+
+    // Entities of the system cases, kept down by the cost of creating them
+    static const std::size_t SPATIAL_BENCH_SYSTEM_ENTITIES = 20000;
+
+    // Queries per sample in a full run
+    static const std::size_t SPATIAL_BENCH_QUERIES = 1000;
+
+    // Size of the world the entities are spread over, about ten entities per cell
+    static const float SPATIAL_BENCH_WORLD_XY = 256.0f;
+    static const float SPATIAL_BENCH_WORLD_Z = 32.0f;
+
+    // Largest step an entity takes per sample along each axis
+    static const float SPATIAL_BENCH_STEP = 0.5f;
+
+    // Query sizes, the cells are as big as the query radius
+    static const float SPATIAL_BENCH_CELL_SIZE = 6.0f;
+    static const float SPATIAL_BENCH_RADIUS = 6.0f;
+    static const float SPATIAL_BENCH_HALF_EXTENT = 6.0f;
+    static const std::size_t SPATIAL_BENCH_NEAREST = 16;
+
+    // Queries of each sample checked against a scan of every entity
+    static const std::size_t SPATIAL_BENCH_CHECKED_QUERIES = 50;
+
+    // Every Nth entity moves in the few-moved system case
+    static const std::size_t SPATIAL_BENCH_MOVE_INTERVAL = 97;
+
+    // Grid under test and what was put in it
+    static SpatialHashGrid s_grid(SPATIAL_BENCH_CELL_SIZE);
+    static std::vector<EntityID> s_ids;
+    static std::vector<Vector3D> s_positions;
+
+    // Query centers and the results of the last query of each
+    static std::vector<Vector3D> s_centers;
+    static std::vector<std::vector<EntityID>> s_results;
+
+    // Inputs of the benchmarks, a new stream per sample would repeat them
+    static RandomStream s_stream(2024);
+
+    // Systems under test
+    static std::shared_ptr<TransformSystem> s_transform_system;
+    static std::shared_ptr<SpatialHashSystem> s_spatial_system;
+    static std::vector<TransformComponent*> s_transforms;
+    static std::size_t s_expected_updates = 0;
+
+    // Random point in the world
+    static Vector3D randomPoint() {
+        return Vector3D(s_stream.nextFloat(0.0f, SPATIAL_BENCH_WORLD_XY), s_stream.nextFloat(0.0f, SPATIAL_BENCH_WORLD_XY),
+            s_stream.nextFloat(0.0f, SPATIAL_BENCH_WORLD_Z));
+    }
+
+    // Random step of an entity
+    static Vector3D randomStep() {
+        return Vector3D(s_stream.nextFloat(-SPATIAL_BENCH_STEP, SPATIAL_BENCH_STEP),
+            s_stream.nextFloat(-SPATIAL_BENCH_STEP, SPATIAL_BENCH_STEP), s_stream.nextFloat(-SPATIAL_BENCH_STEP, SPATIAL_BENCH_STEP));
+    }
+
+    // Fill the grid with entities spread over the world
+    static void populateGrid(std::size_t count) {
+        s_grid.clear();
+        s_ids.resize(count);
+        s_positions.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            s_ids[i] = static_cast<EntityID>(i + 1);
+            s_positions[i] = randomPoint();
+            s_grid.setPosition(s_ids[i], s_positions[i]);
+        }
+    }
+
+    // Fill the grid and pick query centers
+    static void populateQueries(std::size_t count) {
+        populateGrid(SPATIAL_BENCH_ENTITIES);
+        s_centers.resize(count);
+        s_results.assign(count, std::vector<EntityID>());
+        for (Vector3D& center : s_centers) {
+            center = randomPoint();
+        }
+    }
+
+    // Compare the first few queries' results with the entities a predicate accepts
+    template<typename Accept>
+    static bool checkQueries(std::string& message, const char* query, Accept accept) {
+        for (std::size_t q = 0; q < s_centers.size() && q < SPATIAL_BENCH_CHECKED_QUERIES; ++q) {
+            std::vector<EntityID> expected;
+            for (std::size_t i = 0; i < s_ids.size(); ++i) {
+                if (accept(s_centers[q], s_positions[i])) {
+                    expected.push_back(s_ids[i]);
+                }
+            }
+            std::vector<EntityID> found = s_results[q];
+            std::sort(found.begin(), found.end());
+            if (found != expected) {
+                message = std::string(query) + " " + std::to_string(q) + " found " + std::to_string(found.size()) +
+                    " entities, a scan finds " + std::to_string(expected.size());
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Squared distance between two points
+    static float distanceSquared(const Vector3D& a, const Vector3D& b) {
+        float dx = a.x - b.x;
+        float dy = a.y - b.y;
+        float dz = a.z - b.z;
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    // Reset the world and create entities spread over it, with the grid up to date
+    static void populateSystem(std::size_t count) {
+        resetBenchmarkWorld();
+        s_transform_system = EM.registerSystem<TransformSystem>();
+        s_spatial_system = EM.registerSystem<SpatialHashSystem>();
+        s_spatial_system->set_cell_size(SPATIAL_BENCH_CELL_SIZE);
+
+        s_ids.clear();
+        s_transforms.clear();
+        s_ids.reserve(count);
+        s_transforms.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            EntityID id = EM.createEntity().get_id();
+            TransformComponent* transform = EM.addComponent<TransformComponent>(id);
+            transform->setPosition(randomPoint());
+            s_ids.push_back(id);
+            s_transforms.push_back(transform);
+        }
+
+        // First full copy outside the timed run
+        s_transform_system->update(0.0f);
+        s_spatial_system->update(0.0f);
+    }
+
+    // Move every interval-th entity and compute the new world matrices
+    static void moveSystemEntities(std::size_t interval) {
+        s_expected_updates = 0;
+        for (std::size_t i = interval - 1; i < s_transforms.size(); i += interval) {
+            s_transforms[i]->setPosition(s_transforms[i]->getPosition() + randomStep());
+            s_expected_updates++;
+        }
+        s_transform_system->update(0.0f);
+    }
+
+    // Check every entity's position in the grid against its world position
+    static bool checkSystem(std::string& message) {
+        for (std::size_t i = 0; i < s_transforms.size(); ++i) {
+            Vector3D stored;
+            if (!s_spatial_system->get_grid().getPosition(s_ids[i], stored)) {
+                message = "entity " + std::to_string(s_ids[i]) + " is missing from the grid";
+                return false;
+            }
+            Vector3D world = s_transforms[i]->getWorldPosition();
+            if (stored.x != world.x || stored.y != world.y || stored.z != world.z) {
+                message = "grid position of entity " + std::to_string(s_ids[i]) + " doesn't match its world position";
+                return false;
+            }
+        }
+        if (s_spatial_system->get_updated_count() != s_expected_updates) {
+            message = "copied " + std::to_string(s_spatial_system->get_updated_count()) + " positions, expected " +
+                std::to_string(s_expected_updates);
+            return false;
+        }
+        return true;
+    }
+
+    // Add a system update case that moves every interval-th entity before each sample
+    static void addSystemCase(BenchmarkRunner& runner, const std::string& name, std::size_t interval) {
+        BenchmarkCase update;
+        update.name = name;
+        update.ops = SPATIAL_BENCH_SYSTEM_ENTITIES;
+        update.setup = [interval](std::size_t n) {
+            populateSystem(n);
+            moveSystemEntities(interval);
+        };
+        update.run = [](std::size_t) {
+            s_spatial_system->update(0.0f);
+        };
+        update.validate = checkSystem;
+        runner.add(update);
+    }
+
+    // Register the spatial hash benchmarks
+    void registerSpatialBenchmarks(BenchmarkRunner& runner) {
+        BenchmarkCase update_all;
+        update_all.name = "spatial/grid_update_all";
+        update_all.ops = SPATIAL_BENCH_ENTITIES;
+        update_all.setup = [](std::size_t n) {
+            populateGrid(n);
+            for (Vector3D& position : s_positions) {
+                position += randomStep();
+            }
+        };
+        update_all.run = [](std::size_t) {
+            uint64_t moved_cell = 0;
+            for (std::size_t i = 0; i < s_ids.size(); ++i) {
+                moved_cell += s_grid.setPosition(s_ids[i], s_positions[i]);
+            }
+            benchmarkSink(moved_cell);
+        };
+        update_all.validate = [](std::string& message) {
+            for (std::size_t i = 0; i < s_ids.size(); ++i) {
+                Vector3D stored;
+                if (!s_grid.getPosition(s_ids[i], stored) || distanceSquared(stored, s_positions[i]) != 0.0f) {
+                    message = "entity " + std::to_string(s_ids[i]) + " isn't at its new position";
+                    return false;
+                }
+            }
+            if (s_grid.size() != s_ids.size()) {
+                message = "grid holds " + std::to_string(s_grid.size()) + " entities, expected " + std::to_string(s_ids.size());
+                return false;
+            }
+            return true;
+        };
+        runner.add(update_all);
+
+        BenchmarkCase radius;
+        radius.name = "spatial/query_radius";
+        radius.ops = SPATIAL_BENCH_QUERIES;
+        radius.setup = populateQueries;
+        radius.run = [](std::size_t) {
+            uint64_t found = 0;
+            for (std::size_t q = 0; q < s_centers.size(); ++q) {
+                s_grid.queryRadius(s_centers[q], SPATIAL_BENCH_RADIUS, s_results[q]);
+                found += s_results[q].size();
+            }
+            benchmarkSink(found);
+        };
+        radius.validate = [](std::string& message) {
+            return checkQueries(message, "radius query", [](const Vector3D& center, const Vector3D& position) {
+                return distanceSquared(center, position) <= SPATIAL_BENCH_RADIUS * SPATIAL_BENCH_RADIUS;
+            });
+        };
+        runner.add(radius);
+
+        BenchmarkCase box;
+        box.name = "spatial/query_aabb";
+        box.ops = SPATIAL_BENCH_QUERIES;
+        box.setup = populateQueries;
+        box.run = [](std::size_t) {
+            const Vector3D half(SPATIAL_BENCH_HALF_EXTENT, SPATIAL_BENCH_HALF_EXTENT, SPATIAL_BENCH_HALF_EXTENT);
+            uint64_t found = 0;
+            for (std::size_t q = 0; q < s_centers.size(); ++q) {
+                s_grid.queryAABB(s_centers[q] - half, s_centers[q] + half, s_results[q]);
+                found += s_results[q].size();
+            }
+            benchmarkSink(found);
+        };
+        box.validate = [](std::string& message) {
+            return checkQueries(message, "box query", [](const Vector3D& center, const Vector3D& position) {
+                const Vector3D half(SPATIAL_BENCH_HALF_EXTENT, SPATIAL_BENCH_HALF_EXTENT, SPATIAL_BENCH_HALF_EXTENT);
+                Vector3D min = center - half;
+                Vector3D max = center + half;
+                return position.x >= min.x && position.x <= max.x && position.y >= min.y && position.y <= max.y &&
+                    position.z >= min.z && position.z <= max.z;
+            });
+        };
+        runner.add(box);
+
+        BenchmarkCase nearest;
+        nearest.name = "spatial/query_nearest";
+        nearest.ops = SPATIAL_BENCH_QUERIES;
+        nearest.setup = populateQueries;
+        nearest.run = [](std::size_t) {
+            uint64_t found = 0;
+            for (std::size_t q = 0; q < s_centers.size(); ++q) {
+                s_grid.queryNearest(s_centers[q], SPATIAL_BENCH_NEAREST, s_results[q]);
+                found += s_results[q].empty() ? 0 : s_results[q].back();
+            }
+            benchmarkSink(found);
+        };
+        nearest.validate = [](std::string& message) {
+            // Exactly the closest entities, nearest first, ties to the lower ID
+            for (std::size_t q = 0; q < s_centers.size() && q < SPATIAL_BENCH_CHECKED_QUERIES; ++q) {
+                std::vector<std::pair<float, EntityID>> all;
+                all.reserve(s_ids.size());
+                for (std::size_t i = 0; i < s_ids.size(); ++i) {
+                    all.emplace_back(distanceSquared(s_centers[q], s_positions[i]), s_ids[i]);
+                }
+                std::partial_sort(all.begin(), all.begin() + SPATIAL_BENCH_NEAREST, all.end());
+                for (std::size_t i = 0; i < SPATIAL_BENCH_NEAREST; ++i) {
+                    if (s_results[q].size() != SPATIAL_BENCH_NEAREST || s_results[q][i] != all[i].second) {
+                        message = "nearest query " + std::to_string(q) + " doesn't match a scan of every entity";
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+        runner.add(nearest);
+
+        addSystemCase(runner, "spatial/system_update_all", 1);
+        addSystemCase(runner, "spatial/system_update_few", SPATIAL_BENCH_MOVE_INTERVAL);
+    }
+
+} // end of namespace gam300
@@ -0,0 +1,185 @@
+/**
+ * @file TransformBenchmarks.cpp
+ * @brief Benchmarks for the transform hierarchy.
+ * @details Times TransformSystem updates of a four-way tree of entities with every
+ *          transform changed, a few transforms changed and nothing changed, on one
+ *          thread and split across the JobManager's workers, plus the depth sort
+ *          after a parent changes. Every case checks the world matrices against a
+ *          direct parent-first computation.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Benchmark.h"
+#include "../gam_300_engine/Manager/ECSManager.h"
+#include "../gam_300_engine/System/TransformSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace gam300 {
+
+    // Entities in the hierarchy in a full run, kept down by the cost of creating them
+    static const std::size_t TRANSFORM_BENCH_ENTITIES = 20000;
+
+    // Children per entity, node i's parent is node (i - 1) / TRANSFORM_BENCH_BRANCHING
+    static const std::size_t TRANSFORM_BENCH_BRANCHING = 4;
+
+    // Every Nth entity moves in the few-dirty case
+    static const std::size_t TRANSFORM_BENCH_DIRTY_INTERVAL = 97;
+
+    // Smallest level the parallel cases split across workers
+    static const std::size_t TRANSFORM_BENCH_PARALLEL_THRESHOLD = 1024;
+
+    // Largest difference between a world matrix element and the reference
+    static const float TRANSFORM_BENCH_TOLERANCE = 1e-3f;
+
+    // Entities of the hierarchy, parents before children
+    static std::vector<EntityID> s_entities;
+
+    // Transform component of each entity, looked up once per sample
+    static std::vector<TransformComponent*> s_transforms;
+
+    // Entities moved by the setup of the current sample
+    static std::vector<uint8_t> s_moved;
+
+    // System under test
+    static std::shared_ptr<TransformSystem> s_system;
+
+    // Bumped by every setup so each sample moves the entities somewhere new
+    static std::size_t s_sample = 0;
+
+    // Local transform of entity i in a given sample
+    static Transform benchLocal(std::size_t i, std::size_t sample) {
+        float offset = static_cast<float>(sample % 8) * 0.25f;
+        Vector3D position(static_cast<float>(i % 7) * 0.5f + offset, static_cast<float>(i % 5) * 0.25f, static_cast<float>(i % 3) * 0.75f);
+        Quaternion rotation = Quaternion::fromAxisAngle(Vector3D(0.0f, 1.0f, 0.0f), static_cast<float>(i % 11) * 0.1f + offset);
+        Vector3D scale(1.0f + static_cast<float>(i % 2) * 0.01f, 1.0f, 1.0f);
+        return Transform(position, rotation, scale);
+    }
+
+    // Reset the world and build the tree, with every world matrix up to date
+    static void populateHierarchy(std::size_t count, std::size_t parallel_threshold) {
+        resetBenchmarkWorld();
+        s_system = EM.registerSystem<TransformSystem>();
+        s_system->set_parallel_threshold(parallel_threshold);
+
+        s_entities.clear();
+        s_transforms.clear();
+        s_entities.reserve(count);
+        s_transforms.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            EntityID id = EM.createEntity().get_id();
+            TransformComponent* transform = EM.addComponent<TransformComponent>(id);
+            transform->setLocalTransform(benchLocal(i, s_sample));
+            if (i > 0) {
+                transform->setParent(s_entities[(i - 1) / TRANSFORM_BENCH_BRANCHING]);
+            }
+            s_entities.push_back(id);
+            s_transforms.push_back(transform);
+        }
+
+        // Depth sort and first full update outside the timed run
+        s_system->update(0.0f);
+        s_moved.assign(count, 0);
+    }
+
+    // Move every interval-th entity to its transform for the next sample, starting
+    // at the last of the first interval so the root only moves when all entities do
+    static void moveEntities(std::size_t interval) {
+        s_sample++;
+        for (std::size_t i = interval - 1; i < s_transforms.size(); i += interval) {
+            s_transforms[i]->setLocalTransform(benchLocal(i, s_sample));
+            s_moved[i] = 1;
+        }
+    }
+
+    // Check every world matrix against a parent-first computation, and the number
+    // of recomputed matrices against the entities that moved or sit below one
+    static bool validateHierarchy(std::string& message, bool check_updated_count) {
+        std::vector<Matrix4> reference(s_transforms.size());
+        std::vector<uint8_t> changed(s_transforms.size(), 0);
+        std::size_t expected_updates = 0;
+        for (std::size_t i = 0; i < s_transforms.size(); ++i) {
+            Matrix4 local = s_transforms[i]->getLocalMatrix();
+            if (i == 0) {
+                reference[i] = local;
+                changed[i] = s_moved[i];
+            }
+            else {
+                std::size_t parent = (i - 1) / TRANSFORM_BENCH_BRANCHING;
+                reference[i] = reference[parent] * local;
+                changed[i] = s_moved[i] || changed[parent];
+            }
+            expected_updates += changed[i];
+
+            const Matrix4& world = s_transforms[i]->getWorldMatrix();
+            for (int e = 0; e < 16; ++e) {
+                if (std::fabs(world.m[e] - reference[i].m[e]) > TRANSFORM_BENCH_TOLERANCE) {
+                    message = "world matrix of entity " + std::to_string(i) + " doesn't match its parent times its local matrix";
+                    return false;
+                }
+            }
+        }
+
+        if (check_updated_count && s_system->get_updated_count() != expected_updates) {
+            message = "recomputed " + std::to_string(s_system->get_updated_count()) + " matrices, expected " +
+                std::to_string(expected_updates);
+            return false;
+        }
+        return true;
+    }
+
+    // Add an update case that moves every interval-th entity before each sample
+    static void addUpdateCase(BenchmarkRunner& runner, const std::string& name, std::size_t interval, std::size_t parallel_threshold) {
+        BenchmarkCase update;
+        update.name = name;
+        update.ops = TRANSFORM_BENCH_ENTITIES;
+        update.setup = [interval, parallel_threshold](std::size_t n) {
+            populateHierarchy(n, parallel_threshold);
+            if (interval > 0) {
+                moveEntities(interval);
+            }
+        };
+        update.run = [](std::size_t) {
+            s_system->update(0.0f);
+        };
+        update.validate = [](std::string& message) {
+            return validateHierarchy(message, true);
+        };
+        runner.add(update);
+    }
+
+    // Register the transform benchmarks
+    void registerTransformBenchmarks(BenchmarkRunner& runner) {
+        addUpdateCase(runner, "transform/update_all_dirty", 1, 0);
+        addUpdateCase(runner, "transform/update_all_dirty_parallel", 1, TRANSFORM_BENCH_PARALLEL_THRESHOLD);
+        addUpdateCase(runner, "transform/update_few_dirty", TRANSFORM_BENCH_DIRTY_INTERVAL, 0);
+        addUpdateCase(runner, "transform/update_idle", 0, 0);
+
+        BenchmarkCase reparent;
+        reparent.name = "transform/reparent_update";
+        reparent.ops = TRANSFORM_BENCH_ENTITIES;
+        reparent.setup = [](std::size_t n) { populateHierarchy(n, 0); };
+        reparent.run = [](std::size_t) {
+            // Moves the last entity under the root and back, every entity is re-sorted and recomputed twice
+            TransformComponent* last = s_transforms.back();
+            last->setParent(s_entities[0]);
+            s_system->update(0.0f);
+            last->setParent(s_entities[(s_entities.size() - 2) / TRANSFORM_BENCH_BRANCHING]);
+            s_system->update(0.0f);
+        };
+        reparent.validate = [](std::string& message) {
+            // Every entity is recomputed after a depth sort
+            std::fill(s_moved.begin(), s_moved.end(), uint8_t(1));
+            return validateHierarchy(message, true);
+        };
+        runner.add(reparent);
+    }
+
+} // end of namespace gam300
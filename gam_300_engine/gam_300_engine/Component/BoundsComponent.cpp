@@ -0,0 +1,42 @@
+/**
+ * @file BoundsComponent.cpp
+ * @brief Implementation of the Bounds Component for the Entity Component System.
+ * @details Contains implementations for all member functions declared in BoundsComponent.h.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "../Component/BoundsComponent.h"
+#include "../Manager/LogManager.h"
+
+namespace gam300 {
+
+    // Generation shared by all bounds components
+    uint32_t BoundsComponent::s_change_generation = 0;
+
+    // Constructor
+    BoundsComponent::BoundsComponent() : m_local(Vector3D(-0.5f, -0.5f, -0.5f), Vector3D(0.5f, 0.5f, 0.5f)) {
+        // Nothing to initialize
+    }
+
+    // Initialize the component
+    void BoundsComponent::init(EntityID entity_id) {
+        m_owner_id = entity_id;
+        LM.writeLog(LogLevel::DEBUG, "BoundsComponent::init() - Bounds component initialized for entity %d", entity_id);
+    }
+
+    // Update the component
+    void BoundsComponent::update(float /*dt*/) {
+        // World boxes need the world matrix, so the BroadphaseSystem computes them
+    }
+
+    // Set the local box
+    void BoundsComponent::setLocalBounds(const AABB& bounds) {
+        m_local = bounds;
+        s_change_generation++;
+    }
+
+} // namespace gam300
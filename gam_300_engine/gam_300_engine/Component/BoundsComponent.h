@@ -0,0 +1,78 @@
+/**
+ * @file BoundsComponent.h
+ * @brief Declaration of the Bounds Component for the Entity Component System.
+ * @details Holds the box around an entity in its local space, which the
+ *          BroadphaseSystem transforms by the entity's world matrix.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __BOUNDS_COMPONENT_H__
+#define __BOUNDS_COMPONENT_H__
+
+#include "../Component/Component.h"
+#include "../Utility/AABB.h"
+#include <cstdint>
+
+namespace gam300 {
+
+    /**
+     * @brief Component giving an entity a size for the broadphase.
+     * @details Entities need a TransformComponent as well to be placed in the world.
+     *          The default is a unit cube around the entity's origin.
+     */
+    class BoundsComponent : public Component {
+    private:
+        AABB m_local;                               // Box in the entity's local space
+
+        static uint32_t s_change_generation;        // Bumped whenever any component's box changes
+
+    public:
+        /**
+         * @brief Constructor for BoundsComponent.
+         */
+        BoundsComponent();
+
+        /**
+         * @brief Initialize the component after creation.
+         * @param entity_id The ID of the entity this component is attached to.
+         */
+        void init(EntityID entity_id) override;
+
+        /**
+         * @brief Update the component, the BroadphaseSystem does the work.
+         * @param dt Delta time in seconds.
+         */
+        void update(float dt) override;
+
+        /**
+         * @brief Set the box in local space.
+         * @param bounds The new box.
+         */
+        void setLocalBounds(const AABB& bounds);
+
+        /**
+         * @brief Get the box in local space.
+         * @return The local box.
+         */
+        const AABB& getLocalBounds() const {
+            return m_local;
+        }
+
+        /**
+         * @brief Get the change generation shared by all bounds components.
+         * @details Changes whenever any local box is set, so the BroadphaseSystem
+         *          knows when boxes changed without the entity moving.
+         * @return The current generation.
+         */
+        static uint32_t getChangeGeneration() {
+            return s_change_generation;
+        }
+    };
+
+} // namespace gam300
+
+#endif // __BOUNDS_COMPONENT_H__
@@ -0,0 +1,83 @@
+/**
+ * @file ColliderComponent.cpp
+ * @brief Implementation of the Collider Component for the Entity Component System.
+ * @details Contains implementations for all member functions declared in ColliderComponent.h.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "../Component/ColliderComponent.h"
+#include "../Manager/LogManager.h"
+#include <algorithm>
+
+namespace gam300 {
+
+    namespace {
+        // Smallest size a shape can have
+        constexpr float COLLIDER_MIN_SIZE = 1e-3f;
+    }
+
+    // Generation shared by all collider components
+    uint32_t ColliderComponent::s_change_generation = 0;
+
+    // Constructor
+    ColliderComponent::ColliderComponent() : m_friction(0.5f), m_restitution(0.0f), m_dirty(true) {
+        // The default shape is a unit cube
+    }
+
+    // Initialize the component
+    void ColliderComponent::init(EntityID entity_id) {
+        m_owner_id = entity_id;
+        LM.writeLog(LogLevel::DEBUG, "ColliderComponent::init() - Collider component initialized for entity %d", entity_id);
+    }
+
+    // Update the component
+    void ColliderComponent::update(float /*dt*/) {
+        // Shapes are only read by the PhysicsSystem
+    }
+
+    // Flag the component for the PhysicsSystem
+    void ColliderComponent::markDirty() {
+        m_dirty = true;
+        s_change_generation++;
+    }
+
+    // Make the shape a sphere
+    void ColliderComponent::setSphere(float radius) {
+        m_shape.type = ShapeType::SPHERE;
+        m_shape.radius = std::max(radius, COLLIDER_MIN_SIZE);
+        markDirty();
+    }
+
+    // Make the shape a box
+    void ColliderComponent::setBox(const Vector3D& half_extents) {
+        m_shape.type = ShapeType::BOX;
+        m_shape.half_extents = Vector3D(std::max(half_extents.x, COLLIDER_MIN_SIZE), std::max(half_extents.y, COLLIDER_MIN_SIZE),
+            std::max(half_extents.z, COLLIDER_MIN_SIZE));
+        markDirty();
+    }
+
+    // Make the shape a capsule
+    void ColliderComponent::setCapsule(float radius, float half_height) {
+        m_shape.type = ShapeType::CAPSULE;
+        m_shape.radius = std::max(radius, COLLIDER_MIN_SIZE);
+        m_shape.half_height = std::max(half_height, 0.0f);
+        markDirty();
+    }
+
+    // Set the friction coefficient
+    void ColliderComponent::setFriction(float friction) {
+        m_friction = std::max(friction, 0.0f);
+        markDirty();
+    }
+
+    // Set the restitution
+    void ColliderComponent::setRestitution(float restitution) {
+        m_restitution = std::clamp(restitution, 0.0f, 1.0f);
+        markDirty();
+    }
+
+} // namespace gam300
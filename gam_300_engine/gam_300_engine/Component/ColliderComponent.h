@@ -0,0 +1,127 @@
+/**
+ * @file ColliderComponent.h
+ * @brief Declaration of the Collider Component for the Entity Component System.
+ * @details Holds the collision shape and surface of a rigid body, centered on
+ *          the entity's position and turned by its rotation.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __COLLIDER_COMPONENT_H__
+#define __COLLIDER_COMPONENT_H__
+
+#include "../Component/Component.h"
+#include "../Utility/Collision.h"
+#include <cstdint>
+
+namespace gam300 {
+
+    /**
+     * @brief Component giving a rigid body its shape.
+     * @details The default is a unit cube. The shape isn't scaled by the entity's
+     *          TransformComponent, its sizes are in world units.
+     */
+    class ColliderComponent : public Component {
+    private:
+        CollisionShape m_shape;                     // Shape around the entity's origin
+        float m_friction;                           // Coulomb friction coefficient
+        float m_restitution;                        // Bounciness, 0 for none and 1 for elastic
+        bool m_dirty;                               // Changed since the PhysicsSystem last read it
+
+        static uint32_t s_change_generation;        // Bumped whenever any component is changed
+
+        friend class PhysicsSystem;
+
+        // Flag the component for the PhysicsSystem
+        void markDirty();
+
+    public:
+        /**
+         * @brief Constructor for ColliderComponent.
+         */
+        ColliderComponent();
+
+        /**
+         * @brief Initialize the component after creation.
+         * @param entity_id The ID of the entity this component is attached to.
+         */
+        void init(EntityID entity_id) override;
+
+        /**
+         * @brief Update the component, the PhysicsSystem does the work.
+         * @param dt Delta time in seconds.
+         */
+        void update(float dt) override;
+
+        /**
+         * @brief Make the shape a sphere.
+         * @param radius Radius of the sphere.
+         */
+        void setSphere(float radius);
+
+        /**
+         * @brief Make the shape a box.
+         * @param half_extents Half the size of the box along each local axis.
+         */
+        void setBox(const Vector3D& half_extents);
+
+        /**
+         * @brief Make the shape a capsule along the local Y axis.
+         * @param radius Radius of the capsule.
+         * @param half_height Half the length of the segment between the two caps' centers.
+         */
+        void setCapsule(float radius, float half_height);
+
+        /**
+         * @brief Get the shape.
+         * @return The shape in the entity's local space.
+         */
+        const CollisionShape& getShape() const {
+            return m_shape;
+        }
+
+        /**
+         * @brief Set the friction coefficient.
+         * @details Two touching bodies use the geometric mean of theirs.
+         * @param friction The coefficient, 0 for ice.
+         */
+        void setFriction(float friction);
+
+        /**
+         * @brief Get the friction coefficient.
+         * @return The coefficient.
+         */
+        float getFriction() const {
+            return m_friction;
+        }
+
+        /**
+         * @brief Set the restitution.
+         * @details Two touching bodies use the larger of theirs.
+         * @param restitution 0 for no bounce, 1 for an elastic bounce.
+         */
+        void setRestitution(float restitution);
+
+        /**
+         * @brief Get the restitution.
+         * @return The restitution.
+         */
+        float getRestitution() const {
+            return m_restitution;
+        }
+
+        /**
+         * @brief Get the change generation shared by all collider components.
+         * @return The current generation.
+         */
+        static uint32_t getChangeGeneration() {
+            return s_change_generation;
+        }
+    };
+
+} // namespace gam300
+
+#endif // __COLLIDER_COMPONENT_H__
@@ -13,11 +13,11 @@
 #define __COMPONENT_POOL_H__
 
 #include <vector>
-#include <unordered_map>
 #include <algorithm>
 #include <cassert>
 #include <memory>
 #include "../Utility/ECS_Variables.h"
+#include "../Utility/EntitySparseSet.h"
 
 namespace gam300 {
 
@@ -25,7 +25,8 @@ namespace gam300 {
      * @brief Provides contiguous storage for components of a single type.
      * @details Uses a packed array approach for better cache locality with
      *          O(1) access by entity ID. Components are stored densely to
-     *          allow for efficient iteration.
+     *          allow for efficient iteration, and a sparse set maps entity IDs
+     *          to their index without hashing.
      * @tparam T The component type stored in this pool.
      */
     template<typename T>
@@ -47,18 +48,14 @@ namespace gam300 {
          */
         T* insert(EntityID entity_id, std::unique_ptr<T> component) {
             // If entity already has a component of this type, replace it
-            auto it = m_entity_to_index.find(entity_id);
-            if (it != m_entity_to_index.end()) {
-                // Replace existing component
-                size_t index = it->second;
+            std::size_t index = m_entities.index_of(entity_id);
+            if (index < m_components.size()) {
                 m_components[index] = std::move(component);
                 return m_components[index].get();
             }
 
-            // Add new component
-            size_t new_index = m_components.size();
-            m_entity_to_index[entity_id] = new_index;
-            m_index_to_entity[new_index] = entity_id;
+            // Add new component, the entity lands at the same index in the set
+            m_entities.insert(entity_id);
             m_components.push_back(std::move(component));
             return m_components.back().get();
         }
@@ -69,30 +66,19 @@ namespace gam300 {
          * @return True if component was removed, false if entity had no component.
          */
         bool remove(EntityID entity_id) {
-            auto it = m_entity_to_index.find(entity_id);
-            if (it == m_entity_to_index.end()) {
+            std::size_t index_to_remove = m_entities.index_of(entity_id);
+            if (index_to_remove >= m_components.size()) {
                 return false; // Entity doesn't have this component
             }
 
-            // Get the index of the component to remove
-            size_t index_to_remove = it->second;
-            size_t last_index = m_components.size() - 1;
-
             // If it's not the last element, move the last element to this position
+            // The entity set moves its last entity the same way, keeping both in step
+            std::size_t last_index = m_components.size() - 1;
             if (index_to_remove < last_index) {
-                // Move the last component to the removed position
                 m_components[index_to_remove] = std::move(m_components[last_index]);
-
-                // Update the indices for the moved entity
-                EntityID moved_entity = m_index_to_entity[last_index];
-                m_entity_to_index[moved_entity] = index_to_remove;
-                m_index_to_entity[index_to_remove] = moved_entity;
             }
-
-            // Remove the last element and update maps
             m_components.pop_back();
-            m_entity_to_index.erase(entity_id);
-            m_index_to_entity.erase(last_index);
+            m_entities.erase(entity_id);
 
             return true;
         }
@@ -103,11 +89,8 @@ namespace gam300 {
          * @return Pointer to the component, or nullptr if not found.
          */
         T* get(EntityID entity_id) {
-            auto it = m_entity_to_index.find(entity_id);
-            if (it != m_entity_to_index.end()) {
-                return m_components[it->second].get();
-            }
-            return nullptr;
+            std::size_t index = m_entities.index_of(entity_id);
+            return index < m_components.size() ? m_components[index].get() : nullptr;
         }
 
         /**
@@ -116,7 +99,7 @@ namespace gam300 {
          * @return True if the entity has a component, false otherwise.
          */
         bool has(EntityID entity_id) const {
-            return m_entity_to_index.find(entity_id) != m_entity_to_index.end();
+            return m_entities.contains(entity_id);
         }
 
         /**
@@ -132,8 +115,7 @@ namespace gam300 {
          */
         void clear() {
             m_components.clear();
-            m_entity_to_index.clear();
-            m_index_to_entity.clear();
+            m_entities.clear();
         }
 
         /**
@@ -150,17 +132,30 @@ namespace gam300 {
          * @return The entity ID associated with that component.
          */
         EntityID get_entity_at(size_t index) const {
-            auto it = m_index_to_entity.find(index);
-            if (it != m_index_to_entity.end()) {
-                return it->second;
-            }
-            return INVALID_ENTITY_ID;
+            return index < m_components.size() ? m_entities.dense()[index] : INVALID_ENTITY_ID;
+        }
+
+        /**
+         * @brief Get the index of an entity's component in the dense array.
+         * @param entity_id The entity to look up.
+         * @return The index, or size() if the entity has no component here.
+         */
+        size_t index_of(EntityID entity_id) const {
+            return m_entities.index_of(entity_id);
+        }
+
+        /**
+         * @brief Get the component at a dense index, without checking the index.
+         * @param index Index below size().
+         * @return The component.
+         */
+        T* get_at(size_t index) const {
+            return m_components[index].get();
         }
 
     private:
         std::vector<std::unique_ptr<T>> m_components;              ///< Dense array of components
-        std::unordered_map<EntityID, size_t> m_entity_to_index;    ///< Maps entity IDs to component indices
-        std::unordered_map<size_t, EntityID> m_index_to_entity;    ///< Maps component indices to entity IDs
+        EntitySparseSet m_entities;                                ///< Owner of each component, at the same index
     };
 
 } // namespace gam300
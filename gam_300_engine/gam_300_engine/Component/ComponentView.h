@@ -91,8 +91,11 @@ namespace gam300 {
         template<typename First, typename... Rest>
         void find_entities_with_components() {
             ComponentTypeID type_id = get_component_type_id<First>();
-            auto component_array = std::static_pointer_cast<ComponentArray<First>>(
-                CM.m_component_arrays[type_id]);
+            auto it = CM.m_component_arrays.find(type_id);
+            if (it == CM.m_component_arrays.end()) {
+                return; // No component of this type was ever added
+            }
+            auto component_array = std::static_pointer_cast<ComponentArray<First>>(it->second);
 
             // Get entities for the first component type
             for (size_t i = 0; i < component_array->size(); ++i) {
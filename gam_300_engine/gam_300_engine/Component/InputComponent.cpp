@@ -15,15 +15,18 @@
 
 namespace gam300 {
 
+    // Mapping generation shared by all input components
+    uint32_t InputComponent::s_binding_generation = 0;
+
     // Constructor
-    InputComponent::InputComponent() : m_is_active(true) {
+    InputComponent::InputComponent() : m_is_active(true), m_context_callback(nullptr), m_context_user_data(nullptr) {
         // Nothing to initialize
     }
 
     // Initialize the component
     void InputComponent::init(EntityID entity_id) {
         m_owner_id = entity_id;
-        LM.writeLog("InputComponent::init() - Input component initialized for entity %d", entity_id);
+        LM.writeLog(LogLevel::DEBUG, "InputComponent::init() - Input component initialized for entity %d", entity_id);
     }
 
     // Update the component
@@ -32,142 +35,161 @@ namespace gam300 {
         if (!m_is_active) return;
 
         // Process all registered actions
-        for (const auto& action_pair : m_actions) {
-            const InputAction& action = action_pair.second;
+        for (const InputAction& action : m_actions) {
+            if (!action.callback) continue;
+
+            // Keyboard keys sit below the offset, mouse buttons above it
+            bool is_key = action.input_key < MOUSE_BUTTON_INPUT_OFFSET;
+            int button = action.input_key - MOUSE_BUTTON_INPUT_OFFSET;
+            bool fired = false;
 
             // Handle different action types
             switch (action.type) {
             case InputActionType::PRESS:
-                // For key press actions, check if the key was just pressed
-                if (action.input_key < GLFW_MOUSE_BUTTON_1) {
-                    // It's a keyboard key
-                    if (IM.isKeyJustPressed(action.input_key) && action.callback) {
-                        action.callback();
-                    }
-                }
-                else {
-                    // It's a mouse button
-                    if (IM.isMouseButtonJustPressed(action.input_key - GLFW_MOUSE_BUTTON_1) && action.callback) {
-                        action.callback();
-                    }
-                }
+                // For press actions, check if the key/button was just pressed
+                fired = is_key ? IM.isKeyJustPressed(action.input_key) : IM.isMouseButtonJustPressed(button);
                 break;
 
             case InputActionType::RELEASE:
-                // For key release actions, check if the key was just released
-                if (action.input_key < GLFW_MOUSE_BUTTON_1) {
-                    // It's a keyboard key
-                    if (IM.isKeyJustReleased(action.input_key) && action.callback) {
-                        action.callback();
-                    }
-                }
-                else {
-                    // It's a mouse button
-                    if (IM.isMouseButtonJustReleased(action.input_key - GLFW_MOUSE_BUTTON_1) && action.callback) {
-                        action.callback();
-                    }
-                }
+                // For release actions, check if the key/button was just released
+                fired = is_key ? IM.isKeyJustReleased(action.input_key) : IM.isMouseButtonJustReleased(button);
                 break;
 
             case InputActionType::REPEAT:
-                // For key repeat actions, check if the key is pressed
-                if (action.input_key < GLFW_MOUSE_BUTTON_1) {
-                    // It's a keyboard key
-                    if (IM.isKeyPressed(action.input_key) && action.callback) {
-                        action.callback();
-                    }
-                }
-                else {
-                    // It's a mouse button
-                    if (IM.isMouseButtonPressed(action.input_key - GLFW_MOUSE_BUTTON_1) && action.callback) {
-                        action.callback();
-                    }
-                }
+                // For repeat actions, check if the key/button is held
+                fired = is_key ? IM.isKeyPressed(action.input_key) : IM.isMouseButtonPressed(button);
                 break;
 
             case InputActionType::AXIS:
-                // For axis actions, we handle these separately
-                // No direct implementation here as they require special handling
+                // Mouse movement is read from the shared axes, not mapped per entity
                 break;
             }
+
+            if (fired) {
+                action.callback(action.user_data, m_owner_id, action.id);
+            }
         }
     }
 
-    // Map a key press action
-    void InputComponent::mapKeyPress(const std::string& name, int key, std::function<void(void)> callback) {
+    // Find the mapping of an action
+    const InputAction* InputComponent::findAction(ActionID action) const {
+        for (const InputAction& mapped : m_actions) {
+            if (mapped.id == action) {
+                return &mapped;
+            }
+        }
+        return nullptr;
+    }
+
+    // Add or replace the mapping of an action
+    void InputComponent::mapAction(const std::string& name, int input_key, InputActionType type, InputCallback callback, void* user_data) {
         InputAction action;
-        action.name = name;
-        action.input_key = key;
-        action.type = InputActionType::PRESS;
+        action.id = IM.internAction(name);
+        action.input_key = input_key;
+        action.type = type;
         action.callback = callback;
+        action.user_data = user_data;
+
+        // Mapping a name again replaces the previous mapping, as the name is the action's identity
+        s_binding_generation++;
+        for (InputAction& mapped : m_actions) {
+            if (mapped.id == action.id) {
+                mapped = action;
+                return;
+            }
+        }
+        m_actions.push_back(action);
+    }
 
-        m_actions[name] = action;
+    // Map a key press action
+    void InputComponent::mapKeyPress(const std::string& name, int key, InputCallback callback, void* user_data) {
+        mapAction(name, key, InputActionType::PRESS, callback, user_data);
     }
 
     // Map a key release action
-    void InputComponent::mapKeyRelease(const std::string& name, int key, std::function<void(void)> callback) {
-        InputAction action;
-        action.name = name;
-        action.input_key = key;
-        action.type = InputActionType::RELEASE;
-        action.callback = callback;
-
-        m_actions[name] = action;
+    void InputComponent::mapKeyRelease(const std::string& name, int key, InputCallback callback, void* user_data) {
+        mapAction(name, key, InputActionType::RELEASE, callback, user_data);
     }
 
     // Map a key repeat action
-    void InputComponent::mapKeyRepeat(const std::string& name, int key, std::function<void(void)> callback) {
-        InputAction action;
-        action.name = name;
-        action.input_key = key;
-        action.type = InputActionType::REPEAT;
-        action.callback = callback;
-
-        m_actions[name] = action;
+    void InputComponent::mapKeyRepeat(const std::string& name, int key, InputCallback callback, void* user_data) {
+        mapAction(name, key, InputActionType::REPEAT, callback, user_data);
     }
 
     // Map a mouse button press action
-    void InputComponent::mapMousePress(const std::string& name, int button, std::function<void(void)> callback) {
-        InputAction action;
-        action.name = name;
-        action.input_key = GLFW_MOUSE_BUTTON_1 + button; // Offset to distinguish from keyboard keys
-        action.type = InputActionType::PRESS;
-        action.callback = callback;
-
-        m_actions[name] = action;
+    void InputComponent::mapMousePress(const std::string& name, int button, InputCallback callback, void* user_data) {
+        // Offset to distinguish from keyboard keys
+        mapAction(name, MOUSE_BUTTON_INPUT_OFFSET + button, InputActionType::PRESS, callback, user_data);
     }
 
     // Map a mouse button release action
-    void InputComponent::mapMouseRelease(const std::string& name, int button, std::function<void(void)> callback) {
-        InputAction action;
-        action.name = name;
-        action.input_key = GLFW_MOUSE_BUTTON_1 + button; // Offset to distinguish from keyboard keys
-        action.type = InputActionType::RELEASE;
-        action.callback = callback;
+    void InputComponent::mapMouseRelease(const std::string& name, int button, InputCallback callback, void* user_data) {
+        // Offset to distinguish from keyboard keys
+        mapAction(name, MOUSE_BUTTON_INPUT_OFFSET + button, InputActionType::RELEASE, callback, user_data);
+    }
+
+    // Remove an action mapping by name
+    void InputComponent::unmapAction(const std::string& name) {
+        ActionID action = IM.findAction(name);
+        if (action != INVALID_ACTION_ID) {
+            unmapAction(action);
+        }
+    }
 
-        m_actions[name] = action;
+    // Remove an action mapping by ID
+    void InputComponent::unmapAction(ActionID action) {
+        for (auto it = m_actions.begin(); it != m_actions.end(); ++it) {
+            if (it->id == action) {
+                m_actions.erase(it);
+                s_binding_generation++;
+                return;
+            }
+        }
     }
 
-    // Map mouse movement
-    void InputComponent::mapMouseMovement(const std::string& name, std::function<void(float, float)> callback) {
-        // Mark parameters as unused to avoid compiler warnings
-        (void)name;      // Explicitly tell compiler that this parameter is intentionally unused
-        (void)callback;  // Also mark callback as unused since it's not being used yet
+    // Listen to a shared input context
+    bool InputComponent::addContext(ContextID context) {
+        if (!IM.getContext(context)) {
+            return false;
+        }
 
-        // For mouse movement, we use a special axis handler
-        // This would be implemented differently in a complete system
-        // For now, we just log that this functionality isn't fully implemented
-        LM.writeLog("InputComponent::mapMouseMovement() - Mouse movement mapping not fully implemented yet");
+        for (ContextID existing : m_contexts) {
+            if (existing == context) {
+                return true;
+            }
+        }
+        m_contexts.push_back(context);
+        s_binding_generation++;
+        return true;
     }
 
-    // Remove an action mapping
-    void InputComponent::unmapAction(const std::string& name) {
-        auto it = m_actions.find(name);
-        if (it != m_actions.end()) {
-            m_actions.erase(it);
+    // Listen to a shared input context by name
+    bool InputComponent::addContext(const std::string& name) {
+        ContextID context = IM.findContext(name);
+        if (context == INVALID_CONTEXT_ID) {
+            LM.writeLog(LogLevel::WARNING, "InputComponent::addContext() - No input context named '%s'", name.c_str());
+            return false;
+        }
+        return addContext(context);
+    }
+
+    // Stop listening to a shared input context
+    void InputComponent::removeContext(ContextID context) {
+        for (auto it = m_contexts.begin(); it != m_contexts.end(); ++it) {
+            if (*it == context) {
+                m_contexts.erase(it);
+                s_binding_generation++;
+                return;
+            }
         }
     }
 
+    // Set the function called for context actions
+    void InputComponent::setContextCallback(InputCallback callback, void* user_data) {
+        m_context_callback = callback;
+        m_context_user_data = user_data;
+    }
+
     // Set active state
     void InputComponent::setActive(bool active) {
         m_is_active = active;
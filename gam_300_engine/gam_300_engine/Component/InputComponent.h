@@ -13,28 +13,32 @@
 #define __INPUT_COMPONENT_H__
 
 #include "../Component/Component.h"
+#include "../Manager/InputManager.h"
 #include <GLFW/glfw3.h>
-#include <functional>
-#include <unordered_map>
+#include <vector>
 #include <string>
+#include <cstdint>
 
 namespace gam300 {
 
-    // Input action types
-    enum class InputActionType {
-        PRESS,          // Triggered when key/button is pressed
-        RELEASE,        // Triggered when key/button is released
-        REPEAT,         // Triggered continuously while key/button is held
-        AXIS            // Triggered for axis-based input (mouse movement, etc.)
-    };
+    /**
+     * @brief Function called when a mapped action fires.
+     * @details A plain function pointer plus the user data given when the action was
+     *          mapped, so mapping an action never allocates. Captureless lambdas convert
+     *          to this type implicitly.
+     * @param user_data The pointer given when the action was mapped.
+     * @param entity_id The entity whose action fired.
+     * @param action The interned ID of the action that fired.
+     */
+    using InputCallback = void (*)(void* user_data, EntityID entity_id, ActionID action);
 
     // Input action mapping
     struct InputAction {
-        std::string name;                       // Unique name for this action
-        int input_key;                          // GLFW key/button code
+        ActionID id;                            // Interned action name, see IM.getActionName()
+        int input_key;                          // GLFW key code, or mouse button + MOUSE_BUTTON_INPUT_OFFSET
         InputActionType type;                   // Type of action
-        std::function<void(void)> callback;     // Function to call for PRESS/RELEASE/REPEAT
-        std::function<void(float)> axis_callback; // Function to call for AXIS inputs with value
+        InputCallback callback;                 // Function to call for PRESS/RELEASE/REPEAT, may be null
+        void* user_data;                        // Passed back to the callback
     };
 
     /**
@@ -43,8 +47,13 @@ namespace gam300 {
      */
     class InputComponent : public Component {
     private:
-        std::unordered_map<std::string, InputAction> m_actions;  // Input action mappings
+        std::vector<InputAction> m_actions;                      // Input action mappings, one per action ID
         bool m_is_active;                                        // Whether this component processes input
+        std::vector<ContextID> m_contexts;                       // Shared input contexts this entity listens to
+        InputCallback m_context_callback;                        // Called for every context action that fires
+        void* m_context_user_data;                               // Passed back to the context callback
+
+        static uint32_t s_binding_generation;                    // Bumped whenever any component's mappings change
 
     public:
         /**
@@ -52,13 +61,31 @@ namespace gam300 {
          */
         InputComponent();
 
-         /**
-         * @brief Get a copy of all the action mappings for serialization
+        /**
+         * @brief Get all the action mappings, used for serialization and dispatch.
+         * @return The mappings in the order they were first mapped.
          */
-        const std::unordered_map<std::string, InputAction>& getActionMappings() const {
+        const std::vector<InputAction>& getActionMappings() const {
             return m_actions;
         }
 
+        /**
+         * @brief Find the mapping of an action.
+         * @param action The interned action ID.
+         * @return The mapping, or nullptr if the action isn't mapped.
+         */
+        const InputAction* findAction(ActionID action) const;
+
+        /**
+         * @brief Get the mapping generation shared by all input components.
+         * @details Changes whenever an action is mapped or unmapped on any component,
+         *          so the InputSystem knows when its binding index is stale.
+         * @return The current generation.
+         */
+        static uint32_t getBindingGeneration() {
+            return s_binding_generation;
+        }
+
         /**
          * @brief Initialize the component after creation.
          * @param entity_id The ID of the entity this component is attached to.
@@ -66,7 +93,9 @@ namespace gam300 {
         void init(EntityID entity_id) override;
 
         /**
-         * @brief Update the component state.
+         * @brief Poll every mapping against the InputManager and fire the matching callbacks.
+         * @details The InputSystem dispatches from its per-key binding index instead;
+         *          this is kept for components used outside the ECS.
          * @param dt Delta time in seconds.
          */
         void update(float dt) override;
@@ -75,54 +104,111 @@ namespace gam300 {
          * @brief Map a key press action to a callback function.
          * @param name Unique identifier for this action.
          * @param key GLFW key code.
-         * @param callback Function to call when the key is pressed.
+         * @param callback Function to call when the key is pressed, may be null.
+         * @param user_data Passed back to the callback.
          */
-        void mapKeyPress(const std::string& name, int key, std::function<void(void)> callback);
+        void mapKeyPress(const std::string& name, int key, InputCallback callback, void* user_data = nullptr);
 
         /**
          * @brief Map a key release action to a callback function.
          * @param name Unique identifier for this action.
          * @param key GLFW key code.
-         * @param callback Function to call when the key is released.
+         * @param callback Function to call when the key is released, may be null.
+         * @param user_data Passed back to the callback.
          */
-        void mapKeyRelease(const std::string& name, int key, std::function<void(void)> callback);
+        void mapKeyRelease(const std::string& name, int key, InputCallback callback, void* user_data = nullptr);
 
         /**
          * @brief Map a key repeat action to a callback function.
          * @param name Unique identifier for this action.
          * @param key GLFW key code.
-         * @param callback Function to call while the key is held down.
+         * @param callback Function to call while the key is held down, may be null.
+         * @param user_data Passed back to the callback.
          */
-        void mapKeyRepeat(const std::string& name, int key, std::function<void(void)> callback);
+        void mapKeyRepeat(const std::string& name, int key, InputCallback callback, void* user_data = nullptr);
 
         /**
          * @brief Map a mouse button press action to a callback function.
          * @param name Unique identifier for this action.
          * @param button GLFW mouse button code.
-         * @param callback Function to call when the button is pressed.
+         * @param callback Function to call when the button is pressed, may be null.
+         * @param user_data Passed back to the callback.
          */
-        void mapMousePress(const std::string& name, int button, std::function<void(void)> callback);
+        void mapMousePress(const std::string& name, int button, InputCallback callback, void* user_data = nullptr);
 
         /**
          * @brief Map a mouse button release action to a callback function.
          * @param name Unique identifier for this action.
          * @param button GLFW mouse button code.
-         * @param callback Function to call when the button is released.
+         * @param callback Function to call when the button is released, may be null.
+         * @param user_data Passed back to the callback.
          */
-        void mapMouseRelease(const std::string& name, int button, std::function<void(void)> callback);
+        void mapMouseRelease(const std::string& name, int button, InputCallback callback, void* user_data = nullptr);
 
         /**
-         * @brief Map mouse movement to a callback function.
-         * @param name Unique identifier for this action.
-         * @param callback Function to call with the mouse delta.
+         * @brief Remove an action mapping.
+         * @param name The name of the action to remove.
          */
-        void mapMouseMovement(const std::string& name, std::function<void(float, float)> callback);
+        void unmapAction(const std::string& name);
 
         /**
          * @brief Remove an action mapping.
-         * @param name The name of the action to remove.
+         * @param action The interned ID of the action to remove.
          */
-        void unmapAction(const std::string& name);
+        void unmapAction(ActionID action);
+
+        /**
+         * @brief Listen to a shared input context.
+         * @details The context's bindings are evaluated once per frame by the InputManager
+         *          no matter how many entities reference it.
+         * @param context The context ID.
+         * @return False if the context doesn't exist.
+         */
+        bool addContext(ContextID context);
+
+        /**
+         * @brief Listen to a shared input context by name.
+         * @param name The context name.
+         * @return False if no context has that name.
+         */
+        bool addContext(const std::string& name);
+
+        /**
+         * @brief Stop listening to a shared input context.
+         * @param context The context ID.
+         */
+        void removeContext(ContextID context);
+
+        /**
+         * @brief Get the contexts this entity listens to.
+         * @return The context IDs.
+         */
+        const std::vector<ContextID>& getContexts() const {
+            return m_contexts;
+        }
+
+        /**
+         * @brief Set the function called when an action of one of the entity's contexts fires.
+         * @param callback Function to call, may be null to only queue the action events.
+         * @param user_data Passed back to the callback.
+         */
+        void setContextCallback(InputCallback callback, void* user_data = nullptr);
+
+        /**
+         * @brief Get the function called for context actions.
+         * @return The callback, may be null.
+         */
+        InputCallback getContextCallback() const {
+            return m_context_callback;
+        }
+
+        /**
+         * @brief Get the user data passed to the context callback.
+         * @return The user data.
+         */
+        void* getContextUserData() const {
+            return m_context_user_data;
+        }
 
         /**
          * @brief Set whether this component is active.
@@ -135,6 +221,17 @@ namespace gam300 {
          * @return True if active, false otherwise.
          */
         bool isActive() const;
+
+    private:
+        /**
+         * @brief Add or replace the mapping of an action.
+         * @param name The action name, interned by the InputManager.
+         * @param input_key GLFW key code, or mouse button + MOUSE_BUTTON_INPUT_OFFSET.
+         * @param type Type of action.
+         * @param callback Function to call when the action fires, may be null.
+         * @param user_data Passed back to the callback.
+         */
+        void mapAction(const std::string& name, int input_key, InputActionType type, InputCallback callback, void* user_data);
     };
 
 } // namespace gam300
@@ -0,0 +1,144 @@
+/**
+ * @file RigidBodyComponent.cpp
+ * @brief Implementation of the Rigid Body Component for the Entity Component System.
+ * @details Contains implementations for all member functions declared in RigidBodyComponent.h.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "../Component/RigidBodyComponent.h"
+#include "../Manager/LogManager.h"
+#include <algorithm>
+
+namespace gam300 {
+
+    namespace {
+        // Smallest mass a dynamic body can have
+        constexpr float RIGID_BODY_MIN_MASS = 1e-4f;
+    }
+
+    // Generation shared by all rigid body components
+    uint32_t RigidBodyComponent::s_change_generation = 0;
+
+    // Constructor
+    RigidBodyComponent::RigidBodyComponent() : m_type(BodyType::DYNAMIC), m_mass(1.0f), m_linear_damping(0.0f),
+        m_angular_damping(0.05f), m_gravity_scale(1.0f), m_awake(true), m_allow_sleep(true), m_dirty(true) {
+        // Velocities, force and torque start at zero
+    }
+
+    // Initialize the component
+    void RigidBodyComponent::init(EntityID entity_id) {
+        m_owner_id = entity_id;
+        LM.writeLog(LogLevel::DEBUG, "RigidBodyComponent::init() - Rigid body component initialized for entity %d", entity_id);
+    }
+
+    // Update the component
+    void RigidBodyComponent::update(float /*dt*/) {
+        // Bodies are stepped together by the PhysicsSystem
+    }
+
+    // Flag the component for the PhysicsSystem
+    void RigidBodyComponent::markDirty(bool wake) {
+        if (wake) {
+            m_awake = true;
+        }
+        m_dirty = true;
+        s_change_generation++;
+    }
+
+    // Set the body type
+    void RigidBodyComponent::setBodyType(BodyType type) {
+        m_type = type;
+        if (type == BodyType::STATIC) {
+            m_linear_velocity = Vector3D();
+            m_angular_velocity = Vector3D();
+        }
+        markDirty(true);
+    }
+
+    // Set the mass
+    void RigidBodyComponent::setMass(float mass) {
+        m_mass = std::max(mass, RIGID_BODY_MIN_MASS);
+        markDirty(true);
+    }
+
+    // Set the damping
+    void RigidBodyComponent::setDamping(float linear, float angular) {
+        m_linear_damping = std::max(linear, 0.0f);
+        m_angular_damping = std::max(angular, 0.0f);
+        markDirty(false);
+    }
+
+    // Set the gravity scale
+    void RigidBodyComponent::setGravityScale(float scale) {
+        m_gravity_scale = scale;
+        markDirty(true);
+    }
+
+    // Set the linear velocity
+    void RigidBodyComponent::setLinearVelocity(const Vector3D& velocity) {
+        if (m_type == BodyType::STATIC) {
+            return;
+        }
+        m_linear_velocity = velocity;
+        markDirty(velocity.magnitudeSquared() > 0.0f);
+    }
+
+    // Set the angular velocity
+    void RigidBodyComponent::setAngularVelocity(const Vector3D& velocity) {
+        if (m_type == BodyType::STATIC) {
+            return;
+        }
+        m_angular_velocity = velocity;
+        markDirty(velocity.magnitudeSquared() > 0.0f);
+    }
+
+    // Add a force for the next step
+    void RigidBodyComponent::addForce(const Vector3D& force) {
+        if (m_type != BodyType::DYNAMIC) {
+            return;
+        }
+        m_force += force;
+        markDirty(true);
+    }
+
+    // Add a torque for the next step
+    void RigidBodyComponent::addTorque(const Vector3D& torque) {
+        if (m_type != BodyType::DYNAMIC) {
+            return;
+        }
+        m_torque += torque;
+        markDirty(true);
+    }
+
+    // Change the velocity at once
+    void RigidBodyComponent::applyLinearImpulse(const Vector3D& impulse) {
+        if (m_type != BodyType::DYNAMIC) {
+            return;
+        }
+        m_linear_velocity += impulse / m_mass;
+        markDirty(true);
+    }
+
+    // Wake the body or put it to sleep
+    void RigidBodyComponent::setAwake(bool awake) {
+        m_awake = awake;
+        if (!awake) {
+            m_linear_velocity = Vector3D();
+            m_angular_velocity = Vector3D();
+            m_force = Vector3D();
+            m_torque = Vector3D();
+        }
+        markDirty(false);
+    }
+
+    // Allow or forbid sleeping
+    void RigidBodyComponent::setAllowSleep(bool allow) {
+        m_allow_sleep = allow;
+        markDirty(!allow);
+    }
+
+} // namespace gam300
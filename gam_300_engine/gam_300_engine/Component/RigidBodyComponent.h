@@ -0,0 +1,230 @@
+/**
+ * @file RigidBodyComponent.h
+ * @brief Declaration of the Rigid Body Component for the Entity Component System.
+ * @details Holds the mass, damping and motion of an entity the PhysicsSystem
+ *          simulates. Needs a TransformComponent and a ColliderComponent as well.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __RIGID_BODY_COMPONENT_H__
+#define __RIGID_BODY_COMPONENT_H__
+
+#include "../Component/Component.h"
+#include "../Utility/Vector3D.h"
+#include <cstdint>
+
+namespace gam300 {
+
+    // How the PhysicsSystem moves a body
+    enum class BodyType : uint8_t {
+        STATIC,         // Never moves, infinite mass
+        KINEMATIC,      // Moves by its velocity only, pushes dynamic bodies but isn't pushed back
+        DYNAMIC         // Moved by gravity, forces and contacts
+    };
+
+    /**
+     * @brief Component making an entity a rigid body.
+     * @details The PhysicsSystem keeps its own copy of every body and writes the
+     *          velocities and awake state back here after each step, along with the
+     *          position and rotation on the TransformComponent. Setters that change the
+     *          motion wake the body. Forces and torques added between updates are
+     *          applied for one step and then cleared.
+     */
+    class RigidBodyComponent : public Component {
+    private:
+        BodyType m_type;                            // How the body moves
+        float m_mass;                               // Mass of a dynamic body
+        float m_linear_damping;                     // Fraction of linear velocity lost per second, roughly
+        float m_angular_damping;                    // Fraction of angular velocity lost per second, roughly
+        float m_gravity_scale;                      // Multiplier on the world gravity
+        Vector3D m_linear_velocity;                 // World space, units per second
+        Vector3D m_angular_velocity;                // World space, radians per second
+        Vector3D m_force;                           // Force to apply during the next step
+        Vector3D m_torque;                          // Torque to apply during the next step
+        bool m_awake;                               // Whether the body is being simulated
+        bool m_allow_sleep;                         // Whether the body may fall asleep when it comes to rest
+        bool m_dirty;                               // Changed since the PhysicsSystem last read it
+
+        static uint32_t s_change_generation;        // Bumped whenever any component is changed
+
+        friend class PhysicsSystem;
+
+        // Flag the component for the PhysicsSystem, waking it if wake is set
+        void markDirty(bool wake);
+
+    public:
+        /**
+         * @brief Constructor for RigidBodyComponent.
+         */
+        RigidBodyComponent();
+
+        /**
+         * @brief Initialize the component after creation.
+         * @param entity_id The ID of the entity this component is attached to.
+         */
+        void init(EntityID entity_id) override;
+
+        /**
+         * @brief Update the component, the PhysicsSystem does the work.
+         * @param dt Delta time in seconds.
+         */
+        void update(float dt) override;
+
+        /**
+         * @brief Set how the body moves.
+         * @param type The body type, a static body loses its velocity.
+         */
+        void setBodyType(BodyType type);
+
+        /**
+         * @brief Get how the body moves.
+         * @return The body type.
+         */
+        BodyType getBodyType() const {
+            return m_type;
+        }
+
+        /**
+         * @brief Set the mass of a dynamic body.
+         * @details The rotational inertia follows from the mass and the collider's shape.
+         * @param mass The mass, clamped to a small positive value.
+         */
+        void setMass(float mass);
+
+        /**
+         * @brief Get the mass.
+         * @return The mass used when the body is dynamic.
+         */
+        float getMass() const {
+            return m_mass;
+        }
+
+        /**
+         * @brief Set how quickly the body's motion dies away on its own.
+         * @param linear Linear damping, 0 for none.
+         * @param angular Angular damping, 0 for none.
+         */
+        void setDamping(float linear, float angular);
+
+        /**
+         * @brief Get the linear damping.
+         * @return The linear damping.
+         */
+        float getLinearDamping() const {
+            return m_linear_damping;
+        }
+
+        /**
+         * @brief Get the angular damping.
+         * @return The angular damping.
+         */
+        float getAngularDamping() const {
+            return m_angular_damping;
+        }
+
+        /**
+         * @brief Set the multiplier on the world gravity.
+         * @param scale 1 for normal gravity, 0 to float.
+         */
+        void setGravityScale(float scale);
+
+        /**
+         * @brief Get the multiplier on the world gravity.
+         * @return The gravity scale.
+         */
+        float getGravityScale() const {
+            return m_gravity_scale;
+        }
+
+        /**
+         * @brief Set the linear velocity.
+         * @param velocity World space velocity in units per second.
+         */
+        void setLinearVelocity(const Vector3D& velocity);
+
+        /**
+         * @brief Get the linear velocity.
+         * @return The velocity as of the last PhysicsSystem update.
+         */
+        const Vector3D& getLinearVelocity() const {
+            return m_linear_velocity;
+        }
+
+        /**
+         * @brief Set the angular velocity.
+         * @param velocity World space axis scaled by radians per second.
+         */
+        void setAngularVelocity(const Vector3D& velocity);
+
+        /**
+         * @brief Get the angular velocity.
+         * @return The angular velocity as of the last PhysicsSystem update.
+         */
+        const Vector3D& getAngularVelocity() const {
+            return m_angular_velocity;
+        }
+
+        /**
+         * @brief Push the body through its center of mass during the next step.
+         * @param force World space force.
+         */
+        void addForce(const Vector3D& force);
+
+        /**
+         * @brief Turn the body during the next step.
+         * @param torque World space torque.
+         */
+        void addTorque(const Vector3D& torque);
+
+        /**
+         * @brief Change the velocity of a dynamic body at once.
+         * @param impulse World space impulse through the center of mass.
+         */
+        void applyLinearImpulse(const Vector3D& impulse);
+
+        /**
+         * @brief Wake the body or put it to sleep.
+         * @param awake False stops the body until something touches it.
+         */
+        void setAwake(bool awake);
+
+        /**
+         * @brief Check whether the body is being simulated.
+         * @return False while the body sleeps.
+         */
+        bool isAwake() const {
+            return m_awake;
+        }
+
+        /**
+         * @brief Set whether the body may fall asleep when it comes to rest.
+         * @param allow False keeps the body awake.
+         */
+        void setAllowSleep(bool allow);
+
+        /**
+         * @brief Check whether the body may fall asleep.
+         * @return True if it may.
+         */
+        bool getAllowSleep() const {
+            return m_allow_sleep;
+        }
+
+        /**
+         * @brief Get the change generation shared by all rigid body components.
+         * @details Changes whenever any setter is called, so the PhysicsSystem only
+         *          looks for changed components when there are some.
+         * @return The current generation.
+         */
+        static uint32_t getChangeGeneration() {
+            return s_change_generation;
+        }
+    };
+
+} // namespace gam300
+
+#endif // __RIGID_BODY_COMPONENT_H__
@@ -0,0 +1,83 @@
+/**
+ * @file TransformComponent.cpp
+ * @brief Implementation of the Transform Component for the Entity Component System.
+ * @details Contains implementations for all member functions declared in TransformComponent.h.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "../Component/TransformComponent.h"
+#include "../Manager/LogManager.h"
+
+namespace gam300 {
+
+    // Generations shared by all transform components
+    uint32_t TransformComponent::s_hierarchy_generation = 0;
+    uint32_t TransformComponent::s_change_generation = 0;
+
+    // Constructor
+    TransformComponent::TransformComponent() : m_local(), m_parent(INVALID_ENTITY_ID), m_world(), m_dirty(true) {
+        // Nothing to initialize
+    }
+
+    // Initialize the component
+    void TransformComponent::init(EntityID entity_id) {
+        m_owner_id = entity_id;
+        markDirty();
+        LM.writeLog(LogLevel::DEBUG, "TransformComponent::init() - Transform component initialized for entity %d", entity_id);
+    }
+
+    // Update the component
+    void TransformComponent::update(float /*dt*/) {
+        // World matrices depend on the parent's, so the TransformSystem computes them in depth order
+    }
+
+    // Set the local position
+    void TransformComponent::setPosition(const Vector3D& position) {
+        m_local.position = position;
+        markDirty();
+    }
+
+    // Set the local rotation
+    void TransformComponent::setRotation(const Quaternion& rotation) {
+        m_local.rotation = rotation;
+        markDirty();
+    }
+
+    // Set the local scale
+    void TransformComponent::setScale(const Vector3D& scale) {
+        m_local.scale = scale;
+        markDirty();
+    }
+
+    // Set the whole local transform
+    void TransformComponent::setLocalTransform(const Transform& local) {
+        m_local = local;
+        markDirty();
+    }
+
+    // Attach to a parent
+    void TransformComponent::setParent(EntityID parent) {
+        if (parent == m_owner_id && parent != INVALID_ENTITY_ID) {
+            LM.writeLog(LogLevel::WARNING, "TransformComponent::setParent() - Entity %d can't be its own parent", m_owner_id);
+            return;
+        }
+        if (parent == m_parent) {
+            return;
+        }
+
+        m_parent = parent;
+        s_hierarchy_generation++;
+        markDirty();
+    }
+
+    // Mark the world matrix stale
+    void TransformComponent::markDirty() {
+        m_dirty = true;
+        s_change_generation++;
+    }
+
+} // namespace gam300
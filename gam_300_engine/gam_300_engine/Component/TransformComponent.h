@@ -0,0 +1,195 @@
+/**
+ * @file TransformComponent.h
+ * @brief Declaration of the Transform Component for the Entity Component System.
+ * @details Holds an entity's position, rotation and scale relative to its parent and
+ *          the world matrix computed from them by the TransformSystem.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __TRANSFORM_COMPONENT_H__
+#define __TRANSFORM_COMPONENT_H__
+
+#include "../Component/Component.h"
+#include "../Utility/Matrix4.h"
+#include "../Utility/Quaternion.h"
+#include "../Utility/Transform.h"
+#include "../Utility/Vector3D.h"
+#include <cstdint>
+
+namespace gam300 {
+
+    /**
+     * @brief Component placing an entity in the world, optionally relative to a parent entity.
+     * @details Setters only mark the component dirty. The world matrix is recomputed
+     *          by the TransformSystem on its next update, for this entity and every
+     *          entity below it, so getWorldMatrix() lags local changes by one update.
+     */
+    class TransformComponent : public Component {
+    private:
+        Transform m_local;                          // Position, rotation and scale relative to the parent
+        EntityID m_parent;                          // Parent entity, INVALID_ENTITY_ID for a root
+        Matrix4 m_world;                            // Local to world matrix as of the last TransformSystem update
+        bool m_dirty;                               // Local transform changed since the last update
+
+        static uint32_t s_hierarchy_generation;     // Bumped whenever any component's parent changes
+        static uint32_t s_change_generation;        // Bumped whenever any component's local transform changes
+
+        friend class TransformSystem;
+
+    public:
+        /**
+         * @brief Constructor for TransformComponent.
+         */
+        TransformComponent();
+
+        /**
+         * @brief Initialize the component after creation.
+         * @param entity_id The ID of the entity this component is attached to.
+         */
+        void init(EntityID entity_id) override;
+
+        /**
+         * @brief Update the component, the TransformSystem does the work.
+         * @param dt Delta time in seconds.
+         */
+        void update(float dt) override;
+
+        /**
+         * @brief Set the position relative to the parent.
+         * @param position The new position.
+         */
+        void setPosition(const Vector3D& position);
+
+        /**
+         * @brief Get the position relative to the parent.
+         * @return The local position.
+         */
+        const Vector3D& getPosition() const {
+            return m_local.position;
+        }
+
+        /**
+         * @brief Set the rotation relative to the parent.
+         * @param rotation The new rotation, must be unit length.
+         */
+        void setRotation(const Quaternion& rotation);
+
+        /**
+         * @brief Get the rotation relative to the parent.
+         * @return The local rotation.
+         */
+        const Quaternion& getRotation() const {
+            return m_local.rotation;
+        }
+
+        /**
+         * @brief Set the scale relative to the parent.
+         * @param scale The new scale factors.
+         */
+        void setScale(const Vector3D& scale);
+
+        /**
+         * @brief Get the scale relative to the parent.
+         * @return The local scale factors.
+         */
+        const Vector3D& getScale() const {
+            return m_local.scale;
+        }
+
+        /**
+         * @brief Set position, rotation and scale at once.
+         * @param local The new local transform.
+         */
+        void setLocalTransform(const Transform& local);
+
+        /**
+         * @brief Get position, rotation and scale.
+         * @return The local transform.
+         */
+        const Transform& getLocalTransform() const {
+            return m_local;
+        }
+
+        /**
+         * @brief Get the matrix built from the local transform.
+         * @return translation * rotation * scale.
+         */
+        Matrix4 getLocalMatrix() const {
+            return m_local.toMatrix();
+        }
+
+        /**
+         * @brief Attach this entity to a parent.
+         * @details The parent needs a TransformComponent too, otherwise the entity is
+         *          treated as a root. The local transform is kept, so the entity moves
+         *          with the parent from the next update on.
+         * @param parent The parent entity, or INVALID_ENTITY_ID to detach.
+         */
+        void setParent(EntityID parent);
+
+        /**
+         * @brief Get the parent entity.
+         * @return The parent, or INVALID_ENTITY_ID for a root.
+         */
+        EntityID getParent() const {
+            return m_parent;
+        }
+
+        /**
+         * @brief Get the local to world matrix.
+         * @return The matrix computed by the last TransformSystem update.
+         */
+        const Matrix4& getWorldMatrix() const {
+            return m_world;
+        }
+
+        /**
+         * @brief Get the position in world space.
+         * @return The translation of the world matrix.
+         */
+        Vector3D getWorldPosition() const {
+            return m_world.getTranslation();
+        }
+
+        /**
+         * @brief Check whether the local transform changed since the last update.
+         * @return True if the world matrix is stale.
+         */
+        bool isDirty() const {
+            return m_dirty;
+        }
+
+        /**
+         * @brief Get the hierarchy generation shared by all transform components.
+         * @details Changes whenever a parent is set on any component, so the
+         *          TransformSystem knows when its depth order is stale.
+         * @return The current generation.
+         */
+        static uint32_t getHierarchyGeneration() {
+            return s_hierarchy_generation;
+        }
+
+        /**
+         * @brief Get the change generation shared by all transform components.
+         * @details Changes whenever any local transform is set, so the TransformSystem
+         *          can skip frames in which nothing moved.
+         * @return The current generation.
+         */
+        static uint32_t getChangeGeneration() {
+            return s_change_generation;
+        }
+
+    private:
+        /**
+         * @brief Mark the world matrix stale.
+         */
+        void markDirty();
+    };
+
+} // namespace gam300
+
+#endif // __TRANSFORM_COMPONENT_H__
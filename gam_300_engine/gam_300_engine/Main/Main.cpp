@@ -11,7 +11,11 @@
 
 #include "Main.h"
 
-int main(void) {
+int main(int argc, char* argv[]) {
+    // Command-line arguments override the config file, e.g.
+    //   --headless --uncapped --max_frames=600 --config=server.json
+    CFG.setCommandLine(argc, argv);
+
     // Initialize GameManager
     if (GM.startUp()) {
         // Failed to start GameManager
@@ -22,6 +26,17 @@ int main(void) {
     // Get reference to LogManager (already started by GameManager)
     LM.writeLog("Main: GameManager initialized successfully");
 
+    if (GM.isHeadless()) {
+        // Run the simulation without GLFW or GL
+        GM.runHeadless(CFG.getConfig().max_frames);
+
+        // Properly shut down the GameManager (which will also shut down all other managers)
+        GM.shutDown();
+        return 0;
+    }
+
+#ifndef GAM300_HEADLESS_BUILD
+
     // Initialize GLFW
     if (!glfwInit()) {
         LM.writeLog("ERROR: Failed to initialize GLFW");
@@ -47,53 +62,9 @@ int main(void) {
     IM.setWindow(window);
     LM.writeLog("InputManager initialized successfully");
 
-    // Create a clock for timing
-    gam300::Clock clock;
-
-    // Variables for timing
-    int64_t elapsed_time = 0;
-    int64_t sleep_time = 0;
-
-    // Main game loop
+    // Run the fixed-timestep game loop
     LM.writeLog("Starting main game loop");
-    while (!GM.getGameOver() && !glfwWindowShouldClose(window)) {
-        // Process events
-        glfwPollEvents();
-
-        // Update input system
-        IM.update();
-
-        // Start of loop timing
-        clock.delta();
-
-        // Update all systems (including InputSystem)
-        EM.updateSystems(GM.getFrameTime() / 1000.0f);
-
-        // Render frame 
-        glClear(GL_COLOR_BUFFER_BIT);
-
-        // Swap buffers
-        glfwSwapBuffers(window);
-
-        // End of loop timing
-        elapsed_time = clock.split();
-
-        // Convert frame time from milliseconds to microseconds
-        int64_t frame_time_us = GM.getFrameTime() * 1000;
-
-        // Calculate sleep time (need to ensure it's not negative)
-        sleep_time = frame_time_us - elapsed_time;
-
-        // Only sleep if positive sleep time
-        if (sleep_time > 0) {
-            // Convert microseconds to milliseconds for sleep
-            std::this_thread::sleep_for(std::chrono::microseconds(sleep_time));
-        }
-        else {
-            // If we're behind, log that we're not keeping up
-            LM.writeLog("GameManager::run() - Frame running behind: %lld us", -sleep_time);
-        }
-    }
+    GM.run(window);
 
     // Cleanup
     LM.writeLog("Cleaning up resources");
@@ -106,6 +77,7 @@ int main(void) {
 
     // Properly shut down the GameManager (which will also shut down all other managers)
     GM.shutDown();
+#endif
 
     return 0;
 }
\ No newline at end of file
@@ -25,6 +25,8 @@
 #include "../Manager/LogManager.h"
 #include "../Manager/InputManager.h"
 #include "../Manager/ECSManager.h"
+#include "../Manager/ProfileManager.h"
+#include "../Manager/ConfigManager.h"
 #include "../Utility/Clock.h"
 
 #endif // __MAIN_H__
\ No newline at end of file
@@ -15,7 +15,9 @@
 namespace gam300 {
 
     // Initialize singleton instance
-    ComponentManager::ComponentManager() {
+    ComponentManager::ComponentManager() :
+        m_allocation_count(0),
+        m_default_pool_capacity(COMPONENT_POOL_CAPACITY_DEFAULT) {
         setType("ComponentManager");
     }
 
@@ -58,4 +60,23 @@ namespace gam300 {
         }
     }
 
+    // Get the number of components stored for a component type
+    size_t ComponentManager::get_pool_size(ComponentTypeID type_id) const {
+        auto it = m_component_arrays.find(type_id);
+        if (it != m_component_arrays.end()) {
+            return it->second->size();
+        }
+        return 0;
+    }
+
+    // Get the total number of components created since startup
+    size_t ComponentManager::get_allocation_count() const {
+        return m_allocation_count;
+    }
+
+    // Set how many components newly registered component types reserve space for
+    void ComponentManager::set_default_pool_capacity(size_t capacity) {
+        m_default_pool_capacity = capacity;
+    }
+
 } // namespace gam300
\ No newline at end of file
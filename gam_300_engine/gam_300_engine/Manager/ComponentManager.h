@@ -25,6 +25,9 @@
 
 namespace gam300 {
 
+    // Default number of components each component pool reserves space for.
+    constexpr size_t COMPONENT_POOL_CAPACITY_DEFAULT = 100;
+
     /**
      * @brief Container for a specific type of component.
      * @details Stores and manages all instances of a specific component type.
@@ -33,6 +36,7 @@ namespace gam300 {
     public:
         virtual ~IComponentArray() = default;
         virtual void entity_destroyed(EntityID entity_id) = 0;
+        virtual size_t size() const = 0;
     };
 
     /**
@@ -43,6 +47,13 @@ namespace gam300 {
     template<typename T>
     class ComponentArray : public IComponentArray {
     public:
+        /**
+         * @brief Constructor that pre-allocates storage.
+         * @param initial_capacity Number of components to reserve space for.
+         */
+        explicit ComponentArray(size_t initial_capacity = COMPONENT_POOL_CAPACITY_DEFAULT)
+            : m_component_pool(initial_capacity) {}
+
         /**
          * @brief Insert a component for an entity.
          * @param entity_id The entity to attach the component to.
@@ -97,11 +108,29 @@ namespace gam300 {
             return m_component_pool.get_entity_at(index);
         }
 
+        /**
+         * @brief Get the index of an entity's component in the dense array.
+         * @param entity_id The entity to look up.
+         * @return The index, or size() if the entity has no component of this type.
+         */
+        size_t index_of(EntityID entity_id) const {
+            return m_component_pool.index_of(entity_id);
+        }
+
+        /**
+         * @brief Get the component at a dense index, without checking the index.
+         * @param index Index below size().
+         * @return The component.
+         */
+        T* get_at(size_t index) const {
+            return m_component_pool.get_at(index);
+        }
+
         /**
          * @brief Get the number of components in this array.
          * @return The number of components.
          */
-        size_t size() const {
+        size_t size() const override {
             return m_component_pool.size();
         }
 
@@ -122,6 +151,12 @@ namespace gam300 {
         // Maps component type IDs to their component arrays
         std::unordered_map<ComponentTypeID, std::shared_ptr<IComponentArray>> m_component_arrays;
 
+        // Total number of components created, used for allocation statistics
+        size_t m_allocation_count;
+
+        // Number of components each new component array reserves space for
+        size_t m_default_pool_capacity;
+
     public:
         /**
          * @brief Get the singleton instance of the ComponentManager.
@@ -150,7 +185,7 @@ namespace gam300 {
 
             // Create a new component array for this type if it doesn't exist
             if (m_component_arrays.find(type_id) == m_component_arrays.end()) {
-                m_component_arrays[type_id] = std::make_shared<ComponentArray<T>>();
+                m_component_arrays[type_id] = std::make_shared<ComponentArray<T>>(m_default_pool_capacity);
             }
         }
 
@@ -174,6 +209,7 @@ namespace gam300 {
             // Create the component using make_unique
             auto component = std::make_unique<T>(std::forward<Args>(args)...);
             component->init(entity_id);
+            m_allocation_count++;
 
             // Add to component array
             auto componentArray = std::static_pointer_cast<ComponentArray<T>>(m_component_arrays[type_id]);
@@ -204,15 +240,21 @@ namespace gam300 {
          */
         template<typename T>
         T* get_component(EntityID entity_id) {
-            ComponentTypeID type_id = get_component_type_id<T>();
-
-            // Make sure component type is registered
-            if (m_component_arrays.find(type_id) != m_component_arrays.end()) {
-                auto componentArray = std::static_pointer_cast<ComponentArray<T>>(m_component_arrays[type_id]);
-                return componentArray->get_component(entity_id);
-            }
+            ComponentArray<T>* componentArray = get_component_array<T>();
+            return componentArray ? componentArray->get_component(entity_id) : nullptr;
+        }
 
-            return nullptr;
+        /**
+         * @brief Get the storage of a component type.
+         * @details Lets loops over many entities resolve the array once and then look
+         *          components up by entity or dense index.
+         * @tparam T The component type.
+         * @return The component array, or nullptr if the type was never registered.
+         */
+        template<typename T>
+        ComponentArray<T>* get_component_array() {
+            auto it = m_component_arrays.find(get_component_type_id<T>());
+            return it != m_component_arrays.end() ? static_cast<ComponentArray<T>*>(it->second.get()) : nullptr;
         }
 
         /**
@@ -240,8 +282,31 @@ namespace gam300 {
          */
         void entity_destroyed(EntityID entity_id);
 
+        /**
+         * @brief Get the number of components stored for a component type.
+         * @param type_id The component type to query.
+         * @return The number of components, or 0 if the type is not registered.
+         */
+        size_t get_pool_size(ComponentTypeID type_id) const;
+
+        /**
+         * @brief Get the total number of components created since startup.
+         * @return The number of component allocations.
+         */
+        size_t get_allocation_count() const;
+
+        /**
+         * @brief Set how many components newly registered component types reserve space for.
+         * @param capacity The initial pool capacity.
+         */
+        void set_default_pool_capacity(size_t capacity);
+
         // Make ECSManager a friend so it can access ComponentManager methods
         friend class ECSManager;
+
+        // Views walk the component arrays directly
+        template<typename... Components>
+        friend class ComponentView;
     };
 
 } // namespace gam300
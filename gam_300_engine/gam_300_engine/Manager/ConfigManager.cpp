@@ -0,0 +1,336 @@
+/**
+ * @file ConfigManager.cpp
+ * @brief Implementation of the Config Manager for the game engine.
+ * @details Loads engine settings from a config file at startup and applies
+ *          command-line overrides, so deployments can be tuned without recompiling.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "ConfigManager.h"
+#include "LogManager.h"
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace gam300 {
+
+    // Setting types understood by resolveConfig()
+    enum class SettingType { INT, BOOL, STRING };
+
+    // Table entry binding a config key to a field of EngineConfig
+    struct SettingBinding {
+        const char* key;
+        SettingType type;
+        int EngineConfig::* int_field;
+        bool EngineConfig::* bool_field;
+        std::string EngineConfig::* string_field;
+    };
+
+    // Highest frame rate the loop can step at, its fixed step is a whole number of microseconds
+    static const int MAX_FRAME_RATE = 1000000;
+
+    // Every key the engine understands
+    static const SettingBinding SETTING_BINDINGS[] = {
+        { "frame_rate",                   SettingType::INT,    &EngineConfig::frame_rate,                   nullptr, nullptr },
+        { "uncapped",                     SettingType::BOOL,   nullptr, &EngineConfig::uncapped,            nullptr },
+        { "max_steps_per_frame",          SettingType::INT,    &EngineConfig::max_steps_per_frame,          nullptr, nullptr },
+        { "headless",                     SettingType::BOOL,   nullptr, &EngineConfig::headless,            nullptr },
+        { "max_frames",                   SettingType::INT,    &EngineConfig::max_frames,                   nullptr, nullptr },
+        { "worker_threads",               SettingType::INT,    &EngineConfig::worker_threads,               nullptr, nullptr },
+        { "random_seed",                  SettingType::INT,    &EngineConfig::random_seed,                  nullptr, nullptr },
+        { "math_precision",               SettingType::STRING, nullptr, nullptr, &EngineConfig::math_precision },
+        { "log_level",                    SettingType::STRING, nullptr, nullptr, &EngineConfig::log_level },
+        { "log_flush",                    SettingType::BOOL,   nullptr, &EngineConfig::log_flush,           nullptr },
+        { "stats_summary_interval",       SettingType::INT,    &EngineConfig::stats_summary_interval,       nullptr, nullptr },
+        { "component_pool_capacity",      SettingType::INT,    &EngineConfig::component_pool_capacity,      nullptr, nullptr },
+        { "asset_root",                   SettingType::STRING, nullptr, nullptr, &EngineConfig::asset_root },
+        { "scene",                        SettingType::STRING, nullptr, nullptr, &EngineConfig::scene },
+        { "record_input",                 SettingType::STRING, nullptr, nullptr, &EngineConfig::record_input },
+        { "replay_input",                 SettingType::STRING, nullptr, nullptr, &EngineConfig::replay_input },
+    };
+
+    // Parse an integer, returning false if the text isn't a whole number that fits an int
+    static bool parseInt(const std::string& text, int& value) {
+        if (text.empty()) return false;
+        char* end = nullptr;
+        errno = 0;
+        long parsed = std::strtol(text.c_str(), &end, 10);
+        if (end == text.c_str() || *end != '\0') return false;
+        if (errno == ERANGE || parsed < INT_MIN || parsed > INT_MAX) return false;
+        value = static_cast<int>(parsed);
+        return true;
+    }
+
+    // Parse a boolean, returning false if the text isn't one of the recognised words
+    static bool parseBool(const std::string& text, bool& value) {
+        if (text == "true" || text == "1" || text == "yes" || text == "on") {
+            value = true;
+            return true;
+        }
+        if (text == "false" || text == "0" || text == "no" || text == "off") {
+            value = false;
+            return true;
+        }
+        return false;
+    }
+
+    // Initialize singleton instance
+    ConfigManager::ConfigManager() : m_config_path(CONFIG_FILE_DEFAULT) {
+        setType("ConfigManager");
+    }
+
+    // Get the singleton instance
+    ConfigManager& ConfigManager::getInstance() {
+        static ConfigManager instance;
+        return instance;
+    }
+
+    // Start up the ConfigManager
+    int ConfigManager::startUp() {
+        // Call parent's startUp() first
+        if (Manager::startUp())
+            return -1;
+
+        // A missing config file is not an error, the defaults are usable
+        if (!loadFromFile(m_config_path)) {
+            LM.writeLog(LogLevel::WARNING, "ConfigManager::startUp() - Could not read '%s', using defaults",
+                m_config_path.c_str());
+        }
+
+        LM.writeLog("ConfigManager::startUp() - frame_rate %d%s, worker_threads %d, log_level %s, pool capacity %d, asset_root '%s'%s",
+            m_config.frame_rate, m_config.uncapped ? " (uncapped)" : "", getWorkerThreadCount(),
+            m_config.log_level.c_str(), m_config.component_pool_capacity, m_config.asset_root.c_str(),
+            m_config.headless ? ", headless" : "");
+
+        return 0;
+    }
+
+    // Shut down the ConfigManager
+    void ConfigManager::shutDown() {
+        LM.writeLog("ConfigManager::shutDown() - Shutting down Config Manager");
+
+        // Call parent's shutDown()
+        Manager::shutDown();
+    }
+
+    // Store command-line overrides to apply at startup
+    void ConfigManager::setCommandLine(int argc, char* argv[]) {
+        m_overrides.clear();
+
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg.size() < 3 || arg[0] != '-' || arg[1] != '-') {
+                continue;
+            }
+
+            // --key=value, or --key meaning true
+            std::string key;
+            std::string value;
+            size_t equals = arg.find('=');
+            if (equals == std::string::npos) {
+                key = arg.substr(2);
+                value = "true";
+            }
+            else {
+                key = arg.substr(2, equals - 2);
+                value = arg.substr(equals + 1);
+            }
+
+            if (key == "config") {
+                m_config_path = value;
+            }
+            else {
+                m_overrides.emplace_back(key, value);
+            }
+        }
+    }
+
+    // Load settings from a config file
+    bool ConfigManager::loadFromFile(const std::string& filename) {
+        m_values.clear();
+
+        bool loaded = false;
+        std::ifstream file(filename);
+        if (file.is_open()) {
+            std::stringstream buffer;
+            buffer << file.rdbuf();
+            loaded = parseConfig(buffer.str());
+            if (loaded) {
+                LM.writeLog("ConfigManager::loadFromFile() - Loaded %u settings from '%s'",
+                    static_cast<unsigned int>(m_values.size()), filename.c_str());
+            }
+            else {
+                LM.writeLog(LogLevel::ERROR_LEVEL, "ConfigManager::loadFromFile() - '%s' is not a valid config file",
+                    filename.c_str());
+            }
+        }
+
+        // Command line always wins over the file
+        for (const auto& override_pair : m_overrides) {
+            m_values[override_pair.first] = override_pair.second;
+            LM.writeLog("ConfigManager::loadFromFile() - Command line override %s=%s",
+                override_pair.first.c_str(), override_pair.second.c_str());
+        }
+
+        resolveConfig();
+        return loaded;
+    }
+
+    // Parse a flat JSON object of key/value pairs
+    bool ConfigManager::parseConfig(const std::string& content) {
+        size_t pos = content.find('{');
+        if (pos == std::string::npos) {
+            return false;
+        }
+        pos++;
+
+        while (pos < content.size()) {
+            // Skip to the next key or the end of the object
+            while (pos < content.size() && content[pos] != '"' && content[pos] != '}') {
+                pos++;
+            }
+            if (pos >= content.size() || content[pos] == '}') {
+                return true;
+            }
+
+            // Key
+            size_t key_end = content.find('"', pos + 1);
+            if (key_end == std::string::npos) return false;
+            std::string key = content.substr(pos + 1, key_end - pos - 1);
+
+            size_t colon = content.find(':', key_end);
+            if (colon == std::string::npos) return false;
+            pos = colon + 1;
+            while (pos < content.size() && std::isspace(static_cast<unsigned char>(content[pos]))) {
+                pos++;
+            }
+            if (pos >= content.size()) return false;
+
+            // Value: quoted string, or a bare literal up to the next separator
+            std::string value;
+            if (content[pos] == '"') {
+                size_t value_end = content.find('"', pos + 1);
+                if (value_end == std::string::npos) return false;
+                value = content.substr(pos + 1, value_end - pos - 1);
+                pos = value_end + 1;
+            }
+            else {
+                size_t value_start = pos;
+                while (pos < content.size() && content[pos] != ',' && content[pos] != '}' &&
+                    !std::isspace(static_cast<unsigned char>(content[pos]))) {
+                    pos++;
+                }
+                value = content.substr(value_start, pos - value_start);
+            }
+
+            m_values[key] = value;
+        }
+
+        return false;
+    }
+
+    // Copy the raw key/value pairs into the typed settings
+    void ConfigManager::resolveConfig() {
+        m_config = EngineConfig();
+
+        for (const auto& pair : m_values) {
+            const SettingBinding* binding = nullptr;
+            for (const SettingBinding& candidate : SETTING_BINDINGS) {
+                if (pair.first == candidate.key) {
+                    binding = &candidate;
+                    break;
+                }
+            }
+
+            if (!binding) {
+                LM.writeLog(LogLevel::WARNING, "ConfigManager::resolveConfig() - Unknown setting '%s'", pair.first.c_str());
+                continue;
+            }
+
+            switch (binding->type) {
+            case SettingType::INT:
+                if (!parseInt(pair.second, m_config.*(binding->int_field))) {
+                    LM.writeLog(LogLevel::WARNING, "ConfigManager::resolveConfig() - Setting '%s' expects a number, got '%s'",
+                        pair.first.c_str(), pair.second.c_str());
+                }
+                break;
+            case SettingType::BOOL:
+                if (!parseBool(pair.second, m_config.*(binding->bool_field))) {
+                    LM.writeLog(LogLevel::WARNING, "ConfigManager::resolveConfig() - Setting '%s' expects true or false, got '%s'",
+                        pair.first.c_str(), pair.second.c_str());
+                }
+                break;
+            case SettingType::STRING:
+                m_config.*(binding->string_field) = pair.second;
+                break;
+            }
+        }
+
+        // Keep the values the loop depends on sane
+        if (m_config.frame_rate < 1 || m_config.frame_rate > MAX_FRAME_RATE) {
+            int frame_rate = m_config.frame_rate < 1 ? 1 : MAX_FRAME_RATE;
+            LM.writeLog(LogLevel::WARNING, "ConfigManager::resolveConfig() - frame_rate %d out of range, using %d",
+                m_config.frame_rate, frame_rate);
+            m_config.frame_rate = frame_rate;
+        }
+        if (m_config.max_steps_per_frame < 1) m_config.max_steps_per_frame = 1;
+        if (m_config.component_pool_capacity < 0) m_config.component_pool_capacity = 0;
+    }
+
+    // Get the resolved engine settings
+    const EngineConfig& ConfigManager::getConfig() const {
+        return m_config;
+    }
+
+    // Get a raw string setting
+    std::string ConfigManager::getString(const std::string& key, const std::string& default_value) const {
+        auto it = m_values.find(key);
+        return it != m_values.end() ? it->second : default_value;
+    }
+
+    // Get an integer setting
+    int ConfigManager::getInt(const std::string& key, int default_value) const {
+        int value = default_value;
+        auto it = m_values.find(key);
+        if (it == m_values.end() || !parseInt(it->second, value)) {
+            return default_value;
+        }
+        return value;
+    }
+
+    // Get a boolean setting
+    bool ConfigManager::getBool(const std::string& key, bool default_value) const {
+        bool value = default_value;
+        auto it = m_values.find(key);
+        if (it == m_values.end() || !parseBool(it->second, value)) {
+            return default_value;
+        }
+        return value;
+    }
+
+    // Set a setting at runtime
+    void ConfigManager::setValue(const std::string& key, const std::string& value) {
+        m_values[key] = value;
+        resolveConfig();
+    }
+
+    // Get the number of worker threads to use
+    int ConfigManager::getWorkerThreadCount() const {
+        if (m_config.worker_threads > 0) {
+            return m_config.worker_threads;
+        }
+
+        // Leave one hardware thread for the main loop
+        int hardware_threads = static_cast<int>(std::thread::hardware_concurrency());
+        return hardware_threads > 1 ? hardware_threads - 1 : 1;
+    }
+
+} // end of namespace gam300
@@ -0,0 +1,167 @@
+/**
+ * @file ConfigManager.h
+ * @brief Declaration of the Config Manager for the game engine.
+ * @details Loads engine settings from a config file at startup and applies
+ *          command-line overrides, so deployments can be tuned without recompiling.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __CONFIG_MANAGER_H__
+#define __CONFIG_MANAGER_H__
+
+#include "Manager.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Three-letter acronym for easier access to manager.
+#define CFG gam300::ConfigManager::getInstance()
+
+namespace gam300 {
+
+    // Config file read when no --config override is given, relative to the working directory.
+    const std::string CONFIG_FILE_DEFAULT = "engine.json";
+
+    /**
+     * @brief Engine settings, filled from defaults, the config file and the command line.
+     * @details Each field is read from the key of the same name, e.g. "frame_rate": 90
+     *          in the config file or --frame_rate=90 on the command line.
+     */
+    struct EngineConfig {
+        // Game loop
+        int frame_rate = 90;                    // Fixed simulation steps (and frames) per second, 1 to 1000000
+        bool uncapped = false;                  // Run frames back to back instead of pacing them
+        int max_steps_per_frame = 5;            // Spiral-of-death guard for the fixed-step loop
+        bool headless = false;                  // Run without a window
+        int max_frames = 0;                     // Stop a headless run after this many frames (0 = never)
+
+        // Threading
+        int worker_threads = 0;                 // Worker threads for parallel jobs (0 = one per core minus one)
+
+        // Math
+        int random_seed = 0;                    // Seed of the main thread's random stream (0 = from the clock)
+        std::string math_precision = "exact";   // "exact" (standard library) or "fast" (polynomial approximations)
+
+        // Logging and statistics
+        std::string log_level = "info";         // "error", "warning", "info" or "debug"
+        bool log_flush = false;                 // Flush the log after every write
+        int stats_summary_interval = 600;       // Frames between statistics summaries (0 disables)
+
+        // Memory
+        int component_pool_capacity = 100;      // Components each component pool reserves space for
+
+        // Assets
+        std::string asset_root = "Assets/";     // Path to the assets directory
+        std::string scene = "Scene/Game.scn";   // Scene loaded at startup, relative to the asset root
+
+        // Input
+        std::string record_input;               // Record the session's input to this file (empty = off)
+        std::string replay_input;               // Replay a recorded input file in headless mode (empty = off)
+    };
+
+    class ConfigManager : public Manager {
+
+    private:
+        ConfigManager();                         // Private since a singleton.
+        ConfigManager(ConfigManager const&);     // Don't allow copy.
+        void operator=(ConfigManager const&);    // Don't allow assignment.
+
+        EngineConfig m_config;                                   // Resolved settings
+        std::string m_config_path;                               // Config file to load
+        std::unordered_map<std::string, std::string> m_values;   // Raw key/value pairs from file then command line
+        std::vector<std::pair<std::string, std::string>> m_overrides; // Command-line overrides in order
+
+        // Copy the raw key/value pairs into the typed settings.
+        void resolveConfig();
+
+        // Parse a flat JSON object of key/value pairs into m_values.
+        bool parseConfig(const std::string& content);
+
+    public:
+        /**
+         * @brief Get the singleton instance of the ConfigManager.
+         * @return Reference to the singleton instance.
+         */
+        static ConfigManager& getInstance();
+
+        /**
+         * @brief Start up the ConfigManager.
+         * @return 0 if successful, else -1.
+         * @details Loads the config file (a missing file falls back to defaults),
+         *          then applies command-line overrides.
+         */
+        int startUp() override;
+
+        /**
+         * @brief Shut down the ConfigManager.
+         */
+        void shutDown() override;
+
+        /**
+         * @brief Store command-line overrides to apply at startup.
+         * @param argc Argument count from main().
+         * @param argv Argument values from main().
+         * @details Arguments of the form --key=value override config keys, a bare
+         *          --key sets it to true and --config=path selects the config file.
+         *          Call before GameManager::startUp().
+         */
+        void setCommandLine(int argc, char* argv[]);
+
+        /**
+         * @brief Load settings from a config file, replacing previously loaded values.
+         * @param filename Path to the config file.
+         * @return True if the file was read, false otherwise.
+         * @details Command-line overrides are re-applied on top of the file.
+         */
+        bool loadFromFile(const std::string& filename);
+
+        /**
+         * @brief Get the resolved engine settings.
+         * @return Reference to the settings.
+         */
+        const EngineConfig& getConfig() const;
+
+        /**
+         * @brief Get a raw string setting.
+         * @param key The setting name.
+         * @param default_value Value returned if the setting is missing.
+         * @return The setting value.
+         */
+        std::string getString(const std::string& key, const std::string& default_value = "") const;
+
+        /**
+         * @brief Get an integer setting.
+         * @param key The setting name.
+         * @param default_value Value returned if the setting is missing or not a number that fits an int.
+         * @return The setting value.
+         */
+        int getInt(const std::string& key, int default_value = 0) const;
+
+        /**
+         * @brief Get a boolean setting.
+         * @param key The setting name.
+         * @param default_value Value returned if the setting is missing or not a boolean.
+         * @return The setting value ("true", "1", "yes" and "on" are true; "false", "0", "no" and "off" are false).
+         */
+        bool getBool(const std::string& key, bool default_value = false) const;
+
+        /**
+         * @brief Set a setting at runtime.
+         * @param key The setting name.
+         * @param value The new value.
+         */
+        void setValue(const std::string& key, const std::string& value);
+
+        /**
+         * @brief Get the number of worker threads to use.
+         * @return The configured count, or one per hardware thread minus the main thread if 0.
+         */
+        int getWorkerThreadCount() const;
+    };
+
+} // end of namespace gam300
+#endif // __CONFIG_MANAGER_H__
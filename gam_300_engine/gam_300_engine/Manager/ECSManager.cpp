@@ -19,6 +19,7 @@ namespace gam300 {
     ECSManager::ECSManager() {
         setType("ECSManager");
         m_next_entity_id = 0;
+        m_component_batch_depth = 0;
     }
 
     // Get the singleton instance
@@ -60,6 +61,8 @@ namespace gam300 {
 
         // Destroy all entities first
         m_entities.clear();
+        m_pending_component_changes.clear();
+        m_component_batch_depth = 0;
 
         // Shut down managers in reverse order of initialization
         SM.shutDown();
@@ -88,11 +91,17 @@ namespace gam300 {
         return entity;
     }
 
+    // Find an entity in the list, which stays sorted by ID since IDs only grow and removal keeps the order
+    std::vector<Entity>::iterator ECSManager::findEntity(EntityID entity_id) {
+        auto it = std::lower_bound(m_entities.begin(), m_entities.end(), entity_id,
+            [](const Entity& e, EntityID id) { return e.get_id() < id; });
+        return (it != m_entities.end() && it->get_id() == entity_id) ? it : m_entities.end();
+    }
+
     // Destroy an entity
     void ECSManager::destroyEntity(EntityID entity_id) {
         // Find the entity
-        auto it = std::find_if(m_entities.begin(), m_entities.end(),
-            [entity_id](const Entity& e) { return e.get_id() == entity_id; });
+        auto it = findEntity(entity_id);
 
         if (it != m_entities.end()) {
             // Get the name for logging
@@ -115,8 +124,7 @@ namespace gam300 {
 
     // Get an entity by ID
     Entity* ECSManager::getEntity(EntityID entity_id) {
-        auto it = std::find_if(m_entities.begin(), m_entities.end(),
-            [entity_id](const Entity& e) { return e.get_id() == entity_id; });
+        auto it = findEntity(entity_id);
 
         return (it != m_entities.end()) ? &(*it) : nullptr;
     }
@@ -131,4 +139,47 @@ namespace gam300 {
         SM.update_systems(dt);
     }
 
+    // Tell the systems that depend on a component that it was added or removed
+    void ECSManager::notifyComponentChanged(const Entity& entity, ComponentTypeID component_id) {
+        if (m_component_batch_depth == 0) {
+            SM.entity_components_changed(entity, component_id);
+            return;
+        }
+
+        // Components are usually added to one entity after another, so merging with the last entry catches most repeats
+        if (!m_pending_component_changes.empty() && m_pending_component_changes.back().first == entity.get_id()) {
+            m_pending_component_changes.back().second.set(component_id);
+        }
+        else {
+            ComponentMask changed;
+            changed.set(component_id);
+            m_pending_component_changes.emplace_back(entity.get_id(), changed);
+        }
+    }
+
+    // Start holding back component change notifications
+    void ECSManager::beginComponentBatch() {
+        m_component_batch_depth++;
+    }
+
+    // Apply the component changes held back since the outermost beginComponentBatch()
+    void ECSManager::endComponentBatch() {
+        if (m_component_batch_depth == 0) {
+            LM.writeLog(LogLevel::WARNING, "ECSManager::endComponentBatch() - No batch to end");
+            return;
+        }
+        if (--m_component_batch_depth > 0) {
+            return;
+        }
+
+        for (const auto& change : m_pending_component_changes) {
+            // Entities destroyed during the batch have already left every system
+            Entity* entity = getEntity(change.first);
+            if (entity) {
+                SM.entity_components_changed(*entity, change.second);
+            }
+        }
+        m_pending_component_changes.clear();
+    }
+
 } // namespace gam300
\ No newline at end of file
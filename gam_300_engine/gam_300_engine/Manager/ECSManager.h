@@ -16,6 +16,7 @@
 #include "Manager.h"
 #include <vector>
 #include <memory>
+#include <utility>
 #include "../Entity/Entity.h"
 #include "../Manager/ComponentManager.h"
 #include "../System/System.h"
@@ -35,9 +36,19 @@ namespace gam300 {
         ECSManager(ECSManager const&);       // Don't allow copy.
         void operator=(ECSManager const&);   // Don't allow assignment.
 
-        std::vector<Entity> m_entities;      // Storage for all entities
+        std::vector<Entity> m_entities;      // Storage for all entities, sorted by ID
         EntityID m_next_entity_id;           // Next available entity ID
 
+        // Find an entity by binary search, m_entities.end() if there is none with the ID
+        std::vector<Entity>::iterator findEntity(EntityID entity_id);
+
+        // Component changes held back by a batch, one entry per run of changes to the same entity
+        int m_component_batch_depth;
+        std::vector<std::pair<EntityID, ComponentMask>> m_pending_component_changes;
+
+        // Tell the systems that depend on a component that it was added or removed, or queue it in a batch
+        void notifyComponentChanged(const Entity& entity, ComponentTypeID component_id);
+
     public:
         /**
          * @brief Get the singleton instance of the ECSManager.
@@ -105,8 +116,8 @@ namespace gam300 {
             // Add the component to the ComponentManager
             T* component = CM.add_component<T>(entity_id, std::forward<Args>(args)...);
 
-            // Notify the SystemManager that the entity's components changed
-            SM.entity_components_changed(*entity);
+            // Notify the systems that require this component
+            notifyComponentChanged(*entity, component_id);
 
             return component;
         }
@@ -131,8 +142,8 @@ namespace gam300 {
             // Remove the component from the ComponentManager
             CM.remove_component<T>(entity_id);
 
-            // Notify the SystemManager that the entity's components changed
-            SM.entity_components_changed(*entity);
+            // Notify the systems that require this component
+            notifyComponentChanged(*entity, component_id);
         }
 
         /**
@@ -190,6 +201,19 @@ namespace gam300 {
          * @param dt Delta time in seconds.
          */
         void updateSystems(float dt);
+
+        /**
+         * @brief Hold back system membership updates for component changes until the batch ends.
+         * @details Use around bulk changes such as loading a scene, so each entity is
+         *          matched against the affected systems once instead of once per
+         *          component. Batches nest; only the outermost end applies the changes.
+         */
+        void beginComponentBatch();
+
+        /**
+         * @brief End a batch started with beginComponentBatch() and update system membership.
+         */
+        void endComponentBatch();
     };
 
 } // namespace gam300
@@ -15,9 +15,18 @@
 #include "InputManager.h" 
 #include "ECSManager.h"
 #include "SerialisationManager.h"
+#include "ProfileManager.h"
+#include "ConfigManager.h"
+#include "ComponentManager.h"
+#include "JobManager.h"
 #include "../System/InputSystem.h"
+#include "../System/PhysicsSystem.h"
+#include "../System/TransformSystem.h"
+#include "../System/SpatialHashSystem.h"
+#include "../System/BroadphaseSystem.h"
 #include "../Utility/Clock.h"
 #include "../Utility/AssetPath.h"
+#include "../Utility/MathUtils.h"
 
 namespace gam300 {
 
@@ -26,6 +35,12 @@ namespace gam300 {
         setType("GameManager");
         m_game_over = false;
         m_step_count = 0;
+        m_fixed_step_us = FRAME_TIME_DEFAULT * 1000;
+        m_max_steps_per_frame = MAX_STEPS_PER_FRAME_DEFAULT;
+        m_accumulator_us = 0;
+        m_interpolation_alpha = 0.0f;
+        m_run_mode = RunMode::WINDOWED;
+        m_pacing_mode = PacingMode::FIXED_RATE;
     }
 
     // Get the singleton instance
@@ -49,9 +64,43 @@ namespace gam300 {
 
         logManager.writeLog("GameManager::startUp() - LogManager started successfully");
 
+        // Start the ConfigManager, everything after it reads its settings
+        if (CFG.startUp()) {
+            logManager.writeLog("GameManager::startUp() - Failed to start ConfigManager");
+            logManager.shutDown();
+            return -1;
+        }
+
+        logManager.writeLog("GameManager::startUp() - ConfigManager started successfully");
+        applyConfig();
+
+        // Start the JobManager, its worker count is a setting
+        if (JM.startUp()) {
+            logManager.writeLog("GameManager::startUp() - Failed to start JobManager");
+            CFG.shutDown();
+            logManager.shutDown();
+            return -1;
+        }
+
+        logManager.writeLog("GameManager::startUp() - JobManager started successfully");
+
+        // Start the ProfileManager
+        if (PM.startUp()) {
+            logManager.writeLog("GameManager::startUp() - Failed to start ProfileManager");
+            JM.shutDown();
+            CFG.shutDown();
+            logManager.shutDown();
+            return -1;
+        }
+
+        logManager.writeLog("GameManager::startUp() - ProfileManager started successfully");
+
         // Start the InputManager
         if (IM.startUp()) {
             logManager.writeLog("GameManager::startUp() - Failed to start InputManager");
+            PM.shutDown();
+            JM.shutDown();
+            CFG.shutDown();
             logManager.shutDown();
             return -1;
         }
@@ -62,6 +111,9 @@ namespace gam300 {
         if (EM.startUp()) {
             logManager.writeLog("GameManager::startUp() - Failed to start ECSManager");
             IM.shutDown();
+            PM.shutDown();
+            JM.shutDown();
+            CFG.shutDown();
             logManager.shutDown();
             return -1;
         }
@@ -73,6 +125,9 @@ namespace gam300 {
             logManager.writeLog("GameManager::startUp() - Failed to start SerialisationManager");
             EM.shutDown();
             IM.shutDown();
+            PM.shutDown();
+            JM.shutDown();
+            CFG.shutDown();
             logManager.shutDown();
             return -1;
         }
@@ -88,8 +143,44 @@ namespace gam300 {
             logManager.writeLog("GameManager::startUp() - InputSystem registered successfully");
         }
 
+        // Register the PhysicsSystem to move rigid bodies before their world matrices are computed
+        auto physicsSystem = EM.registerSystem<PhysicsSystem>();
+        if (!physicsSystem) {
+            logManager.writeLog("GameManager::startUp() - Failed to register PhysicsSystem");
+        }
+        else {
+            logManager.writeLog("GameManager::startUp() - PhysicsSystem registered successfully");
+        }
+
+        // Register the TransformSystem to compute world matrices of Transform components
+        auto transformSystem = EM.registerSystem<TransformSystem>();
+        if (!transformSystem) {
+            logManager.writeLog("GameManager::startUp() - Failed to register TransformSystem");
+        }
+        else {
+            logManager.writeLog("GameManager::startUp() - TransformSystem registered successfully");
+        }
+
+        // Register the SpatialHashSystem to answer proximity queries on world positions
+        auto spatialHashSystem = EM.registerSystem<SpatialHashSystem>();
+        if (!spatialHashSystem) {
+            logManager.writeLog("GameManager::startUp() - Failed to register SpatialHashSystem");
+        }
+        else {
+            logManager.writeLog("GameManager::startUp() - SpatialHashSystem registered successfully");
+        }
+
+        // Register the BroadphaseSystem to find overlapping Bounds components
+        auto broadphaseSystem = EM.registerSystem<BroadphaseSystem>();
+        if (!broadphaseSystem) {
+            logManager.writeLog("GameManager::startUp() - Failed to register BroadphaseSystem");
+        }
+        else {
+            logManager.writeLog("GameManager::startUp() - BroadphaseSystem registered successfully");
+        }
+
         // Load the scene
-        const std::string scenePath = getAssetFilePath("Scene/Game.scn");
+        const std::string scenePath = getAssetFilePath(CFG.getConfig().scene);
         if (SEM.loadScene(scenePath)) {
             logManager.writeLog("GameManager::startUp() - Scene loaded successfully from %s", scenePath.c_str());
         }
@@ -105,6 +196,25 @@ namespace gam300 {
             }
         }
 
+        // Input recording and replay start with the first frame of the loaded scene
+        const EngineConfig& config = CFG.getConfig();
+        if (!config.replay_input.empty()) {
+            if (getRunMode() != RunMode::HEADLESS) {
+                logManager.writeLog(LogLevel::WARNING, "GameManager::startUp() - Input replay needs headless mode, ignoring '%s'",
+                    config.replay_input.c_str());
+            }
+            else if (IM.startReplay(config.replay_input) && IM.getReplayFixedStep() > 0 &&
+                IM.getReplayFixedStep() != m_fixed_step_us) {
+                // The recorded steps only reproduce with the step they were taken with
+                logManager.writeLog("GameManager::startUp() - Using the replay's fixed step of %lld us",
+                    static_cast<long long>(IM.getReplayFixedStep()));
+                setFixedStep(IM.getReplayFixedStep());
+            }
+        }
+        if (!config.record_input.empty()) {
+            IM.startRecording(config.record_input, m_fixed_step_us);
+        }
+
         // Initialize step count
         m_step_count = 0;
 
@@ -114,6 +224,50 @@ namespace gam300 {
         return 0;
     }
 
+    // Apply the loaded settings to the engine
+    void GameManager::applyConfig() {
+        const EngineConfig& config = CFG.getConfig();
+
+        // Logging
+        LogLevel log_level = LogLevel::INFO;
+        if (LogManager::parseLogLevel(config.log_level, log_level)) {
+            LM.setLogLevel(log_level);
+        }
+        else {
+            LM.writeLog(LogLevel::WARNING, "GameManager::applyConfig() - Unknown log level '%s'", config.log_level.c_str());
+        }
+        LM.setFlush(config.log_flush);
+
+        // Math, the seed is logged so a run can be repeated with --random_seed
+        unsigned int random_seed = config.random_seed != 0 ?
+            static_cast<unsigned int>(config.random_seed) : static_cast<unsigned int>(Clock::now());
+        MathUtils::seedRandom(random_seed);
+        LM.writeLog("GameManager::applyConfig() - Random seed %u", random_seed);
+        MathPrecision math_precision = MathPrecision::EXACT;
+        if (MathUtils::parsePrecision(config.math_precision, math_precision)) {
+            MathUtils::setPrecision(math_precision);
+        }
+        else {
+            LM.writeLog(LogLevel::WARNING, "GameManager::applyConfig() - Unknown math precision '%s'", config.math_precision.c_str());
+        }
+
+        // Statistics, memory and assets
+        PM.setSummaryInterval(config.stats_summary_interval);
+        CM.set_default_pool_capacity(static_cast<size_t>(config.component_pool_capacity));
+        setAssetsPath(config.asset_root);
+
+        // Game loop
+        setFixedStep(1000000 / config.frame_rate);
+        setMaxStepsPerFrame(config.max_steps_per_frame);
+        setPacingMode(config.uncapped ? PacingMode::UNCAPPED : PacingMode::FIXED_RATE);
+#ifdef GAM300_HEADLESS_BUILD
+        // Builds without GLFW can only run headless
+        setRunMode(RunMode::HEADLESS);
+#else
+        setRunMode(config.headless ? RunMode::HEADLESS : RunMode::WINDOWED);
+#endif
+    }
+
     // Check if an event is valid for the GameManager
     bool GameManager::isValid(std::string event_name) const {
         // GameManager only accepts "step" events
@@ -133,6 +287,9 @@ namespace gam300 {
         SEM.shutDown();
         EM.shutDown();
         IM.shutDown();
+        PM.shutDown();
+        JM.shutDown();
+        CFG.shutDown();
         logManager.shutDown();
 
         // Call parent's shutDown()
@@ -146,7 +303,7 @@ namespace gam300 {
 
         // Log every 100 steps
         if (m_step_count % 100 == 0) {
-            LM.writeLog("GameManager::update() - Step count: %d", m_step_count);
+            LM.writeLog(LogLevel::DEBUG, "GameManager::update() - Step count: %d", m_step_count);
         }
 
         // Check for escape key to quit
@@ -159,6 +316,211 @@ namespace gam300 {
         EM.updateSystems(dt);
     }
 
+#ifndef GAM300_HEADLESS_BUILD
+    // Run the game loop until game over or the window is closed
+    void GameManager::run(GLFWwindow* window) {
+        LM.writeLog("GameManager::run() - Starting game loop with %lld us fixed step", static_cast<long long>(m_fixed_step_us));
+
+        m_accumulator_us = 0;
+        int64_t previous_time = Clock::now();
+
+        while (!m_game_over && !glfwWindowShouldClose(window)) {
+            // Start recording frame statistics
+            PM.beginFrame();
+            int64_t frame_start = Clock::now();
+
+            // Feed real elapsed time into the accumulator, capped so a stall
+            // (debugger, window drag) doesn't turn into a burst of steps
+            int64_t elapsed = frame_start - previous_time;
+            previous_time = frame_start;
+            if (elapsed > MAX_FRAME_DELTA_US) {
+                elapsed = MAX_FRAME_DELTA_US;
+            }
+            m_accumulator_us += elapsed;
+
+            // Process events once per frame, they stay queued until a step consumes them
+            glfwPollEvents();
+
+            // Advance the simulation in fixed steps, refreshing input before each so
+            // every press is seen by exactly one step
+            Clock update_clock;
+            int steps = 0;
+            const float step_seconds = getFixedStep();
+            while (m_accumulator_us >= m_fixed_step_us && steps < m_max_steps_per_frame) {
+                updateInput(steps);
+                update(step_seconds);
+                m_accumulator_us -= m_fixed_step_us;
+                steps++;
+            }
+
+            // Spiral-of-death guard: drop whatever the step budget couldn't cover
+            if (m_accumulator_us >= m_fixed_step_us) {
+                int64_t dropped = m_accumulator_us - (m_accumulator_us % m_fixed_step_us);
+                m_accumulator_us -= dropped;
+                PM.recordMetric(FrameMetric::OVERRUN_TIME, dropped);
+                LM.writeLog(LogLevel::WARNING, "GameManager::run() - Simulation running behind, dropped %lld us", static_cast<long long>(dropped));
+            }
+
+            m_interpolation_alpha = static_cast<float>(m_accumulator_us) / static_cast<float>(m_fixed_step_us);
+            PM.recordMetric(FrameMetric::UPDATE_TIME, update_clock.split());
+            PM.recordMetric(FrameMetric::SIM_STEPS, steps);
+            IM.endFrame(steps);
+
+            // Render frame
+            glClear(GL_COLOR_BUFFER_BIT);
+
+            // Swap buffers
+            glfwSwapBuffers(window);
+
+            // Pace the frame to the frame time unless running uncapped
+            int64_t target_time = frame_start + m_fixed_step_us;
+            int64_t wait_start = Clock::now();
+            if (m_pacing_mode == PacingMode::FIXED_RATE && wait_start < target_time) {
+                waitUntil(target_time);
+                PM.recordMetric(FrameMetric::SLEEP_TIME, Clock::now() - wait_start);
+            }
+
+            // Jitter is how far the frame landed from its target length
+            int64_t frame_time = Clock::now() - frame_start;
+            PM.recordMetric(FrameMetric::FRAME_TIME, frame_time);
+            PM.recordMetric(FrameMetric::FRAME_JITTER, frame_time > m_fixed_step_us ?
+                frame_time - m_fixed_step_us : m_fixed_step_us - frame_time);
+
+            // Commit the frame statistics
+            PM.endFrame();
+        }
+
+        LM.writeLog("GameManager::run() - Game loop ended after %d steps", m_step_count);
+    }
+#endif
+
+    // Run the game loop without a window until game over or a frame limit
+    int GameManager::runHeadless(int max_frames) {
+        const bool paced = (m_pacing_mode == PacingMode::FIXED_RATE);
+        LM.writeLog("GameManager::runHeadless() - Starting headless loop (%s, %d frames)",
+            paced ? "fixed rate" : "uncapped", max_frames);
+
+        // A replay ends the run once its last recorded frame has been stepped
+        const bool replaying = IM.isReplaying();
+
+        int frames = 0;
+        while (!m_game_over && (max_frames <= 0 || frames < max_frames)) {
+            stepHeadlessFrame(paced);
+            frames++;
+
+            if (replaying && !IM.isReplaying()) {
+                break;
+            }
+        }
+
+        LM.writeLog("GameManager::runHeadless() - Headless loop ended after %d frames", frames);
+        return frames;
+    }
+
+    // Advance the simulation by a number of frames immediately
+    int GameManager::stepFrames(int frame_count) {
+        int frames = 0;
+        while (!m_game_over && frames < frame_count) {
+            stepHeadlessFrame(false);
+            frames++;
+        }
+        return frames;
+    }
+
+    // Refresh input ahead of one simulation step of the frame
+    void GameManager::updateInput(int step) {
+        IM.update();
+
+        // The frame's events arrive before its first step, later steps only pick up stragglers
+        if (step == 0) {
+            PM.recordMetric(FrameMetric::INPUT_LATENCY, IM.getInputLatency());
+        }
+        PM.addMetric(FrameMetric::INPUT_EVENTS, static_cast<int64_t>(IM.getFrameEvents().size()));
+    }
+
+    // Run one headless frame of exactly one fixed simulation step
+    void GameManager::stepHeadlessFrame(bool paced) {
+        PM.beginFrame();
+        int64_t frame_start = Clock::now();
+
+        // Exactly one step with the fixed dt, independent of real time, unless a replay
+        // says how many steps the recorded frame ran
+        int steps = IM.getReplayFrameSteps();
+        if (steps < 0) {
+            steps = 1;
+        }
+
+        // Input still runs so injected or replayed events reach the systems
+        Clock update_clock;
+        for (int step = 0; step < steps; ++step) {
+            updateInput(step);
+            update(getFixedStep());
+        }
+        m_interpolation_alpha = 0.0f;
+        PM.recordMetric(FrameMetric::UPDATE_TIME, update_clock.split());
+        PM.recordMetric(FrameMetric::SIM_STEPS, steps);
+        IM.endFrame(steps);
+
+        int64_t frame_time = Clock::now() - frame_start;
+        if (paced) {
+            int64_t target_time = frame_start + m_fixed_step_us;
+            int64_t wait_start = Clock::now();
+            if (wait_start < target_time) {
+                waitUntil(target_time);
+                PM.recordMetric(FrameMetric::SLEEP_TIME, Clock::now() - wait_start);
+            }
+            else {
+                PM.recordMetric(FrameMetric::OVERRUN_TIME, wait_start - target_time);
+            }
+
+            frame_time = Clock::now() - frame_start;
+            PM.recordMetric(FrameMetric::FRAME_JITTER, frame_time > m_fixed_step_us ?
+                frame_time - m_fixed_step_us : m_fixed_step_us - frame_time);
+        }
+
+        PM.recordMetric(FrameMetric::FRAME_TIME, frame_time);
+        PM.endFrame();
+    }
+
+    // Set how the game loop is hosted
+    void GameManager::setRunMode(RunMode mode) {
+        m_run_mode = mode;
+    }
+
+    // Get how the game loop is hosted
+    RunMode GameManager::getRunMode() const {
+        return m_run_mode;
+    }
+
+    // Check if the engine is running without a window
+    bool GameManager::isHeadless() const {
+        return m_run_mode == RunMode::HEADLESS;
+    }
+
+    // Set how headless frames are paced
+    void GameManager::setPacingMode(PacingMode mode) {
+        m_pacing_mode = mode;
+    }
+
+    // Wait until the monotonic clock reaches a target time
+    void GameManager::waitUntil(int64_t target_us) const {
+        for (;;) {
+            int64_t remaining = target_us - Clock::now();
+            if (remaining <= 0) {
+                break;
+            }
+
+            if (remaining > SPIN_WAIT_THRESHOLD_US) {
+                // Sleep for the bulk of the wait, leaving the threshold to spin off
+                std::this_thread::sleep_for(std::chrono::microseconds(remaining - SPIN_WAIT_THRESHOLD_US));
+            }
+            else {
+                // Close to the target: give up the time slice but stay runnable
+                std::this_thread::yield();
+            }
+        }
+    }
+
     // Set game over status
     void GameManager::setGameOver(bool new_game_over) {
         m_game_over = new_game_over;
@@ -177,9 +539,30 @@ namespace gam300 {
 
     // Get frame time in milliseconds
     int GameManager::getFrameTime() const {
-        // For now, return the default value
-        // In a more complete implementation, this would be read from a config file
-        return FRAME_TIME_DEFAULT;
+        // The frame is paced to the fixed simulation step
+        return static_cast<int>(m_fixed_step_us / 1000);
+    }
+
+    // Get the fixed simulation step in seconds
+    float GameManager::getFixedStep() const {
+        return static_cast<float>(m_fixed_step_us) / 1000000.0f;
+    }
+
+    // Set the fixed simulation step in microseconds
+    void GameManager::setFixedStep(int64_t step_us) {
+        if (step_us > 0) {
+            m_fixed_step_us = step_us;
+        }
+    }
+
+    // Set the maximum number of simulation steps run in one frame
+    void GameManager::setMaxStepsPerFrame(int max_steps) {
+        m_max_steps_per_frame = max_steps < 1 ? 1 : max_steps;
+    }
+
+    // Get the interpolation alpha between the last two simulation steps
+    float GameManager::getInterpolationAlpha() const {
+        return m_interpolation_alpha;
     }
 
     // Get step count
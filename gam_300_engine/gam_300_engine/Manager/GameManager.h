@@ -17,6 +17,7 @@
 #include <GLFW/glfw3.h>
 #include <thread>
 #include <chrono>
+#include <cstdint>
 
 
  // Forward declaration for Clock (to avoid circular dependency)
@@ -32,6 +33,28 @@ namespace gam300 {
     // Default frame time (game loop time) in milliseconds (11.11 ms == 90 f/s).
     const int FRAME_TIME_DEFAULT = 11;
 
+    // Default maximum number of fixed simulation steps run in one frame.
+    const int MAX_STEPS_PER_FRAME_DEFAULT = 5;
+
+    // Longest real time (in microseconds) a single frame may feed into the accumulator.
+    const int64_t MAX_FRAME_DELTA_US = 250000;
+
+    // Waits shorter than this (in microseconds) are spun instead of slept, since
+    // OS sleeps routinely overshoot by a scheduler quantum.
+    const int64_t SPIN_WAIT_THRESHOLD_US = 2000;
+
+    // How the game loop is hosted.
+    enum class RunMode {
+        WINDOWED,   // GLFW window, rendering and OS input
+        HEADLESS    // Simulation only, no GLFW or GL (servers, build boxes, benchmarks)
+    };
+
+    // How frames are paced.
+    enum class PacingMode {
+        FIXED_RATE, // One frame per fixed step of real time
+        UNCAPPED    // Run frames back to back as fast as possible
+    };
+
     class GameManager : public Manager {
 
     private:
@@ -40,6 +63,38 @@ namespace gam300 {
         void operator=(GameManager const&); // Don't allow assignment.
         bool m_game_over;                   // True -> game loop should stop.
         int m_step_count;                   // Count of game loop iterations.
+        int64_t m_fixed_step_us;            // Simulation step length in microseconds.
+        int m_max_steps_per_frame;          // Spiral-of-death guard for the accumulator.
+        int64_t m_accumulator_us;           // Real time not yet consumed by simulation steps.
+        float m_interpolation_alpha;        // Fraction of a step left in the accumulator after updating.
+        RunMode m_run_mode;                 // Windowed or headless.
+        PacingMode m_pacing_mode;           // Frame pacing used by run() and runHeadless().
+
+        /**
+         * @brief Refresh input ahead of one simulation step and record its statistics.
+         * @param step Index of the step within the frame, input latency is taken from the first.
+         */
+        void updateInput(int step);
+
+        /**
+         * @brief Run one headless frame of exactly one fixed simulation step.
+         * @param paced True to wait out the rest of the fixed step afterwards.
+         */
+        void stepHeadlessFrame(bool paced);
+
+        /**
+         * @brief Wait until the monotonic clock reaches a target time.
+         * @param target_us Target time from Clock::now() in microseconds.
+         * @details Sleeps for the bulk of the wait and spins for the remainder.
+         */
+        void waitUntil(int64_t target_us) const;
+
+        /**
+         * @brief Apply the settings loaded by the ConfigManager.
+         * @details Configures logging, statistics, pool capacity, the asset root
+         *          and the game loop timing and run mode.
+         */
+        void applyConfig();
 
     public:
         /**
@@ -75,6 +130,59 @@ namespace gam300 {
          */
         void update(float dt);
 
+#ifndef GAM300_HEADLESS_BUILD
+        /**
+         * @brief Run the game loop until game over or the window is closed.
+         * @param window The window to poll events from and present to.
+         * @details Advances the simulation in fixed steps driven by an accumulator
+         *          and paces frames to the frame time with a hybrid sleep/spin wait.
+         */
+        void run(GLFWwindow* window);
+#endif
+
+        /**
+         * @brief Run the game loop without a window until game over or a frame limit.
+         * @param max_frames Number of frames to run (0 runs until game over).
+         * @return Number of frames run.
+         * @details Every frame advances the simulation by exactly one fixed step, so a
+         *          given input stream always produces the same simulation. Frames are
+         *          paced according to the pacing mode.
+         */
+        int runHeadless(int max_frames = 0);
+
+        /**
+         * @brief Advance the simulation by a number of frames immediately.
+         * @param frame_count Number of frames to step.
+         * @return Number of frames stepped (fewer if the game ended).
+         * @details Each frame runs one fixed step with no waiting, for deterministic
+         *          benchmarks and tests.
+         */
+        int stepFrames(int frame_count);
+
+        /**
+         * @brief Set how the game loop is hosted.
+         * @param mode The run mode.
+         */
+        void setRunMode(RunMode mode);
+
+        /**
+         * @brief Get how the game loop is hosted.
+         * @return The run mode.
+         */
+        RunMode getRunMode() const;
+
+        /**
+         * @brief Check if the engine is running without a window.
+         * @return True if headless, false otherwise.
+         */
+        bool isHeadless() const;
+
+        /**
+         * @brief Set how frames are paced.
+         * @param mode The pacing mode.
+         */
+        void setPacingMode(PacingMode mode);
+
         /**
          * @brief Set game over status to indicated value.
          * @param new_game_over The new game over status (default: true).
@@ -95,6 +203,32 @@ namespace gam300 {
          */
         int getFrameTime() const;
 
+        /**
+         * @brief Return the fixed simulation step.
+         * @return Step length in seconds.
+         */
+        float getFixedStep() const;
+
+        /**
+         * @brief Set the fixed simulation step.
+         * @param step_us Step length in microseconds (must be positive).
+         */
+        void setFixedStep(int64_t step_us);
+
+        /**
+         * @brief Set the maximum number of simulation steps run in one frame.
+         * @param max_steps Maximum step count (at least 1).
+         * @details Time beyond this many steps is dropped so a slow frame cannot
+         *          cause ever longer catch-up frames.
+         */
+        void setMaxStepsPerFrame(int max_steps);
+
+        /**
+         * @brief Return how far presentation is between the last two simulation steps.
+         * @return Interpolation alpha in [0, 1).
+         */
+        float getInterpolationAlpha() const;
+
         /**
          * @brief Return game loop step count.
          * @return The current game loop step count.
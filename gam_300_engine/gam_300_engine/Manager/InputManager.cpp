@@ -11,31 +11,131 @@
 
 #include "InputManager.h"
 #include "LogManager.h"
+#include "../Utility/Clock.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
 
 namespace gam300 {
 
+    // Recording file layout, all values little endian:
+    //   header: "G3IN", uint16 version, uint16 reserved, uint32 fixed step in microseconds
+    //   frame:  uint8 simulation steps, uint8 update count, then per update
+    //   update: uint16 event count, then per event
+    //           uint8 type, uint8 action, int16 code, uint32 age in microseconds when consumed,
+    //           and float32 x, y for CURSOR and SCROLL events only
+    static const char INPUT_RECORDING_MAGIC[4] = { 'G', '3', 'I', 'N' };
+    static const uint16_t INPUT_RECORDING_VERSION = 2;
+    static const std::size_t INPUT_RECORDING_HEADER_SIZE = 12;
+    static const std::size_t INPUT_RECORDING_FRAME_SIZE = 2;
+    static const std::size_t INPUT_RECORDING_UPDATE_SIZE = 2;
+    static const std::size_t INPUT_RECORDING_EVENT_SIZE = 8;
+    static const std::size_t INPUT_RECORDING_POSITION_SIZE = 8;
+
+    // Append little endian values to a recording buffer
+    static void writeU16(std::vector<uint8_t>& buffer, uint16_t value) {
+        buffer.push_back(static_cast<uint8_t>(value));
+        buffer.push_back(static_cast<uint8_t>(value >> 8));
+    }
+
+    static void writeU32(std::vector<uint8_t>& buffer, uint32_t value) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            buffer.push_back(static_cast<uint8_t>(value >> shift));
+        }
+    }
+
+    static void writeF32(std::vector<uint8_t>& buffer, float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeU32(buffer, bits);
+    }
+
+    // Read little endian values from a recording, the caller checks the bounds
+    static uint16_t readU16(const uint8_t* data) {
+        return static_cast<uint16_t>(data[0] | (data[1] << 8));
+    }
+
+    static uint32_t readU32(const uint8_t* data) {
+        return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+            (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+    }
+
+    static float readF32(const uint8_t* data) {
+        uint32_t bits = readU32(data);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    // Whether an event carries a position
+    static bool hasPosition(InputEventType type) {
+        return type == InputEventType::CURSOR || type == InputEventType::SCROLL;
+    }
+
+    // Size of the recorded frame starting at 'offset', 0 if it runs past the end of the data
+    static std::size_t getRecordedFrameSize(const std::vector<uint8_t>& data, std::size_t offset) {
+        if (data.size() - offset < INPUT_RECORDING_FRAME_SIZE) {
+            return 0;
+        }
+
+        std::size_t size = INPUT_RECORDING_FRAME_SIZE;
+        uint8_t update_count = data[offset + 1];
+        for (uint8_t update = 0; update < update_count; ++update) {
+            if (data.size() - offset - size < INPUT_RECORDING_UPDATE_SIZE) {
+                return 0;
+            }
+            uint16_t event_count = readU16(&data[offset + size]);
+            size += INPUT_RECORDING_UPDATE_SIZE;
+            for (uint16_t i = 0; i < event_count; ++i) {
+                if (data.size() - offset - size < INPUT_RECORDING_EVENT_SIZE) {
+                    return 0;
+                }
+                bool position = hasPosition(static_cast<InputEventType>(data[offset + size]));
+                size += INPUT_RECORDING_EVENT_SIZE;
+                if (position) {
+                    if (data.size() - offset - size < INPUT_RECORDING_POSITION_SIZE) {
+                        return 0;
+                    }
+                    size += INPUT_RECORDING_POSITION_SIZE;
+                }
+            }
+        }
+        return size;
+    }
+
     // Initialize static instance pointer for callback access
     InputManager* InputManager::s_instance = nullptr;
 
     // Constructor
     InputManager::InputManager() :
         m_window(nullptr),
+        m_input_latency(0),
+        m_frame_open(false),
+        m_record_update_count(0),
+        m_recording(false),
+        m_recorded_frames(0),
+        m_replay_offset(0),
+        m_replay_cursor(0),
+        m_replay_updates_left(0),
+        m_replaying(false),
+        m_replayed_frames(0),
+        m_replay_fixed_step_us(0),
+        m_key_current{},
+        m_key_pressed{},
+        m_key_released{},
+        m_mouse_current(0),
+        m_mouse_pressed(0),
+        m_mouse_released(0),
         m_mouse_x(0.0),
         m_mouse_y(0.0),
         m_prev_mouse_x(0.0),
         m_prev_mouse_y(0.0),
         m_scroll_x_offset(0.0),
-        m_scroll_y_offset(0.0) {
+        m_scroll_y_offset(0.0),
+        m_context_order_dirty(true) {
 
         setType("InputManager");
-
-        // Initialize mouse button states
-        for (auto& state : m_mouse_button_states) {
-            state = InputState::RELEASED;
-        }
-        for (auto& state : m_prev_mouse_button_states) {
-            state = InputState::RELEASED;
-        }
     }
 
     // Get the singleton instance
@@ -51,6 +151,13 @@ namespace gam300 {
         if (Manager::startUp())
             return -1;
 
+        // A live update never consumes more events than the queue holds, so only replays grow this
+        m_frame_events.reserve(INPUT_EVENT_QUEUE_CAPACITY);
+
+        // The built-in axes come first so their IDs are fixed
+        createAxis("mouse_delta_x", InputAxisSource::MOUSE_DELTA_X);
+        createAxis("mouse_delta_y", InputAxisSource::MOUSE_DELTA_Y);
+
         // Log startup
         LM.writeLog("InputManager::startUp() - Input Manager started successfully");
 
@@ -64,16 +171,41 @@ namespace gam300 {
 
         // Reset window callbacks if we have a window
         if (m_window) {
+#ifndef GAM300_HEADLESS_BUILD
             glfwSetKeyCallback(m_window, nullptr);
             glfwSetMouseButtonCallback(m_window, nullptr);
             glfwSetCursorPosCallback(m_window, nullptr);
             glfwSetScrollCallback(m_window, nullptr);
+#endif
             m_window = nullptr;
         }
 
         // Clear stored states
-        m_key_states.clear();
-        m_prev_key_states.clear();
+        stopRecording();
+        stopReplay();
+        m_event_queue.clear();
+        m_frame_events.clear();
+        m_input_latency = 0;
+        m_frame_open = false;
+        m_key_current.fill(0);
+        m_key_pressed.fill(0);
+        m_key_released.fill(0);
+        m_mouse_current = m_mouse_pressed = m_mouse_released = 0;
+        m_scroll_x_offset = m_scroll_y_offset = 0.0;
+
+        // Forget the contexts, they refer to interned names
+        m_contexts.clear();
+        m_context_order.clear();
+        m_context_events.clear();
+        m_context_order_dirty = true;
+
+        // Axes are redefined by whoever starts the manager again, the built-in ones by startUp()
+        m_axes.clear();
+        m_axis_values.clear();
+
+        // Forget interned action names
+        m_action_ids.clear();
+        m_action_names.clear();
 
         // Call parent's shutDown()
         Manager::shutDown();
@@ -83,6 +215,10 @@ namespace gam300 {
     void InputManager::setWindow(GLFWwindow* window) {
         m_window = window;
 
+#ifdef GAM300_HEADLESS_BUILD
+        // Headless builds don't link GLFW, so there is never a window to listen to
+        m_window = nullptr;
+#else
         if (m_window) {
             // Set up GLFW callbacks
             glfwSetKeyCallback(m_window, key_callback);
@@ -97,93 +233,236 @@ namespace gam300 {
 
             LM.writeLog("InputManager::setWindow() - Window set and callbacks registered");
         }
+#endif
     }
 
-    // Update input states, should be called once per frame
+    // Update input states, should be called once per simulation step
     void InputManager::update() {
-        // Store previous states for transitions
-        m_prev_key_states = m_key_states;
-        m_prev_mouse_button_states = m_mouse_button_states;
+        // Edges and scrolling only cover the events since the last update
+        m_key_pressed.fill(0);
+        m_key_released.fill(0);
+        m_mouse_pressed = 0;
+        m_mouse_released = 0;
+        m_scroll_x_offset = 0.0;
+        m_scroll_y_offset = 0.0;
 
         // Store previous mouse position
         m_prev_mouse_x = m_mouse_x;
         m_prev_mouse_y = m_mouse_y;
 
-        // Update key states from JUST_PRESSED to PRESSED and JUST_RELEASED to RELEASED
-        for (auto& key_state : m_key_states) {
-            if (key_state.second == InputState::JUST_PRESSED) {
-                key_state.second = InputState::PRESSED;
+        int64_t now = Clock::now();
+        bool first_update = !m_frame_open;
+        m_frame_open = true;
+        m_frame_events.clear();
+        if (m_replaying) {
+            // A replay replaces whatever the window delivered with the events this update consumed when recorded
+            m_event_queue.clear();
+            if (first_update) {
+                openReplayFrame();
+            }
+            replayUpdate(now, true);
+        }
+        else {
+            // Apply the events in arrival order, so a press and release between two updates both count
+            InputEvent event;
+            while (m_event_queue.pop(event)) {
+                m_frame_events.push_back(event);
+                applyEvent(event);
+            }
+        }
+
+        // Each update is recorded on its own so a replay hands every step the same events
+        if (m_recording) {
+            writeU16(m_record_buffer, static_cast<uint16_t>(m_frame_events.size()));
+            for (const InputEvent& frame_event : m_frame_events) {
+                recordEvent(frame_event, now);
             }
-            else if (key_state.second == InputState::JUST_RELEASED) {
-                key_state.second = InputState::RELEASED;
+            m_record_update_count++;
+        }
+
+        // The first event has waited the longest for the simulation to see it
+        m_input_latency = 0;
+        if (!m_frame_events.empty()) {
+            int64_t latency = now - m_frame_events.front().timestamp;
+            m_input_latency = latency > 0 ? latency : 0;
+        }
+
+        // Shared contexts are evaluated once here rather than per entity
+        evaluateContexts();
+        evaluateAxes();
+
+        uint32_t dropped = m_event_queue.takeDropped();
+        if (dropped > 0) {
+            LM.writeLog(LogLevel::WARNING, "InputManager::update() - Input event queue full, dropped %u events", dropped);
+        }
+    }
+
+    // Apply one event to the input state
+    void InputManager::applyEvent(const InputEvent& event) {
+        switch (event.type) {
+        case InputEventType::KEY: {
+            if (event.code < 0 || event.code >= KEY_STATE_COUNT) {
+                break; // GLFW_KEY_UNKNOWN and out of range codes
+            }
+            uint64_t& word = m_key_current[event.code >> 6];
+            uint64_t bit = uint64_t(1) << (event.code & 63);
+            if (event.action == GLFW_PRESS && !(word & bit)) {
+                word |= bit;
+                m_key_pressed[event.code >> 6] |= bit;
             }
+            else if (event.action == GLFW_RELEASE && (word & bit)) {
+                word &= ~bit;
+                m_key_released[event.code >> 6] |= bit;
+            }
+            break;
         }
 
-        // Update mouse button states
-        for (int i = 0; i < MAX_MOUSE_BUTTONS; ++i) {
-            if (m_mouse_button_states[i] == InputState::JUST_PRESSED) {
-                m_mouse_button_states[i] = InputState::PRESSED;
+        case InputEventType::MOUSE_BUTTON: {
+            if (event.code < 0 || event.code >= MAX_MOUSE_BUTTONS) {
+                break;
+            }
+            uint32_t bit = 1u << event.code;
+            if (event.action == GLFW_PRESS && !(m_mouse_current & bit)) {
+                m_mouse_current |= bit;
+                m_mouse_pressed |= bit;
             }
-            else if (m_mouse_button_states[i] == InputState::JUST_RELEASED) {
-                m_mouse_button_states[i] = InputState::RELEASED;
+            else if (event.action == GLFW_RELEASE && (m_mouse_current & bit)) {
+                m_mouse_current &= ~bit;
+                m_mouse_released |= bit;
             }
+            break;
         }
 
-        // Reset scroll values since they're only valid for one frame
-        m_scroll_x_offset = 0.0;
-        m_scroll_y_offset = 0.0;
+        case InputEventType::CURSOR:
+            m_mouse_x = event.x;
+            m_mouse_y = event.y;
+            break;
+
+        case InputEventType::SCROLL:
+            m_scroll_x_offset += event.x;
+            m_scroll_y_offset += event.y;
+            break;
+        }
+    }
+
+    // Queue an input event for the next update
+    void InputManager::injectEvent(const InputEvent& event) {
+        m_event_queue.push(event);
+    }
+
+    // Queue a key event for the next update
+    void InputManager::injectKeyEvent(int key, int action) {
+        // Key repeats don't change the state, keep them out of the queue
+        if (action != GLFW_PRESS && action != GLFW_RELEASE) {
+            return;
+        }
+
+        InputEvent event;
+        event.timestamp = Clock::now();
+        event.code = key;
+        event.action = action;
+        event.type = InputEventType::KEY;
+        m_event_queue.push(event);
+    }
+
+    // Queue a mouse button event for the next update
+    void InputManager::injectMouseButtonEvent(int button, int action) {
+        InputEvent event;
+        event.timestamp = Clock::now();
+        event.code = button;
+        event.action = action;
+        event.type = InputEventType::MOUSE_BUTTON;
+        m_event_queue.push(event);
+    }
+
+    // Queue a cursor movement for the next update
+    void InputManager::injectCursorEvent(double x, double y) {
+        InputEvent event;
+        event.timestamp = Clock::now();
+        event.x = x;
+        event.y = y;
+        event.type = InputEventType::CURSOR;
+        m_event_queue.push(event);
+    }
+
+    // Queue a scroll event for the next update
+    void InputManager::injectScrollEvent(double x_offset, double y_offset) {
+        InputEvent event;
+        event.timestamp = Clock::now();
+        event.x = x_offset;
+        event.y = y_offset;
+        event.type = InputEventType::SCROLL;
+        m_event_queue.push(event);
+    }
+
+    // Get the events consumed by the last update
+    const std::vector<InputEvent>& InputManager::getFrameEvents() const {
+        return m_frame_events;
+    }
+
+    // Get how long input waited before the last update consumed it
+    int64_t InputManager::getInputLatency() const {
+        return m_input_latency;
     }
 
     // Check if a key is currently pressed
     bool InputManager::isKeyPressed(int key) const {
-        auto it = m_key_states.find(key);
-        if (it != m_key_states.end()) {
-            return it->second == InputState::PRESSED || it->second == InputState::JUST_PRESSED;
-        }
-        return false;
+        return testKey(m_key_current, key);
     }
 
     // Check if a key was just pressed this frame
     bool InputManager::isKeyJustPressed(int key) const {
-        auto it = m_key_states.find(key);
-        if (it != m_key_states.end()) {
-            return it->second == InputState::JUST_PRESSED;
-        }
-        return false;
+        return testKey(m_key_pressed, key);
     }
 
     // Check if a key was just released this frame
     bool InputManager::isKeyJustReleased(int key) const {
-        auto it = m_key_states.find(key);
-        if (it != m_key_states.end()) {
-            return it->second == InputState::JUST_RELEASED;
-        }
-        return false;
+        return testKey(m_key_released, key);
     }
 
     // Check if a mouse button is currently pressed
     bool InputManager::isMouseButtonPressed(int button) const {
-        if (button >= 0 && button < MAX_MOUSE_BUTTONS) {
-            return m_mouse_button_states[button] == InputState::PRESSED ||
-                m_mouse_button_states[button] == InputState::JUST_PRESSED;
-        }
-        return false;
+        return button >= 0 && button < MAX_MOUSE_BUTTONS && (m_mouse_current >> button) & 1u;
     }
 
     // Check if a mouse button was just pressed this frame
     bool InputManager::isMouseButtonJustPressed(int button) const {
-        if (button >= 0 && button < MAX_MOUSE_BUTTONS) {
-            return m_mouse_button_states[button] == InputState::JUST_PRESSED;
-        }
-        return false;
+        return button >= 0 && button < MAX_MOUSE_BUTTONS && (m_mouse_pressed >> button) & 1u;
     }
 
     // Check if a mouse button was just released this frame
     bool InputManager::isMouseButtonJustReleased(int button) const {
-        if (button >= 0 && button < MAX_MOUSE_BUTTONS) {
-            return m_mouse_button_states[button] == InputState::JUST_RELEASED;
-        }
-        return false;
+        return button >= 0 && button < MAX_MOUSE_BUTTONS && (m_mouse_released >> button) & 1u;
+    }
+
+    // Get the keys held this frame
+    const KeyStateBits& InputManager::getKeysDown() const {
+        return m_key_current;
+    }
+
+    // Get the keys that went down this frame
+    const KeyStateBits& InputManager::getKeysPressed() const {
+        return m_key_pressed;
+    }
+
+    // Get the keys that went up this frame
+    const KeyStateBits& InputManager::getKeysReleased() const {
+        return m_key_released;
+    }
+
+    // Get the mouse buttons held this frame
+    uint32_t InputManager::getMouseButtonsDown() const {
+        return m_mouse_current;
+    }
+
+    // Get the mouse buttons that went down this frame
+    uint32_t InputManager::getMouseButtonsPressed() const {
+        return m_mouse_pressed;
+    }
+
+    // Get the mouse buttons that went up this frame
+    uint32_t InputManager::getMouseButtonsReleased() const {
+        return m_mouse_released;
     }
 
     // Get the current mouse X position
@@ -219,40 +498,596 @@ namespace gam300 {
     // GLFW Callback for keyboard input
     void InputManager::key_callback(GLFWwindow* /*window*/, int key, int /*scancode*/, int action, int /*mods*/) {
         if (s_instance) {
-            if (action == GLFW_PRESS) {
-                s_instance->m_key_states[key] = InputState::JUST_PRESSED;
-            }
-            else if (action == GLFW_RELEASE) {
-                s_instance->m_key_states[key] = InputState::JUST_RELEASED;
-            }
+            s_instance->injectKeyEvent(key, action);
         }
     }
 
     // GLFW Callback for mouse button input
     void InputManager::mouse_button_callback(GLFWwindow* /*window*/, int button, int action, int /*mods*/) {
-        if (s_instance && button >= 0 && button < MAX_MOUSE_BUTTONS) {
-            if (action == GLFW_PRESS) {
-                s_instance->m_mouse_button_states[button] = InputState::JUST_PRESSED;
-            }
-            else if (action == GLFW_RELEASE) {
-                s_instance->m_mouse_button_states[button] = InputState::JUST_RELEASED;
-            }
+        if (s_instance) {
+            s_instance->injectMouseButtonEvent(button, action);
         }
     }
 
     // GLFW Callback for cursor position
     void InputManager::cursor_position_callback(GLFWwindow* /*window*/, double xpos, double ypos) {
         if (s_instance) {
-            s_instance->m_mouse_x = xpos;
-            s_instance->m_mouse_y = ypos;
+            s_instance->injectCursorEvent(xpos, ypos);
         }
     }
 
     // GLFW Callback for scroll input
     void InputManager::scroll_callback(GLFWwindow* /*window*/, double xoffset, double yoffset) {
         if (s_instance) {
-            s_instance->m_scroll_x_offset = xoffset;
-            s_instance->m_scroll_y_offset = yoffset;
+            s_instance->injectScrollEvent(xoffset, yoffset);
+        }
+    }
+
+    // Intern an action name
+    ActionID InputManager::internAction(const std::string& name) {
+        auto it = m_action_ids.find(name);
+        if (it != m_action_ids.end()) {
+            return it->second;
+        }
+
+        ActionID action = static_cast<ActionID>(m_action_names.size());
+        m_action_names.push_back(name);
+        m_action_ids.emplace(name, action);
+        return action;
+    }
+
+    // Look up an action name without interning it
+    ActionID InputManager::findAction(const std::string& name) const {
+        auto it = m_action_ids.find(name);
+        return it != m_action_ids.end() ? it->second : INVALID_ACTION_ID;
+    }
+
+    // Get the name of an action ID
+    const std::string& InputManager::getActionName(ActionID action) const {
+        static const std::string empty_name;
+        return action < m_action_names.size() ? m_action_names[action] : empty_name;
+    }
+
+    // Get the number of interned action names
+    std::size_t InputManager::getActionCount() const {
+        return m_action_names.size();
+    }
+
+    // Create an axis driven by a pair of keys or mouse buttons
+    AxisID InputManager::createKeyAxis(const std::string& name, int negative_key, int positive_key, float scale) {
+        AxisID id = findAxis(name);
+        if (id == INVALID_AXIS_ID) {
+            id = static_cast<AxisID>(m_axes.size());
+            m_axes.push_back({ name, InputAxisSource::KEYS, -1, -1, 1.0f, 0.0f });
+            m_axis_values.push_back(0.0f);
+        }
+
+        InputAxis& axis = m_axes[id];
+        axis.source = InputAxisSource::KEYS;
+        axis.negative_key = negative_key;
+        axis.positive_key = positive_key;
+        axis.scale = scale;
+        axis.dead_zone = 0.0f;
+        return id;
+    }
+
+    // Create an axis driven by mouse movement or scrolling
+    AxisID InputManager::createAxis(const std::string& name, InputAxisSource source, float scale, float dead_zone) {
+        if (source == InputAxisSource::KEYS) {
+            LM.writeLog(LogLevel::WARNING, "InputManager::createAxis() - Axis '%s' needs keys, use createKeyAxis()", name.c_str());
+            return INVALID_AXIS_ID;
+        }
+
+        AxisID id = findAxis(name);
+        if (id == INVALID_AXIS_ID) {
+            id = static_cast<AxisID>(m_axes.size());
+            m_axes.push_back({ name, source, -1, -1, 1.0f, 0.0f });
+            m_axis_values.push_back(0.0f);
+        }
+
+        InputAxis& axis = m_axes[id];
+        axis.source = source;
+        axis.negative_key = axis.positive_key = -1;
+        axis.scale = scale;
+        axis.dead_zone = dead_zone;
+        return id;
+    }
+
+    // Find an axis by name
+    AxisID InputManager::findAxis(const std::string& name) const {
+        for (std::size_t i = 0; i < m_axes.size(); ++i) {
+            if (m_axes[i].name == name) {
+                return static_cast<AxisID>(i);
+            }
+        }
+        return INVALID_AXIS_ID;
+    }
+
+    // Get an axis definition
+    const InputAxis* InputManager::getAxis(AxisID axis) const {
+        return axis < m_axes.size() ? &m_axes[axis] : nullptr;
+    }
+
+    // Get the number of axes
+    std::size_t InputManager::getAxisCount() const {
+        return m_axes.size();
+    }
+
+    // Change the scale of an axis
+    void InputManager::setAxisScale(AxisID axis, float scale) {
+        if (axis < m_axes.size()) {
+            m_axes[axis].scale = scale;
+        }
+    }
+
+    // Get the value of an axis after the last update
+    float InputManager::getAxisValue(AxisID axis) const {
+        return axis < m_axis_values.size() ? m_axis_values[axis] : 0.0f;
+    }
+
+    // Get the values of every axis after the last update
+    const float* InputManager::getAxisValues() const {
+        return m_axis_values.data();
+    }
+
+    // Test a key or offset mouse button code against the held state
+    bool InputManager::isInputCodeDown(int input_code) const {
+        if (input_code >= MOUSE_BUTTON_INPUT_OFFSET) {
+            int button = input_code - MOUSE_BUTTON_INPUT_OFFSET;
+            return button < MAX_MOUSE_BUTTONS && (m_mouse_current >> button) & 1u;
+        }
+        return testKey(m_key_current, input_code);
+    }
+
+    // Evaluate every axis into m_axis_values
+    void InputManager::evaluateAxes() {
+        // The analog sources are read once per update, indexed by InputAxisSource
+        const float analog[] = {
+            0.0f,
+            static_cast<float>(m_mouse_x - m_prev_mouse_x),
+            static_cast<float>(m_mouse_y - m_prev_mouse_y),
+            static_cast<float>(m_scroll_x_offset),
+            static_cast<float>(m_scroll_y_offset)
+        };
+
+        for (std::size_t i = 0; i < m_axes.size(); ++i) {
+            const InputAxis& axis = m_axes[i];
+            float value = axis.source == InputAxisSource::KEYS
+                ? static_cast<float>(isInputCodeDown(axis.positive_key)) - static_cast<float>(isInputCodeDown(axis.negative_key))
+                : analog[static_cast<int>(axis.source)];
+            value *= axis.scale;
+            m_axis_values[i] = std::fabs(value) > axis.dead_zone ? value : 0.0f;
+        }
+    }
+
+    // Start recording input to a file
+    bool InputManager::startRecording(const std::string& filename, int64_t fixed_step_us) {
+        stopRecording();
+
+        m_record_file.open(filename, std::ios::binary | std::ios::trunc);
+        if (!m_record_file.is_open()) {
+            LM.writeLog(LogLevel::ERROR_LEVEL, "InputManager::startRecording() - Failed to open '%s'", filename.c_str());
+            return false;
+        }
+
+        m_record_buffer.clear();
+        for (char magic : INPUT_RECORDING_MAGIC) {
+            m_record_buffer.push_back(static_cast<uint8_t>(magic));
+        }
+        writeU16(m_record_buffer, INPUT_RECORDING_VERSION);
+        writeU16(m_record_buffer, 0);
+        writeU32(m_record_buffer, static_cast<uint32_t>(fixed_step_us));
+        m_record_file.write(reinterpret_cast<const char*>(m_record_buffer.data()), m_record_buffer.size());
+
+        // The open frame's record starts empty, updates append to it
+        m_record_buffer.assign(INPUT_RECORDING_FRAME_SIZE, 0);
+        m_record_update_count = 0;
+        m_recording = true;
+        m_recorded_frames = 0;
+        LM.writeLog("InputManager::startRecording() - Recording input to '%s'", filename.c_str());
+        return true;
+    }
+
+    // Append an event to the open frame of the recording
+    void InputManager::recordEvent(const InputEvent& event, int64_t now) {
+        int64_t age = now - event.timestamp;
+        m_record_buffer.push_back(static_cast<uint8_t>(event.type));
+        m_record_buffer.push_back(static_cast<uint8_t>(event.action));
+        writeU16(m_record_buffer, static_cast<uint16_t>(static_cast<int16_t>(event.code)));
+        writeU32(m_record_buffer, static_cast<uint32_t>(age < 0 ? 0 : (age > UINT32_MAX ? UINT32_MAX : age)));
+        if (hasPosition(event.type)) {
+            writeF32(m_record_buffer, static_cast<float>(event.x));
+            writeF32(m_record_buffer, static_cast<float>(event.y));
+        }
+    }
+
+    // Close the frame
+    void InputManager::endFrame(int sim_steps) {
+        if (m_recording) {
+            if (sim_steps < 0 || sim_steps > UINT8_MAX || m_record_update_count > UINT8_MAX) {
+                // The header can't hold the frame, a recording that skipped it would replay differently
+                LM.writeLog(LogLevel::ERROR_LEVEL, "InputManager::endFrame() - Frame of %d steps and %zu updates doesn't fit the recording format, recording stopped",
+                    sim_steps, m_record_update_count);
+                stopRecording();
+            }
+            else {
+                // Fill in the frame header now the steps and updates are known
+                m_record_buffer[0] = static_cast<uint8_t>(sim_steps);
+                m_record_buffer[1] = static_cast<uint8_t>(m_record_update_count);
+
+                // The file stream buffers the small writes
+                m_record_file.write(reinterpret_cast<const char*>(m_record_buffer.data()), m_record_buffer.size());
+                m_recorded_frames++;
+            }
+            m_record_buffer.assign(INPUT_RECORDING_FRAME_SIZE, 0);
+            m_record_update_count = 0;
+        }
+
+        if (m_replaying) {
+            // Recorded updates the frame didn't run, such as all of a frame that ran no step, only change what is held
+            if (!m_frame_open) {
+                openReplayFrame();
+            }
+            while (m_replay_updates_left > 0) {
+                replayUpdate(Clock::now(), false);
+            }
+
+            m_replay_offset = m_replay_cursor;
+            m_replayed_frames++;
+            if (m_replay_offset >= m_replay_data.size()) {
+                LM.writeLog("InputManager::endFrame() - Replay finished after %d frames", m_replayed_frames);
+                stopReplay();
+            }
+        }
+        m_frame_open = false;
+    }
+
+    // Finish the recording
+    void InputManager::stopRecording() {
+        if (!m_recording) {
+            return;
+        }
+
+        m_record_file.close();
+        m_recording = false;
+        LM.writeLog("InputManager::stopRecording() - Recorded %d frames", m_recorded_frames);
+    }
+
+    // Check if input is being recorded
+    bool InputManager::isRecording() const {
+        return m_recording;
+    }
+
+    // Replace live input with a recording
+    bool InputManager::startReplay(const std::string& filename) {
+        stopReplay();
+
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.is_open()) {
+            LM.writeLog(LogLevel::ERROR_LEVEL, "InputManager::startReplay() - Failed to open '%s'", filename.c_str());
+            return false;
+        }
+        m_replay_data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+        if (m_replay_data.size() < INPUT_RECORDING_HEADER_SIZE ||
+            std::memcmp(m_replay_data.data(), INPUT_RECORDING_MAGIC, 4) != 0 ||
+            readU16(&m_replay_data[4]) != INPUT_RECORDING_VERSION) {
+            LM.writeLog(LogLevel::ERROR_LEVEL, "InputManager::startReplay() - '%s' is not an input recording", filename.c_str());
+            m_replay_data.clear();
+            return false;
+        }
+
+        // Walk the frames once so a truncated file is reported up front
+        int frame_count = 0;
+        std::size_t offset = INPUT_RECORDING_HEADER_SIZE;
+        while (offset < m_replay_data.size()) {
+            std::size_t frame_size = getRecordedFrameSize(m_replay_data, offset);
+            if (frame_size == 0) {
+                LM.writeLog(LogLevel::WARNING, "InputManager::startReplay() - '%s' is truncated after %d frames",
+                    filename.c_str(), frame_count);
+                m_replay_data.resize(offset);
+                break;
+            }
+            offset += frame_size;
+            frame_count++;
+        }
+
+        m_replay_fixed_step_us = readU32(&m_replay_data[8]);
+        m_replay_offset = INPUT_RECORDING_HEADER_SIZE;
+        m_replay_cursor = m_replay_offset;
+        m_replay_updates_left = 0;
+        m_replayed_frames = 0;
+        m_replaying = frame_count > 0;
+        m_frame_open = false;
+        LM.writeLog("InputManager::startReplay() - Replaying %d frames from '%s'", frame_count, filename.c_str());
+        return true;
+    }
+
+    // Start replaying the next recorded frame
+    void InputManager::openReplayFrame() {
+        m_replay_updates_left = m_replay_data[m_replay_offset + 1];
+        m_replay_cursor = m_replay_offset + INPUT_RECORDING_FRAME_SIZE;
+    }
+
+    // Apply the events of the next recorded update of the open frame
+    void InputManager::replayUpdate(int64_t now, bool consume) {
+        if (m_replay_updates_left == 0) {
+            return; // The frame ran more updates than were recorded
+        }
+        m_replay_updates_left--;
+
+        uint16_t event_count = readU16(&m_replay_data[m_replay_cursor]);
+        m_replay_cursor += INPUT_RECORDING_UPDATE_SIZE;
+        for (uint16_t i = 0; i < event_count; ++i) {
+            const uint8_t* data = &m_replay_data[m_replay_cursor];
+            InputEvent event;
+            event.type = static_cast<InputEventType>(data[0]);
+            event.action = data[1];
+            event.code = static_cast<int16_t>(readU16(data + 2));
+            event.timestamp = now - readU32(data + 4);
+            m_replay_cursor += INPUT_RECORDING_EVENT_SIZE;
+
+            if (hasPosition(event.type)) {
+                event.x = readF32(data + INPUT_RECORDING_EVENT_SIZE);
+                event.y = readF32(data + INPUT_RECORDING_EVENT_SIZE + 4);
+                m_replay_cursor += INPUT_RECORDING_POSITION_SIZE;
+            }
+
+            // Applied directly, the event queue is too small for the largest recorded update
+            if (consume) {
+                m_frame_events.push_back(event);
+            }
+            applyEvent(event);
+        }
+    }
+
+    // Stop replaying
+    void InputManager::stopReplay() {
+        m_replaying = false;
+        m_replay_data.clear();
+        m_replay_data.shrink_to_fit();
+        m_replay_offset = 0;
+        m_replay_cursor = 0;
+        m_replay_updates_left = 0;
+    }
+
+    // Check if a recording is being replayed
+    bool InputManager::isReplaying() const {
+        return m_replaying;
+    }
+
+    // Get the simulation steps of the next replayed frame
+    int InputManager::getReplayFrameSteps() const {
+        return m_replaying ? m_replay_data[m_replay_offset] : -1;
+    }
+
+    // Get the fixed step the replay was recorded with
+    int64_t InputManager::getReplayFixedStep() const {
+        return m_replay_fixed_step_us;
+    }
+
+    // Create a shared input context
+    ContextID InputManager::createContext(const std::string& name, int priority) {
+        ContextID existing = findContext(name);
+        if (existing != INVALID_CONTEXT_ID) {
+            return existing;
+        }
+
+        InputContext context;
+        context.name = name;
+        context.priority = priority;
+        m_contexts.push_back(std::move(context));
+        m_context_order_dirty = true;
+
+        LM.writeLog(LogLevel::DEBUG, "InputManager::createContext() - Created input context '%s'", name.c_str());
+        return static_cast<ContextID>(m_contexts.size() - 1);
+    }
+
+    // Look up a context by name
+    ContextID InputManager::findContext(const std::string& name) const {
+        for (std::size_t i = 0; i < m_contexts.size(); ++i) {
+            if (m_contexts[i].name == name) {
+                return static_cast<ContextID>(i);
+            }
+        }
+        return INVALID_CONTEXT_ID;
+    }
+
+    // Get a context
+    const InputContext* InputManager::getContext(ContextID context) const {
+        return context < m_contexts.size() ? &m_contexts[context] : nullptr;
+    }
+
+    // Get the number of contexts
+    std::size_t InputManager::getContextCount() const {
+        return m_contexts.size();
+    }
+
+    // Bind an action in a context
+    bool InputManager::bindContextAction(ContextID context, const std::string& action_name, int input_key, InputActionType type) {
+        if (context >= m_contexts.size() || input_key < 0 || input_key >= INPUT_CODE_COUNT ||
+            static_cast<int>(type) >= INPUT_BINDING_TABLES) {
+            return false;
+        }
+
+        InputContextBinding binding{ internAction(action_name), input_key, type };
+        InputContext& target = m_contexts[context];
+        target.compiled = false;
+        for (InputContextBinding& existing : target.bindings) {
+            if (existing.action == binding.action) {
+                existing = binding;
+                return true;
+            }
+        }
+        target.bindings.push_back(binding);
+        return true;
+    }
+
+    // Move an action of a context to another key
+    bool InputManager::rebindContextAction(ContextID context, ActionID action, int input_key) {
+        if (context >= m_contexts.size() || input_key < 0 || input_key >= INPUT_CODE_COUNT) {
+            return false;
+        }
+
+        InputContext& target = m_contexts[context];
+        for (InputContextBinding& binding : target.bindings) {
+            if (binding.action == action) {
+                binding.input_key = input_key;
+                target.compiled = false;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Remove an action from a context
+    void InputManager::unbindContextAction(ContextID context, ActionID action) {
+        if (context >= m_contexts.size()) {
+            return;
+        }
+
+        InputContext& target = m_contexts[context];
+        for (auto it = target.bindings.begin(); it != target.bindings.end(); ++it) {
+            if (it->action == action) {
+                target.bindings.erase(it);
+                target.compiled = false;
+                return;
+            }
+        }
+    }
+
+    // Enable or disable a context
+    void InputManager::setContextEnabled(ContextID context, bool enabled) {
+        if (context < m_contexts.size() && m_contexts[context].enabled != enabled) {
+            m_contexts[context].enabled = enabled;
+            m_context_order_dirty = true;
+        }
+    }
+
+    // Change the priority of a context
+    void InputManager::setContextPriority(ContextID context, int priority) {
+        if (context < m_contexts.size() && m_contexts[context].priority != priority) {
+            m_contexts[context].priority = priority;
+            m_context_order_dirty = true;
+        }
+    }
+
+    // Set whether a context hides its keys from lower contexts
+    void InputManager::setContextConsumesInput(ContextID context, bool consume_input) {
+        if (context < m_contexts.size()) {
+            m_contexts[context].consume_input = consume_input;
+        }
+    }
+
+    // Get the context actions fired by the last update
+    const std::vector<InputContextEvent>& InputManager::getContextEvents() const {
+        return m_context_events;
+    }
+
+    // Compile a context's bindings into its lookup tables
+    void InputManager::compileContext(InputContext& context) {
+        const std::size_t range_count = static_cast<std::size_t>(INPUT_BINDING_TABLES) * INPUT_CODE_COUNT;
+        context.offsets.assign(range_count + 1, 0);
+        context.bound_keys = {};
+        context.bound_mouse = {};
+        context.claimed_keys = {};
+        context.claimed_mouse = 0;
+
+        // Count the bindings per range, then turn the counts into range starts
+        for (const InputContextBinding& binding : context.bindings) {
+            context.offsets[static_cast<int>(binding.type) * INPUT_CODE_COUNT + binding.input_key + 1]++;
+        }
+        for (std::size_t i = 1; i <= range_count; ++i) {
+            context.offsets[i] += context.offsets[i - 1];
+        }
+
+        context.actions.resize(context.bindings.size());
+        std::vector<uint32_t> cursor(context.offsets.begin(), context.offsets.end() - 1);
+        for (const InputContextBinding& binding : context.bindings) {
+            int table = static_cast<int>(binding.type);
+            context.actions[cursor[table * INPUT_CODE_COUNT + binding.input_key]++] = binding.action;
+
+            if (binding.input_key < MOUSE_BUTTON_INPUT_OFFSET) {
+                uint64_t bit = uint64_t(1) << (binding.input_key & 63);
+                context.bound_keys[table][binding.input_key >> 6] |= bit;
+                context.claimed_keys[binding.input_key >> 6] |= bit;
+            }
+            else {
+                uint32_t bit = 1u << (binding.input_key - MOUSE_BUTTON_INPUT_OFFSET);
+                context.bound_mouse[table] |= bit;
+                context.claimed_mouse |= bit;
+            }
+        }
+        context.compiled = true;
+    }
+
+    // Fire the context actions for this frame's input
+    void InputManager::evaluateContexts() {
+        m_context_events.clear();
+
+        if (m_context_order_dirty) {
+            m_context_order.clear();
+            for (std::size_t i = 0; i < m_contexts.size(); ++i) {
+                if (m_contexts[i].enabled) {
+                    m_context_order.push_back(static_cast<ContextID>(i));
+                }
+            }
+            std::stable_sort(m_context_order.begin(), m_context_order.end(), [this](ContextID a, ContextID b) {
+                return m_contexts[a].priority > m_contexts[b].priority;
+            });
+            m_context_order_dirty = false;
+        }
+
+        for (ContextID id : m_context_order) {
+            if (!m_contexts[id].compiled) {
+                compileContext(m_contexts[id]);
+            }
+        }
+
+        // Walk each changed (or held, for REPEAT) code once, handing it down the context layers
+        const KeyStateBits* key_states[INPUT_BINDING_TABLES] = { &m_key_pressed, &m_key_released, &m_key_current };
+        const uint32_t mouse_states[INPUT_BINDING_TABLES] = { m_mouse_pressed, m_mouse_released, m_mouse_current };
+
+        auto fire_code = [this](int table, int code, bool is_key) {
+            for (ContextID id : m_context_order) {
+                const InputContext& context = m_contexts[id];
+                std::size_t range = static_cast<std::size_t>(table) * INPUT_CODE_COUNT + code;
+                for (uint32_t i = context.offsets[range]; i < context.offsets[range + 1]; ++i) {
+                    m_context_events.push_back({ id, context.actions[i], static_cast<InputActionType>(table) });
+                }
+
+                bool claimed = is_key ? testKey(context.claimed_keys, code) :
+                    ((context.claimed_mouse >> (code - MOUSE_BUTTON_INPUT_OFFSET)) & 1u) != 0;
+                if (claimed && context.consume_input) {
+                    break;
+                }
+            }
+        };
+
+        for (int table = 0; table < INPUT_BINDING_TABLES; ++table) {
+            // Only codes some enabled context binds are worth looking up
+            KeyStateBits keys{};
+            uint32_t buttons = 0;
+            for (ContextID id : m_context_order) {
+                for (int word = 0; word < KEY_STATE_WORDS; ++word) {
+                    keys[word] |= m_contexts[id].bound_keys[table][word];
+                }
+                buttons |= m_contexts[id].bound_mouse[table];
+            }
+
+            for (int word = 0; word < KEY_STATE_WORDS; ++word) {
+                uint64_t bits = keys[word] & (*key_states[table])[word];
+                while (bits) {
+                    fire_code(table, word * 64 + std::countr_zero(bits), true);
+                    bits &= bits - 1;
+                }
+            }
+
+            buttons &= mouse_states[table];
+            while (buttons) {
+                fire_code(table, MOUSE_BUTTON_INPUT_OFFSET + std::countr_zero(buttons), false);
+                buttons &= buttons - 1;
+            }
         }
     }
 
@@ -13,9 +13,14 @@
 #define __INPUT_MANAGER_H__
 
 #include "Manager.h"
+#include "../Utility/InputEventQueue.h"
 #include <GLFW/glfw3.h>
-#include <unordered_map>
 #include <array>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
  // Two-letter acronym for easier access to manager.
@@ -26,12 +31,127 @@ namespace gam300 {
     // Maximum number of mouse buttons to track
     constexpr int MAX_MOUSE_BUTTONS = 8;
 
-    // Key and button states
-    enum class InputState {
-        RELEASED = 0,    // Not pressed
-        PRESSED,         // Currently pressed
-        JUST_PRESSED,    // Pressed this frame
-        JUST_RELEASED    // Released this frame
+    // Number of key codes tracked, one per GLFW key code
+    constexpr int KEY_STATE_COUNT = GLFW_KEY_LAST + 1;
+
+    // Number of 64-bit words holding one bit per key code
+    constexpr int KEY_STATE_WORDS = (KEY_STATE_COUNT + 63) / 64;
+
+    // One bit per key code, indexed by GLFW key code
+    using KeyStateBits = std::array<uint64_t, KEY_STATE_WORDS>;
+
+    // Offset added to mouse button codes so they don't collide with GLFW key codes
+    constexpr int MOUSE_BUTTON_INPUT_OFFSET = GLFW_KEY_LAST + 1;
+
+    // Input codes covered by binding tables: GLFW keys, then offset mouse buttons
+    constexpr int INPUT_CODE_COUNT = MOUSE_BUTTON_INPUT_OFFSET + MAX_MOUSE_BUTTONS;
+
+    // Binding tables, one per dispatched action type (PRESS, RELEASE, REPEAT)
+    constexpr int INPUT_BINDING_TABLES = 3;
+
+    // Input action types
+    enum class InputActionType {
+        PRESS,          // Triggered when key/button is pressed
+        RELEASE,        // Triggered when key/button is released
+        REPEAT,         // Triggered continuously while key/button is held
+        AXIS            // Triggered for axis-based input (mouse movement, etc.)
+    };
+
+    /**
+     * @brief Compact identifier of an interned input action name.
+     * @details Equal names always intern to the same ID, so actions can be compared
+     *          and looked up without hashing or comparing strings.
+     */
+    using ActionID = std::uint32_t;
+
+    /**
+     * @brief Invalid action ID constant.
+     * @details Returned when looking up a name that was never interned.
+     */
+    constexpr ActionID INVALID_ACTION_ID = 0xFFFFFFFFu;
+
+    /**
+     * @brief Identifier of a shared input context.
+     */
+    using ContextID = std::uint32_t;
+
+    /**
+     * @brief Invalid context ID constant.
+     */
+    constexpr ContextID INVALID_CONTEXT_ID = 0xFFFFFFFFu;
+
+    // A key or mouse button bound to an action inside an input context
+    struct InputContextBinding {
+        ActionID action;                        // Interned action name
+        int input_key;                          // GLFW key code, or mouse button + MOUSE_BUTTON_INPUT_OFFSET
+        InputActionType type;                   // PRESS, RELEASE or REPEAT
+    };
+
+    /**
+     * @brief A named set of bindings shared by every entity that references it.
+     * @details Enabled contexts are evaluated once per update from the highest priority
+     *          down. A context that consumes input hides the keys it binds from the
+     *          contexts below it, so a menu layer can take over keys used by gameplay.
+     */
+    struct InputContext {
+        std::string name;                       // Unique context name
+        int priority = 0;                       // Higher priority contexts see input first
+        bool enabled = true;                    // Disabled contexts fire nothing
+        bool consume_input = true;              // Keys bound here don't reach lower contexts
+        std::vector<InputContextBinding> bindings; // Bindings as authored
+
+        // Lookup tables compiled from the bindings
+        std::vector<uint32_t> offsets;          // Start of each (table, code) range in actions
+        std::vector<ActionID> actions;          // Actions grouped by table, then by input code
+        std::array<KeyStateBits, INPUT_BINDING_TABLES> bound_keys{}; // Keys with bindings, per table
+        std::array<uint32_t, INPUT_BINDING_TABLES> bound_mouse{};    // Mouse buttons with bindings, per table
+        KeyStateBits claimed_keys{};            // Keys bound in any table
+        uint32_t claimed_mouse = 0;             // Mouse buttons bound in any table
+        bool compiled = false;                  // Whether the tables match the bindings
+    };
+
+    // A context action that fired this frame
+    struct InputContextEvent {
+        ContextID context;                      // Context the binding belongs to
+        ActionID action;                        // Interned action name
+        InputActionType type;                   // PRESS, RELEASE or REPEAT
+    };
+
+    /**
+     * @brief Identifier of an input axis, an index into the shared axis value array.
+     */
+    using AxisID = std::uint32_t;
+
+    /**
+     * @brief Invalid axis ID constant.
+     */
+    constexpr AxisID INVALID_AXIS_ID = 0xFFFFFFFFu;
+
+    /**
+     * @brief Axes every InputManager defines when it starts, the mouse movement of the last update.
+     * @details Named "mouse_delta_x" and "mouse_delta_y" with a scale of 1, which a scene
+     *          or a sensitivity setting may change.
+     */
+    constexpr AxisID MOUSE_DELTA_X_AXIS = 0;
+    constexpr AxisID MOUSE_DELTA_Y_AXIS = 1;
+
+    // Where an axis reads its value from
+    enum class InputAxisSource : uint8_t {
+        KEYS,           // Positive key minus negative key, -1, 0 or 1
+        MOUSE_DELTA_X,  // Horizontal cursor movement this frame
+        MOUSE_DELTA_Y,  // Vertical cursor movement this frame
+        SCROLL_X,       // Horizontal scrolling this frame
+        SCROLL_Y        // Vertical scrolling this frame
+    };
+
+    // A composite axis evaluated once per update into the shared axis values
+    struct InputAxis {
+        std::string name;                       // Unique axis name
+        InputAxisSource source;                 // Where the value comes from
+        int negative_key;                       // KEYS only, input code pulling towards -1
+        int positive_key;                       // KEYS only, input code pulling towards +1
+        float scale;                            // Multiplies the raw value, e.g. mouse sensitivity
+        float dead_zone;                        // Values with a smaller magnitude read as 0
     };
 
     class InputManager : public Manager {
@@ -43,13 +163,39 @@ namespace gam300 {
         // Window reference for input
         GLFWwindow* m_window;
 
-        // Key state tracking
-        std::unordered_map<int, InputState> m_key_states;
-        std::unordered_map<int, InputState> m_prev_key_states;
+        // Events received since the last update, in arrival order
+        InputEventQueue m_event_queue;
+        std::vector<InputEvent> m_frame_events; // Events consumed by the last update
+        int64_t m_input_latency;             // Age of the oldest event at the last update, in microseconds
+
+        // Frames group the updates of one rendered frame's simulation steps, closed by endFrame()
+        bool m_frame_open;                   // Whether an update has run since the last endFrame()
+
+        // Input recording, one record per frame written by endFrame()
+        std::ofstream m_record_file;
+        std::vector<uint8_t> m_record_buffer; // Encoded frame, filled by each update and written by endFrame()
+        std::size_t m_record_update_count;   // Updates in m_record_buffer
+        bool m_recording;
+        int m_recorded_frames;
+
+        // Input replay, the whole recording is read up front so frames never touch the disk
+        std::vector<uint8_t> m_replay_data;
+        std::size_t m_replay_offset;         // Start of the open frame, or of the next one between frames
+        std::size_t m_replay_cursor;         // Next recorded update of the open frame
+        int m_replay_updates_left;           // Recorded updates of the open frame not replayed yet
+        bool m_replaying;
+        int m_replayed_frames;
+        int64_t m_replay_fixed_step_us;      // Fixed step the replay was recorded with
 
-        // Mouse button state tracking
-        std::array<InputState, MAX_MOUSE_BUTTONS> m_mouse_button_states;
-        std::array<InputState, MAX_MOUSE_BUTTONS> m_prev_mouse_button_states;
+        // Key state tracking, one bit per key
+        KeyStateBits m_key_current;          // Keys held after the last update
+        KeyStateBits m_key_pressed;          // Keys that went down during the last frame
+        KeyStateBits m_key_released;         // Keys that went up during the last frame
+
+        // Mouse button state tracking, one bit per button
+        uint32_t m_mouse_current;            // Buttons held after the last update
+        uint32_t m_mouse_pressed;            // Buttons that went down during the last frame
+        uint32_t m_mouse_released;           // Buttons that went up during the last frame
 
         // Mouse position
         double m_mouse_x;
@@ -57,10 +203,54 @@ namespace gam300 {
         double m_prev_mouse_x;
         double m_prev_mouse_y;
 
-        // Mouse scroll offset
+        // Mouse scroll offset for this frame
         double m_scroll_x_offset;
         double m_scroll_y_offset;
 
+        // Shared input contexts, indexed by ContextID
+        std::vector<InputContext> m_contexts;
+        std::vector<ContextID> m_context_order; // Enabled contexts, highest priority first
+        bool m_context_order_dirty;
+        std::vector<InputContextEvent> m_context_events; // Context actions fired by the last update
+
+        // Composite axes, indexed by AxisID, and their values after the last update
+        std::vector<InputAxis> m_axes;
+        std::vector<float> m_axis_values;
+
+        // Evaluate every axis into m_axis_values
+        void evaluateAxes();
+
+        // Test a key or offset mouse button code against the held state
+        bool isInputCodeDown(int input_code) const;
+
+        // Compile a context's bindings into its lookup tables
+        static void compileContext(InputContext& context);
+
+        // Fire the context actions for this frame's input
+        void evaluateContexts();
+
+        // Apply one event to the input state
+        void applyEvent(const InputEvent& event);
+
+        // Start replaying the frame at m_replay_offset
+        void openReplayFrame();
+
+        // Apply the events of the next recorded update, adding them to the update's events if consume is set
+        void replayUpdate(int64_t now, bool consume);
+
+        // Append an event consumed by an update to the open frame of the recording
+        void recordEvent(const InputEvent& event, int64_t now);
+
+        // Test a key bit, false for codes outside the tracked range
+        static bool testKey(const KeyStateBits& bits, int key) {
+            return key >= 0 && key < KEY_STATE_COUNT &&
+                (bits[key >> 6] >> (key & 63)) & 1u;
+        }
+
+        // Action name interning, IDs index m_action_names
+        std::unordered_map<std::string, ActionID> m_action_ids;
+        std::deque<std::string> m_action_names; // Deque so returned name references stay valid
+
         // Callback storage to avoid loss during static function callbacks
         static InputManager* s_instance;
 
@@ -95,10 +285,273 @@ namespace gam300 {
         void setWindow(GLFWwindow* window);
 
         /**
-         * @brief Update input states, should be called once per frame.
+         * @brief Update input states, should be called once per simulation step.
+         * @details Drains the event queue in arrival order and derives the key and button
+         *          states from it. A key pressed and released between two updates reports
+         *          both edges, so short taps are never lost. Edges last exactly one update,
+         *          so a frame that runs no step leaves its events queued for the next one
+         *          that does, and a frame that runs several reports each edge once.
          */
         void update();
 
+        /**
+         * @brief Queue an input event for the next update.
+         * @param event The event, with the time it was received.
+         * @details Safe to call from one thread other than the one calling update().
+         */
+        void injectEvent(const InputEvent& event);
+
+        /**
+         * @brief Queue a key event for the next update, stamped with the current time.
+         * @param key GLFW key code
+         * @param action GLFW_PRESS or GLFW_RELEASE
+         * @details Used by the GLFW callback, and to drive input without a window.
+         */
+        void injectKeyEvent(int key, int action);
+
+        /**
+         * @brief Queue a mouse button event for the next update, stamped with the current time.
+         * @param button GLFW mouse button code
+         * @param action GLFW_PRESS or GLFW_RELEASE
+         * @details Used by the GLFW callback, and to drive input without a window.
+         */
+        void injectMouseButtonEvent(int button, int action);
+
+        /**
+         * @brief Queue a cursor movement for the next update, stamped with the current time.
+         * @param x New cursor X position
+         * @param y New cursor Y position
+         */
+        void injectCursorEvent(double x, double y);
+
+        /**
+         * @brief Queue a scroll event for the next update, stamped with the current time.
+         * @param x_offset Horizontal scroll offset
+         * @param y_offset Vertical scroll offset
+         */
+        void injectScrollEvent(double x_offset, double y_offset);
+
+        /**
+         * @brief Get the events consumed by the last update.
+         * @return The events in the order they were received.
+         */
+        const std::vector<InputEvent>& getFrameEvents() const;
+
+        /**
+         * @brief Get how long input waited before the last update consumed it.
+         * @return Age of the oldest event consumed by the last update in microseconds,
+         *         0 if there were no events.
+         */
+        int64_t getInputLatency() const;
+
+        /**
+         * @brief Create a shared input context, or get the existing one with the same name.
+         * @param name Unique context name.
+         * @param priority Higher priority contexts see input first.
+         * @return The ID of the context.
+         */
+        ContextID createContext(const std::string& name, int priority = 0);
+
+        /**
+         * @brief Look up a context by name.
+         * @param name The context name.
+         * @return The ID of the context, or INVALID_CONTEXT_ID if there is none.
+         */
+        ContextID findContext(const std::string& name) const;
+
+        /**
+         * @brief Get a context.
+         * @param context The context ID.
+         * @return The context, or nullptr for an unknown ID.
+         */
+        const InputContext* getContext(ContextID context) const;
+
+        /**
+         * @brief Get the number of contexts.
+         * @return Number of contexts, valid IDs are below this.
+         */
+        std::size_t getContextCount() const;
+
+        /**
+         * @brief Bind an action in a context, replacing the action's previous binding.
+         * @param context The context ID.
+         * @param action_name The action name.
+         * @param input_key GLFW key code, or mouse button + MOUSE_BUTTON_INPUT_OFFSET.
+         * @param type PRESS, RELEASE or REPEAT.
+         * @return False if the context, key or type is invalid.
+         */
+        bool bindContextAction(ContextID context, const std::string& action_name, int input_key, InputActionType type);
+
+        /**
+         * @brief Move an action of a context to another key, keeping its type.
+         * @param context The context ID.
+         * @param action The action to rebind.
+         * @param input_key GLFW key code, or mouse button + MOUSE_BUTTON_INPUT_OFFSET.
+         * @return False if the context doesn't bind the action or the key is invalid.
+         */
+        bool rebindContextAction(ContextID context, ActionID action, int input_key);
+
+        /**
+         * @brief Remove an action from a context.
+         * @param context The context ID.
+         * @param action The action to remove.
+         */
+        void unbindContextAction(ContextID context, ActionID action);
+
+        /**
+         * @brief Enable or disable a context.
+         * @param context The context ID.
+         * @param enabled New enabled state.
+         */
+        void setContextEnabled(ContextID context, bool enabled);
+
+        /**
+         * @brief Change the priority of a context.
+         * @param context The context ID.
+         * @param priority Higher priority contexts see input first.
+         */
+        void setContextPriority(ContextID context, int priority);
+
+        /**
+         * @brief Set whether a context hides the keys it binds from lower contexts.
+         * @param context The context ID.
+         * @param consume_input True to hide bound keys from lower priority contexts.
+         */
+        void setContextConsumesInput(ContextID context, bool consume_input);
+
+        /**
+         * @brief Get the context actions fired by the last update.
+         * @return The fired actions, highest priority context first for each key.
+         */
+        const std::vector<InputContextEvent>& getContextEvents() const;
+
+        /**
+         * @brief Create an axis driven by a pair of keys or mouse buttons, or rebind the existing one.
+         * @param name Unique axis name.
+         * @param negative_key Input code that pulls the axis to -1, a GLFW key or mouse button + MOUSE_BUTTON_INPUT_OFFSET.
+         * @param positive_key Input code that pulls the axis to +1.
+         * @param scale Multiplies the value.
+         * @return ID of the axis.
+         */
+        AxisID createKeyAxis(const std::string& name, int negative_key, int positive_key, float scale = 1.0f);
+
+        /**
+         * @brief Create an axis driven by mouse movement or scrolling, or replace the existing one.
+         * @param name Unique axis name.
+         * @param source Mouse delta or scroll component to read, not KEYS.
+         * @param scale Multiplies the value, e.g. mouse sensitivity.
+         * @param dead_zone Scaled values with a smaller magnitude read as 0.
+         * @return ID of the axis, INVALID_AXIS_ID if the source is KEYS.
+         */
+        AxisID createAxis(const std::string& name, InputAxisSource source, float scale = 1.0f, float dead_zone = 0.0f);
+
+        /**
+         * @brief Find an axis by name.
+         * @param name Axis name.
+         * @return ID of the axis, INVALID_AXIS_ID if there is none.
+         */
+        AxisID findAxis(const std::string& name) const;
+
+        /**
+         * @brief Get an axis definition.
+         * @param axis ID of the axis.
+         * @return The axis, or nullptr if the ID is invalid.
+         */
+        const InputAxis* getAxis(AxisID axis) const;
+
+        /**
+         * @brief Get the number of axes.
+         * @return Number of axes, valid IDs are below it.
+         */
+        std::size_t getAxisCount() const;
+
+        /**
+         * @brief Change the scale of an axis, e.g. for a sensitivity setting.
+         * @param axis ID of the axis.
+         * @param scale New scale.
+         */
+        void setAxisScale(AxisID axis, float scale);
+
+        /**
+         * @brief Get the value of an axis after the last update.
+         * @param axis ID of the axis.
+         * @return The scaled value, 0 for an invalid ID.
+         */
+        float getAxisValue(AxisID axis) const;
+
+        /**
+         * @brief Get the values of every axis after the last update.
+         * @details Indexed by AxisID. The pointer stays valid until an axis is created,
+         *          so systems can look their axes up once and read them every frame.
+         * @return Pointer to getAxisCount() values.
+         */
+        const float* getAxisValues() const;
+
+        /**
+         * @brief Start recording the events of every update to a binary file.
+         * @details Call endFrame() after each frame's simulation steps.
+         * @param filename File to write, replaced if it exists.
+         * @param fixed_step_us Fixed simulation step the session runs with, in microseconds.
+         * @return True if the file could be opened.
+         */
+        bool startRecording(const std::string& filename, int64_t fixed_step_us);
+
+        /**
+         * @brief Close the frame, call once per rendered frame after its simulation steps.
+         * @details Writes the events consumed by each of the frame's updates to the
+         *          recording, and lets the next update replay the next recorded frame.
+         *          Recorded updates a replayed frame didn't run are applied here. A frame
+         *          of more than 255 steps or updates doesn't fit the format and stops the
+         *          recording with an error.
+         * @param sim_steps Number of simulation steps, and so updates, the frame ran.
+         */
+        void endFrame(int sim_steps);
+
+        /**
+         * @brief Finish the recording and close the file.
+         */
+        void stopRecording();
+
+        /**
+         * @brief Check if input is being recorded.
+         * @return True while recording.
+         */
+        bool isRecording() const;
+
+        /**
+         * @brief Replace live input with a recording made by startRecording().
+         * @details Each update applies the events the matching update of the recorded
+         *          frame consumed and ignores window input. Frames are closed by endFrame(),
+         *          and the replay stops by itself after the last frame.
+         * @param filename Recording to read.
+         * @return True if the file was read and is a valid recording.
+         */
+        bool startReplay(const std::string& filename);
+
+        /**
+         * @brief Stop replaying and return to live input.
+         */
+        void stopReplay();
+
+        /**
+         * @brief Check if a recording is being replayed.
+         * @return True while frames remain to be replayed.
+         */
+        bool isReplaying() const;
+
+        /**
+         * @brief Get the number of simulation steps the next replayed frame ran when recorded.
+         * @details Read before the frame's updates to run the same number of steps.
+         * @return The step count, or -1 if not replaying.
+         */
+        int getReplayFrameSteps() const;
+
+        /**
+         * @brief Get the fixed simulation step the replay was recorded with.
+         * @return The step in microseconds, 0 if no replay has been started.
+         */
+        int64_t getReplayFixedStep() const;
+
         /**
          * @brief Check if a key is currently pressed.
          * @param key GLFW key code
@@ -141,6 +594,42 @@ namespace gam300 {
          */
         bool isMouseButtonJustReleased(int button) const;
 
+        /**
+         * @brief Get the keys held this frame.
+         * @return One bit per GLFW key code.
+         */
+        const KeyStateBits& getKeysDown() const;
+
+        /**
+         * @brief Get the keys that went down this frame.
+         * @return One bit per GLFW key code.
+         */
+        const KeyStateBits& getKeysPressed() const;
+
+        /**
+         * @brief Get the keys that went up this frame.
+         * @return One bit per GLFW key code.
+         */
+        const KeyStateBits& getKeysReleased() const;
+
+        /**
+         * @brief Get the mouse buttons held this frame.
+         * @return One bit per GLFW mouse button code.
+         */
+        uint32_t getMouseButtonsDown() const;
+
+        /**
+         * @brief Get the mouse buttons that went down this frame.
+         * @return One bit per GLFW mouse button code.
+         */
+        uint32_t getMouseButtonsPressed() const;
+
+        /**
+         * @brief Get the mouse buttons that went up this frame.
+         * @return One bit per GLFW mouse button code.
+         */
+        uint32_t getMouseButtonsReleased() const;
+
         /**
          * @brief Get the current mouse X position.
          * @return Current mouse X position in screen coordinates.
@@ -176,6 +665,34 @@ namespace gam300 {
          * @return Mouse scroll Y offset.
          */
         double getScrollY() const;
+
+        /**
+         * @brief Intern an action name.
+         * @param name The action name.
+         * @return The ID of the name, allocating one the first time the name is seen.
+         */
+        ActionID internAction(const std::string& name);
+
+        /**
+         * @brief Look up the ID of an action name without interning it.
+         * @param name The action name.
+         * @return The ID of the name, or INVALID_ACTION_ID if it was never interned.
+         */
+        ActionID findAction(const std::string& name) const;
+
+        /**
+         * @brief Get the name an action ID was interned from.
+         * @details The reference stays valid until the InputManager shuts down.
+         * @param action The action ID.
+         * @return The action name, or an empty string for an unknown ID.
+         */
+        const std::string& getActionName(ActionID action) const;
+
+        /**
+         * @brief Get the number of interned action names.
+         * @return Number of interned names.
+         */
+        std::size_t getActionCount() const;
     };
 
 } // end of namespace gam300
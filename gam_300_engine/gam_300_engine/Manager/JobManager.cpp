@@ -0,0 +1,177 @@
+/**
+ * @file JobManager.cpp
+ * @brief Implementation of the Job Manager for the game engine.
+ * @details A posted job is a loop split into chunks. Workers and the posting
+ *          thread claim chunks from a shared counter until none are left, so
+ *          there is no per-chunk queue or allocation.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "JobManager.h"
+#include "ConfigManager.h"
+#include "LogManager.h"
+#include <algorithm>
+
+namespace gam300 {
+
+    // Index of the calling thread, 0 outside the workers
+    static thread_local int s_thread_index = 0;
+
+    // True while the calling thread runs a job, nested loops then run inline
+    static thread_local bool s_in_job = false;
+
+    // Initialize singleton instance
+    JobManager::JobManager() :
+        m_body(nullptr),
+        m_count(0),
+        m_chunk_size(0),
+        m_chunk_count(0),
+        m_next_chunk(0),
+        m_chunks_done(0),
+        m_generation(0),
+        m_busy_workers(0),
+        m_stopping(false) {
+        setType("JobManager");
+    }
+
+    // Get the singleton instance
+    JobManager& JobManager::getInstance() {
+        static JobManager instance;
+        return instance;
+    }
+
+    // Start up the JobManager
+    int JobManager::startUp() {
+        // Call parent's startUp() first
+        if (Manager::startUp())
+            return -1;
+
+        m_stopping = false;
+        m_busy_workers = 0;
+
+        int worker_count = CFG.getWorkerThreadCount();
+        m_workers.reserve(worker_count);
+        for (int i = 0; i < worker_count; ++i) {
+            m_workers.emplace_back(&JobManager::workerLoop, this, i + 1);
+        }
+
+        LM.writeLog("JobManager::startUp() - Job Manager started with %d worker threads", worker_count);
+        return 0;
+    }
+
+    // Shut down the JobManager
+    void JobManager::shutDown() {
+        LM.writeLog("JobManager::shutDown() - Shutting down Job Manager");
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_work_ready.notify_all();
+        for (std::thread& worker : m_workers) {
+            worker.join();
+        }
+        m_workers.clear();
+
+        // Call parent's shutDown()
+        Manager::shutDown();
+    }
+
+    // Run a loop body across the workers
+    void JobManager::parallelFor(std::size_t count, std::size_t min_chunk, const JobRangeFunc& body) {
+        if (count == 0) {
+            return;
+        }
+
+        std::size_t threads = static_cast<std::size_t>(getThreadCount());
+        std::size_t target_chunks = threads * JOB_CHUNKS_PER_THREAD;
+        std::size_t chunk_size = std::max<std::size_t>(std::max<std::size_t>(min_chunk, 1), (count + target_chunks - 1) / target_chunks);
+        std::size_t chunk_count = (count + chunk_size - 1) / chunk_size;
+
+        if (m_workers.empty() || s_in_job || chunk_count <= 1) {
+            body(0, count);
+            return;
+        }
+
+        // One job at a time; workers still leaving the previous job would take chunks of this one
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_work_done.wait(lock, [this]() { return m_busy_workers == 0; });
+        m_body = &body;
+        m_count = count;
+        m_chunk_size = chunk_size;
+        m_chunk_count = chunk_count;
+        m_chunks_done.store(0, std::memory_order_relaxed);
+        m_next_chunk.store(0, std::memory_order_release);
+        m_generation++;
+        lock.unlock();
+        m_work_ready.notify_all();
+
+        s_in_job = true;
+        runChunks();
+        s_in_job = false;
+
+        lock.lock();
+        m_work_done.wait(lock, [this]() { return m_chunks_done.load(std::memory_order_acquire) == m_chunk_count; });
+        m_body = nullptr;
+    }
+
+    // Get the number of threads that work on a job
+    int JobManager::getThreadCount() const {
+        return static_cast<int>(m_workers.size()) + 1;
+    }
+
+    // Get the index of the calling thread
+    int JobManager::getThreadIndex() {
+        return s_thread_index;
+    }
+
+    // Main loop of a worker thread
+    void JobManager::workerLoop(int thread_index) {
+        s_thread_index = thread_index;
+        s_in_job = true;
+
+        uint64_t seen_generation = 0;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_work_ready.wait(lock, [this, &seen_generation]() { return m_stopping || m_generation != seen_generation; });
+            if (m_stopping) {
+                return;
+            }
+
+            seen_generation = m_generation;
+            m_busy_workers++;
+            lock.unlock();
+
+            runChunks();
+
+            lock.lock();
+            if (--m_busy_workers == 0) {
+                m_work_done.notify_all();
+            }
+        }
+    }
+
+    // Run chunks of the current job until none are left
+    void JobManager::runChunks() {
+        while (true) {
+            std::size_t chunk = m_next_chunk.fetch_add(1, std::memory_order_acq_rel);
+            if (chunk >= m_chunk_count) {
+                return;
+            }
+
+            std::size_t begin = chunk * m_chunk_size;
+            std::size_t end = std::min(begin + m_chunk_size, m_count);
+            (*m_body)(begin, end);
+
+            if (m_chunks_done.fetch_add(1, std::memory_order_acq_rel) + 1 == m_chunk_count) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_work_done.notify_all();
+            }
+        }
+    }
+
+} // end of namespace gam300
@@ -0,0 +1,111 @@
+/**
+ * @file JobManager.h
+ * @brief Declaration of the Job Manager for the game engine.
+ * @details Owns the worker threads and splits data-parallel loops across them.
+ *          The number of workers comes from the worker_threads setting.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __JOB_MANAGER_H__
+#define __JOB_MANAGER_H__
+
+#include "Manager.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Two-letter acronym for easier access to manager.
+#define JM gam300::JobManager::getInstance()
+
+namespace gam300 {
+
+    // Body of a parallel loop, called with a half-open range [begin, end) of indices.
+    using JobRangeFunc = std::function<void(std::size_t begin, std::size_t end)>;
+
+    // Chunks per thread a parallel loop is split into, so uneven chunks balance out.
+    constexpr std::size_t JOB_CHUNKS_PER_THREAD = 4;
+
+    class JobManager : public Manager {
+
+    private:
+        JobManager();                       // Private since a singleton.
+        JobManager(JobManager const&);      // Don't allow copy.
+        void operator=(JobManager const&);  // Don't allow assignment.
+
+        std::vector<std::thread> m_workers;             // Worker threads, not including the main thread
+        std::mutex m_mutex;                             // Guards posting jobs and the worker wake-up state
+        std::condition_variable m_work_ready;           // Signalled when a job is posted or on shutdown
+        std::condition_variable m_work_done;            // Signalled when a worker finishes the last chunk or goes idle
+        const JobRangeFunc* m_body;                     // Loop body of the current job
+        std::size_t m_count;                            // Indices in the current job
+        std::size_t m_chunk_size;                       // Indices per chunk of the current job
+        std::size_t m_chunk_count;                      // Chunks in the current job
+        std::atomic<std::size_t> m_next_chunk;          // Next chunk to hand out
+        std::atomic<std::size_t> m_chunks_done;         // Chunks finished
+        uint64_t m_generation;                          // Bumped for every posted job
+        int m_busy_workers;                             // Workers that joined the current job and haven't gone idle
+        bool m_stopping;                                // Set by shutDown() to release the workers
+
+        // Main loop of a worker thread.
+        void workerLoop(int thread_index);
+
+        // Run chunks of the current job until none are left.
+        void runChunks();
+
+    public:
+        /**
+         * @brief Get the singleton instance of the JobManager.
+         * @return Reference to the singleton instance.
+         */
+        static JobManager& getInstance();
+
+        /**
+         * @brief Start up the JobManager.
+         * @return 0 if successful, else -1.
+         * @details Starts ConfigManager::getWorkerThreadCount() workers. The main
+         *          thread also works on every job, so one worker still halves the time.
+         */
+        int startUp() override;
+
+        /**
+         * @brief Shut down the JobManager.
+         * @details Waits for the workers to finish and joins them.
+         */
+        void shutDown() override;
+
+        /**
+         * @brief Run a loop body over [0, count) on the workers and the calling thread.
+         * @details Blocks until every index has been processed. Calls made from inside
+         *          a job, before startUp() or with too few indices for more than one
+         *          chunk run on the calling thread. Chunks may run in any order.
+         * @param count Number of indices.
+         * @param min_chunk Smallest number of indices worth handing to another thread.
+         * @param body Function called with each chunk's [begin, end) range.
+         */
+        void parallelFor(std::size_t count, std::size_t min_chunk, const JobRangeFunc& body);
+
+        /**
+         * @brief Get the number of threads that work on a job.
+         * @return Workers plus the calling thread.
+         */
+        int getThreadCount() const;
+
+        /**
+         * @brief Get the index of the calling thread.
+         * @details Lets jobs pick per-thread buffers without locking.
+         * @return 0 outside the workers, 1 to getThreadCount() - 1 on a worker.
+         */
+        static int getThreadIndex();
+    };
+
+} // end of namespace gam300
+#endif // __JOB_MANAGER_H__
@@ -14,11 +14,26 @@
 
 namespace gam300 {
 
+    // Format the current local time into the given buffer
+    static void formatTimestamp(char* buffer, size_t size) {
+        time_t now = time(NULL);
+        struct tm timeinfo;
+
+        // Use the secure/re-entrant version available on this platform
+#ifdef _MSC_VER
+        localtime_s(&timeinfo, &now);
+#else
+        localtime_r(&now, &timeinfo);
+#endif
+        strftime(buffer, size, "%Y-%m-%d %H:%M:%S", &timeinfo);
+    }
+
     // Initialize the singleton instance pointer
     LogManager::LogManager() {
         setType("LogManager");
         m_p_f = NULL;
         m_do_flush = false;
+        m_log_level = LogLevel::INFO;
     }
 
     // Destructor - close the log file if it's open
@@ -38,20 +53,22 @@ namespace gam300 {
         if (Manager::startUp())
             return -1;
 
-        // Try to open the log file using secure version
+        // Try to open the log file using secure version where available
+#ifdef _MSC_VER
         errno_t err = fopen_s(&m_p_f, LOGFILE_DEFAULT.c_str(), "w");
         if (err != 0 || m_p_f == NULL) {
             return -1;
         }
+#else
+        m_p_f = fopen(LOGFILE_DEFAULT.c_str(), "w");
+        if (m_p_f == NULL) {
+            return -1;
+        }
+#endif
 
         // Write header to log file with timestamp
-        time_t now = time(NULL);
         char timestamp[26];  // Enough space for the formatted time string
-        struct tm timeinfo;
-
-        // Format the time using secure version
-        localtime_s(&timeinfo, &now);
-        strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &timeinfo);
+        formatTimestamp(timestamp, sizeof(timestamp));
 
         // Write the header
         fprintf(m_p_f, "=== GAM300 LOG START: %s ===\n", timestamp);
@@ -69,13 +86,8 @@ namespace gam300 {
         // If the log file is open, close it
         if (m_p_f != NULL) {
             // Write footer with timestamp
-            time_t now = time(NULL);
             char timestamp[26];
-            struct tm timeinfo;
-
-            // Format the time using secure version
-            localtime_s(&timeinfo, &now);
-            strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &timeinfo);
+            formatTimestamp(timestamp, sizeof(timestamp));
 
             // Write the footer
             fprintf(m_p_f, "=== GAM300 LOG END: %s ===\n", timestamp);
@@ -91,33 +103,51 @@ namespace gam300 {
 
     // Write to the log file with printf-style formatting
     int LogManager::writeLog(const char* fmt, ...) const {
+        // Messages without a level are informational
+        if (LogLevel::INFO > m_log_level) {
+            return 0;
+        }
+
+        va_list args;
+        va_start(args, fmt);
+        int bytes_written = writeLogArgs(fmt, args);
+        va_end(args);
+
+        return bytes_written;
+    }
+
+    // Write to the log file at a given level with printf-style formatting
+    int LogManager::writeLog(LogLevel level, const char* fmt, ...) const {
+        // Skip messages more verbose than the current level
+        if (level > m_log_level) {
+            return 0;
+        }
+
+        va_list args;
+        va_start(args, fmt);
+        int bytes_written = writeLogArgs(fmt, args);
+        va_end(args);
+
+        return bytes_written;
+    }
+
+    // Write a formatted message with a timestamp prefix
+    int LogManager::writeLogArgs(const char* fmt, va_list args) const {
         // If the log file isn't open, return error
         if (m_p_f == NULL) {
             return -1;
         }
 
         // Get current time for timestamp
-        time_t now = time(NULL);
         char timestamp[26];
-        struct tm timeinfo;
-
-        // Format the time using secure version
-        localtime_s(&timeinfo, &now);
-        strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &timeinfo);
+        formatTimestamp(timestamp, sizeof(timestamp));
 
         // Write timestamp prefix
         fprintf(m_p_f, "[%s] ", timestamp);
 
-        // Set up variable arguments
-        va_list args;
-        va_start(args, fmt);
-
         // Write formatted message to log file
         int bytes_written = vfprintf(m_p_f, fmt, args);
 
-        // End variable arguments
-        va_end(args);
-
         // Add a newline if the message doesn't end with one
         if (bytes_written > 0 && fmt[strlen(fmt) - 1] != '\n') {
             fprintf(m_p_f, "\n");
@@ -131,6 +161,26 @@ namespace gam300 {
         return bytes_written;
     }
 
+    // Set the most verbose level that is written
+    void LogManager::setLogLevel(LogLevel level) {
+        m_log_level = level;
+    }
+
+    // Get the most verbose level that is written
+    LogLevel LogManager::getLogLevel() const {
+        return m_log_level;
+    }
+
+    // Convert a level name to a log level
+    bool LogManager::parseLogLevel(const std::string& name, LogLevel& level) {
+        if (name == "error") level = LogLevel::ERROR_LEVEL;
+        else if (name == "warning") level = LogLevel::WARNING;
+        else if (name == "info") level = LogLevel::INFO;
+        else if (name == "debug") level = LogLevel::DEBUG;
+        else return false;
+        return true;
+    }
+
     // Set whether to flush after each write
     void LogManager::setFlush(bool new_do_flush) {
         m_do_flush = new_do_flush;
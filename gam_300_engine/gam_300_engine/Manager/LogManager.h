@@ -29,6 +29,14 @@ namespace gam300 {
 
 	const std::string LOGFILE_DEFAULT = "gam300.log";
 
+	// Log verbosity levels, from least to most verbose.
+	enum class LogLevel {
+		ERROR_LEVEL = 0,	// Failures only
+		WARNING,			// Failures and recoverable problems
+		INFO,				// Normal engine messages (default)
+		DEBUG				// Chatty per-frame or per-object messages
+	};
+
 	class LogManager : public Manager {
 
 	private:
@@ -37,6 +45,10 @@ namespace gam300 {
 		void operator=(LogManager const&);// Don't allow assignment.
 		bool m_do_flush;                  // True if flush to disk after write.
 		FILE* m_p_f;                      // Pointer to main logfile.
+		LogLevel m_log_level;             // Most verbose level that is written.
+
+		// Write a formatted message with a timestamp prefix.
+		int writeLogArgs(const char* fmt, va_list args) const;
 
 	public:
 		// If logfile is open, close it.
@@ -66,6 +78,35 @@ namespace gam300 {
 		 */
 		int writeLog(const char* fmt, ...) const;
 
+		/**
+		 * @brief Write to logfile at a given level.
+		 * @param level Level of the message, skipped if more verbose than the log level.
+		 * @param fmt Format string supporting printf() formatting.
+		 * @param ... Variable arguments for formatting.
+		 * @return Number of bytes written (excluding prepends), 0 if skipped, -1 if error.
+		 */
+		int writeLog(LogLevel level, const char* fmt, ...) const;
+
+		/**
+		 * @brief Set the most verbose level that is written.
+		 * @param level The new log level (default: INFO).
+		 */
+		void setLogLevel(LogLevel level = LogLevel::INFO);
+
+		/**
+		 * @brief Get the most verbose level that is written.
+		 * @return The current log level.
+		 */
+		LogLevel getLogLevel() const;
+
+		/**
+		 * @brief Convert a level name ("error", "warning", "info", "debug") to a log level.
+		 * @param name The level name.
+		 * @param level Set to the parsed level on success.
+		 * @return True if the name was recognised, false otherwise.
+		 */
+		static bool parseLogLevel(const std::string& name, LogLevel& level);
+
 		/**
 		 * @brief Set flush of logfile after each write.
 		 * @param new_do_flush New flush setting (default: true).
@@ -0,0 +1,300 @@
+/**
+ * @file ProfileManager.cpp
+ * @brief Implementation of the Profile Manager for the game engine.
+ * @details Records per-frame timings and engine counters into a fixed ring buffer
+ *          and answers rolling min/avg/p95/p99/max queries over them.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "ProfileManager.h"
+#include "LogManager.h"
+#include "ECSManager.h"
+#include "ComponentManager.h"
+#include <algorithm>
+
+namespace gam300 {
+
+    // Initialize singleton instance
+    ProfileManager::ProfileManager() :
+        m_next_slot(0),
+        m_recorded_frames(0),
+        m_in_frame(false),
+        m_frame_count(0),
+        m_summary_interval(STATS_SUMMARY_INTERVAL_DEFAULT),
+        m_last_allocation_count(0) {
+        setType("ProfileManager");
+    }
+
+    // Get the singleton instance
+    ProfileManager& ProfileManager::getInstance() {
+        static ProfileManager instance;
+        return instance;
+    }
+
+    // Start up the ProfileManager
+    int ProfileManager::startUp() {
+        // Call parent's startUp() first
+        if (Manager::startUp())
+            return -1;
+
+        // Allocate everything up front so recording a frame never allocates
+        m_history.assign(STATS_HISTORY_FRAMES, FrameStats());
+        m_scratch.reserve(STATS_HISTORY_FRAMES);
+        m_system_names.clear();
+        m_system_names.reserve(MAX_PROFILED_SYSTEMS);
+        reset();
+
+        LM.writeLog("ProfileManager::startUp() - Profile Manager started with a %u frame history",
+            static_cast<unsigned int>(STATS_HISTORY_FRAMES));
+
+        return 0;
+    }
+
+    // Shut down the ProfileManager
+    void ProfileManager::shutDown() {
+        LM.writeLog("ProfileManager::shutDown() - Shutting down Profile Manager");
+
+        // Leave one last summary covering the end of the session
+        if (m_recorded_frames > 0) {
+            writeSummary();
+        }
+
+        m_history.clear();
+        m_scratch.clear();
+        m_system_names.clear();
+
+        // Call parent's shutDown()
+        Manager::shutDown();
+    }
+
+    // Mark the start of a frame
+    void ProfileManager::beginFrame() {
+        if (!isStarted()) return;
+
+        m_current = FrameStats();
+        m_current.frame = m_frame_count;
+        m_in_frame = true;
+        m_frame_clock.delta();
+    }
+
+    // Mark the end of a frame
+    void ProfileManager::endFrame() {
+        if (!isStarted() || !m_in_frame) return;
+
+        // Frame time is only measured here if the caller didn't provide it
+        if (m_current.metrics[static_cast<std::size_t>(FrameMetric::FRAME_TIME)] == 0) {
+            recordMetric(FrameMetric::FRAME_TIME, m_frame_clock.split());
+        }
+
+        // Sample the ECS counters
+        recordMetric(FrameMetric::ENTITY_COUNT, static_cast<int64_t>(EM.getAllEntities().size()));
+
+        int64_t component_count = 0;
+        for (ComponentTypeID type_id = 0; type_id < MAX_COMPONENTS; ++type_id) {
+            std::size_t pool_size = CM.get_pool_size(type_id);
+            m_current.pool_sizes[type_id] = static_cast<uint32_t>(pool_size);
+            component_count += static_cast<int64_t>(pool_size);
+        }
+        recordMetric(FrameMetric::COMPONENT_COUNT, component_count);
+
+        std::size_t allocation_count = CM.get_allocation_count();
+        recordMetric(FrameMetric::ALLOCATION_COUNT,
+            static_cast<int64_t>(allocation_count - m_last_allocation_count));
+        m_last_allocation_count = allocation_count;
+
+        // Commit the frame to the ring
+        m_history[m_next_slot] = m_current;
+        m_next_slot = (m_next_slot + 1) % STATS_HISTORY_FRAMES;
+        if (m_recorded_frames < STATS_HISTORY_FRAMES) {
+            m_recorded_frames++;
+        }
+
+        m_frame_count++;
+        m_in_frame = false;
+
+        // Periodic summary line
+        if (m_summary_interval > 0 && m_frame_count % m_summary_interval == 0) {
+            writeSummary();
+        }
+    }
+
+    // Set the value of a metric for the current frame
+    void ProfileManager::recordMetric(FrameMetric metric, int64_t value) {
+        m_current.metrics[static_cast<std::size_t>(metric)] = value;
+    }
+
+    // Add to the value of a metric for the current frame
+    void ProfileManager::addMetric(FrameMetric metric, int64_t value) {
+        m_current.metrics[static_cast<std::size_t>(metric)] += value;
+    }
+
+    // Reserve a profiling slot for a system
+    std::size_t ProfileManager::registerSystem(const std::string& name) {
+        // Reuse the slot if a system with this name was registered before
+        for (std::size_t slot = 0; slot < m_system_names.size(); ++slot) {
+            if (m_system_names[slot] == name) {
+                return slot;
+            }
+        }
+
+        if (m_system_names.size() >= MAX_PROFILED_SYSTEMS) {
+            LM.writeLog("ProfileManager::registerSystem() - No profiling slot left for system '%s'", name.c_str());
+            return INVALID_PROFILE_SLOT;
+        }
+
+        m_system_names.push_back(name);
+        return m_system_names.size() - 1;
+    }
+
+    // Record the update time of a system for the current frame
+    void ProfileManager::recordSystemTime(std::size_t slot, int64_t time_us) {
+        if (slot < MAX_PROFILED_SYSTEMS) {
+            m_current.system_time_us[slot] += time_us;
+        }
+    }
+
+    // Compute rolling statistics for a value pulled from each recorded frame
+    template<typename Getter>
+    RollingStats ProfileManager::computeStats(std::size_t window, Getter getter) const {
+        RollingStats stats;
+
+        std::size_t count = m_recorded_frames;
+        if (window > 0 && window < count) {
+            count = window;
+        }
+        if (count == 0) {
+            return stats;
+        }
+
+        // Gather the most recent 'count' frames, newest first
+        m_scratch.clear();
+        int64_t sum = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            std::size_t slot = (m_next_slot + STATS_HISTORY_FRAMES - 1 - i) % STATS_HISTORY_FRAMES;
+            int64_t value = getter(m_history[slot]);
+            m_scratch.push_back(value);
+            sum += value;
+        }
+
+        stats.samples = count;
+        stats.avg = static_cast<double>(sum) / static_cast<double>(count);
+
+        auto minmax = std::minmax_element(m_scratch.begin(), m_scratch.end());
+        stats.min = *minmax.first;
+        stats.max = *minmax.second;
+
+        // Nearest-rank percentiles, p99 is found in the upper partition left by p95
+        std::size_t p95_rank = (count * 95 + 99) / 100 - 1;
+        std::size_t p99_rank = (count * 99 + 99) / 100 - 1;
+        std::nth_element(m_scratch.begin(), m_scratch.begin() + p95_rank, m_scratch.end());
+        stats.p95 = m_scratch[p95_rank];
+        std::nth_element(m_scratch.begin() + p95_rank, m_scratch.begin() + p99_rank, m_scratch.end());
+        stats.p99 = m_scratch[p99_rank];
+
+        return stats;
+    }
+
+    // Get rolling statistics for a metric
+    RollingStats ProfileManager::getStats(FrameMetric metric, std::size_t window) const {
+        std::size_t index = static_cast<std::size_t>(metric);
+        return computeStats(window, [index](const FrameStats& frame) {
+            return frame.metrics[index];
+            });
+    }
+
+    // Get rolling statistics for a system's update time
+    RollingStats ProfileManager::getSystemStats(std::size_t slot, std::size_t window) const {
+        if (slot >= MAX_PROFILED_SYSTEMS) {
+            return RollingStats();
+        }
+        return computeStats(window, [slot](const FrameStats& frame) {
+            return frame.system_time_us[slot];
+            });
+    }
+
+    // Get rolling statistics for the size of a component pool
+    RollingStats ProfileManager::getPoolStats(ComponentTypeID type_id, std::size_t window) const {
+        if (type_id >= MAX_COMPONENTS) {
+            return RollingStats();
+        }
+        return computeStats(window, [type_id](const FrameStats& frame) {
+            return static_cast<int64_t>(frame.pool_sizes[type_id]);
+            });
+    }
+
+    // Get a recorded frame
+    const FrameStats* ProfileManager::getFrame(std::size_t frames_ago) const {
+        if (frames_ago >= m_recorded_frames) {
+            return nullptr;
+        }
+        std::size_t slot = (m_next_slot + STATS_HISTORY_FRAMES - 1 - frames_ago) % STATS_HISTORY_FRAMES;
+        return &m_history[slot];
+    }
+
+    // Get the number of frames currently held in the ring buffer
+    std::size_t ProfileManager::getRecordedFrameCount() const {
+        return m_recorded_frames;
+    }
+
+    // Set how often a summary line is written to the log
+    void ProfileManager::setSummaryInterval(int frames) {
+        m_summary_interval = frames;
+    }
+
+    // Discard all recorded frames
+    void ProfileManager::reset() {
+        m_next_slot = 0;
+        m_recorded_frames = 0;
+        m_frame_count = 0;
+        m_in_frame = false;
+        m_current = FrameStats();
+        m_last_allocation_count = CM.get_allocation_count();
+    }
+
+    // Write the periodic summary line to the log
+    void ProfileManager::writeSummary() const {
+        std::size_t window = m_summary_interval > 0 ? static_cast<std::size_t>(m_summary_interval) : 0;
+
+        RollingStats frame = getStats(FrameMetric::FRAME_TIME, window);
+        RollingStats update = getStats(FrameMetric::UPDATE_TIME, window);
+        RollingStats overrun = getStats(FrameMetric::OVERRUN_TIME, window);
+        RollingStats jitter = getStats(FrameMetric::FRAME_JITTER, window);
+        RollingStats allocations = getStats(FrameMetric::ALLOCATION_COUNT, window);
+        RollingStats input_latency = getStats(FrameMetric::INPUT_LATENCY, window);
+        const FrameStats* last = getFrame();
+
+        LM.writeLog("ProfileManager - %u frames: frame min %.2f avg %.2f p95 %.2f p99 %.2f max %.2f ms | "
+            "update avg %.2f p99 %.2f ms | jitter avg %.3f p99 %.3f ms | overrun max %.2f ms | input latency p99 %.2f max %.2f ms | "
+            "entities %lld components %lld allocs %.1f/frame",
+            static_cast<unsigned int>(frame.samples),
+            frame.min / 1000.0, frame.avg / 1000.0, frame.p95 / 1000.0, frame.p99 / 1000.0, frame.max / 1000.0,
+            update.avg / 1000.0, update.p99 / 1000.0,
+            jitter.avg / 1000.0, jitter.p99 / 1000.0,
+            overrun.max / 1000.0,
+            input_latency.p99 / 1000.0, input_latency.max / 1000.0,
+            last ? static_cast<long long>(last->metrics[static_cast<std::size_t>(FrameMetric::ENTITY_COUNT)]) : 0LL,
+            last ? static_cast<long long>(last->metrics[static_cast<std::size_t>(FrameMetric::COMPONENT_COUNT)]) : 0LL,
+            allocations.avg);
+
+        // Point at the most expensive system so regressions are easy to attribute
+        std::size_t slowest_slot = INVALID_PROFILE_SLOT;
+        RollingStats slowest;
+        for (std::size_t slot = 0; slot < m_system_names.size(); ++slot) {
+            RollingStats system = getSystemStats(slot, window);
+            if (slowest_slot == INVALID_PROFILE_SLOT || system.avg > slowest.avg) {
+                slowest_slot = slot;
+                slowest = system;
+            }
+        }
+        if (slowest_slot != INVALID_PROFILE_SLOT) {
+            LM.writeLog("ProfileManager - slowest system '%s': avg %.1f p99 %lld max %lld us",
+                m_system_names[slowest_slot].c_str(), slowest.avg,
+                static_cast<long long>(slowest.p99), static_cast<long long>(slowest.max));
+        }
+    }
+
+} // end of namespace gam300
@@ -0,0 +1,214 @@
+/**
+ * @file ProfileManager.h
+ * @brief Declaration of the Profile Manager for the game engine.
+ * @details Records per-frame timings and engine counters into a fixed ring buffer
+ *          and answers rolling min/avg/p95/p99/max queries over them.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __PROFILE_MANAGER_H__
+#define __PROFILE_MANAGER_H__
+
+#include "Manager.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../Utility/Clock.h"
+#include "../Utility/ECS_Variables.h"
+
+// Two-letter acronym for easier access to manager.
+#define PM gam300::ProfileManager::getInstance()
+
+namespace gam300 {
+
+    // Number of frames kept in the statistics ring buffer.
+    constexpr std::size_t STATS_HISTORY_FRAMES = 1024;
+
+    // Maximum number of systems that can be timed individually.
+    constexpr std::size_t MAX_PROFILED_SYSTEMS = 32;
+
+    // Default number of frames between summary lines in the log (0 disables).
+    constexpr int STATS_SUMMARY_INTERVAL_DEFAULT = 600;
+
+    // Slot returned when a system could not be given a profiling slot.
+    constexpr std::size_t INVALID_PROFILE_SLOT = static_cast<std::size_t>(-1);
+
+    // Per-frame values recorded by the ProfileManager.
+    enum class FrameMetric {
+        FRAME_TIME = 0,     // Total time of the frame in microseconds
+        UPDATE_TIME,        // Time spent updating systems in microseconds
+        SLEEP_TIME,         // Time spent waiting for the next frame in microseconds
+        OVERRUN_TIME,       // Time the frame ran past its budget in microseconds
+        FRAME_JITTER,       // Distance of the frame time from its target in microseconds
+        SIM_STEPS,          // Number of fixed simulation steps run during the frame
+        ENTITY_COUNT,       // Number of live entities at the end of the frame
+        COMPONENT_COUNT,    // Number of components across all pools at the end of the frame
+        ALLOCATION_COUNT,   // Number of components allocated during the frame
+        INPUT_LATENCY,      // Age of the oldest input event when the simulation consumed it in microseconds
+        INPUT_EVENTS,       // Number of input events consumed during the frame
+        COUNT               // Number of metrics, keep last
+    };
+
+    // Everything recorded for a single frame.
+    struct FrameStats {
+        int frame = 0;                                                  // Frame number
+        std::array<int64_t, static_cast<std::size_t>(FrameMetric::COUNT)> metrics{}; // Values indexed by FrameMetric
+        std::array<int64_t, MAX_PROFILED_SYSTEMS> system_time_us{};     // Update time per profiled system
+        std::array<uint32_t, MAX_COMPONENTS> pool_sizes{};              // Component count per component type
+    };
+
+    // Result of a rolling query over the ring buffer.
+    struct RollingStats {
+        std::size_t samples = 0;    // Number of frames the statistics were computed over
+        int64_t min = 0;            // Smallest value
+        double avg = 0.0;           // Mean value
+        int64_t p95 = 0;            // 95th percentile
+        int64_t p99 = 0;            // 99th percentile
+        int64_t max = 0;            // Largest value
+    };
+
+    class ProfileManager : public Manager {
+
+    private:
+        ProfileManager();                         // Private since a singleton.
+        ProfileManager(ProfileManager const&);    // Don't allow copy.
+        void operator=(ProfileManager const&);    // Don't allow assignment.
+
+        std::vector<FrameStats> m_history;        // Ring buffer of completed frames
+        std::size_t m_next_slot;                  // Ring slot the next frame will be written to
+        std::size_t m_recorded_frames;            // Number of valid frames in the ring (<= capacity)
+        FrameStats m_current;                     // Frame currently being recorded
+        bool m_in_frame;                          // True between beginFrame() and endFrame()
+        int m_frame_count;                        // Number of frames recorded since startUp()
+        int m_summary_interval;                   // Frames between summary log lines
+        std::size_t m_last_allocation_count;      // Component allocations seen at the previous frame end
+        Clock m_frame_clock;                      // Measures the frame time
+
+        std::vector<std::string> m_system_names;  // Name of the system occupying each profiling slot
+
+        mutable std::vector<int64_t> m_scratch;   // Preallocated scratch space for percentile queries
+
+        // Compute rolling statistics for a value pulled from each recorded frame.
+        template<typename Getter>
+        RollingStats computeStats(std::size_t window, Getter getter) const;
+
+        // Write the periodic summary line to the log.
+        void writeSummary() const;
+
+    public:
+        /**
+         * @brief Get the singleton instance of the ProfileManager.
+         * @return Reference to the singleton instance.
+         */
+        static ProfileManager& getInstance();
+
+        /**
+         * @brief Start up the ProfileManager.
+         * @return 0 if successful, else -1.
+         * @details Allocates the ring buffer up front so recording never allocates.
+         */
+        int startUp() override;
+
+        /**
+         * @brief Shut down the ProfileManager.
+         * @details Writes a final summary before releasing the ring buffer.
+         */
+        void shutDown() override;
+
+        /**
+         * @brief Mark the start of a frame.
+         * @details Resets the record for the new frame and restarts the frame clock.
+         */
+        void beginFrame();
+
+        /**
+         * @brief Mark the end of a frame.
+         * @details Samples engine counters, commits the frame to the ring buffer
+         *          and writes a summary line every summary interval.
+         */
+        void endFrame();
+
+        /**
+         * @brief Set the value of a metric for the current frame.
+         * @param metric The metric to set.
+         * @param value The value to record.
+         */
+        void recordMetric(FrameMetric metric, int64_t value);
+
+        /**
+         * @brief Add to the value of a metric for the current frame.
+         * @param metric The metric to accumulate into.
+         * @param value The value to add.
+         */
+        void addMetric(FrameMetric metric, int64_t value);
+
+        /**
+         * @brief Reserve a profiling slot for a system.
+         * @param name The name of the system, used in summaries.
+         * @return The slot index, or INVALID_PROFILE_SLOT if all slots are taken.
+         */
+        std::size_t registerSystem(const std::string& name);
+
+        /**
+         * @brief Record the update time of a system for the current frame.
+         * @param slot The slot returned by registerSystem().
+         * @param time_us The update time in microseconds.
+         */
+        void recordSystemTime(std::size_t slot, int64_t time_us);
+
+        /**
+         * @brief Get rolling statistics for a metric.
+         * @param metric The metric to query.
+         * @param window Number of most recent frames to include (0 for the whole ring).
+         * @return The rolling statistics.
+         */
+        RollingStats getStats(FrameMetric metric, std::size_t window = 0) const;
+
+        /**
+         * @brief Get rolling statistics for a system's update time.
+         * @param slot The slot returned by registerSystem().
+         * @param window Number of most recent frames to include (0 for the whole ring).
+         * @return The rolling statistics in microseconds.
+         */
+        RollingStats getSystemStats(std::size_t slot, std::size_t window = 0) const;
+
+        /**
+         * @brief Get rolling statistics for the size of a component pool.
+         * @param type_id The component type to query.
+         * @param window Number of most recent frames to include (0 for the whole ring).
+         * @return The rolling statistics.
+         */
+        RollingStats getPoolStats(ComponentTypeID type_id, std::size_t window = 0) const;
+
+        /**
+         * @brief Get a recorded frame.
+         * @param frames_ago 0 for the most recent completed frame, 1 for the one before, etc.
+         * @return Pointer to the frame, or nullptr if it is no longer in the ring.
+         */
+        const FrameStats* getFrame(std::size_t frames_ago = 0) const;
+
+        /**
+         * @brief Get the number of frames currently held in the ring buffer.
+         * @return The number of recorded frames.
+         */
+        std::size_t getRecordedFrameCount() const;
+
+        /**
+         * @brief Set how often a summary line is written to the log.
+         * @param frames Number of frames between summaries (0 disables summaries).
+         */
+        void setSummaryInterval(int frames);
+
+        /**
+         * @brief Discard all recorded frames.
+         */
+        void reset();
+    };
+
+} // end of namespace gam300
+#endif // __PROFILE_MANAGER_H__
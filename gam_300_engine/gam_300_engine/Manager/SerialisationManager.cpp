@@ -16,10 +16,107 @@
 #include "../Utility/InputKeyMappings.h"
 #include <fstream>
 #include <sstream>
-#include <functional>
+#include <unordered_set>
+#include <cstdlib>
+#include <iterator>
 
 namespace gam300 {
 
+    // Log messages of the actions loaded from scene files, shared by every mapping with the same text
+    static const std::string* internSceneActionMessage(const std::string& message) {
+        static std::unordered_set<std::string> s_messages; // Node based, so the pointers stay valid
+        return &*s_messages.insert(message).first;
+    }
+
+    // Callback of actions loaded from scene files, logs the action's message
+    static void logSceneAction(void* user_data, EntityID /*entity_id*/, ActionID action) {
+        if (user_data) {
+            LM.writeLog("%s", static_cast<const std::string*>(user_data)->c_str());
+        }
+        else {
+            LM.writeLog("%s action", IM.getActionName(action).c_str());
+        }
+    }
+
+    // Message written to the scene file for an action
+    static std::string getSceneActionMessage(const InputAction& action) {
+        if (action.callback == &logSceneAction && action.user_data) {
+            return *static_cast<const std::string*>(action.user_data);
+        }
+        return IM.getActionName(action.id) + " action";
+    }
+
+    // Log messages of context actions loaded from scene files, indexed by ActionID
+    static std::vector<const std::string*>& getContextActionMessages() {
+        static std::vector<const std::string*> s_messages;
+        return s_messages;
+    }
+
+    // Remember the log message of a context action
+    static void setContextActionMessage(ActionID action, const std::string& message) {
+        std::vector<const std::string*>& messages = getContextActionMessages();
+        if (messages.size() <= action) {
+            messages.resize(action + 1, nullptr);
+        }
+        messages[action] = internSceneActionMessage(message);
+    }
+
+    // Message written to the scene file for a context action
+    static std::string getContextActionMessage(ActionID action) {
+        const std::vector<const std::string*>& messages = getContextActionMessages();
+        if (action < messages.size() && messages[action]) {
+            return *messages[action];
+        }
+        return IM.getActionName(action) + " action";
+    }
+
+    // Context callback of entities loaded from scene files, logs the action's message
+    static void logSceneContextAction(void* /*user_data*/, EntityID /*entity_id*/, ActionID action) {
+        LM.writeLog("%s", getContextActionMessage(action).c_str());
+    }
+
+    // Name of an action type in scene files
+    static const char* getActionTypeName(InputActionType type) {
+        switch (type) {
+        case InputActionType::RELEASE: return "release";
+        case InputActionType::REPEAT:  return "repeat";
+        case InputActionType::AXIS:    return "axis";
+        default:                       return "press";
+        }
+    }
+
+    // Name of a key or offset mouse button code in scene files
+    static std::string getInputCodeName(int input_code) {
+        if (input_code >= MOUSE_BUTTON_INPUT_OFFSET) {
+            for (const auto& buttonPair : getMouseButtonNameMap()) {
+                if (buttonPair.second == input_code - MOUSE_BUTTON_INPUT_OFFSET) {
+                    return buttonPair.first;
+                }
+            }
+        }
+        else {
+            for (const auto& keyPair : getKeyNameMap()) {
+                if (keyPair.second == input_code) {
+                    return keyPair.first;
+                }
+            }
+        }
+        return "UNKNOWN";
+    }
+
+    // Key or offset mouse button code of a name in scene files, -1 if unknown
+    static int getInputCodeFromName(const std::string& name) {
+        int key = getKeyCodeFromName(name);
+        if (key != GLFW_KEY_UNKNOWN) {
+            return key;
+        }
+        int button = getMouseButtonFromName(name);
+        return button == -1 ? -1 : MOUSE_BUTTON_INPUT_OFFSET + button;
+    }
+
+    // Names of axis sources in scene files, indexed by InputAxisSource
+    static const char* const AXIS_SOURCE_NAMES[] = { "keys", "mouse_x", "mouse_y", "scroll_x", "scroll_y" };
+
     // InputComponentSerializer implementation
     std::string InputComponentSerializer::serialize(Component* component) {
         InputComponent* input = static_cast<InputComponent*>(component);
@@ -38,10 +135,9 @@ namespace gam300 {
         std::vector<const InputAction*> mouseMappings;
 
         // Sort the actions into the appropriate categories
-        for (const auto& pair : actions) {
-            const InputAction& action = pair.second;
-            // Mouse buttons start at GLFW_MOUSE_BUTTON_1
-            if (action.input_key >= GLFW_MOUSE_BUTTON_1) {
+        for (const InputAction& action : actions) {
+            // Mouse buttons start at MOUSE_BUTTON_INPUT_OFFSET
+            if (action.input_key >= MOUSE_BUTTON_INPUT_OFFSET) {
                 mouseMappings.push_back(&action);
             }
             else {
@@ -54,7 +150,7 @@ namespace gam300 {
         for (size_t i = 0; i < keyMappings.size(); i++) {
             const InputAction* action = keyMappings[i];
             ss << "            {\n";
-            ss << "              \"name\": \"" << action->name << "\",\n";
+            ss << "              \"name\": \"" << IM.getActionName(action->id) << "\",\n";
 
             // Convert action type to string
             std::string typeStr = "press";
@@ -74,7 +170,7 @@ namespace gam300 {
             }
 
             ss << "              \"key\": \"" << keyStr << "\",\n";
-            ss << "              \"action\": \"" << action->name << " action\"\n";
+            ss << "              \"action\": \"" << getSceneActionMessage(*action) << "\"\n";
             ss << "            }";
 
             // Add comma if not the last item
@@ -90,7 +186,7 @@ namespace gam300 {
         for (size_t i = 0; i < mouseMappings.size(); i++) {
             const InputAction* action = mouseMappings[i];
             ss << "            {\n";
-            ss << "              \"name\": \"" << action->name << "\",\n";
+            ss << "              \"name\": \"" << IM.getActionName(action->id) << "\",\n";
 
             // Convert action type to string
             std::string typeStr = "press";
@@ -101,7 +197,7 @@ namespace gam300 {
 
             // Convert button code to string
             std::string buttonStr = "UNKNOWN";
-            int buttonIndex = action->input_key - GLFW_MOUSE_BUTTON_1; // Convert back to button index
+            int buttonIndex = action->input_key - MOUSE_BUTTON_INPUT_OFFSET; // Convert back to button index
             for (const auto& buttonPair : getMouseButtonNameMap()) {
                 if (buttonPair.second == buttonIndex) {
                     buttonStr = buttonPair.first;
@@ -110,7 +206,7 @@ namespace gam300 {
             }
 
             ss << "              \"button\": \"" << buttonStr << "\",\n";
-            ss << "              \"action\": \"" << action->name << " action\"\n";
+            ss << "              \"action\": \"" << getSceneActionMessage(*action) << "\"\n";
             ss << "            }";
 
             // Add comma if not the last item
@@ -119,7 +215,19 @@ namespace gam300 {
             }
             ss << "\n";
         }
-        ss << "          ]\n";
+        ss << "          ]";
+
+        // Serialize the shared contexts the entity listens to
+        const std::vector<ContextID>& contexts = input->getContexts();
+        if (!contexts.empty()) {
+            ss << ",\n          \"contexts\": [";
+            for (size_t i = 0; i < contexts.size(); i++) {
+                const InputContext* context = IM.getContext(contexts[i]);
+                ss << (i > 0 ? ", " : "") << "\"" << (context ? context->name : "") << "\"";
+            }
+            ss << "]";
+        }
+        ss << "\n";
         ss << "        }";
 
         return ss.str();
@@ -142,6 +250,22 @@ namespace gam300 {
             SerialisationManager::parseMouseMappings(mouseMappingsSection, input);
         }
 
+        // Reference shared contexts instead of carrying a copy of their bindings
+        std::string contextsSection = SerialisationManager::extractSection(jsonData, "\"contexts\"");
+        bool hasContexts = false;
+        size_t namePos = contextsSection.find('"');
+        while (namePos != std::string::npos) {
+            size_t nameEnd = contextsSection.find('"', namePos + 1);
+            if (nameEnd == std::string::npos) {
+                break;
+            }
+            hasContexts |= input->addContext(contextsSection.substr(namePos + 1, nameEnd - namePos - 1));
+            namePos = contextsSection.find('"', nameEnd + 1);
+        }
+        if (hasContexts) {
+            input->setContextCallback(&logSceneContextAction);
+        }
+
         return input;
     }
 
@@ -217,6 +341,17 @@ namespace gam300 {
             return false;
         }
 
+        // Shared input contexts come first so objects can reference them
+        std::string contextsSection = extractSection(fileContent, "\"inputContexts\"");
+        if (!contextsSection.empty()) {
+            parseInputContexts(contextsSection);
+        }
+
+        std::string axesSection = extractSection(fileContent, "\"inputAxes\"");
+        if (!axesSection.empty()) {
+            parseInputAxes(axesSection);
+        }
+
         // Very simple JSON parsing - in a real implementation we would use a proper JSON parser
         // Find the objects array
         size_t objectsStart = fileContent.find("\"objects\"");
@@ -232,9 +367,20 @@ namespace gam300 {
             return false;
         }
 
-        // Find the end of the objects array
-        size_t arrayEnd = fileContent.find(']', arrayStart);
-        if (arrayEnd == std::string::npos) {
+        // Find the end of the objects array, skipping the arrays nested inside objects
+        int arrayBracketLevel = 1;
+        size_t arrayEnd = arrayStart + 1;
+        while (arrayBracketLevel > 0 && arrayEnd < fileContent.length()) {
+            if (fileContent[arrayEnd] == '[') {
+                arrayBracketLevel++;
+            }
+            else if (fileContent[arrayEnd] == ']') {
+                arrayBracketLevel--;
+            }
+            arrayEnd++;
+        }
+        arrayEnd--; // Move back to the closing bracket
+        if (arrayBracketLevel != 0) {
             LM.writeLog("SerialisationManager::loadScene() - Invalid objects format in scene file");
             return false;
         }
@@ -242,6 +388,9 @@ namespace gam300 {
         // Extract the objects array content
         std::string objectsContent = fileContent.substr(arrayStart + 1, arrayEnd - arrayStart - 1);
 
+        // Systems pick up each object once, after all of its components are in place
+        EM.beginComponentBatch();
+
         // Process each object in the array
         size_t objectStart = 0;
         while (objectStart < objectsContent.length()) {
@@ -340,6 +489,8 @@ namespace gam300 {
             objectStart = objectEnd + 1;
         }
 
+        EM.endComponentBatch();
+
         LM.writeLog("SerialisationManager::loadScene() - Scene loaded successfully");
         return true;
     }
@@ -360,6 +511,62 @@ namespace gam300 {
 
         // Start the JSON structure
         file << "{\n";
+
+        // Shared input contexts, written once however many entities use them
+        if (IM.getContextCount() > 0) {
+            file << getIndent(1) << "\"inputContexts\": [\n";
+            for (ContextID id = 0; id < IM.getContextCount(); ++id) {
+                const InputContext* context = IM.getContext(id);
+                file << getIndent(2) << "{\n";
+                file << getIndent(3) << "\"name\": \"" << context->name << "\",\n";
+                file << getIndent(3) << "\"priority\": " << context->priority << ",\n";
+                file << getIndent(3) << "\"enabled\": " << (context->enabled ? "true" : "false") << ",\n";
+                file << getIndent(3) << "\"consumeInput\": " << (context->consume_input ? "true" : "false") << ",\n";
+
+                // Keyboard and mouse bindings go in separate arrays, like component mappings
+                for (int mouse = 0; mouse < 2; ++mouse) {
+                    file << getIndent(3) << (mouse ? "\"mouseMappings\": [" : "\"keyMappings\": [");
+                    bool first = true;
+                    for (const InputContextBinding& binding : context->bindings) {
+                        if ((binding.input_key >= MOUSE_BUTTON_INPUT_OFFSET) != (mouse == 1)) {
+                            continue;
+                        }
+
+                        std::string codeStr = getInputCodeName(binding.input_key);
+                        file << (first ? "\n" : ",\n");
+                        file << getIndent(4) << "{ \"name\": \"" << IM.getActionName(binding.action) << "\", "
+                            << "\"type\": \"" << getActionTypeName(binding.type) << "\", "
+                            << (mouse ? "\"button\"" : "\"key\"") << ": \"" << codeStr << "\", "
+                            << "\"action\": \"" << getContextActionMessage(binding.action) << "\" }";
+                        first = false;
+                    }
+                    file << (first ? "]" : "\n" + getIndent(3) + "]") << (mouse ? "\n" : ",\n");
+                }
+
+                file << getIndent(2) << "}" << (id + 1 < IM.getContextCount() ? "," : "") << "\n";
+            }
+            file << getIndent(1) << "],\n";
+        }
+
+        // Shared axes, read by systems rather than attached to objects
+        if (IM.getAxisCount() > 0) {
+            file << getIndent(1) << "\"inputAxes\": [\n";
+            for (AxisID id = 0; id < IM.getAxisCount(); ++id) {
+                const InputAxis* axis = IM.getAxis(id);
+                file << getIndent(2) << "{ \"name\": \"" << axis->name << "\", "
+                    << "\"source\": \"" << AXIS_SOURCE_NAMES[static_cast<int>(axis->source)] << "\", ";
+                if (axis->source == InputAxisSource::KEYS) {
+                    file << "\"negative\": \"" << getInputCodeName(axis->negative_key) << "\", "
+                        << "\"positive\": \"" << getInputCodeName(axis->positive_key) << "\", ";
+                }
+                else {
+                    file << "\"deadZone\": " << axis->dead_zone << ", ";
+                }
+                file << "\"scale\": " << axis->scale << " }" << (id + 1 < IM.getAxisCount() ? "," : "") << "\n";
+            }
+            file << getIndent(1) << "],\n";
+        }
+
         file << getIndent(1) << "\"objects\": [\n";
 
         // Save each entity
@@ -385,10 +592,9 @@ namespace gam300 {
             // TODO: Add more component types here as needed
 
             // Close the components object
-            file << "\n" << getIndent(3) << "}";
+            file << "\n" << getIndent(3) << "}\n";
 
             // Add comma if not the last entity
-            file << (i < entities.size() - 1 ? "," : "") << "\n";
             file << getIndent(2) << "}";
             file << (i < entities.size() - 1 ? "," : "") << "\n";
         }
@@ -548,23 +754,20 @@ namespace gam300 {
                 continue;
             }
 
-            // Create a closure that logs the action
-            std::string actionCopy = action; // Copy for the lambda capture
-            auto callback = [actionCopy]() {
-                LM.writeLog("%s", actionCopy.c_str());
-                };
+            // Log the action's message when it fires, the text is stored once per distinct message
+            void* message = const_cast<std::string*>(internSceneActionMessage(action));
 
             // Register the mapping based on type
             if (type == "press") {
-                input->mapKeyPress(name, keyCode, callback);
+                input->mapKeyPress(name, keyCode, &logSceneAction, message);
                 LM.writeLog("Added key press mapping: %s -> %s", name.c_str(), action.c_str());
             }
             else if (type == "release") {
-                input->mapKeyRelease(name, keyCode, callback);
+                input->mapKeyRelease(name, keyCode, &logSceneAction, message);
                 LM.writeLog("Added key release mapping: %s -> %s", name.c_str(), action.c_str());
             }
             else if (type == "repeat") {
-                input->mapKeyRepeat(name, keyCode, callback);
+                input->mapKeyRepeat(name, keyCode, &logSceneAction, message);
                 LM.writeLog("Added key repeat mapping: %s -> %s", name.c_str(), action.c_str());
             }
         }
@@ -593,24 +796,173 @@ namespace gam300 {
                 continue;
             }
 
-            // Create a closure that logs the action
-            std::string actionCopy = action; // Copy for the lambda capture
-            auto callback = [actionCopy]() {
-                LM.writeLog("%s", actionCopy.c_str());
-                };
+            // Log the action's message when it fires, the text is stored once per distinct message
+            void* message = const_cast<std::string*>(internSceneActionMessage(action));
 
             // Register the mapping based on type
             if (type == "press") {
-                input->mapMousePress(name, buttonCode, callback);
+                input->mapMousePress(name, buttonCode, &logSceneAction, message);
                 LM.writeLog("Added mouse press mapping: %s -> %s", name.c_str(), action.c_str());
             }
             else if (type == "release") {
-                input->mapMouseRelease(name, buttonCode, callback);
+                input->mapMouseRelease(name, buttonCode, &logSceneAction, message);
                 LM.writeLog("Added mouse release mapping: %s -> %s", name.c_str(), action.c_str());
             }
         }
     }
 
+    // Parse the shared input contexts of a scene
+    void SerialisationManager::parseInputContexts(const std::string& contextsJson) {
+        for (const auto& contextJson : splitJsonArray(contextsJson)) {
+            // Settings come before the mapping arrays, whose entries have names of their own
+            std::string header = contextJson.substr(0, contextJson.find('['));
+            std::string name = extractQuotedValue(header, "name");
+            if (name.empty()) {
+                LM.writeLog(LogLevel::WARNING, "SerialisationManager::parseInputContexts() - Input context without a name");
+                continue;
+            }
+
+            ContextID context = IM.createContext(name, extractIntValue(header, "priority", 0));
+            IM.setContextPriority(context, extractIntValue(header, "priority", 0));
+            IM.setContextEnabled(context, extractBoolValue(header, "enabled", true));
+            IM.setContextConsumesInput(context, extractBoolValue(header, "consumeInput", true));
+
+            for (int mouse = 0; mouse < 2; ++mouse) {
+                std::string section = extractSection(contextJson, mouse ? "\"mouseMappings\"" : "\"keyMappings\"");
+                for (const auto& mapping : splitJsonArray(section)) {
+                    std::string actionName = extractQuotedValue(mapping, "name");
+                    std::string type = extractQuotedValue(mapping, "type");
+                    std::string code = extractQuotedValue(mapping, mouse ? "button" : "key");
+
+                    int inputKey = -1;
+                    if (mouse) {
+                        int button = getMouseButtonFromName(code);
+                        inputKey = button == -1 ? -1 : MOUSE_BUTTON_INPUT_OFFSET + button;
+                    }
+                    else {
+                        int key = getKeyCodeFromName(code);
+                        inputKey = key == GLFW_KEY_UNKNOWN ? -1 : key;
+                    }
+
+                    InputActionType actionType = InputActionType::PRESS;
+                    if (type == "release") actionType = InputActionType::RELEASE;
+                    else if (type == "repeat") actionType = InputActionType::REPEAT;
+
+                    if (actionName.empty() || inputKey < 0 ||
+                        !IM.bindContextAction(context, actionName, inputKey, actionType)) {
+                        LM.writeLog(LogLevel::WARNING, "SerialisationManager::parseInputContexts() - Skipping mapping '%s' in context '%s'",
+                            actionName.c_str(), name.c_str());
+                        continue;
+                    }
+                    setContextActionMessage(IM.findAction(actionName), extractQuotedValue(mapping, "action"));
+                }
+            }
+
+            LM.writeLog("SerialisationManager::parseInputContexts() - Loaded input context '%s' with %zu bindings",
+                name.c_str(), IM.getContext(context)->bindings.size());
+        }
+    }
+
+    // Parse the shared input axes of a scene
+    void SerialisationManager::parseInputAxes(const std::string& axesJson) {
+        for (const auto& axisJson : splitJsonArray(axesJson)) {
+            std::string name = extractQuotedValue(axisJson, "name");
+            std::string source = extractQuotedValue(axisJson, "source");
+            float scale = extractFloatValue(axisJson, "scale", 1.0f);
+
+            int sourceIndex = -1;
+            for (int i = 0; i < static_cast<int>(std::size(AXIS_SOURCE_NAMES)); ++i) {
+                if (source == AXIS_SOURCE_NAMES[i]) {
+                    sourceIndex = i;
+                    break;
+                }
+            }
+
+            if (name.empty() || sourceIndex == -1) {
+                LM.writeLog(LogLevel::WARNING, "SerialisationManager::parseInputAxes() - Skipping axis '%s' with source '%s'",
+                    name.c_str(), source.c_str());
+                continue;
+            }
+
+            if (static_cast<InputAxisSource>(sourceIndex) == InputAxisSource::KEYS) {
+                int negative = getInputCodeFromName(extractQuotedValue(axisJson, "negative"));
+                int positive = getInputCodeFromName(extractQuotedValue(axisJson, "positive"));
+                if (negative < 0 || positive < 0) {
+                    LM.writeLog(LogLevel::WARNING, "SerialisationManager::parseInputAxes() - Axis '%s' has an unknown key", name.c_str());
+                    continue;
+                }
+                IM.createKeyAxis(name, negative, positive, scale);
+            }
+            else {
+                IM.createAxis(name, static_cast<InputAxisSource>(sourceIndex), scale, extractFloatValue(axisJson, "deadZone", 0.0f));
+            }
+        }
+
+        LM.writeLog("SerialisationManager::parseInputAxes() - %zu input axes defined", IM.getAxisCount());
+    }
+
+    // Helper function to extract a floating point field
+    float SerialisationManager::extractFloatValue(const std::string& json, const std::string& fieldName, float defaultValue) {
+        size_t pos = json.find("\"" + fieldName + "\"");
+        if (pos == std::string::npos) {
+            return defaultValue;
+        }
+
+        size_t colonPos = json.find(':', pos);
+        if (colonPos == std::string::npos) {
+            return defaultValue;
+        }
+
+        const char* start = json.c_str() + colonPos + 1;
+        char* end = nullptr;
+        float value = strtof(start, &end);
+        return end == start ? defaultValue : value;
+    }
+
+    // Helper function to extract an integer field
+    int SerialisationManager::extractIntValue(const std::string& json, const std::string& fieldName, int defaultValue) {
+        size_t pos = json.find("\"" + fieldName + "\"");
+        if (pos == std::string::npos) {
+            return defaultValue;
+        }
+
+        size_t colonPos = json.find(':', pos);
+        if (colonPos == std::string::npos) {
+            return defaultValue;
+        }
+
+        size_t valueStart = json.find_first_not_of(" \t\r\n", colonPos + 1);
+        if (valueStart == std::string::npos) {
+            return defaultValue;
+        }
+
+        char* end = nullptr;
+        long value = strtol(json.c_str() + valueStart, &end, 10);
+        return end == json.c_str() + valueStart ? defaultValue : static_cast<int>(value);
+    }
+
+    // Helper function to extract a boolean field
+    bool SerialisationManager::extractBoolValue(const std::string& json, const std::string& fieldName, bool defaultValue) {
+        size_t pos = json.find("\"" + fieldName + "\"");
+        if (pos == std::string::npos) {
+            return defaultValue;
+        }
+
+        size_t colonPos = json.find(':', pos);
+        if (colonPos == std::string::npos) {
+            return defaultValue;
+        }
+
+        size_t valueStart = json.find_first_not_of(" \t\r\n", colonPos + 1);
+        if (valueStart == std::string::npos) {
+            return defaultValue;
+        }
+
+        if (json.compare(valueStart, 4, "true") == 0) return true;
+        if (json.compare(valueStart, 5, "false") == 0) return false;
+        return defaultValue;
+    }
+
     // Split a JSON array into individual objects
     std::vector<std::string> SerialisationManager::splitJsonArray(const std::string& jsonArray) {
         std::vector<std::string> result;
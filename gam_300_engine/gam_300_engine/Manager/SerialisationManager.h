@@ -136,6 +136,11 @@ namespace gam300 {
         static std::vector<std::string> splitJsonArray(const std::string& jsonArray);
         static void parseKeyMappings(const std::string& keyMappingsJson, InputComponent* input);
         static void parseMouseMappings(const std::string& mouseMappingsJson, InputComponent* input);
+        static void parseInputContexts(const std::string& contextsJson);
+        static void parseInputAxes(const std::string& axesJson);
+        static float extractFloatValue(const std::string& json, const std::string& fieldName, float defaultValue);
+        static int extractIntValue(const std::string& json, const std::string& fieldName, int defaultValue);
+        static bool extractBoolValue(const std::string& json, const std::string& fieldName, bool defaultValue);
 
         // Indentation helper for pretty JSON output
         std::string getIndent(int level) const;
@@ -49,6 +49,7 @@ namespace gam300 {
         // Clear all systems
         m_systems.clear();
         m_system_types.clear();
+        rebuild_component_index();
 
         // Call parent's shutDown()
         Manager::shutDown();
@@ -56,10 +57,12 @@ namespace gam300 {
 
     // Update all systems
     void SystemManager::update_systems(float dt) {
-        // Only update active systems
+        // Only update active systems, timing each one for the frame statistics
         for (auto& system : m_systems) {
             if (system->is_active()) {
+                Clock system_clock;
                 system->update(dt);
+                PM.recordSystemTime(system->get_profile_slot(), system_clock.split());
             }
         }
     }
@@ -71,10 +74,47 @@ namespace gam300 {
             [](const std::shared_ptr<System>& a, const std::shared_ptr<System>& b) {
                 return a->get_priority() > b->get_priority();
             });
+
+        // The per-component lists follow the update order
+        rebuild_component_index();
+    }
+
+    // Rebuild the per-component system lists
+    void SystemManager::rebuild_component_index() {
+        for (std::vector<uint32_t>& systems : m_systems_by_component) {
+            systems.clear();
+        }
+        m_maskless_systems.clear();
+        m_candidate_marks.assign(m_systems.size(), 0);
+
+        for (uint32_t index = 0; index < m_systems.size(); ++index) {
+            ComponentMask mask = m_systems[index]->get_component_mask();
+            if (mask.none()) {
+                m_maskless_systems.push_back(index);
+                continue;
+            }
+
+            for (ComponentTypeID component_id = 0; component_id < MAX_COMPONENTS; ++component_id) {
+                if (mask.test(component_id)) {
+                    m_systems_by_component[component_id].push_back(index);
+                }
+            }
+        }
     }
 
     // Entity was created, notify all systems
     void SystemManager::entity_created(const Entity& entity) {
+        // A new entity has no components yet, so only systems that require none can take it
+        if (entity.get_component_mask().none()) {
+            for (uint32_t index : m_maskless_systems) {
+                System* system = m_systems[index].get();
+                if (system->matches_requirements(entity)) {
+                    system->add_entity(entity.get_id());
+                }
+            }
+            return;
+        }
+
         // Check each system to see if the entity should be added
         for (auto& system : m_systems) {
             if (system->matches_requirements(entity)) {
@@ -91,6 +131,69 @@ namespace gam300 {
         }
     }
 
+    // A component was added or removed, notify the systems that require it
+    void SystemManager::entity_components_changed(const Entity& entity, ComponentTypeID component_id) {
+        if (component_id >= MAX_COMPONENTS) {
+            entity_components_changed(entity);
+            return;
+        }
+
+        // Systems that don't require the component can't change their mind about the entity
+        EntityID entity_id = entity.get_id();
+        for (uint32_t index : m_systems_by_component[component_id]) {
+            System* system = m_systems[index].get();
+            bool matches = system->matches_requirements(entity);
+            if (matches != system->has_entity(entity_id)) {
+                if (matches) {
+                    system->add_entity(entity_id);
+                }
+                else {
+                    system->remove_entity(entity_id);
+                }
+            }
+        }
+    }
+
+    // Several components changed, notify each system that requires any of them once
+    void SystemManager::entity_components_changed(const Entity& entity, const ComponentMask& changed_components) {
+        if (changed_components.none()) {
+            return;
+        }
+
+        // Gather the systems requiring any of the components, each once, then visit them in update order
+        m_candidate_systems.clear();
+        auto add_candidates = [this](const std::vector<uint32_t>& systems) {
+            for (uint32_t index : systems) {
+                if (!m_candidate_marks[index]) {
+                    m_candidate_marks[index] = 1;
+                    m_candidate_systems.push_back(index);
+                }
+            }
+        };
+        for (ComponentTypeID component_id = 0; component_id < MAX_COMPONENTS; ++component_id) {
+            if (changed_components.test(component_id)) {
+                add_candidates(m_systems_by_component[component_id]);
+            }
+        }
+        add_candidates(m_maskless_systems);
+        std::sort(m_candidate_systems.begin(), m_candidate_systems.end());
+
+        EntityID entity_id = entity.get_id();
+        for (uint32_t index : m_candidate_systems) {
+            m_candidate_marks[index] = 0;
+            System* system = m_systems[index].get();
+            bool matches = system->matches_requirements(entity);
+            if (matches != system->has_entity(entity_id)) {
+                if (matches) {
+                    system->add_entity(entity_id);
+                }
+                else {
+                    system->remove_entity(entity_id);
+                }
+            }
+        }
+    }
+
     // Entity's component mask changed, notify all systems
     void SystemManager::entity_components_changed(const Entity& entity) {
         // Check each system to see if the entity should be added or removed
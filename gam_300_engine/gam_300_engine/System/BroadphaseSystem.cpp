@@ -0,0 +1,334 @@
+/**
+ * @file BroadphaseSystem.cpp
+ * @brief Implementation of the Broadphase System for the Entity Component System.
+ * @details Contains implementations for all member functions declared in BroadphaseSystem.h.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "../System/BroadphaseSystem.h"
+#include "../System/TransformSystem.h"
+#include "../Manager/ComponentManager.h"
+#include "../Manager/JobManager.h"
+#include "../Manager/LogManager.h"
+#include <algorithm>
+#include <span>
+
+namespace gam300 {
+
+    namespace {
+        // Moved proxies worth searching for pairs on another thread
+        constexpr std::size_t BROADPHASE_PAIR_CHUNK = 64;
+
+        // Ray packets worth casting on another thread
+        constexpr std::size_t BROADPHASE_RAY_PACKET_CHUNK = 16;
+
+        // Longest move per update the fat boxes stretch ahead for, longer ones are teleports
+        constexpr float BROADPHASE_MAX_PREDICTED_DISPLACEMENT = 1.0f;
+
+        // World box of an entity
+        AABB computeWorldBounds(const TransformComponent& transform, const BoundsComponent& bounds) {
+            return bounds.getLocalBounds().transformed(transform.getWorldMatrix());
+        }
+    }
+
+    // Constructor
+    BroadphaseSystem::BroadphaseSystem() : ComponentSystem<TransformComponent, BoundsComponent>("BroadphaseSystem"),
+        m_updated_count(0), m_transform_update_count(0), m_change_generation(0), m_hierarchy_generation(0),
+        m_bounds_generation(0), m_full_update(true) {
+        // Set priority - world boxes are computed after the TransformSystem has computed world matrices
+        set_priority(-200);
+    }
+
+    // Initialize the system
+    bool BroadphaseSystem::init(SystemManager& /*system_manager*/) {
+        LM.writeLog("BroadphaseSystem::init() - Broadphase System initialized");
+        return true;
+    }
+
+    // Update the system
+    void BroadphaseSystem::update(float /*dt*/) {
+        m_updated_count = 0;
+        std::shared_ptr<TransformSystem> transform_system = SM.get_system<TransformSystem>();
+
+        const bool transforms_updated = transform_system && transform_system->is_active();
+        bool full_update = m_full_update || m_bounds_generation != BoundsComponent::getChangeGeneration();
+        if (!full_update && transforms_updated) {
+            uint64_t transform_updates = transform_system->get_update_count();
+            if (transform_updates == m_transform_update_count + 1) {
+                m_transform_update_count = transform_updates;
+                for (EntityID entity_id : transform_system->get_moved_entities()) {
+                    process_entity(entity_id);
+                }
+            }
+            else if (transform_updates != m_transform_update_count) {
+                full_update = true;
+            }
+        }
+        else if (!full_update && (m_change_generation != TransformComponent::getChangeGeneration() ||
+            m_hierarchy_generation != TransformComponent::getHierarchyGeneration())) {
+            full_update = true;
+        }
+
+        if (full_update) {
+            // First update, missed a TransformSystem update, a local box changed, or no running TransformSystem to ask
+            for_each([this](EntityID entity_id, TransformComponent& transform, BoundsComponent& bounds) {
+                std::size_t slot = m_members.index_of(entity_id);
+                if (slot < m_proxies.size()) {
+                    refit(slot, computeWorldBounds(transform, bounds), false);
+                }
+            });
+            m_transform_update_count = transform_system ? transform_system->get_update_count() : 0;
+            m_change_generation = TransformComponent::getChangeGeneration();
+            m_hierarchy_generation = TransformComponent::getHierarchyGeneration();
+            m_bounds_generation = BoundsComponent::getChangeGeneration();
+            m_full_update = false;
+        }
+
+        updatePairs();
+    }
+
+    // Shut down the system
+    void BroadphaseSystem::shutdown() {
+        m_tree.clear();
+        m_members.clear();
+        m_proxies.clear();
+        m_world_bounds.clear();
+        m_destroyed.clear();
+        m_changed.clear();
+        m_thread_pairs.clear();
+        m_proxy_pairs.clear();
+        m_pairs.clear();
+        m_ray_hits.clear();
+        m_full_update = true;
+        LM.writeLog("BroadphaseSystem::shutdown() - Broadphase System shut down");
+    }
+
+    // Process a specific entity
+    void BroadphaseSystem::process_entity(EntityID entity_id) {
+        std::size_t slot = m_members.index_of(entity_id);
+        if (slot == m_proxies.size()) {
+            return;
+        }
+        TransformComponent* transform = CM.get_component<TransformComponent>(entity_id);
+        BoundsComponent* bounds = CM.get_component<BoundsComponent>(entity_id);
+        if (transform && bounds) {
+            refit(slot, computeWorldBounds(*transform, *bounds), true);
+        }
+    }
+
+    // Entity joined the system
+    void BroadphaseSystem::on_entity_added(EntityID entity_id) {
+        TransformComponent* transform = CM.get_component<TransformComponent>(entity_id);
+        BoundsComponent* bounds = CM.get_component<BoundsComponent>(entity_id);
+        AABB world = transform && bounds ? computeWorldBounds(*transform, *bounds) : AABB();
+
+        if (m_members.contains(entity_id)) {
+            refit(m_members.index_of(entity_id), world, false);
+            return;
+        }
+
+        int32_t proxy = m_tree.createProxy(world, entity_id);
+        m_members.insert(entity_id);
+        m_proxies.push_back(proxy);
+        if (static_cast<std::size_t>(proxy) >= m_world_bounds.size()) {
+            m_world_bounds.resize(static_cast<std::size_t>(proxy) + 1);
+        }
+        m_world_bounds[proxy] = world;
+    }
+
+    // Entity left the system, its components may already be gone
+    void BroadphaseSystem::on_entity_removed(EntityID entity_id) {
+        std::size_t slot = m_members.index_of(entity_id);
+        if (slot == m_proxies.size()) {
+            return;
+        }
+
+        int32_t proxy = m_proxies[slot];
+        m_tree.destroyProxy(proxy);
+        m_destroyed.push_back(proxy);
+
+        // Same swap with the last slot as the sparse set does
+        m_proxies[slot] = m_proxies.back();
+        m_proxies.pop_back();
+        m_members.erase(entity_id);
+    }
+
+    // Get the overlapping entities
+    const std::vector<EntityPair>& BroadphaseSystem::get_pairs() const {
+        return m_pairs;
+    }
+
+    // Find the entities whose world box overlaps a box
+    void BroadphaseSystem::query_overlap(const AABB& bounds, std::vector<EntityID>& results) const {
+        results.clear();
+        m_tree.query(bounds, [this, &bounds, &results](int32_t proxy) {
+            if (m_world_bounds[proxy].overlaps(bounds)) {
+                results.push_back(m_tree.getEntity(proxy));
+            }
+            return true;
+        });
+    }
+
+    // Find the first world box a ray hits
+    bool BroadphaseSystem::raycast(const Vector3D& origin, const Vector3D& direction, float max_distance, EntityID& entity,
+        float& distance) const {
+        const Vector3D inverse(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+        bool hit = false;
+        m_tree.raycast(origin, direction, max_distance, [&](int32_t proxy, float limit) {
+            float entry = 0.0f;
+            if (!m_world_bounds[proxy].intersectRay(origin, inverse, limit, entry)) {
+                return limit;
+            }
+
+            // Equally distant boxes go to the lower entity, whichever order the tree visits them in
+            EntityID candidate = m_tree.getEntity(proxy);
+            if (!hit || entry < distance || (entry == distance && candidate < entity)) {
+                entity = candidate;
+                distance = entry;
+                hit = true;
+            }
+            return entry;
+        });
+        return hit;
+    }
+
+    // Cast many rays at once
+    std::span<const RayHit> BroadphaseSystem::submit_raycasts(std::span<const Ray> rays) {
+        m_ray_hits.assign(rays.size(), RayHit());
+        const std::size_t packet_count = (rays.size() + RAY_PACKET_SIZE - 1) / RAY_PACKET_SIZE;
+        JM.parallelFor(packet_count, BROADPHASE_RAY_PACKET_CHUNK, [this, rays](std::size_t begin, std::size_t end) {
+            for (std::size_t packet = begin; packet < end; ++packet) {
+                const std::size_t first = packet * RAY_PACKET_SIZE;
+                cast_packet(rays.subspan(first, std::min(RAY_PACKET_SIZE, rays.size() - first)), m_ray_hits.data() + first);
+            }
+        });
+        return m_ray_hits;
+    }
+
+    // Get the world box of an entity
+    bool BroadphaseSystem::get_world_bounds(EntityID entity_id, AABB& bounds) const {
+        std::size_t slot = m_members.index_of(entity_id);
+        if (slot == m_proxies.size()) {
+            return false;
+        }
+        bounds = m_world_bounds[m_proxies[slot]];
+        return true;
+    }
+
+    // Get the tree
+    const DynamicAABBTree& BroadphaseSystem::get_tree() const {
+        return m_tree;
+    }
+
+    // Get the number of world boxes recomputed during the last update
+    std::size_t BroadphaseSystem::get_updated_count() const {
+        return m_updated_count;
+    }
+
+    // Cast one packet of rays
+    void BroadphaseSystem::cast_packet(std::span<const Ray> rays, RayHit* hits) const {
+        RayPacket packet(rays);
+        m_tree.raycastPacket(packet, [&](int32_t proxy) {
+            float entries[RAY_PACKET_SIZE];
+            uint32_t mask = packet.intersect(m_world_bounds[proxy], entries);
+            const EntityID candidate = m_tree.getEntity(proxy);
+            for (std::size_t lane = 0; mask != 0; ++lane, mask >>= 1) {
+                if (!(mask & 1u)) {
+                    continue;
+                }
+
+                // The grown box is only exact for thin rays and where a sphere meets a face
+                float distance = entries[lane];
+                const Ray& ray = rays[lane];
+                if (ray.radius > 0.0f &&
+                    !RayPacket::sweepSphere(m_world_bounds[proxy], ray.origin, ray.direction, ray.radius, packet.limit[lane], distance)) {
+                    continue;
+                }
+
+                // Equally distant boxes go to the lower entity, as in raycast()
+                RayHit& hit = hits[lane];
+                if (hit.entity == INVALID_ENTITY_ID || distance < hit.distance || (distance == hit.distance && candidate < hit.entity)) {
+                    hit.entity = candidate;
+                    hit.distance = distance;
+                    packet.limit[lane] = distance;
+                }
+            }
+        });
+    }
+
+    // Move an entity's proxy
+    void BroadphaseSystem::refit(std::size_t slot, const AABB& bounds, bool predict) {
+        int32_t proxy = m_proxies[slot];
+        Vector3D displacement = bounds.getCenter() - m_world_bounds[proxy].getCenter();
+        if (!predict || displacement.magnitudeSquared() >
+            BROADPHASE_MAX_PREDICTED_DISPLACEMENT * BROADPHASE_MAX_PREDICTED_DISPLACEMENT) {
+            displacement = Vector3D();
+        }
+        m_world_bounds[proxy] = bounds;
+        m_tree.moveProxy(proxy, bounds, displacement);
+        m_updated_count++;
+    }
+
+    // Replace the pairs of changed proxies
+    void BroadphaseSystem::updatePairs() {
+        const std::vector<int32_t>& moved = m_tree.getMovedProxies();
+        if (moved.empty() && m_destroyed.empty()) {
+            return;
+        }
+
+        // Pairs of proxies that kept their fat box still overlap, the rest are searched for again
+        m_changed.resize(m_world_bounds.size(), 0);
+        for (int32_t proxy : moved) {
+            if (proxy != AABB_TREE_NULL_NODE) {
+                m_changed[proxy] = 1;
+            }
+        }
+        for (int32_t proxy : m_destroyed) {
+            m_changed[proxy] = 1;
+        }
+        std::erase_if(m_proxy_pairs, [this](const ProxyPair& pair) {
+            return m_changed[pair.first] || m_changed[pair.second];
+        });
+
+        // Each thread searches around a share of the moved proxies into its own buffer
+        m_thread_pairs.resize(static_cast<std::size_t>(JM.getThreadCount()));
+        for (std::vector<ProxyPair>& pairs : m_thread_pairs) {
+            pairs.clear();
+        }
+        JM.parallelFor(moved.size(), BROADPHASE_PAIR_CHUNK, [this, &moved](std::size_t begin, std::size_t end) {
+            m_tree.findPairs(std::span<const int32_t>(moved.data() + begin, end - begin),
+                m_thread_pairs[static_cast<std::size_t>(JobManager::getThreadIndex())]);
+        });
+
+        // Sorting the new pairs makes the order independent of how the work was split
+        std::size_t kept = m_proxy_pairs.size();
+        for (const std::vector<ProxyPair>& pairs : m_thread_pairs) {
+            m_proxy_pairs.insert(m_proxy_pairs.end(), pairs.begin(), pairs.end());
+        }
+        std::sort(m_proxy_pairs.begin() + kept, m_proxy_pairs.end());
+        std::inplace_merge(m_proxy_pairs.begin(), m_proxy_pairs.begin() + kept, m_proxy_pairs.end());
+
+        for (int32_t proxy : moved) {
+            if (proxy != AABB_TREE_NULL_NODE) {
+                m_changed[proxy] = 0;
+            }
+        }
+        for (int32_t proxy : m_destroyed) {
+            m_changed[proxy] = 0;
+        }
+        m_tree.clearMovedProxies();
+        m_destroyed.clear();
+
+        m_pairs.resize(m_proxy_pairs.size());
+        for (std::size_t i = 0; i < m_proxy_pairs.size(); ++i) {
+            EntityID first = m_tree.getEntity(m_proxy_pairs[i].first);
+            EntityID second = m_tree.getEntity(m_proxy_pairs[i].second);
+            m_pairs[i] = first < second ? EntityPair(first, second) : EntityPair(second, first);
+        }
+    }
+
+} // namespace gam300
@@ -0,0 +1,179 @@
+/**
+ * @file BroadphaseSystem.h
+ * @brief Declaration of the Broadphase System for the Entity Component System.
+ * @details Keeps a DynamicAABBTree of the world boxes of entities with Transform
+ *          and Bounds components, the pairs of entities whose boxes may overlap,
+ *          and answers overlap and raycast queries against the boxes, one at a
+ *          time or in batches spread over the job system's threads.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __BROADPHASE_SYSTEM_H__
+#define __BROADPHASE_SYSTEM_H__
+
+#include "../System/System.h"
+#include "../Component/BoundsComponent.h"
+#include "../Component/TransformComponent.h"
+#include "../Utility/AABB.h"
+#include "../Utility/DynamicAABBTree.h"
+#include "../Utility/EntitySparseSet.h"
+#include "../Utility/RayPacket.h"
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace gam300 {
+
+    // Two entities whose fat boxes overlap, first < second
+    using EntityPair = std::pair<EntityID, EntityID>;
+
+    /**
+     * @brief System finding the entities that may touch, for physics and gameplay.
+     * @details Runs after the TransformSystem and recomputes only the world boxes of
+     *          the entities the TransformSystem moved in its last update; every box is
+     *          recomputed when the system first runs, after it misses a TransformSystem
+     *          update, when a local box changed, or when no TransformSystem is running
+     *          and a transform changed. The tree only changes for entities that left
+     *          their fat box, and pairs are only searched for around those, on the job
+     *          system's threads. Pairs and queries see boxes as of the last update.
+     */
+    class BroadphaseSystem : public ComponentSystem<TransformComponent, BoundsComponent> {
+    public:
+        /**
+         * @brief Constructor for BroadphaseSystem.
+         */
+        BroadphaseSystem();
+
+        /**
+         * @brief Initialize the system.
+         * @param system_manager Reference to the system manager.
+         * @return True if initialization was successful, false otherwise.
+         */
+        bool init(SystemManager& system_manager) override;
+
+        /**
+         * @brief Refit the boxes that changed and update the pairs.
+         * @param dt Delta time since the last update.
+         */
+        void update(float dt) override;
+
+        /**
+         * @brief Clean up the system when shutting down.
+         */
+        void shutdown() override;
+
+        /**
+         * @brief Recompute one entity's world box and move its proxy.
+         * @param entity_id The ID of the entity to process.
+         */
+        void process_entity(EntityID entity_id) override;
+
+        /**
+         * @brief Add an entity to the tree when it joins the system.
+         * @param entity_id The ID of the entity that was added.
+         */
+        void on_entity_added(EntityID entity_id) override;
+
+        /**
+         * @brief Remove an entity from the tree when it leaves the system.
+         * @param entity_id The ID of the entity that was removed.
+         */
+        void on_entity_removed(EntityID entity_id) override;
+
+        /**
+         * @brief Get the pairs of entities whose fat boxes overlap.
+         * @details Fat boxes are a little bigger than the world boxes, so a pair may
+         *          not actually touch; narrower tests are up to the caller.
+         * @return The pairs as of the last update, in an order that doesn't depend on
+         *         how the search was split between threads.
+         */
+        const std::vector<EntityPair>& get_pairs() const;
+
+        /**
+         * @brief Find the entities whose world box overlaps a box.
+         * @param bounds The box, touching faces count.
+         * @param results Replaced with the entities found, in no particular order.
+         */
+        void query_overlap(const AABB& bounds, std::vector<EntityID>& results) const;
+
+        /**
+         * @brief Find the first world box a ray hits.
+         * @param origin Start of the ray, boxes around it are hit at distance 0.
+         * @param direction Direction of the ray, distances are in multiples of its length.
+         * @param max_distance Length of the ray.
+         * @param entity Set to the entity hit.
+         * @param distance Set to the distance along the ray to the box.
+         * @return True if a box was hit.
+         */
+        bool raycast(const Vector3D& origin, const Vector3D& direction, float max_distance, EntityID& entity,
+            float& distance) const;
+
+        /**
+         * @brief Find the first world box each of many rays or sphere casts hits.
+         * @details Consecutive rays are carried through the tree in packets of
+         *          RAY_PACKET_SIZE, each box tested against a whole packet at once, and
+         *          the packets are shared out between the job system's threads. Rays
+         *          starting close together and pointing the same way, like an agent's
+         *          line of sight checks, share the most work and should be submitted
+         *          next to each other. Thin rays give the same hits as raycast().
+         * @param rays The rays, a radius above zero sweeps a sphere along the ray.
+         * @return One hit per ray in the same order, valid until the next call.
+         */
+        std::span<const RayHit> submit_raycasts(std::span<const Ray> rays);
+
+        /**
+         * @brief Get the world box of an entity.
+         * @param entity_id The entity.
+         * @param bounds Set to the box as of the last update.
+         * @return False if the entity isn't in the system.
+         */
+        bool get_world_bounds(EntityID entity_id, AABB& bounds) const;
+
+        /**
+         * @brief Get the tree.
+         * @return The tree, for queries and statistics.
+         */
+        const DynamicAABBTree& get_tree() const;
+
+        /**
+         * @brief Get the number of world boxes recomputed during the last update.
+         * @return Entities whose world matrix changed, or every entity after a full refit.
+         */
+        std::size_t get_updated_count() const;
+
+    private:
+        // Move an entity's proxy to a new world box, stretching its fat box ahead if predict is set
+        void refit(std::size_t slot, const AABB& bounds, bool predict);
+
+        // Replace the pairs involving proxies that moved, were created or were destroyed
+        void updatePairs();
+
+        // Find the hits of up to RAY_PACKET_SIZE rays, run on a worker thread
+        void cast_packet(std::span<const Ray> rays, RayHit* hits) const;
+
+        DynamicAABBTree m_tree;                             ///< Fat boxes of the system's entities
+        EntitySparseSet m_members;                          ///< Entities in the tree, their dense index is their slot
+        std::vector<int32_t> m_proxies;                     ///< Proxy of each slot
+        std::vector<AABB> m_world_bounds;                   ///< World box of each proxy
+        std::vector<int32_t> m_destroyed;                   ///< Proxies destroyed since the last update
+        std::vector<uint8_t> m_changed;                     ///< Per proxy, whether its pairs are being replaced
+        std::vector<std::vector<ProxyPair>> m_thread_pairs; ///< New pairs found by each job system thread
+        std::vector<ProxyPair> m_proxy_pairs;               ///< Overlapping proxies, sorted
+        std::vector<EntityPair> m_pairs;                    ///< Overlapping entities, in m_proxy_pairs order
+        std::vector<RayHit> m_ray_hits;                     ///< Hits of the last submit_raycasts()
+        std::size_t m_updated_count;                        ///< World boxes recomputed during the last update
+        uint64_t m_transform_update_count;                  ///< TransformSystem update count as of the last update
+        uint32_t m_change_generation;                       ///< TransformComponent change generation of the last update
+        uint32_t m_hierarchy_generation;                    ///< TransformComponent hierarchy generation of the last update
+        uint32_t m_bounds_generation;                       ///< BoundsComponent change generation of the last update
+        bool m_full_update;                                 ///< Recompute every box on the next update
+    };
+
+} // namespace gam300
+
+#endif // __BROADPHASE_SYSTEM_H__
@@ -12,11 +12,13 @@
 #include "../System/InputSystem.h"
 #include "../Manager/ComponentManager.h"
 #include "../Manager/LogManager.h"
+#include <bit>
 
 namespace gam300 {
 
     // Constructor
-    InputSystem::InputSystem() : ComponentSystem<InputComponent>("InputSystem") {
+    InputSystem::InputSystem() : ComponentSystem<InputComponent>("InputSystem"),
+        m_bound_keys{}, m_bound_mouse{}, m_binding_generation(0), m_bindings_dirty(true) {
         // Set priority - input system should run early in the update cycle
         set_priority(100);
     }
@@ -32,14 +34,28 @@ namespace gam300 {
         // Mark parameter as unused to avoid compiler warning
         (void)dt;  // Explicitly tell compiler that this parameter is intentionally unused
 
-        // Process all entities that have InputComponents
-        for (EntityID entity_id : m_entities) {
-            process_entity(entity_id);
+        m_action_events.clear();
+
+        if (m_bindings_dirty || m_binding_generation != InputComponent::getBindingGeneration()) {
+            rebuild_bindings();
         }
+
+        // Only the keys that changed this frame are looked up, plus held keys for REPEAT
+        if (!dispatch_bindings(static_cast<int>(InputActionType::PRESS), IM.getKeysPressed(), IM.getMouseButtonsPressed()))
+            return;
+        if (!dispatch_bindings(static_cast<int>(InputActionType::RELEASE), IM.getKeysReleased(), IM.getMouseButtonsReleased()))
+            return;
+        if (!dispatch_bindings(static_cast<int>(InputActionType::REPEAT), IM.getKeysDown(), IM.getMouseButtonsDown()))
+            return;
+        dispatch_context_events();
     }
 
     // Shut down the system
     void InputSystem::shutdown() {
+        m_bindings.clear();
+        m_binding_offsets.clear();
+        m_context_listeners.clear();
+        m_bindings_dirty = true;
         LM.writeLog("InputSystem::shutdown() - Input System shut down");
     }
 
@@ -50,9 +66,176 @@ namespace gam300 {
 
         // Make sure we have a valid component
         if (input_component && input_component->isActive()) {
-            // Update the input component (which will process all mapped actions)
+            // Poll the component's mappings directly, bypassing the binding index
             input_component->update(0.0f); // dt not used in input processing
         }
     }
 
+    // Entity joined the system
+    void InputSystem::on_entity_added(EntityID /*entity_id*/) {
+        m_bindings_dirty = true;
+    }
+
+    // Entity left the system, its component may already be gone
+    void InputSystem::on_entity_removed(EntityID /*entity_id*/) {
+        m_bindings_dirty = true;
+    }
+
+    // Get the number of indexed actions
+    std::size_t InputSystem::get_binding_count() const {
+        return m_bindings.size();
+    }
+
+    // Get the actions fired during the last update
+    const std::vector<InputActionEvent>& InputSystem::get_action_events() const {
+        return m_action_events;
+    }
+
+    // Rebuild the binding index
+    void InputSystem::rebuild_bindings() {
+        const std::size_t range_count = static_cast<std::size_t>(INPUT_BINDING_TABLES) * INPUT_CODE_COUNT;
+        m_binding_offsets.assign(range_count + 1, 0);
+        m_bound_keys = {};
+        m_bound_mouse = {};
+
+        for (std::vector<InputComponent*>& listeners : m_context_listeners) {
+            listeners.clear();
+        }
+        m_context_listeners.resize(IM.getContextCount());
+
+        // Gather the components once, the first pass counts the bindings per range
+        std::vector<InputComponent*> components;
+        components.reserve(m_entities.size());
+        for_each([this, &components](EntityID, InputComponent& input) {
+            InputComponent* input_component = &input;
+            components.push_back(input_component);
+
+            for (ContextID context : input_component->getContexts()) {
+                if (context < m_context_listeners.size()) {
+                    m_context_listeners[context].push_back(input_component);
+                }
+            }
+
+            for (const InputAction& action : input_component->getActionMappings()) {
+                int table = static_cast<int>(action.type);
+                if (table >= INPUT_BINDING_TABLES || action.input_key < 0 || action.input_key >= INPUT_CODE_COUNT) {
+                    continue;
+                }
+                m_binding_offsets[table * INPUT_CODE_COUNT + action.input_key + 1]++;
+            }
+        });
+
+        // Prefix sum turns the counts into range starts
+        for (std::size_t i = 1; i <= range_count; ++i) {
+            m_binding_offsets[i] += m_binding_offsets[i - 1];
+        }
+
+        // Second pass places each binding, keeping entity order within a range
+        m_bindings.resize(m_binding_offsets[range_count]);
+        std::vector<uint32_t> cursor(m_binding_offsets.begin(), m_binding_offsets.end() - 1);
+        for (InputComponent* input_component : components) {
+            for (const InputAction& action : input_component->getActionMappings()) {
+                int table = static_cast<int>(action.type);
+                if (table >= INPUT_BINDING_TABLES || action.input_key < 0 || action.input_key >= INPUT_CODE_COUNT) {
+                    continue;
+                }
+                m_bindings[cursor[table * INPUT_CODE_COUNT + action.input_key]++] = { input_component, &action };
+
+                if (action.input_key < MOUSE_BUTTON_INPUT_OFFSET) {
+                    m_bound_keys[table][action.input_key / 64] |= uint64_t(1) << (action.input_key % 64);
+                }
+                else {
+                    m_bound_mouse[table] |= uint32_t(1) << (action.input_key - MOUSE_BUTTON_INPUT_OFFSET);
+                }
+            }
+        }
+
+        m_binding_generation = InputComponent::getBindingGeneration();
+        m_bindings_dirty = false;
+
+        LM.writeLog(LogLevel::DEBUG, "InputSystem::rebuild_bindings() - Indexed %zu bindings for %zu entities",
+            m_bindings.size(), components.size());
+    }
+
+    // Fire one table's actions for every set bit of the given state
+    bool InputSystem::dispatch_bindings(int table, const KeyStateBits& keys, uint32_t mouse_buttons) {
+        // Skip words with no bound keys without touching the index
+        for (int word = 0; word < KEY_STATE_WORDS; ++word) {
+            uint64_t bits = keys[word] & m_bound_keys[table][word];
+            while (bits) {
+                int code = word * 64 + std::countr_zero(bits);
+                bits &= bits - 1;
+                if (!fire_bindings(table, code)) {
+                    return false;
+                }
+            }
+        }
+
+        uint32_t buttons = mouse_buttons & m_bound_mouse[table];
+        while (buttons) {
+            int code = MOUSE_BUTTON_INPUT_OFFSET + std::countr_zero(buttons);
+            buttons &= buttons - 1;
+            if (!fire_bindings(table, code)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Hand the context actions fired this frame to their listeners
+    bool InputSystem::dispatch_context_events() {
+        for (const InputContextEvent& event : IM.getContextEvents()) {
+            if (event.context >= m_context_listeners.size()) {
+                continue;
+            }
+
+            for (InputComponent* input_component : m_context_listeners[event.context]) {
+                if (!input_component->isActive()) {
+                    continue;
+                }
+
+                EntityID entity_id = input_component->get_owner();
+                m_action_events.push_back({ entity_id, event.action, event.type });
+                InputCallback callback = input_component->getContextCallback();
+                if (!callback) {
+                    continue;
+                }
+                callback(input_component->getContextUserData(), entity_id, event.action);
+
+                // Same as fire_bindings, the listener lists may be stale now
+                if (m_binding_generation != InputComponent::getBindingGeneration() || m_bindings_dirty) {
+                    LM.writeLog(LogLevel::DEBUG, "InputSystem::dispatch_context_events() - Mappings changed during dispatch, remaining actions skipped this frame");
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Fire the actions bound to one input code
+    bool InputSystem::fire_bindings(int table, int code) {
+        std::size_t range = static_cast<std::size_t>(table) * INPUT_CODE_COUNT + code;
+        for (uint32_t i = m_binding_offsets[range]; i < m_binding_offsets[range + 1]; ++i) {
+            const InputBinding& binding = m_bindings[i];
+            if (!binding.component->isActive()) {
+                continue;
+            }
+
+            const InputAction& action = *binding.action;
+            EntityID entity_id = binding.component->get_owner();
+            m_action_events.push_back({ entity_id, action.id, action.type });
+            if (!action.callback) {
+                continue;
+            }
+            action.callback(action.user_data, entity_id, action.id);
+
+            // A callback that remaps actions may have freed the ones still to be visited
+            if (m_binding_generation != InputComponent::getBindingGeneration() || m_bindings_dirty) {
+                LM.writeLog(LogLevel::DEBUG, "InputSystem::fire_bindings() - Mappings changed during dispatch, remaining actions skipped this frame");
+                return false;
+            }
+        }
+        return true;
+    }
+
 } // namespace gam300
\ No newline at end of file
@@ -1,7 +1,7 @@
 /**
  * @file InputSystem.h
  * @brief Declaration of the Input System for the Entity Component System.
- * @details Processes all entities with InputComponents.
+ * @details Dispatches input edges to the actions mapped by entities with InputComponents.
  * @author
  * @date
  * Copyright (C) 2025 DigiPen Institute of Technology.
@@ -14,12 +14,38 @@
 
 #include "../System/System.h"
 #include "../Component/InputComponent.h"
+#include "../Manager/InputManager.h"
+#include <array>
+#include <vector>
+#include <cstdint>
 
 namespace gam300 {
 
+    // An action reached from the binding index
+    struct InputBinding {
+        InputComponent* component;      // Component that owns the action
+        const InputAction* action;      // Action to fire
+    };
+
+    // An action that fired this frame, queued for systems that read input without callbacks
+    struct InputActionEvent {
+        EntityID entity_id;             // Entity whose action fired
+        ActionID action;                // Interned action name
+        InputActionType type;           // PRESS, RELEASE or REPEAT
+    };
+
     /**
      * @brief System for processing entity input components.
-     * @details Updates all entities with InputComponents, processing their input mappings.
+     * @details Keeps an index from input code to the actions bound to it. Each frame
+     *          only the keys and buttons that changed state (or are held, for REPEAT
+     *          actions) are looked up, so the cost follows the input events rather than
+     *          the number of entities times their mappings. The index is rebuilt when
+     *          entities join or leave the system or any mapping changes. Actions of
+     *          shared input contexts are evaluated once by the InputManager and handed
+     *          to every entity referencing the context. Fired actions call their callback
+     *          and are also queued for systems that update later. Mouse movement isn't
+     *          mapped per entity: cameras and other analog readers use the InputManager's
+     *          shared axes, such as MOUSE_DELTA_X_AXIS and MOUSE_DELTA_Y_AXIS.
      */
     class InputSystem : public ComponentSystem<InputComponent> {
     public:
@@ -51,6 +77,70 @@ namespace gam300 {
          * @param entity_id The ID of the entity to process.
          */
         void process_entity(EntityID entity_id) override;
+
+        /**
+         * @brief Mark the binding index stale when an entity joins the system.
+         * @param entity_id The ID of the entity that was added.
+         */
+        void on_entity_added(EntityID entity_id) override;
+
+        /**
+         * @brief Mark the binding index stale when an entity leaves the system.
+         * @param entity_id The ID of the entity that was removed.
+         */
+        void on_entity_removed(EntityID entity_id) override;
+
+        /**
+         * @brief Get the number of actions in the binding index.
+         * @return Number of PRESS, RELEASE and REPEAT actions indexed.
+         */
+        std::size_t get_binding_count() const;
+
+        /**
+         * @brief Get the actions that fired during the last update.
+         * @details Systems with a lower priority can consume these instead of mapping
+         *          callbacks. The queue is cleared at the start of every update.
+         * @return The fired actions, in dispatch order.
+         */
+        const std::vector<InputActionEvent>& get_action_events() const;
+
+    private:
+        /**
+         * @brief Rebuild the binding index from the mappings of every entity in the system.
+         */
+        void rebuild_bindings();
+
+        /**
+         * @brief Fire the actions of one table for every set bit in the given state.
+         * @param table Binding table (PRESS, RELEASE or REPEAT).
+         * @param keys Key state to dispatch.
+         * @param mouse_buttons Mouse button state to dispatch.
+         * @return False if a callback changed the mappings and dispatch had to stop.
+         */
+        bool dispatch_bindings(int table, const KeyStateBits& keys, uint32_t mouse_buttons);
+
+        /**
+         * @brief Hand the context actions fired this frame to the entities listening to them.
+         * @return False if a callback changed the mappings and dispatch had to stop.
+         */
+        bool dispatch_context_events();
+
+        /**
+         * @brief Fire the actions bound to one input code.
+         * @param table Binding table (PRESS, RELEASE or REPEAT).
+         * @param code Key code, or mouse button + MOUSE_BUTTON_INPUT_OFFSET.
+         * @return False if a callback changed the mappings and dispatch had to stop.
+         */
+        bool fire_bindings(int table, int code);
+
+        std::vector<InputBinding> m_bindings;   ///< Bindings grouped by table, then by input code
+        std::vector<uint32_t> m_binding_offsets; ///< Start of each (table, code) range in m_bindings
+        std::array<KeyStateBits, INPUT_BINDING_TABLES> m_bound_keys;  ///< Keys with bindings, per table
+        std::array<uint32_t, INPUT_BINDING_TABLES> m_bound_mouse;     ///< Mouse buttons with bindings, per table
+        std::vector<std::vector<InputComponent*>> m_context_listeners; ///< Components per ContextID
+        std::vector<InputActionEvent> m_action_events; ///< Actions fired during the last update
+        uint32_t m_binding_generation;          ///< InputComponent generation the index was built from
+        bool m_bindings_dirty;                  ///< Set when the system's entities change
     };
 
 } // namespace gam300
@@ -0,0 +1,1037 @@
+/**
+ * @file PhysicsSystem.cpp
+ * @brief Implementation of the Physics System for the Entity Component System.
+ * @details Contains implementations for all member functions declared in PhysicsSystem.h.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "../System/PhysicsSystem.h"
+#include "../Manager/ComponentManager.h"
+#include "../Manager/JobManager.h"
+#include "../Manager/LogManager.h"
+#include "../Utility/MathUtils.h"
+#include "../Utility/Transform.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <iterator>
+
+namespace gam300 {
+
+    namespace {
+        // Gap up to which contacts are kept, so bodies closing in are stopped before they overlap
+        constexpr float PHYSICS_CONTACT_MARGIN = 0.05f;
+
+        // Overlap left alone so resting contacts don't jitter
+        constexpr float PHYSICS_LINEAR_SLOP = 0.005f;
+
+        // Fraction of the remaining overlap pushed out per step
+        constexpr float PHYSICS_BAUMGARTE = 0.2f;
+
+        // Fastest the overlap correction pushes bodies apart
+        constexpr float PHYSICS_MAX_CORRECTION_VELOCITY = 2.0f;
+
+        // Slowest approach that bounces
+        constexpr float PHYSICS_RESTITUTION_THRESHOLD = 1.0f;
+
+        // Contact points closer than this between steps, in the first body's space, are the same point
+        constexpr float PHYSICS_WARM_START_DISTANCE = 0.05f;
+
+        // Normals turning further than this between steps start their contact from scratch
+        constexpr float PHYSICS_WARM_START_NORMAL_COSINE = 0.95f;
+
+        // Speeds under which a body counts as still
+        constexpr float PHYSICS_SLEEP_LINEAR_VELOCITY = 0.05f;
+        constexpr float PHYSICS_SLEEP_ANGULAR_VELOCITY = 0.05f;
+
+        // Seconds every body of an island has to be still before the island falls asleep
+        constexpr float PHYSICS_TIME_TO_SLEEP = 0.5f;
+
+        // Longest move per step the fat boxes stretch ahead for
+        constexpr float PHYSICS_MAX_PREDICTED_DISPLACEMENT = 1.0f;
+
+        // Defaults
+        constexpr int PHYSICS_DEFAULT_ITERATIONS = 8;
+        constexpr float PHYSICS_DEFAULT_GRAVITY = -9.81f;
+
+        // Island index of bodies that aren't in one
+        constexpr uint32_t PHYSICS_NO_ISLAND = UINT32_MAX;
+
+        // Searching bodies handed to a worker thread at a time
+        constexpr std::size_t PHYSICS_SEARCH_CHUNK = 32;
+
+        // Contact search state of a body during find_contacts
+        constexpr uint8_t PHYSICS_SEARCH_NONE = 0;          // Not searching
+        constexpr uint8_t PHYSICS_SEARCH_CURRENT = 1;       // Searching in the current round
+        constexpr uint8_t PHYSICS_SEARCH_DONE = 2;          // Searched in an earlier round
+
+        // Inverse inertia times a vector
+        Vector3D multiply(const std::array<Vector3D, 3>& rows, const Vector3D& v) {
+            return Vector3D(Vector3D::dot(rows[0], v), Vector3D::dot(rows[1], v), Vector3D::dot(rows[2], v));
+        }
+
+        // Unit vector at right angles to a unit vector, the same one every time for the same input
+        Vector3D perpendicular(const Vector3D& v) {
+            return std::abs(v.x) < 0.57735f ? Vector3D::cross(v, Vector3D(1.0f, 0.0f, 0.0f)).normalize()
+                : Vector3D::cross(v, Vector3D(0.0f, 1.0f, 0.0f)).normalize();
+        }
+
+        // Rotation after turning at an angular velocity for a time
+        Quaternion integrateRotation(const Quaternion& rotation, const Vector3D& angular_velocity, float dt) {
+            Quaternion spin = Quaternion(angular_velocity.x, angular_velocity.y, angular_velocity.z, 0.0f) * rotation;
+            const float half_dt = 0.5f * dt;
+            return Quaternion(rotation.x + spin.x * half_dt, rotation.y + spin.y * half_dt, rotation.z + spin.z * half_dt,
+                rotation.w + spin.w * half_dt).normalize();
+        }
+
+        // Exact comparison, any change made through a setter counts
+        bool samePlacement(const Vector3D& position_a, const Quaternion& rotation_a, const Vector3D& position_b,
+            const Quaternion& rotation_b) {
+            return position_a.x == position_b.x && position_a.y == position_b.y && position_a.z == position_b.z &&
+                rotation_a.x == rotation_b.x && rotation_a.y == rotation_b.y && rotation_a.z == rotation_b.z &&
+                rotation_a.w == rotation_b.w;
+        }
+
+        // Move the last element into a removed one's place
+        template<typename T>
+        void swapRemove(std::vector<T>& values, std::size_t index) {
+            values[index] = values.back();
+            values.pop_back();
+        }
+    }
+
+    // Constructor
+    PhysicsSystem::PhysicsSystem() : ComponentSystem<TransformComponent, RigidBodyComponent, ColliderComponent>("PhysicsSystem"),
+        m_gravity(0.0f, PHYSICS_DEFAULT_GRAVITY, 0.0f), m_iterations(PHYSICS_DEFAULT_ITERATIONS), m_awake_count(0),
+        m_island_count(0), m_body_generation(0), m_collider_generation(0), m_transform_generation(0) {
+        // Set priority - bodies move before the TransformSystem computes world matrices
+        set_priority(-50);
+    }
+
+    // Initialize the system
+    bool PhysicsSystem::init(SystemManager& /*system_manager*/) {
+        LM.writeLog("PhysicsSystem::init() - Physics System initialized");
+        return true;
+    }
+
+    // Update the system
+    void PhysicsSystem::update(float dt) {
+        m_awake_count = 0;
+        m_island_count = 0;
+        m_events.clear();
+        sync_components();
+        if (dt <= 0.0f) {
+            return;
+        }
+        if (m_bodies.empty()) {
+            // The last bodies were removed, whatever they touched stops touching
+            m_contacts.clear();
+            build_events();
+            return;
+        }
+
+        // Bodies that are awake now are simulated, along with any they wake
+        const std::size_t body_count = m_bodies.size();
+        m_simulated.assign(body_count, 0);
+        for (std::size_t slot = 0; slot < body_count; ++slot) {
+            if (m_awake[slot] && m_type[slot] != BodyType::STATIC) {
+                m_simulated[slot] = 1;
+                update_proxy(slot, m_linear_velocity[slot] * dt);
+            }
+        }
+
+        find_contacts();
+        build_islands();
+
+        // Islands share no dynamic bodies, so each is solved on its own thread
+        JM.parallelFor(m_island_count, 1, [this, dt](std::size_t begin, std::size_t end) {
+            for (std::size_t island = begin; island < end; ++island) {
+                solve_island(island, dt);
+            }
+        });
+
+        // Kinematic bodies follow their velocity and stop being simulated once it is zero
+        for (std::size_t slot = 0; slot < body_count; ++slot) {
+            if (m_type[slot] == BodyType::KINEMATIC && m_simulated[slot]) {
+                m_position[slot] += m_linear_velocity[slot] * dt;
+                m_rotation[slot] = integrateRotation(m_rotation[slot], m_angular_velocity[slot], dt);
+                m_awake[slot] = m_linear_velocity[slot].magnitudeSquared() > 0.0f ||
+                    m_angular_velocity[slot].magnitudeSquared() > 0.0f;
+            }
+            m_force[slot] = Vector3D();
+            m_torque[slot] = Vector3D();
+            m_awake_count += m_simulated[slot];
+        }
+
+        write_back();
+        build_events();
+    }
+
+    // Shut down the system
+    void PhysicsSystem::shutdown() {
+        m_bodies.clear();
+        m_entity.clear();
+        m_type.clear();
+        m_position.clear();
+        m_rotation.clear();
+        m_linear_velocity.clear();
+        m_angular_velocity.clear();
+        m_force.clear();
+        m_torque.clear();
+        m_mass.clear();
+        m_inverse_mass.clear();
+        m_local_inverse_inertia.clear();
+        m_world_inverse_inertia.clear();
+        m_linear_damping.clear();
+        m_angular_damping.clear();
+        m_gravity_scale.clear();
+        m_shape.clear();
+        m_friction.clear();
+        m_restitution.clear();
+        m_proxy.clear();
+        m_sleep_time.clear();
+        m_awake.clear();
+        m_allow_sleep.clear();
+        m_simulated.clear();
+        m_tree.clear();
+        m_contacts.clear();
+        m_previous_contacts.clear();
+        m_thread_contacts.clear();
+        m_merged_contacts.clear();
+        m_touching.clear();
+        m_previous_touching.clear();
+        m_events.clear();
+        LM.writeLog("PhysicsSystem::shutdown() - Physics System shut down");
+    }
+
+    // Process a specific entity
+    void PhysicsSystem::process_entity(EntityID entity_id) {
+        std::size_t slot = m_bodies.index_of(entity_id);
+        if (slot == m_bodies.size()) {
+            return;
+        }
+
+        TransformComponent* transform = CM.get_component<TransformComponent>(entity_id);
+        RigidBodyComponent* body = CM.get_component<RigidBodyComponent>(entity_id);
+        ColliderComponent* collider = CM.get_component<ColliderComponent>(entity_id);
+        if (transform) {
+            m_position[slot] = transform->getPosition();
+            m_rotation[slot] = transform->getRotation();
+        }
+        if (collider) {
+            read_collider(slot, *collider);
+        }
+        if (body) {
+            read_body(slot, *body);
+        }
+        update_mass(slot);
+        update_proxy(slot, Vector3D());
+        wake_overlapping(slot);
+    }
+
+    // Entity joined the system
+    void PhysicsSystem::on_entity_added(EntityID entity_id) {
+        if (!m_bodies.contains(entity_id)) {
+            m_bodies.insert(entity_id);
+            m_entity.push_back(entity_id);
+            m_type.push_back(BodyType::DYNAMIC);
+            m_position.emplace_back();
+            m_rotation.emplace_back();
+            m_linear_velocity.emplace_back();
+            m_angular_velocity.emplace_back();
+            m_force.emplace_back();
+            m_torque.emplace_back();
+            m_mass.push_back(1.0f);
+            m_inverse_mass.push_back(0.0f);
+            m_local_inverse_inertia.emplace_back();
+            m_world_inverse_inertia.emplace_back();
+            m_linear_damping.push_back(0.0f);
+            m_angular_damping.push_back(0.0f);
+            m_gravity_scale.push_back(1.0f);
+            m_shape.emplace_back();
+            m_friction.push_back(0.5f);
+            m_restitution.push_back(0.0f);
+            m_proxy.push_back(m_tree.createProxy(AABB(), entity_id));
+            m_sleep_time.push_back(0.0f);
+            m_awake.push_back(1);
+            m_allow_sleep.push_back(1);
+            m_simulated.push_back(0);
+        }
+        process_entity(entity_id);
+    }
+
+    // Entity left the system, its components may already be gone
+    void PhysicsSystem::on_entity_removed(EntityID entity_id) {
+        std::size_t slot = m_bodies.index_of(entity_id);
+        if (slot == m_bodies.size()) {
+            return;
+        }
+
+        // Whatever rested on the body has to notice it is gone
+        wake_overlapping(slot);
+        m_tree.destroyProxy(m_proxy[slot]);
+
+        // Same swap with the last slot as the sparse set does
+        swapRemove(m_entity, slot);
+        swapRemove(m_type, slot);
+        swapRemove(m_position, slot);
+        swapRemove(m_rotation, slot);
+        swapRemove(m_linear_velocity, slot);
+        swapRemove(m_angular_velocity, slot);
+        swapRemove(m_force, slot);
+        swapRemove(m_torque, slot);
+        swapRemove(m_mass, slot);
+        swapRemove(m_inverse_mass, slot);
+        swapRemove(m_local_inverse_inertia, slot);
+        swapRemove(m_world_inverse_inertia, slot);
+        swapRemove(m_linear_damping, slot);
+        swapRemove(m_angular_damping, slot);
+        swapRemove(m_gravity_scale, slot);
+        swapRemove(m_shape, slot);
+        swapRemove(m_friction, slot);
+        swapRemove(m_restitution, slot);
+        swapRemove(m_proxy, slot);
+        swapRemove(m_sleep_time, slot);
+        swapRemove(m_awake, slot);
+        swapRemove(m_allow_sleep, slot);
+        swapRemove(m_simulated, slot);
+        m_bodies.erase(entity_id);
+    }
+
+    // Set the world gravity
+    void PhysicsSystem::set_gravity(const Vector3D& gravity) {
+        m_gravity = gravity;
+        for (std::size_t slot = 0; slot < m_bodies.size(); ++slot) {
+            if (m_type[slot] == BodyType::DYNAMIC) {
+                wake_body(slot);
+            }
+        }
+    }
+
+    // Get the world gravity
+    const Vector3D& PhysicsSystem::get_gravity() const {
+        return m_gravity;
+    }
+
+    // Set the solver iterations
+    void PhysicsSystem::set_iterations(int iterations) {
+        m_iterations = std::max(iterations, 1);
+    }
+
+    // Get the solver iterations
+    int PhysicsSystem::get_iterations() const {
+        return m_iterations;
+    }
+
+    // Get the number of bodies
+    std::size_t PhysicsSystem::get_body_count() const {
+        return m_bodies.size();
+    }
+
+    // Get the number of bodies simulated in the last update
+    std::size_t PhysicsSystem::get_awake_count() const {
+        return m_awake_count;
+    }
+
+    // Get the number of islands solved in the last update
+    std::size_t PhysicsSystem::get_island_count() const {
+        return m_island_count;
+    }
+
+    // Get the number of touching pairs
+    std::size_t PhysicsSystem::get_contact_count() const {
+        return m_contacts.size();
+    }
+
+    // Get the last update's collision events
+    std::span<const CollisionEvent> PhysicsSystem::get_collision_events() const {
+        return m_events;
+    }
+
+    // Copy a body's settings
+    void PhysicsSystem::read_body(std::size_t slot, RigidBodyComponent& body) {
+        m_type[slot] = body.m_type;
+        m_mass[slot] = body.m_mass;
+        m_linear_damping[slot] = body.m_linear_damping;
+        m_angular_damping[slot] = body.m_angular_damping;
+        m_gravity_scale[slot] = body.m_gravity_scale;
+        m_linear_velocity[slot] = body.m_linear_velocity;
+        m_angular_velocity[slot] = body.m_angular_velocity;
+        m_force[slot] += body.m_force;
+        m_torque[slot] += body.m_torque;
+        m_allow_sleep[slot] = body.m_allow_sleep;
+        body.m_force = Vector3D();
+        body.m_torque = Vector3D();
+        body.m_dirty = false;
+
+        if (body.m_type == BodyType::STATIC) {
+            // Never simulated, so never awake
+            body.m_awake = false;
+            m_awake[slot] = 0;
+        }
+        else if (body.m_awake || !body.m_allow_sleep) {
+            wake_body(slot);
+        }
+        else {
+            m_awake[slot] = 0;
+            m_sleep_time[slot] = 0.0f;
+            m_linear_velocity[slot] = Vector3D();
+            m_angular_velocity[slot] = Vector3D();
+        }
+    }
+
+    // Copy a body's shape and surface
+    void PhysicsSystem::read_collider(std::size_t slot, ColliderComponent& collider) {
+        m_shape[slot] = collider.m_shape;
+        m_friction[slot] = collider.m_friction;
+        m_restitution[slot] = collider.m_restitution;
+        collider.m_dirty = false;
+        wake_body(slot);
+    }
+
+    // Pick up component changes
+    void PhysicsSystem::sync_components() {
+        const bool bodies_changed = m_body_generation != RigidBodyComponent::getChangeGeneration();
+        const bool colliders_changed = m_collider_generation != ColliderComponent::getChangeGeneration();
+        const bool transforms_changed = m_transform_generation != TransformComponent::getChangeGeneration();
+        if (!bodies_changed && !colliders_changed && !transforms_changed) {
+            return;
+        }
+
+        for (std::size_t slot = 0; slot < m_bodies.size(); ++slot) {
+            const EntityID entity_id = m_entity[slot];
+            bool changed = false;
+            bool moved = false;
+
+            RigidBodyComponent* body = bodies_changed ? CM.get_component<RigidBodyComponent>(entity_id) : nullptr;
+            if (body && body->m_dirty) {
+                read_body(slot, *body);
+                changed = true;
+            }
+
+            ColliderComponent* collider = colliders_changed ? CM.get_component<ColliderComponent>(entity_id) : nullptr;
+            if (collider && collider->m_dirty) {
+                read_collider(slot, *collider);
+                changed = true;
+                moved = true;
+            }
+
+            // Transforms set from outside teleport the body
+            TransformComponent* transform = transforms_changed ? CM.get_component<TransformComponent>(entity_id) : nullptr;
+            if (transform && !samePlacement(transform->getPosition(), transform->getRotation(), m_position[slot], m_rotation[slot])) {
+                wake_overlapping(slot);
+                m_position[slot] = transform->getPosition();
+                m_rotation[slot] = transform->getRotation();
+                wake_body(slot);
+                changed = true;
+                moved = true;
+            }
+
+            if (changed) {
+                update_mass(slot);
+            }
+            if (moved) {
+                update_proxy(slot, Vector3D());
+                wake_overlapping(slot);
+            }
+        }
+
+        m_body_generation = RigidBodyComponent::getChangeGeneration();
+        m_collider_generation = ColliderComponent::getChangeGeneration();
+        m_transform_generation = TransformComponent::getChangeGeneration();
+    }
+
+    // Recompute the inverse mass and inertia
+    void PhysicsSystem::update_mass(std::size_t slot) {
+        if (m_type[slot] != BodyType::DYNAMIC) {
+            m_inverse_mass[slot] = 0.0f;
+            m_local_inverse_inertia[slot] = Vector3D();
+            update_world_inertia(slot);
+            return;
+        }
+
+        const float mass = m_mass[slot];
+        const CollisionShape& shape = m_shape[slot];
+        Vector3D inertia;
+        switch (shape.type) {
+        case ShapeType::SPHERE: {
+            const float i = 0.4f * mass * shape.radius * shape.radius;
+            inertia = Vector3D(i, i, i);
+            break;
+        }
+
+        case ShapeType::CAPSULE: {
+            // Cylinder plus the two caps, the mass split between them by volume
+            const float r = shape.radius;
+            const float r_sq = r * r;
+            const float h = 2.0f * shape.half_height;
+            const float cylinder_volume = MathUtils::PI * r_sq * h;
+            const float caps_volume = 4.0f / 3.0f * MathUtils::PI * r_sq * r;
+            const float cylinder_mass = mass * cylinder_volume / (cylinder_volume + caps_volume);
+            const float caps_mass = mass - cylinder_mass;
+            const float along = 0.5f * cylinder_mass * r_sq + 0.4f * caps_mass * r_sq;
+            const float across = cylinder_mass * (3.0f * r_sq + h * h) / 12.0f +
+                caps_mass * (0.4f * r_sq + 0.25f * h * h + 0.375f * h * r);
+            inertia = Vector3D(across, along, across);
+            break;
+        }
+
+        case ShapeType::BOX:
+        default: {
+            const Vector3D& e = shape.half_extents;
+            const float third = mass / 3.0f;
+            inertia = Vector3D(third * (e.y * e.y + e.z * e.z), third * (e.x * e.x + e.z * e.z), third * (e.x * e.x + e.y * e.y));
+            break;
+        }
+        }
+
+        m_inverse_mass[slot] = 1.0f / mass;
+        m_local_inverse_inertia[slot] = Vector3D(1.0f / inertia.x, 1.0f / inertia.y, 1.0f / inertia.z);
+        update_world_inertia(slot);
+    }
+
+    // Rotate the inverse inertia into world space, R * D * R^T
+    void PhysicsSystem::update_world_inertia(std::size_t slot) {
+        const Quaternion& rotation = m_rotation[slot];
+        const Vector3D& d = m_local_inverse_inertia[slot];
+        const Vector3D x = rotation.rotate(Vector3D(1.0f, 0.0f, 0.0f));
+        const Vector3D y = rotation.rotate(Vector3D(0.0f, 1.0f, 0.0f));
+        const Vector3D z = rotation.rotate(Vector3D(0.0f, 0.0f, 1.0f));
+        InertiaRows& rows = m_world_inverse_inertia[slot];
+        rows[0] = x * (d.x * x.x) + y * (d.y * y.x) + z * (d.z * z.x);
+        rows[1] = x * (d.x * x.y) + y * (d.y * y.y) + z * (d.z * z.y);
+        rows[2] = x * (d.x * x.z) + y * (d.y * y.z) + z * (d.z * z.z);
+    }
+
+    // Move a body's proxy
+    void PhysicsSystem::update_proxy(std::size_t slot, const Vector3D& displacement) {
+        Vector3D predicted = displacement;
+        if (predicted.magnitudeSquared() > PHYSICS_MAX_PREDICTED_DISPLACEMENT * PHYSICS_MAX_PREDICTED_DISPLACEMENT) {
+            predicted = Vector3D();
+        }
+        m_tree.moveProxy(m_proxy[slot], Collision::computeBounds(m_shape[slot], m_position[slot], m_rotation[slot]), predicted);
+    }
+
+    // Wake a body
+    void PhysicsSystem::wake_body(std::size_t slot) {
+        m_awake[slot] = 1;
+        m_sleep_time[slot] = 0.0f;
+    }
+
+    // Wake the dynamic bodies around a body
+    void PhysicsSystem::wake_overlapping(std::size_t slot) {
+        m_tree.query(m_tree.getFatAABB(m_proxy[slot]), [this, slot](int32_t proxy) {
+            std::size_t other = m_bodies.index_of(m_tree.getEntity(proxy));
+            if (other != slot && other < m_bodies.size() && m_type[other] == BodyType::DYNAMIC) {
+                wake_body(other);
+            }
+            return true;
+        });
+    }
+
+    // Find the contacts of the awake bodies
+    void PhysicsSystem::find_contacts() {
+        const std::size_t body_count = m_bodies.size();
+        m_contacts.swap(m_previous_contacts);
+        m_contacts.clear();
+        m_search_state.assign(body_count, PHYSICS_SEARCH_NONE);
+        m_search.clear();
+        for (std::size_t slot = 0; slot < body_count; ++slot) {
+            if (m_simulated[slot]) {
+                m_search.push_back(static_cast<uint32_t>(slot));
+            }
+        }
+        m_thread_contacts.resize(JM.getThreadCount());
+
+        // Sleeping bodies an awake body touches wake up and search in the next round, so a whole pile wakes at once
+        while (!m_search.empty()) {
+            for (uint32_t slot : m_search) {
+                m_search_state[slot] = PHYSICS_SEARCH_CURRENT;
+            }
+            for (std::vector<Contact>& contacts : m_thread_contacts) {
+                contacts.clear();
+            }
+
+            // Queries and narrowphase only read the bodies, so each thread fills its own list
+            JM.parallelFor(m_search.size(), PHYSICS_SEARCH_CHUNK, [this](std::size_t begin, std::size_t end) {
+                std::vector<Contact>& contacts = m_thread_contacts[JobManager::getThreadIndex()];
+                for (std::size_t i = begin; i < end; ++i) {
+                    find_body_contacts(m_search[i], contacts);
+                }
+            });
+            for (uint32_t slot : m_search) {
+                m_search_state[slot] = PHYSICS_SEARCH_DONE;
+            }
+
+            // Which thread found what depends on timing, sorting the round by pair hides it
+            const std::size_t round_begin = m_contacts.size();
+            for (std::vector<Contact>& contacts : m_thread_contacts) {
+                if (m_contacts.empty()) {
+                    m_contacts.swap(contacts);
+                }
+                else {
+                    m_contacts.insert(m_contacts.end(), contacts.begin(), contacts.end());
+                }
+            }
+            std::sort(m_contacts.begin() + round_begin, m_contacts.end(), [](const Contact& a, const Contact& b) {
+                return a.key < b.key;
+            });
+
+            // A sleeping dynamic body touched by a searching one joins in
+            m_woken.clear();
+            for (std::size_t i = round_begin; i < m_contacts.size(); ++i) {
+                for (uint32_t body : { m_contacts[i].body_a, m_contacts[i].body_b }) {
+                    if (!m_simulated[body] && m_type[body] == BodyType::DYNAMIC) {
+                        wake_body(body);
+                        m_simulated[body] = 1;
+                        m_woken.push_back(body);
+                    }
+                }
+            }
+            m_search.swap(m_woken);
+            merge_contacts(round_begin);
+        }
+        m_tree.clearMovedProxies();
+
+        warm_start_contacts();
+    }
+
+    // Merge two sorted runs of contacts
+    void PhysicsSystem::merge_contacts(std::size_t middle) {
+        if (middle == 0 || middle == m_contacts.size()) {
+            return;
+        }
+        m_merged_contacts.clear();
+        std::merge(m_contacts.begin(), m_contacts.begin() + middle, m_contacts.begin() + middle, m_contacts.end(),
+            std::back_inserter(m_merged_contacts), [](const Contact& a, const Contact& b) {
+                return a.key < b.key;
+            });
+        m_contacts.swap(m_merged_contacts);
+    }
+
+    // Find one body's contacts
+    void PhysicsSystem::find_body_contacts(uint32_t slot, std::vector<Contact>& contacts) const {
+        m_tree.query(m_tree.getFatAABB(m_proxy[slot]), [this, slot, &contacts](int32_t proxy) {
+            uint32_t a = slot;
+            uint32_t b = static_cast<uint32_t>(m_bodies.index_of(m_tree.getEntity(proxy)));
+
+            // A pair is found by whichever of its bodies searches first, or the lower slot when both search together
+            const uint8_t state = m_search_state[b];
+            if (b == a || state == PHYSICS_SEARCH_DONE || (state == PHYSICS_SEARCH_CURRENT && b < a) ||
+                (m_type[a] != BodyType::DYNAMIC && m_type[b] != BodyType::DYNAMIC)) {
+                return true;
+            }
+            if (m_entity[a] > m_entity[b]) {
+                std::swap(a, b);
+            }
+
+            ContactManifold manifold;
+            if (!Collision::collide(m_shape[a], m_position[a], m_rotation[a], m_shape[b], m_position[b], m_rotation[b],
+                PHYSICS_CONTACT_MARGIN, manifold)) {
+                return true;
+            }
+
+            Contact contact;
+            contact.key = (static_cast<uint64_t>(m_entity[a]) << 32) | m_entity[b];
+            contact.body_a = a;
+            contact.body_b = b;
+            contact.normal = manifold.normal;
+            contact.tangent[0] = perpendicular(manifold.normal);
+            contact.tangent[1] = Vector3D::cross(manifold.normal, contact.tangent[0]);
+            contact.friction = std::sqrt(m_friction[a] * m_friction[b]);
+            contact.restitution = std::max(m_restitution[a], m_restitution[b]);
+            contact.touching = false;
+            contact.point_count = manifold.count;
+            const Quaternion to_local_a = m_rotation[a].conjugate();
+            float deepest = -FLT_MAX;
+            for (int i = 0; i < manifold.count; ++i) {
+                SolverPoint& point = contact.points[i];
+                const Vector3D& position = manifold.points[i].position;
+                point.anchor = to_local_a.rotate(position - m_position[a]);
+                point.r_a = position - m_position[a];
+                point.r_b = position - m_position[b];
+                point.separation = -manifold.points[i].depth;
+                point.relative_velocity = 0.0f;
+                point.normal_impulse = 0.0f;
+                point.tangent_impulse[0] = 0.0f;
+                point.tangent_impulse[1] = 0.0f;
+                point.normal_mass = 0.0f;
+                point.tangent_mass[0] = 0.0f;
+                point.tangent_mass[1] = 0.0f;
+                contact.touching = contact.touching || point.separation <= PHYSICS_LINEAR_SLOP;
+                if (manifold.points[i].depth > deepest) {
+                    deepest = manifold.points[i].depth;
+                    contact.deepest = position;
+                }
+            }
+            contacts.push_back(contact);
+            return true;
+        });
+    }
+
+    // Carry impulses over from the last step
+    void PhysicsSystem::warm_start_contacts() {
+        // Both lists are sorted by key, so one walk matches them up
+        std::size_t previous = 0;
+        for (Contact& contact : m_contacts) {
+            while (previous < m_previous_contacts.size() && m_previous_contacts[previous].key < contact.key) {
+                previous++;
+            }
+            if (previous == m_previous_contacts.size()) {
+                break;
+            }
+            const Contact& old = m_previous_contacts[previous];
+            if (old.key != contact.key || Vector3D::dot(old.normal, contact.normal) < PHYSICS_WARM_START_NORMAL_COSINE) {
+                continue;
+            }
+
+            for (int i = 0; i < contact.point_count; ++i) {
+                SolverPoint& point = contact.points[i];
+                for (int j = 0; j < old.point_count; ++j) {
+                    const SolverPoint& old_point = old.points[j];
+                    if (Vector3D::distanceSquared(point.anchor, old_point.anchor) <
+                        PHYSICS_WARM_START_DISTANCE * PHYSICS_WARM_START_DISTANCE) {
+                        point.normal_impulse = old_point.normal_impulse;
+                        point.tangent_impulse[0] = old_point.tangent_impulse[0];
+                        point.tangent_impulse[1] = old_point.tangent_impulse[1];
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // Group the awake dynamic bodies into islands
+    void PhysicsSystem::build_islands() {
+        const std::size_t body_count = m_bodies.size();
+        m_union_parent.resize(body_count);
+        for (std::size_t slot = 0; slot < body_count; ++slot) {
+            m_union_parent[slot] = static_cast<uint32_t>(slot);
+        }
+
+        auto find = [this](uint32_t slot) {
+            while (m_union_parent[slot] != slot) {
+                m_union_parent[slot] = m_union_parent[m_union_parent[slot]];
+                slot = m_union_parent[slot];
+            }
+            return slot;
+        };
+
+        // Static and kinematic bodies don't pass contacts on, so they don't link islands
+        for (const Contact& contact : m_contacts) {
+            if (m_type[contact.body_a] == BodyType::DYNAMIC && m_type[contact.body_b] == BodyType::DYNAMIC) {
+                uint32_t root_a = find(contact.body_a);
+                uint32_t root_b = find(contact.body_b);
+                // The lowest slot is the root, so islands are numbered in slot order below
+                if (root_a < root_b) {
+                    m_union_parent[root_b] = root_a;
+                }
+                else if (root_b < root_a) {
+                    m_union_parent[root_a] = root_b;
+                }
+            }
+        }
+
+        // Number the islands by their first body
+        m_island_of.assign(body_count, PHYSICS_NO_ISLAND);
+        m_island_count = 0;
+        for (std::size_t slot = 0; slot < body_count; ++slot) {
+            if (m_simulated[slot] && m_type[slot] == BodyType::DYNAMIC) {
+                uint32_t root = find(static_cast<uint32_t>(slot));
+                m_island_of[slot] = root == slot ? static_cast<uint32_t>(m_island_count++) : m_island_of[root];
+            }
+        }
+
+        // Bucket the bodies and contacts by island, keeping their order
+        m_island_body_offsets.assign(m_island_count + 1, 0);
+        m_island_contact_offsets.assign(m_island_count + 1, 0);
+        for (std::size_t slot = 0; slot < body_count; ++slot) {
+            if (m_island_of[slot] != PHYSICS_NO_ISLAND) {
+                m_island_body_offsets[m_island_of[slot] + 1]++;
+            }
+        }
+        for (const Contact& contact : m_contacts) {
+            uint32_t body = m_type[contact.body_a] == BodyType::DYNAMIC ? contact.body_a : contact.body_b;
+            m_island_contact_offsets[m_island_of[body] + 1]++;
+        }
+        for (std::size_t island = 0; island < m_island_count; ++island) {
+            m_island_body_offsets[island + 1] += m_island_body_offsets[island];
+            m_island_contact_offsets[island + 1] += m_island_contact_offsets[island];
+        }
+
+        m_island_bodies.resize(m_island_body_offsets.back());
+        m_island_contacts.resize(m_island_contact_offsets.back());
+        // The union-find parents aren't needed any more, they become the fill positions
+        std::vector<uint32_t>& body_cursor = m_union_parent;
+        body_cursor.assign(m_island_body_offsets.begin(), m_island_body_offsets.end() - 1);
+        for (std::size_t slot = 0; slot < body_count; ++slot) {
+            if (m_island_of[slot] != PHYSICS_NO_ISLAND) {
+                m_island_bodies[body_cursor[m_island_of[slot]]++] = static_cast<uint32_t>(slot);
+            }
+        }
+        body_cursor.assign(m_island_contact_offsets.begin(), m_island_contact_offsets.end() - 1);
+        for (std::size_t i = 0; i < m_contacts.size(); ++i) {
+            const Contact& contact = m_contacts[i];
+            uint32_t body = m_type[contact.body_a] == BodyType::DYNAMIC ? contact.body_a : contact.body_b;
+            m_island_contacts[body_cursor[m_island_of[body]]++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    // Solve one island
+    void PhysicsSystem::solve_island(std::size_t island, float dt) {
+        const uint32_t* bodies = m_island_bodies.data() + m_island_body_offsets[island];
+        const std::size_t body_count = m_island_body_offsets[island + 1] - m_island_body_offsets[island];
+        const uint32_t* contacts = m_island_contacts.data() + m_island_contact_offsets[island];
+        const std::size_t contact_count = m_island_contact_offsets[island + 1] - m_island_contact_offsets[island];
+        const float inverse_dt = 1.0f / dt;
+
+        // Gravity, forces and damping
+        for (std::size_t i = 0; i < body_count; ++i) {
+            const uint32_t slot = bodies[i];
+            Vector3D& v = m_linear_velocity[slot];
+            Vector3D& w = m_angular_velocity[slot];
+            v += (m_gravity * m_gravity_scale[slot] + m_force[slot] * m_inverse_mass[slot]) * dt;
+            w += multiply(m_world_inverse_inertia[slot], m_torque[slot]) * dt;
+            v *= 1.0f / (1.0f + dt * m_linear_damping[slot]);
+            w *= 1.0f / (1.0f + dt * m_angular_damping[slot]);
+        }
+
+        // Effective masses, and the approach speeds restitution bounces back from
+        for (std::size_t c = 0; c < contact_count; ++c) {
+            Contact& contact = m_contacts[contacts[c]];
+            const uint32_t a = contact.body_a;
+            const uint32_t b = contact.body_b;
+            const float mass_a = m_inverse_mass[a];
+            const float mass_b = m_inverse_mass[b];
+            const InertiaRows& inertia_a = m_world_inverse_inertia[a];
+            const InertiaRows& inertia_b = m_world_inverse_inertia[b];
+            for (int i = 0; i < contact.point_count; ++i) {
+                SolverPoint& point = contact.points[i];
+                auto effective_mass = [&](const Vector3D& direction) {
+                    Vector3D arm_a = Vector3D::cross(point.r_a, direction);
+                    Vector3D arm_b = Vector3D::cross(point.r_b, direction);
+                    float k = mass_a + mass_b + Vector3D::dot(arm_a, multiply(inertia_a, arm_a)) +
+                        Vector3D::dot(arm_b, multiply(inertia_b, arm_b));
+                    return k > 0.0f ? 1.0f / k : 0.0f;
+                };
+                point.normal_mass = effective_mass(contact.normal);
+                point.tangent_mass[0] = effective_mass(contact.tangent[0]);
+                point.tangent_mass[1] = effective_mass(contact.tangent[1]);
+                Vector3D dv = m_linear_velocity[b] + Vector3D::cross(m_angular_velocity[b], point.r_b) -
+                    m_linear_velocity[a] - Vector3D::cross(m_angular_velocity[a], point.r_a);
+                point.relative_velocity = Vector3D::dot(dv, contact.normal);
+            }
+        }
+
+        // Kinematic and static bodies are shared between islands, only dynamic ones are written
+        auto solve_contacts = [&](auto&& solve_point) {
+            for (std::size_t c = 0; c < contact_count; ++c) {
+                Contact& contact = m_contacts[contacts[c]];
+                const uint32_t a = contact.body_a;
+                const uint32_t b = contact.body_b;
+                Vector3D va = m_linear_velocity[a];
+                Vector3D wa = m_angular_velocity[a];
+                Vector3D vb = m_linear_velocity[b];
+                Vector3D wb = m_angular_velocity[b];
+                const float mass_a = m_inverse_mass[a];
+                const float mass_b = m_inverse_mass[b];
+                const InertiaRows& inertia_a = m_world_inverse_inertia[a];
+                const InertiaRows& inertia_b = m_world_inverse_inertia[b];
+                auto apply = [&](const SolverPoint& point, const Vector3D& impulse) {
+                    va -= impulse * mass_a;
+                    wa -= multiply(inertia_a, Vector3D::cross(point.r_a, impulse));
+                    vb += impulse * mass_b;
+                    wb += multiply(inertia_b, Vector3D::cross(point.r_b, impulse));
+                };
+                auto relative = [&](const SolverPoint& point) {
+                    return vb + Vector3D::cross(wb, point.r_b) - va - Vector3D::cross(wa, point.r_a);
+                };
+                for (int i = 0; i < contact.point_count; ++i) {
+                    solve_point(contact, contact.points[i], apply, relative);
+                }
+                if (m_type[a] == BodyType::DYNAMIC) {
+                    m_linear_velocity[a] = va;
+                    m_angular_velocity[a] = wa;
+                }
+                if (m_type[b] == BodyType::DYNAMIC) {
+                    m_linear_velocity[b] = vb;
+                    m_angular_velocity[b] = wb;
+                }
+            }
+        };
+
+        // Start from last step's impulses
+        solve_contacts([](Contact& contact, SolverPoint& point, auto& apply, auto&) {
+            apply(point, contact.normal * point.normal_impulse + contact.tangent[0] * point.tangent_impulse[0] +
+                contact.tangent[1] * point.tangent_impulse[1]);
+        });
+
+        // Friction first so the normal impulses get the last word on overlap
+        for (int iteration = 0; iteration < m_iterations; ++iteration) {
+            solve_contacts([inverse_dt](Contact& contact, SolverPoint& point, auto& apply, auto& relative) {
+                const float limit = contact.friction * point.normal_impulse;
+                for (int k = 0; k < 2; ++k) {
+                    float speed = Vector3D::dot(relative(point), contact.tangent[k]);
+                    float total = std::clamp(point.tangent_impulse[k] - point.tangent_mass[k] * speed, -limit, limit);
+                    float impulse = total - point.tangent_impulse[k];
+                    point.tangent_impulse[k] = total;
+                    apply(point, contact.tangent[k] * impulse);
+                }
+
+                // Apart, the bodies may close the gap this step but no more; overlapping, they are pushed out
+                float target = point.separation > 0.0f ? -point.separation * inverse_dt :
+                    std::min(PHYSICS_BAUMGARTE * inverse_dt * std::max(-point.separation - PHYSICS_LINEAR_SLOP, 0.0f),
+                        PHYSICS_MAX_CORRECTION_VELOCITY);
+                float speed = Vector3D::dot(relative(point), contact.normal);
+                float total = std::max(point.normal_impulse + point.normal_mass * (target - speed), 0.0f);
+                float impulse = total - point.normal_impulse;
+                point.normal_impulse = total;
+                apply(point, contact.normal * impulse);
+            });
+        }
+
+        // Points that were approaching quickly and got pushed bounce back
+        solve_contacts([](Contact& contact, SolverPoint& point, auto& apply, auto& relative) {
+            if (contact.restitution == 0.0f || point.relative_velocity > -PHYSICS_RESTITUTION_THRESHOLD ||
+                point.normal_impulse == 0.0f) {
+                return;
+            }
+            float speed = Vector3D::dot(relative(point), contact.normal);
+            float total = std::max(point.normal_impulse - point.normal_mass * (speed + contact.restitution * point.relative_velocity), 0.0f);
+            float impulse = total - point.normal_impulse;
+            point.normal_impulse = total;
+            apply(point, contact.normal * impulse);
+        });
+
+        // Move the bodies and see whether the island has come to rest
+        float island_sleep_time = FLT_MAX;
+        for (std::size_t i = 0; i < body_count; ++i) {
+            const uint32_t slot = bodies[i];
+            const Vector3D& v = m_linear_velocity[slot];
+            const Vector3D& w = m_angular_velocity[slot];
+            m_position[slot] += v * dt;
+            m_rotation[slot] = integrateRotation(m_rotation[slot], w, dt);
+            update_world_inertia(slot);
+
+            if (m_allow_sleep[slot] && v.magnitudeSquared() < PHYSICS_SLEEP_LINEAR_VELOCITY * PHYSICS_SLEEP_LINEAR_VELOCITY &&
+                w.magnitudeSquared() < PHYSICS_SLEEP_ANGULAR_VELOCITY * PHYSICS_SLEEP_ANGULAR_VELOCITY) {
+                m_sleep_time[slot] += dt;
+            }
+            else {
+                m_sleep_time[slot] = 0.0f;
+            }
+            island_sleep_time = std::min(island_sleep_time, m_sleep_time[slot]);
+        }
+
+        if (island_sleep_time >= PHYSICS_TIME_TO_SLEEP) {
+            for (std::size_t i = 0; i < body_count; ++i) {
+                const uint32_t slot = bodies[i];
+                m_awake[slot] = 0;
+                m_sleep_time[slot] = 0.0f;
+                m_linear_velocity[slot] = Vector3D();
+                m_angular_velocity[slot] = Vector3D();
+            }
+        }
+    }
+
+    // Copy the simulated bodies back to their components
+    void PhysicsSystem::write_back() {
+        for (std::size_t slot = 0; slot < m_bodies.size(); ++slot) {
+            if (!m_simulated[slot]) {
+                continue;
+            }
+            const EntityID entity_id = m_entity[slot];
+            TransformComponent* transform = CM.get_component<TransformComponent>(entity_id);
+            if (transform) {
+                Transform local = transform->getLocalTransform();
+                local.position = m_position[slot];
+                local.rotation = m_rotation[slot];
+                transform->setLocalTransform(local);
+            }
+            RigidBodyComponent* body = CM.get_component<RigidBodyComponent>(entity_id);
+            if (body) {
+                body->m_linear_velocity = m_linear_velocity[slot];
+                body->m_angular_velocity = m_angular_velocity[slot];
+                body->m_awake = m_awake[slot] != 0;
+            }
+        }
+
+        // Only changes made after this count as teleports
+        m_transform_generation = TransformComponent::getChangeGeneration();
+    }
+
+    // Fill the collision events
+    void PhysicsSystem::build_events() {
+        m_previous_touching.swap(m_touching);
+        m_touching.clear();
+
+        auto add_event = [this](const TouchingPair& pair, CollisionEventType type) {
+            CollisionEvent event;
+            event.first = static_cast<EntityID>(pair.key >> 32);
+            event.second = static_cast<EntityID>(pair.key & UINT32_MAX);
+            event.type = type;
+            event.approach_speed = type == CollisionEventType::EXIT ? 0.0f : pair.approach_speed;
+            event.normal = pair.normal;
+            event.point = pair.point;
+            m_events.push_back(event);
+        };
+
+        // Neither body of a sleeping pair was simulated, so nothing looked for its contact and it still touches
+        const std::size_t body_count = m_bodies.size();
+        auto still_asleep = [this, body_count](const TouchingPair& pair) {
+            const std::size_t a = m_bodies.index_of(static_cast<EntityID>(pair.key >> 32));
+            const std::size_t b = m_bodies.index_of(static_cast<EntityID>(pair.key & UINT32_MAX));
+            return a < body_count && b < body_count && !m_simulated[a] && !m_simulated[b] &&
+                (m_type[a] == BodyType::DYNAMIC || m_type[b] == BodyType::DYNAMIC);
+        };
+
+        // Both lists are sorted by key, so one walk pairs up each contact with last step's and keeps the events sorted
+        std::size_t previous = 0;
+        for (std::size_t current = 0; current <= m_contacts.size(); ++current) {
+            const bool at_end = current == m_contacts.size();
+            while (previous < m_previous_touching.size() && (at_end || m_previous_touching[previous].key < m_contacts[current].key)) {
+                const TouchingPair& pair = m_previous_touching[previous++];
+                if (still_asleep(pair)) {
+                    m_touching.push_back(pair);
+                    m_touching.back().asleep = true;
+                }
+                else {
+                    // Drifted out of range or one of the bodies is gone
+                    add_event(pair, CollisionEventType::EXIT);
+                }
+            }
+            if (at_end) {
+                break;
+            }
+
+            const Contact& contact = m_contacts[current];
+            const bool was_touching = previous < m_previous_touching.size() && m_previous_touching[previous].key == contact.key;
+            if (was_touching) {
+                previous++;
+            }
+            if (!contact.touching) {
+                if (was_touching) {
+                    add_event(m_previous_touching[previous - 1], CollisionEventType::EXIT);
+                }
+                continue;
+            }
+
+            TouchingPair pair;
+            pair.key = contact.key;
+            pair.normal = contact.normal;
+            pair.point = contact.deepest;
+            pair.approach_speed = 0.0f;
+            for (int i = 0; i < contact.point_count; ++i) {
+                pair.approach_speed = std::max(pair.approach_speed, -contact.points[i].relative_velocity);
+            }
+            pair.asleep = false;
+            m_touching.push_back(pair);
+            add_event(pair, was_touching ? CollisionEventType::STAY : CollisionEventType::ENTER);
+        }
+    }
+
+} // namespace gam300
@@ -0,0 +1,309 @@
+/**
+ * @file PhysicsSystem.h
+ * @brief Declaration of the Physics System for the Entity Component System.
+ * @details Simulates the rigid bodies of entities with Transform, RigidBody and
+ *          Collider components: gravity and forces, contacts found with a
+ *          DynamicAABBTree and the narrowphase tests in Collision.h, and a
+ *          sequential impulse solver run per island on the job system's threads.
+ *          Reports the pairs that start, keep and stop touching as a list of
+ *          CollisionEvents per update.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __PHYSICS_SYSTEM_H__
+#define __PHYSICS_SYSTEM_H__
+
+#include "../System/System.h"
+#include "../Component/ColliderComponent.h"
+#include "../Component/RigidBodyComponent.h"
+#include "../Component/TransformComponent.h"
+#include "../Utility/Collision.h"
+#include "../Utility/DynamicAABBTree.h"
+#include "../Utility/EntitySparseSet.h"
+#include "../Utility/Quaternion.h"
+#include "../Utility/Vector3D.h"
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace gam300 {
+
+    /**
+     * @brief System stepping the rigid bodies by one fixed step per update.
+     * @details Runs before the TransformSystem, with the game loop's fixed step as
+     *          the time step, and writes the positions and rotations of the bodies
+     *          that moved to their TransformComponents. Bodies are treated as root
+     *          entities: the local position and rotation are taken as the world ones.
+     *
+     *          The system keeps its own copy of every body in parallel arrays, read
+     *          from the components only when they change. Each step the bodies that
+     *          are awake look for contacts, the bodies they touch are linked into
+     *          islands, and the islands are solved independently on the JobManager's
+     *          threads. Islands that have stayed still for a while fall asleep and
+     *          cost nothing until an awake body touches them. Everything is done in
+     *          an order that doesn't depend on timing or the thread count, so the
+     *          same scene stepped the same way gives the same result bit for bit.
+     *
+     *          Contacts are looked for on the JobManager's threads, each writing to
+     *          its own list, and the lists are merged and sorted by pair afterwards.
+     *          Systems that react to collisions read get_collision_events() after
+     *          this system has updated instead of registering callbacks.
+     */
+    class PhysicsSystem : public ComponentSystem<TransformComponent, RigidBodyComponent, ColliderComponent> {
+    public:
+        /**
+         * @brief Constructor for PhysicsSystem.
+         */
+        PhysicsSystem();
+
+        /**
+         * @brief Initialize the system.
+         * @param system_manager Reference to the system manager.
+         * @return True if initialization was successful, false otherwise.
+         */
+        bool init(SystemManager& system_manager) override;
+
+        /**
+         * @brief Read changed components, step the bodies and write back the ones that moved.
+         * @param dt Time step in seconds.
+         */
+        void update(float dt) override;
+
+        /**
+         * @brief Clean up the system when shutting down.
+         */
+        void shutdown() override;
+
+        /**
+         * @brief Read an entity's components into its body, waking it.
+         * @param entity_id The ID of the entity to process.
+         */
+        void process_entity(EntityID entity_id) override;
+
+        /**
+         * @brief Add a body when an entity joins the system.
+         * @param entity_id The ID of the entity that was added.
+         */
+        void on_entity_added(EntityID entity_id) override;
+
+        /**
+         * @brief Remove a body when an entity leaves the system, waking what it touched.
+         * @param entity_id The ID of the entity that was removed.
+         */
+        void on_entity_removed(EntityID entity_id) override;
+
+        /**
+         * @brief Set the world gravity.
+         * @param gravity Acceleration in units per second squared, wakes every body.
+         */
+        void set_gravity(const Vector3D& gravity);
+
+        /**
+         * @brief Get the world gravity.
+         * @return The acceleration.
+         */
+        const Vector3D& get_gravity() const;
+
+        /**
+         * @brief Set the number of solver iterations per step.
+         * @details More iterations make tall stacks stiffer and cost proportionally more.
+         * @param iterations Iterations, at least 1.
+         */
+        void set_iterations(int iterations);
+
+        /**
+         * @brief Get the number of solver iterations per step.
+         * @return The iterations.
+         */
+        int get_iterations() const;
+
+        /**
+         * @brief Get the number of bodies.
+         * @return Bodies of every type.
+         */
+        std::size_t get_body_count() const;
+
+        /**
+         * @brief Get the number of bodies that were simulated in the last update.
+         * @return Awake dynamic and moving kinematic bodies.
+         */
+        std::size_t get_awake_count() const;
+
+        /**
+         * @brief Get the number of islands solved in the last update.
+         * @return Groups of touching awake dynamic bodies.
+         */
+        std::size_t get_island_count() const;
+
+        /**
+         * @brief Get the number of touching pairs found in the last update.
+         * @return Pairs with at least one contact point.
+         */
+        std::size_t get_contact_count() const;
+
+        /**
+         * @brief Get the collision events of the last update.
+         * @details One event per pair that started touching, kept touching while at
+         *          least one side was awake, or stopped touching, sorted by pair.
+         *          Pairs only near each other don't count as touching. The span stays
+         *          valid until the next update.
+         * @return The events.
+         */
+        std::span<const CollisionEvent> get_collision_events() const;
+
+    private:
+        // Solver state of one contact point
+        struct SolverPoint {
+            Vector3D anchor;                // Position in the first body's space, to match points between steps
+            Vector3D r_a;                   // Position relative to the first body
+            Vector3D r_b;                   // Position relative to the second body
+            float separation;               // Gap along the normal at the start of the step
+            float relative_velocity;        // Normal velocity at the start of the step
+            float normal_impulse;           // Accumulated impulses, kept for warm starting
+            float tangent_impulse[2];
+            float normal_mass;              // Effective masses
+            float tangent_mass[2];
+        };
+
+        // Contact between two bodies, the first having the lower entity ID
+        struct Contact {
+            uint64_t key;                   // Entity IDs packed so contacts sort by pair
+            uint32_t body_a;
+            uint32_t body_b;
+            Vector3D normal;                // From the first body to the second
+            Vector3D tangent[2];
+            float friction;
+            float restitution;
+            bool touching;                  // Whether any point overlaps or is within the slop
+            Vector3D deepest;               // Deepest point in world space, for events
+            int point_count;
+            SolverPoint points[CONTACT_MAX_POINTS];
+        };
+
+        // Pair that touched in the last update, what the collision events are worked out from
+        struct TouchingPair {
+            uint64_t key;                   // Same as the contact's
+            Vector3D normal;
+            Vector3D point;                 // Deepest point in world space
+            float approach_speed;
+            bool asleep;                    // Kept from an earlier update because neither body was simulated
+        };
+
+        // Inverse inertia in world space, a symmetric matrix stored by rows
+        using InertiaRows = std::array<Vector3D, 3>;
+
+        // Copy a body's settings from its RigidBodyComponent
+        void read_body(std::size_t slot, RigidBodyComponent& body);
+
+        // Copy a body's shape and surface from its ColliderComponent
+        void read_collider(std::size_t slot, ColliderComponent& collider);
+
+        // Pick up changes made to the components since the last update
+        void sync_components();
+
+        // Recompute the inverse mass and inertia of a body
+        void update_mass(std::size_t slot);
+
+        // Recompute the world inverse inertia of a body from its rotation
+        void update_world_inertia(std::size_t slot);
+
+        // Move a body's proxy to its current box
+        void update_proxy(std::size_t slot, const Vector3D& displacement);
+
+        // Wake a body and reset its sleep timer
+        void wake_body(std::size_t slot);
+
+        // Wake the other dynamic bodies whose fat box overlaps a body's
+        void wake_overlapping(std::size_t slot);
+
+        // Find the contacts of the awake bodies, waking the bodies they touch
+        void find_contacts();
+
+        // Find the contacts of one searching body, run on a worker thread
+        void find_body_contacts(uint32_t slot, std::vector<Contact>& contacts) const;
+
+        // Merge the contacts before middle with those after, both sorted by key
+        void merge_contacts(std::size_t middle);
+
+        // Carry accumulated impulses over from the matching contacts of the last step
+        void warm_start_contacts();
+
+        // Group the awake dynamic bodies into islands through their contacts
+        void build_islands();
+
+        // Solve one island and integrate its bodies
+        void solve_island(std::size_t island, float dt);
+
+        // Copy the bodies that were simulated back to their components
+        void write_back();
+
+        // Compare the touching contacts with last update's touching pairs to fill the collision events
+        void build_events();
+
+        // Body storage, indexed by the body's dense index in m_bodies
+        EntitySparseSet m_bodies;                       ///< Entities with a body, their dense index is their slot
+        std::vector<EntityID> m_entity;                 ///< Entity of each body
+        std::vector<BodyType> m_type;                   ///< How each body moves
+        std::vector<Vector3D> m_position;               ///< Center in world space
+        std::vector<Quaternion> m_rotation;             ///< Rotation in world space
+        std::vector<Vector3D> m_linear_velocity;        ///< Units per second
+        std::vector<Vector3D> m_angular_velocity;       ///< Radians per second about a world axis
+        std::vector<Vector3D> m_force;                  ///< Force for the next step
+        std::vector<Vector3D> m_torque;                 ///< Torque for the next step
+        std::vector<float> m_mass;                      ///< Mass as set on the component
+        std::vector<float> m_inverse_mass;              ///< 0 for static and kinematic bodies
+        std::vector<Vector3D> m_local_inverse_inertia;  ///< Diagonal of the inverse inertia in local space
+        std::vector<InertiaRows> m_world_inverse_inertia; ///< Inverse inertia in world space
+        std::vector<float> m_linear_damping;
+        std::vector<float> m_angular_damping;
+        std::vector<float> m_gravity_scale;
+        std::vector<CollisionShape> m_shape;
+        std::vector<float> m_friction;
+        std::vector<float> m_restitution;
+        std::vector<int32_t> m_proxy;                   ///< Proxy of each body in m_tree
+        std::vector<float> m_sleep_time;                ///< Seconds each body has been nearly still
+        std::vector<uint8_t> m_awake;                   ///< Whether each body is simulated
+        std::vector<uint8_t> m_allow_sleep;             ///< Whether each body may fall asleep
+        std::vector<uint8_t> m_simulated;               ///< Whether each body was simulated this update
+
+        // Contacts
+        DynamicAABBTree m_tree;                         ///< Fat boxes of every body
+        std::vector<uint32_t> m_search;                 ///< Bodies whose contacts are being looked for
+        std::vector<uint32_t> m_woken;                  ///< Bodies woken by a contact, searched next
+        std::vector<uint8_t> m_search_state;            ///< Whether each body is searching this round or already has
+        std::vector<std::vector<Contact>> m_thread_contacts; ///< Contacts found by each worker thread this round
+        std::vector<Contact> m_contacts;                ///< Touching pairs, sorted by key
+        std::vector<Contact> m_merged_contacts;         ///< Scratch for merging sorted runs of contacts
+        std::vector<Contact> m_previous_contacts;       ///< Last step's contacts, for warm starting
+
+        // Collision events
+        std::vector<TouchingPair> m_touching;           ///< Pairs touching after the last update, sleeping ones included, sorted by key
+        std::vector<TouchingPair> m_previous_touching;  ///< Pairs touching after the update before
+        std::vector<CollisionEvent> m_events;           ///< Collision events of the last update, sorted by pair
+
+        // Islands
+        std::vector<uint32_t> m_union_parent;           ///< Union-find parent of each body
+        std::vector<uint32_t> m_island_of;              ///< Island of each body
+        std::vector<uint32_t> m_island_body_offsets;    ///< First entry of each island in m_island_bodies, plus the total
+        std::vector<uint32_t> m_island_bodies;          ///< Bodies grouped by island, in slot order
+        std::vector<uint32_t> m_island_contact_offsets; ///< First entry of each island in m_island_contacts, plus the total
+        std::vector<uint32_t> m_island_contacts;        ///< Contacts grouped by island, in key order
+
+        // Settings and statistics
+        Vector3D m_gravity;                             ///< World gravity
+        int m_iterations;                               ///< Solver iterations per step
+        std::size_t m_awake_count;                      ///< Bodies simulated in the last update
+        std::size_t m_island_count;                     ///< Islands solved in the last update
+        uint32_t m_body_generation;                     ///< RigidBodyComponent change generation last read
+        uint32_t m_collider_generation;                 ///< ColliderComponent change generation last read
+        uint32_t m_transform_generation;                ///< TransformComponent change generation after the last write back
+    };
+
+} // namespace gam300
+
+#endif // __PHYSICS_SYSTEM_H__
@@ -0,0 +1,130 @@
+/**
+ * @file SpatialHashSystem.cpp
+ * @brief Implementation of the Spatial Hash System for the Entity Component System.
+ * @details Contains implementations for all member functions declared in SpatialHashSystem.h.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "../System/SpatialHashSystem.h"
+#include "../System/TransformSystem.h"
+#include "../Manager/ComponentManager.h"
+#include "../Manager/LogManager.h"
+
+namespace gam300 {
+
+    // Constructor
+    SpatialHashSystem::SpatialHashSystem() : ComponentSystem<TransformComponent>("SpatialHashSystem"),
+        m_updated_count(0), m_transform_update_count(0), m_change_generation(0), m_hierarchy_generation(0),
+        m_full_update(true) {
+        // Set priority - positions are read after the TransformSystem has computed them
+        set_priority(-200);
+    }
+
+    // Initialize the system
+    bool SpatialHashSystem::init(SystemManager& /*system_manager*/) {
+        LM.writeLog("SpatialHashSystem::init() - Spatial Hash System initialized");
+        return true;
+    }
+
+    // Update the system
+    void SpatialHashSystem::update(float /*dt*/) {
+        m_updated_count = 0;
+        std::shared_ptr<TransformSystem> transform_system = SM.get_system<TransformSystem>();
+
+        const bool transforms_updated = transform_system && transform_system->is_active();
+        if (transforms_updated && !m_full_update) {
+            uint64_t transform_updates = transform_system->get_update_count();
+            if (transform_updates == m_transform_update_count) {
+                // No world matrix changed since the last update
+                return;
+            }
+            if (transform_updates == m_transform_update_count + 1) {
+                m_transform_update_count = transform_updates;
+                for (EntityID entity_id : transform_system->get_moved_entities()) {
+                    process_entity(entity_id);
+                }
+                return;
+            }
+        }
+        else if (!transforms_updated && !m_full_update &&
+            m_change_generation == TransformComponent::getChangeGeneration() &&
+            m_hierarchy_generation == TransformComponent::getHierarchyGeneration()) {
+            return;
+        }
+
+        // First update, missed a TransformSystem update, or no running TransformSystem to ask
+        for_each([this](EntityID entity_id, TransformComponent& transform) {
+            m_grid.setPosition(entity_id, transform.getWorldPosition());
+            m_updated_count++;
+        });
+        m_transform_update_count = transform_system ? transform_system->get_update_count() : 0;
+        m_change_generation = TransformComponent::getChangeGeneration();
+        m_hierarchy_generation = TransformComponent::getHierarchyGeneration();
+        m_full_update = false;
+    }
+
+    // Shut down the system
+    void SpatialHashSystem::shutdown() {
+        m_grid.clear();
+        m_full_update = true;
+        LM.writeLog("SpatialHashSystem::shutdown() - Spatial Hash System shut down");
+    }
+
+    // Process a specific entity
+    void SpatialHashSystem::process_entity(EntityID entity_id) {
+        if (!m_entities.contains(entity_id)) {
+            return;
+        }
+        TransformComponent* transform = CM.get_component<TransformComponent>(entity_id);
+        if (transform) {
+            m_grid.setPosition(entity_id, transform->getWorldPosition());
+            m_updated_count++;
+        }
+    }
+
+    // Entity joined the system
+    void SpatialHashSystem::on_entity_added(EntityID entity_id) {
+        TransformComponent* transform = CM.get_component<TransformComponent>(entity_id);
+        m_grid.setPosition(entity_id, transform ? transform->getWorldPosition() : Vector3D());
+    }
+
+    // Entity left the system, its component may already be gone
+    void SpatialHashSystem::on_entity_removed(EntityID entity_id) {
+        m_grid.remove(entity_id);
+    }
+
+    // Find the entities within a distance of a point
+    void SpatialHashSystem::query_radius(const Vector3D& center, float radius, std::vector<EntityID>& results) const {
+        m_grid.queryRadius(center, radius, results);
+    }
+
+    // Find the entities inside an axis-aligned box
+    void SpatialHashSystem::query_aabb(const Vector3D& min, const Vector3D& max, std::vector<EntityID>& results) const {
+        m_grid.queryAABB(min, max, results);
+    }
+
+    // Find the entities closest to a point
+    void SpatialHashSystem::query_nearest(const Vector3D& center, std::size_t count, std::vector<EntityID>& results) const {
+        m_grid.queryNearest(center, count, results);
+    }
+
+    // Set the grid's cell edge length
+    void SpatialHashSystem::set_cell_size(float cell_size) {
+        m_grid.setCellSize(cell_size);
+    }
+
+    // Get the grid
+    const SpatialHashGrid& SpatialHashSystem::get_grid() const {
+        return m_grid;
+    }
+
+    // Get the number of positions copied during the last update
+    std::size_t SpatialHashSystem::get_updated_count() const {
+        return m_updated_count;
+    }
+
+} // namespace gam300
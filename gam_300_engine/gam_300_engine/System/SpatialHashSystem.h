@@ -0,0 +1,132 @@
+/**
+ * @file SpatialHashSystem.h
+ * @brief Declaration of the Spatial Hash System for the Entity Component System.
+ * @details Keeps a SpatialHashGrid of the world positions of entities with
+ *          TransformComponents for proximity queries.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __SPATIAL_HASH_SYSTEM_H__
+#define __SPATIAL_HASH_SYSTEM_H__
+
+#include "../System/System.h"
+#include "../Component/TransformComponent.h"
+#include "../Utility/SpatialHashGrid.h"
+#include <cstdint>
+#include <vector>
+
+namespace gam300 {
+
+    /**
+     * @brief System answering "which entities are near here" queries.
+     * @details Runs after the TransformSystem and copies into the grid only the world
+     *          positions the TransformSystem recomputed in its last update, so a frame
+     *          in which a few entities moved costs a few grid updates. Every position
+     *          is copied again when the system first runs, after it misses a
+     *          TransformSystem update, or when no TransformSystem is running and a
+     *          transform changed. Entities joining the system are added at their
+     *          current world position straight away. Queries see positions as of the
+     *          last update.
+     */
+    class SpatialHashSystem : public ComponentSystem<TransformComponent> {
+    public:
+        /**
+         * @brief Constructor for SpatialHashSystem.
+         */
+        SpatialHashSystem();
+
+        /**
+         * @brief Initialize the system.
+         * @param system_manager Reference to the system manager.
+         * @return True if initialization was successful, false otherwise.
+         */
+        bool init(SystemManager& system_manager) override;
+
+        /**
+         * @brief Copy the world positions that changed into the grid.
+         * @param dt Delta time since the last update.
+         */
+        void update(float dt) override;
+
+        /**
+         * @brief Clean up the system when shutting down.
+         */
+        void shutdown() override;
+
+        /**
+         * @brief Copy one entity's world position into the grid.
+         * @param entity_id The ID of the entity to process.
+         */
+        void process_entity(EntityID entity_id) override;
+
+        /**
+         * @brief Add an entity to the grid when it joins the system.
+         * @param entity_id The ID of the entity that was added.
+         */
+        void on_entity_added(EntityID entity_id) override;
+
+        /**
+         * @brief Remove an entity from the grid when it leaves the system.
+         * @param entity_id The ID of the entity that was removed.
+         */
+        void on_entity_removed(EntityID entity_id) override;
+
+        /**
+         * @brief Find the entities within a distance of a point.
+         * @param center Center of the sphere.
+         * @param radius Distance, entities exactly on the surface are included.
+         * @param results Replaced with the entities found, in no particular order.
+         */
+        void query_radius(const Vector3D& center, float radius, std::vector<EntityID>& results) const;
+
+        /**
+         * @brief Find the entities inside an axis-aligned box.
+         * @param min Smallest corner.
+         * @param max Largest corner, entities on the faces are included.
+         * @param results Replaced with the entities found, in no particular order.
+         */
+        void query_aabb(const Vector3D& min, const Vector3D& max, std::vector<EntityID>& results) const;
+
+        /**
+         * @brief Find the entities closest to a point.
+         * @param center The point.
+         * @param count Number of entities wanted.
+         * @param results Replaced with up to count entities, nearest first.
+         */
+        void query_nearest(const Vector3D& center, std::size_t count, std::vector<EntityID>& results) const;
+
+        /**
+         * @brief Set the grid's cell edge length.
+         * @details Roughly the radius of typical queries works best. Re-buckets every entity.
+         * @param cell_size New edge length, ignored unless positive.
+         */
+        void set_cell_size(float cell_size);
+
+        /**
+         * @brief Get the grid.
+         * @return The grid, for queries and statistics.
+         */
+        const SpatialHashGrid& get_grid() const;
+
+        /**
+         * @brief Get the number of positions copied into the grid during the last update.
+         * @return Entities whose world matrix changed, or every entity after a full copy.
+         */
+        std::size_t get_updated_count() const;
+
+    private:
+        SpatialHashGrid m_grid;                     ///< World positions of the system's entities
+        std::size_t m_updated_count;                ///< Positions copied during the last update
+        uint64_t m_transform_update_count;          ///< TransformSystem update count as of the last update
+        uint32_t m_change_generation;               ///< TransformComponent change generation of the last update
+        uint32_t m_hierarchy_generation;            ///< TransformComponent hierarchy generation of the last update
+        bool m_full_update;                         ///< Copy every position on the next update
+    };
+
+} // namespace gam300
+
+#endif // __SPATIAL_HASH_SYSTEM_H__
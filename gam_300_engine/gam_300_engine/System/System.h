@@ -12,6 +12,8 @@
 #ifndef __SYSTEM_H__
 #define __SYSTEM_H__
 
+#include <array>
+#include <tuple>
 #include <vector>
 #include <unordered_map>
 #include <typeindex>
@@ -23,6 +25,9 @@
 #include "../Entity/Entity.h"
 #include "../Manager/Manager.h"
 #include "../Manager/LogManager.h"
+#include "../Manager/ProfileManager.h"
+#include "../Utility/EntitySparseSet.h"
+#include "../Utility/Prefetch.h"
 
 namespace gam300 {
 
@@ -42,7 +47,7 @@ namespace gam300 {
          * @param name The name of the system for identification and debugging.
          */
         System(const std::string& name)
-            : m_name(name), m_is_active(true), m_priority(0) {}
+            : m_name(name), m_is_active(true), m_priority(0), m_profile_slot(INVALID_PROFILE_SLOT) {}
 
         /**
          * @brief Virtual destructor for proper cleanup of derived classes.
@@ -78,9 +83,9 @@ namespace gam300 {
          * @param entity_id The ID of the entity to add.
          */
         void add_entity(EntityID entity_id) {
-            // Only add the entity if it's not already in the list
-            if (std::find(m_entities.begin(), m_entities.end(), entity_id) == m_entities.end()) {
-                m_entities.push_back(entity_id);
+            // Only add the entity if it's not already in the set
+            if (m_entities.insert(entity_id)) {
+                on_entity_added(entity_id);
             }
         }
 
@@ -89,12 +94,25 @@ namespace gam300 {
          * @param entity_id The ID of the entity to remove.
          */
         void remove_entity(EntityID entity_id) {
-            m_entities.erase(
-                std::remove(m_entities.begin(), m_entities.end(), entity_id),
-                m_entities.end()
-            );
+            if (m_entities.erase(entity_id)) {
+                on_entity_removed(entity_id);
+            }
         }
 
+        /**
+         * @brief Called after an entity has been added to this system.
+         * @details Lets systems that keep per-entity lookup tables update them.
+         * @param entity_id The ID of the entity that was added.
+         */
+        virtual void on_entity_added(EntityID /*entity_id*/) {}
+
+        /**
+         * @brief Called after an entity has been removed from this system.
+         * @details The entity's components may already have been destroyed.
+         * @param entity_id The ID of the entity that was removed.
+         */
+        virtual void on_entity_removed(EntityID /*entity_id*/) {}
+
         /**
          * @brief Get whether the system is active.
          * @return True if the system is active, false otherwise.
@@ -137,6 +155,22 @@ namespace gam300 {
             m_priority = priority;
         }
 
+        /**
+         * @brief Get the slot this system's update time is recorded in by the ProfileManager.
+         * @return The profiling slot, or INVALID_PROFILE_SLOT if the system is not profiled.
+         */
+        std::size_t get_profile_slot() const {
+            return m_profile_slot;
+        }
+
+        /**
+         * @brief Set the slot this system's update time is recorded in by the ProfileManager.
+         * @param slot The profiling slot.
+         */
+        void set_profile_slot(std::size_t slot) {
+            m_profile_slot = slot;
+        }
+
         /**
          * @brief Check if an entity matches the component requirements of this system.
          * @param entity The entity to check.
@@ -144,12 +178,25 @@ namespace gam300 {
          */
         virtual bool matches_requirements(const Entity& entity) const = 0;
 
+        /**
+         * @brief Get the components an entity needs to be processed by this system.
+         * @details Used by the SystemManager to only re-check the systems that depend on
+         *          a component when it is added or removed.
+         * @return Bit mask of required component types, empty if the system doesn't
+         *         depend on any component.
+         */
+        virtual ComponentMask get_component_mask() const {
+            return ComponentMask();
+        }
+
         /**
          * @brief Get the list of entities managed by this system.
+         * @details Removing an entity moves the last one into its place, so the order
+         *          is not the order the entities were added in.
          * @return Vector of entity IDs processed by this system.
          */
         const std::vector<EntityID>& get_entities() const {
-            return m_entities;
+            return m_entities.dense();
         }
 
         /**
@@ -158,14 +205,15 @@ namespace gam300 {
          * @return True if the entity is in this system, false otherwise.
          */
         bool has_entity(EntityID entity_id) const {
-            return std::find(m_entities.begin(), m_entities.end(), entity_id) != m_entities.end();
+            return m_entities.contains(entity_id);
         }
 
     protected:
         std::string m_name;              ///< Name of the system
-        std::vector<EntityID> m_entities; ///< Entities processed by this system
+        EntitySparseSet m_entities;      ///< Entities processed by this system
         bool m_is_active;                ///< Whether the system is active
         int m_priority;                  ///< Update priority (higher = updated earlier)
+        std::size_t m_profile_slot;      ///< ProfileManager slot for this system's update time
     };
 
     /**
@@ -180,6 +228,15 @@ namespace gam300 {
 
         std::vector<std::shared_ptr<System>> m_systems; ///< All registered systems
         std::unordered_map<std::type_index, std::shared_ptr<System>> m_system_types; ///< Map of system types to instances
+        std::array<std::vector<uint32_t>, MAX_COMPONENTS> m_systems_by_component; ///< Indices in m_systems of the systems requiring each component type, by priority
+        std::vector<uint32_t> m_maskless_systems; ///< Indices in m_systems of the systems that don't require any component, by priority
+        std::vector<uint32_t> m_candidate_systems; ///< Scratch for the systems a batch of component changes affects
+        std::vector<uint8_t> m_candidate_marks;   ///< Whether each system is already in m_candidate_systems
+
+        /**
+         * @brief Rebuild the per-component system lists after systems were added or reordered.
+         */
+        void rebuild_component_index();
 
     public:
         /**
@@ -222,6 +279,9 @@ namespace gam300 {
                 return nullptr;
             }
 
+            // Give the system a slot so its update time shows up in frame statistics
+            system->set_profile_slot(PM.registerSystem(system->get_name()));
+
             // Store the system
             m_systems.push_back(system);
             m_system_types[type_index] = system;
@@ -273,9 +333,25 @@ namespace gam300 {
 
         /**
          * @brief Entity's component mask changed, notify all systems.
+         * @details Re-checks every system, use the overloads below when the changed
+         *          components are known.
          * @param entity The entity whose component mask changed.
          */
         void entity_components_changed(const Entity& entity);
+
+        /**
+         * @brief A component was added to or removed from an entity, notify the systems that require it.
+         * @param entity The entity whose component mask changed.
+         * @param component_id The component type that was added or removed.
+         */
+        void entity_components_changed(const Entity& entity, ComponentTypeID component_id);
+
+        /**
+         * @brief Several components of an entity changed, notify each system that requires any of them once.
+         * @param entity The entity whose component mask changed.
+         * @param changed_components Bit mask of the component types that were added or removed.
+         */
+        void entity_components_changed(const Entity& entity, const ComponentMask& changed_components);
     };
 
     // Define the SM macro for easier access to the SystemManager
@@ -292,7 +368,7 @@ namespace gam300 {
          * @brief Constructor for the ComponentSystem.
          * @param name The name of the system.
          */
-        ComponentSystem(const std::string& name) : System(name) {
+        ComponentSystem(const std::string& name) : System(name), m_storage_order(false), m_sorted_version(0) {
             // Create the component mask for this system by setting bits for each component type
             (m_component_mask.set(get_component_type_id<Components>()), ...);
         }
@@ -307,8 +383,105 @@ namespace gam300 {
             return (entity.get_component_mask() & m_component_mask) == m_component_mask;
         }
 
+        /**
+         * @brief Get the components an entity needs to be processed by this system.
+         * @return Bit mask of the required component types.
+         */
+        ComponentMask get_component_mask() const override {
+            return m_component_mask;
+        }
+
+        /**
+         * @brief Call a function for every entity of the system with its components.
+         * @details The component arrays are resolved once per call and each entity's
+         *          components are looked up by dense index a few entities ahead of the
+         *          call, with a prefetch, so the memory is on its way by the time the
+         *          function runs. The function must not add or remove the system's
+         *          component types or change its entities.
+         * @tparam Func Callable as func(EntityID, Components&...).
+         * @param func The function to call.
+         */
+        template<typename Func>
+        void for_each(Func&& func) {
+            std::tuple<ComponentArray<Components>*...> arrays(CM.template get_component_array<Components>()...);
+            if ((!std::get<ComponentArray<Components>*>(arrays) || ...)) {
+                return;
+            }
+
+            if (m_storage_order && m_sorted_version != m_entities.version()) {
+                sort_entities(arrays);
+            }
+
+            // Components of the next few entities, filled in ahead of use
+            const std::vector<EntityID>& entities = m_entities.dense();
+            const std::size_t count = entities.size();
+            std::array<std::tuple<Components*...>, FOR_EACH_PREFETCH_DISTANCE> ahead;
+            for (std::size_t i = 0; i < count && i < FOR_EACH_PREFETCH_DISTANCE; ++i) {
+                ahead[i] = fetch_components(arrays, entities[i]);
+            }
+
+            for (std::size_t i = 0; i < count; ++i) {
+                std::tuple<Components*...> current = ahead[i % FOR_EACH_PREFETCH_DISTANCE];
+                if (i + FOR_EACH_PREFETCH_DISTANCE < count) {
+                    ahead[i % FOR_EACH_PREFETCH_DISTANCE] = fetch_components(arrays, entities[i + FOR_EACH_PREFETCH_DISTANCE]);
+                }
+
+                // Members always have the components, unless the function broke the rule above
+                if ((!std::get<Components*>(current) || ...)) {
+                    continue;
+                }
+                func(entities[i], *std::get<Components*>(current)...);
+            }
+        }
+
+        /**
+         * @brief Keep the entities in the storage order of the first component type.
+         * @details for_each() then walks that component's array front to back. The
+         *          entities are re-sorted lazily, on the first for_each() after they change.
+         * @param storage_order True to sort, false to keep the order entities joined in.
+         */
+        void set_storage_order(bool storage_order) {
+            m_storage_order = storage_order;
+            m_sorted_version = m_entities.version() - 1;
+        }
+
+        /**
+         * @brief Sort the entities into the storage order of the first component type now.
+         * @details Lets a system with storage order enabled pay for the sort at a time of
+         *          its choosing, e.g. after loading a level, rather than in for_each().
+         */
+        void sort_by_storage() {
+            std::tuple<ComponentArray<Components>*...> arrays(CM.template get_component_array<Components>()...);
+            if ((!std::get<ComponentArray<Components>*>(arrays) || ...)) {
+                return;
+            }
+            sort_entities(arrays);
+        }
+
     protected:
+        // Entities ahead of the current one whose components for_each() resolves and prefetches
+        static constexpr std::size_t FOR_EACH_PREFETCH_DISTANCE = 8;
+
         ComponentMask m_component_mask; ///< Bit mask of required components
+        bool m_storage_order;           ///< Whether for_each() sorts entities by storage order
+        uint32_t m_sorted_version;      ///< m_entities version after the last sort
+
+    private:
+        // Look up an entity's components and start loading them
+        static std::tuple<Components*...> fetch_components(const std::tuple<ComponentArray<Components>*...>& arrays, EntityID entity_id) {
+            std::tuple<Components*...> components(std::get<ComponentArray<Components>*>(arrays)->get_component(entity_id)...);
+            (prefetch(std::get<Components*>(components)), ...);
+            return components;
+        }
+
+        // Sort the entities by the dense index of their first component
+        void sort_entities(const std::tuple<ComponentArray<Components>*...>& arrays) {
+            auto* first = std::get<0>(arrays);
+            m_entities.sort([first](EntityID a, EntityID b) {
+                return first->index_of(a) < first->index_of(b);
+            });
+            m_sorted_version = m_entities.version();
+        }
     };
 
 } // namespace gam300
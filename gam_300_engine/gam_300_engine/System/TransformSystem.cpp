@@ -0,0 +1,310 @@
+/**
+ * @file TransformSystem.cpp
+ * @brief Implementation of the Transform System for the Entity Component System.
+ * @details Contains implementations for all member functions declared in TransformSystem.h.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "../System/TransformSystem.h"
+#include "../Manager/ComponentManager.h"
+#include "../Manager/JobManager.h"
+#include "../Manager/LogManager.h"
+#include <atomic>
+
+namespace gam300 {
+
+    namespace {
+        // Entities a level needs before it is split across workers
+        constexpr std::size_t DEFAULT_PARALLEL_THRESHOLD = 4096;
+
+        // Fewest nodes handed to a worker at once
+        constexpr std::size_t MIN_NODES_PER_JOB = 1024;
+    }
+
+    // Constructor
+    TransformSystem::TransformSystem() : ComponentSystem<TransformComponent>("TransformSystem"),
+        m_moved_listed(true), m_update_count(0), m_updated_count(0), m_parallel_threshold(DEFAULT_PARALLEL_THRESHOLD),
+        m_hierarchy_generation(0), m_change_generation(0), m_hierarchy_dirty(true) {
+        // Set priority - world matrices are computed after the systems that move entities
+        set_priority(-100);
+    }
+
+    // Initialize the system
+    bool TransformSystem::init(SystemManager& /*system_manager*/) {
+        LM.writeLog("TransformSystem::init() - Transform System initialized");
+        return true;
+    }
+
+    // Update the system
+    void TransformSystem::update(float /*dt*/) {
+        m_update_count++;
+        m_moved_entities.clear();
+        m_moved_listed = true;
+
+        bool hierarchy_changed = m_hierarchy_dirty || m_hierarchy_generation != TransformComponent::getHierarchyGeneration();
+        if (!hierarchy_changed && m_change_generation == TransformComponent::getChangeGeneration()) {
+            // Nothing moved since the last update
+            m_updated_count = 0;
+            return;
+        }
+
+        if (hierarchy_changed) {
+            rebuild_hierarchy();
+        }
+        m_change_generation = TransformComponent::getChangeGeneration();
+
+        // Levels in order, every parent's matrix is final before its children read it
+        m_updated_count = 0;
+        for (std::size_t level = 0; level + 1 < m_level_offsets.size(); ++level) {
+            std::size_t begin = m_level_offsets[level];
+            std::size_t end = m_level_offsets[level + 1];
+
+            if (m_parallel_threshold == 0 || end - begin < m_parallel_threshold) {
+                m_updated_count += update_nodes(begin, end);
+                continue;
+            }
+
+            std::atomic<std::size_t> updated(0);
+            JM.parallelFor(end - begin, MIN_NODES_PER_JOB, [this, begin, &updated](std::size_t first, std::size_t last) {
+                updated.fetch_add(update_nodes(begin + first, begin + last), std::memory_order_relaxed);
+            });
+            m_updated_count += updated.load(std::memory_order_relaxed);
+        }
+        m_moved_listed = m_updated_count == 0;
+    }
+
+    // Shut down the system
+    void TransformSystem::shutdown() {
+        m_nodes.clear();
+        m_node_entities.clear();
+        m_node_parents.clear();
+        m_child_begins.clear();
+        m_child_counts.clear();
+        m_level_offsets.clear();
+        m_dense_to_node.clear();
+        m_world_changed.clear();
+        m_moved_entities.clear();
+        m_moved_listed = true;
+        m_hierarchy_dirty = true;
+        LM.writeLog("TransformSystem::shutdown() - Transform System shut down");
+    }
+
+    // Process a specific entity
+    void TransformSystem::process_entity(EntityID entity_id) {
+        TransformComponent* transform = CM.get_component<TransformComponent>(entity_id);
+        if (!transform) {
+            return;
+        }
+
+        TransformComponent* parent = transform->getParent() != INVALID_ENTITY_ID ?
+            CM.get_component<TransformComponent>(transform->getParent()) : nullptr;
+        transform->m_world = parent ? parent->m_world * transform->getLocalMatrix() : transform->getLocalMatrix();
+        transform->m_dirty = false;
+    }
+
+    // Entity joined the system
+    void TransformSystem::on_entity_added(EntityID /*entity_id*/) {
+        m_hierarchy_dirty = true;
+    }
+
+    // Entity left the system, its component may already be gone
+    void TransformSystem::on_entity_removed(EntityID /*entity_id*/) {
+        m_hierarchy_dirty = true;
+    }
+
+    // Get the direct children of an entity
+    std::span<const EntityID> TransformSystem::get_children(EntityID entity_id) {
+        if (m_hierarchy_dirty || m_hierarchy_generation != TransformComponent::getHierarchyGeneration()) {
+            rebuild_hierarchy();
+        }
+
+        std::size_t dense = m_entities.index_of(entity_id);
+        if (dense >= m_dense_to_node.size()) {
+            return {};
+        }
+        uint32_t node = m_dense_to_node[dense];
+        return std::span<const EntityID>(m_node_entities.data() + m_child_begins[node], m_child_counts[node]);
+    }
+
+    // Get the number of depth levels
+    std::size_t TransformSystem::get_depth_count() {
+        if (m_hierarchy_dirty || m_hierarchy_generation != TransformComponent::getHierarchyGeneration()) {
+            rebuild_hierarchy();
+        }
+        return m_level_offsets.empty() ? 0 : m_level_offsets.size() - 1;
+    }
+
+    // Get the number of matrices recomputed during the last update
+    std::size_t TransformSystem::get_updated_count() const {
+        return m_updated_count;
+    }
+
+    // Get the entities whose world matrix was recomputed during the last update
+    const std::vector<EntityID>& TransformSystem::get_moved_entities() {
+        if (!m_moved_listed) {
+            for (std::size_t node = 0; node < m_world_changed.size(); ++node) {
+                if (m_world_changed[node]) {
+                    m_moved_entities.push_back(m_node_entities[node]);
+                }
+            }
+            m_moved_listed = true;
+        }
+        return m_moved_entities;
+    }
+
+    // Get the number of times update() has run
+    uint64_t TransformSystem::get_update_count() const {
+        return m_update_count;
+    }
+
+    // Set the smallest level split across workers
+    void TransformSystem::set_parallel_threshold(std::size_t node_count) {
+        m_parallel_threshold = node_count;
+    }
+
+    // Sort the entities by depth
+    void TransformSystem::rebuild_hierarchy() {
+        // The node order and change flags are about to be replaced, list the last update's moves first
+        get_moved_entities();
+
+        const std::size_t count = m_entities.size();
+
+        // Gather the components and resolve each parent to an index in m_entities
+        std::vector<TransformComponent*> components;
+        std::vector<uint32_t> parents;
+        components.reserve(count);
+        parents.reserve(count);
+        std::size_t missing_parents = 0;
+        for_each([this, &components, &parents, &missing_parents, count](EntityID, TransformComponent& transform) {
+            std::size_t parent = count;
+            if (transform.getParent() != INVALID_ENTITY_ID) {
+                parent = m_entities.index_of(transform.getParent());
+                if (parent == count) {
+                    missing_parents++;
+                }
+            }
+            components.push_back(&transform);
+            parents.push_back(parent == count ? NO_PARENT : static_cast<uint32_t>(parent));
+        });
+        if (missing_parents > 0) {
+            LM.writeLog(LogLevel::WARNING, "TransformSystem::rebuild_hierarchy() - %zu entities have a parent without a transform, treated as roots",
+                missing_parents);
+        }
+
+        // Loops of parents never reach a root, break each at the first member found
+        std::vector<uint8_t> state(count, 0); // 0 unvisited, 1 on the current walk, 2 known to reach a root
+        for (std::size_t i = 0; i < count; ++i) {
+            std::size_t j = i;
+            while (state[j] == 0 && parents[j] != NO_PARENT) {
+                state[j] = 1;
+                j = parents[j];
+            }
+            if (state[j] == 1) {
+                LM.writeLog(LogLevel::WARNING, "TransformSystem::rebuild_hierarchy() - Entity %d is its own ancestor, treated as a root",
+                    components[j]->get_owner());
+                parents[j] = NO_PARENT;
+            }
+            for (j = i; state[j] != 2; j = parents[j]) {
+                state[j] = 2;
+                if (parents[j] == NO_PARENT) {
+                    break;
+                }
+            }
+        }
+
+        // Children of each entity, grouped by parent in entity order
+        std::vector<uint32_t> child_offsets(count + 1, 0);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (parents[i] != NO_PARENT) {
+                child_offsets[parents[i] + 1]++;
+            }
+        }
+        for (std::size_t i = 1; i <= count; ++i) {
+            child_offsets[i] += child_offsets[i - 1];
+        }
+        std::vector<uint32_t> children(child_offsets[count]);
+        std::vector<uint32_t> cursor(child_offsets.begin(), child_offsets.end() - 1);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (parents[i] != NO_PARENT) {
+                children[cursor[parents[i]]++] = static_cast<uint32_t>(i);
+            }
+        }
+
+        // Breadth-first from the roots, each level follows the previous one and
+        // the children of a node end up next to each other
+        std::vector<uint32_t> order;
+        order.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (parents[i] == NO_PARENT) {
+                order.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        m_level_offsets.clear();
+        m_child_begins.assign(count, 0);
+        m_child_counts.assign(count, 0);
+        std::size_t level_begin = 0;
+        while (level_begin < order.size()) {
+            std::size_t level_end = order.size();
+            m_level_offsets.push_back(static_cast<uint32_t>(level_begin));
+            for (std::size_t node = level_begin; node < level_end; ++node) {
+                uint32_t dense = order[node];
+                m_child_begins[node] = static_cast<uint32_t>(order.size());
+                m_child_counts[node] = child_offsets[dense + 1] - child_offsets[dense];
+                order.insert(order.end(), children.begin() + child_offsets[dense], children.begin() + child_offsets[dense + 1]);
+            }
+            level_begin = level_end;
+        }
+        m_level_offsets.push_back(static_cast<uint32_t>(order.size()));
+
+        // Node arrays in depth order, every node recomputed on the next update
+        m_nodes.resize(count);
+        m_node_entities.resize(count);
+        m_node_parents.resize(count);
+        m_dense_to_node.resize(count);
+        m_world_changed.assign(count, 0);
+        for (std::size_t node = 0; node < count; ++node) {
+            m_dense_to_node[order[node]] = static_cast<uint32_t>(node);
+        }
+        const std::vector<EntityID>& entities = m_entities.dense();
+        for (std::size_t node = 0; node < count; ++node) {
+            uint32_t dense = order[node];
+            m_nodes[node] = components[dense];
+            m_node_entities[node] = entities[dense];
+            m_node_parents[node] = parents[dense] == NO_PARENT ? NO_PARENT : m_dense_to_node[parents[dense]];
+            components[dense]->m_dirty = true;
+        }
+
+        m_hierarchy_generation = TransformComponent::getHierarchyGeneration();
+        m_hierarchy_dirty = false;
+
+        LM.writeLog(LogLevel::DEBUG, "TransformSystem::rebuild_hierarchy() - Sorted %zu entities into %zu levels",
+            count, m_level_offsets.size() - 1);
+    }
+
+    // Recompute the world matrices of a range of nodes
+    std::size_t TransformSystem::update_nodes(std::size_t begin, std::size_t end) {
+        std::size_t updated = 0;
+        for (std::size_t node = begin; node < end; ++node) {
+            TransformComponent* transform = m_nodes[node];
+            uint32_t parent = m_node_parents[node];
+            bool parent_changed = parent != NO_PARENT && m_world_changed[parent];
+            if (!transform->m_dirty && !parent_changed) {
+                m_world_changed[node] = 0;
+                continue;
+            }
+
+            Matrix4 local = transform->getLocalMatrix();
+            transform->m_world = parent == NO_PARENT ? local : m_nodes[parent]->m_world * local;
+            transform->m_dirty = false;
+            m_world_changed[node] = 1;
+            updated++;
+        }
+        return updated;
+    }
+
+} // namespace gam300
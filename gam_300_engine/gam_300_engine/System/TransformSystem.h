@@ -0,0 +1,161 @@
+/**
+ * @file TransformSystem.h
+ * @brief Declaration of the Transform System for the Entity Component System.
+ * @details Computes the world matrices of entities with TransformComponents from
+ *          their local transforms and their parents' world matrices.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __TRANSFORM_SYSTEM_H__
+#define __TRANSFORM_SYSTEM_H__
+
+#include "../System/System.h"
+#include "../Component/TransformComponent.h"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace gam300 {
+
+    /**
+     * @brief System for propagating transforms down the entity hierarchy.
+     * @details Keeps the entities sorted by depth, parents before children and the
+     *          children of each parent next to each other, so one linear pass updates
+     *          every world matrix after its parent's. Only entities whose local
+     *          transform changed, and the entities below them, are recomputed; frames
+     *          in which nothing moved are skipped outright. Entities at the same depth
+     *          don't depend on each other, so large levels are split across the
+     *          JobManager's workers. The order is rebuilt when entities join or leave
+     *          the system or any parent changes. Parents that don't have a transform,
+     *          and loops of parents, are reported and broken by treating the entity as
+     *          a root.
+     */
+    class TransformSystem : public ComponentSystem<TransformComponent> {
+    public:
+        /**
+         * @brief Constructor for TransformSystem.
+         */
+        TransformSystem();
+
+        /**
+         * @brief Initialize the system.
+         * @param system_manager Reference to the system manager.
+         * @return True if initialization was successful, false otherwise.
+         */
+        bool init(SystemManager& system_manager) override;
+
+        /**
+         * @brief Update the world matrices of the entities that moved and their descendants.
+         * @param dt Delta time since the last update.
+         */
+        void update(float dt) override;
+
+        /**
+         * @brief Clean up the system when shutting down.
+         */
+        void shutdown() override;
+
+        /**
+         * @brief Recompute one entity's world matrix from its parent's current one.
+         * @details Doesn't update the entity's descendants.
+         * @param entity_id The ID of the entity to process.
+         */
+        void process_entity(EntityID entity_id) override;
+
+        /**
+         * @brief Mark the depth order stale when an entity joins the system.
+         * @param entity_id The ID of the entity that was added.
+         */
+        void on_entity_added(EntityID entity_id) override;
+
+        /**
+         * @brief Mark the depth order stale when an entity leaves the system.
+         * @param entity_id The ID of the entity that was removed.
+         */
+        void on_entity_removed(EntityID entity_id) override;
+
+        /**
+         * @brief Get the direct children of an entity.
+         * @details Valid until the next update that rebuilds the depth order.
+         * @param entity_id The parent entity.
+         * @return The children, empty if the entity has none or isn't in the system.
+         */
+        std::span<const EntityID> get_children(EntityID entity_id);
+
+        /**
+         * @brief Get the number of depth levels.
+         * @return 1 for a flat scene, 0 if the system has no entities.
+         */
+        std::size_t get_depth_count();
+
+        /**
+         * @brief Get the number of world matrices recomputed during the last update.
+         * @return Entities that moved plus their descendants.
+         */
+        std::size_t get_updated_count() const;
+
+        /**
+         * @brief Get the entities whose world matrix was recomputed during the last update.
+         * @details Lets systems that mirror world positions, such as the spatial hash,
+         *          touch only what moved. Listed on the first call after each update.
+         * @return The entities, in depth order.
+         */
+        const std::vector<EntityID>& get_moved_entities();
+
+        /**
+         * @brief Get the number of times update() has run, including updates skipped because nothing moved.
+         * @details Tells a caller of get_moved_entities() whether it missed an update.
+         * @return The count.
+         */
+        uint64_t get_update_count() const;
+
+        /**
+         * @brief Set the smallest level split across worker threads.
+         * @details Smaller levels are updated on the calling thread, where handing them
+         *          out would cost more than it saves. 0 disables the split.
+         * @param node_count Entities a level needs before it is split.
+         */
+        void set_parallel_threshold(std::size_t node_count);
+
+    private:
+        /**
+         * @brief Sort the entities by depth and index their children.
+         */
+        void rebuild_hierarchy();
+
+        /**
+         * @brief Recompute the world matrices of a range of nodes in depth order.
+         * @param begin First node.
+         * @param end One past the last node.
+         * @return Number of matrices recomputed.
+         */
+        std::size_t update_nodes(std::size_t begin, std::size_t end);
+
+        // Parent index of a root node
+        static constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+        std::vector<TransformComponent*> m_nodes;   ///< Components in depth order
+        std::vector<EntityID> m_node_entities;      ///< Entity of each node
+        std::vector<uint32_t> m_node_parents;       ///< Parent node of each node, NO_PARENT for roots
+        std::vector<uint32_t> m_child_begins;       ///< First child node of each node
+        std::vector<uint32_t> m_child_counts;       ///< Children of each node
+        std::vector<uint32_t> m_level_offsets;      ///< First node of each depth level, plus the node count
+        std::vector<uint32_t> m_dense_to_node;      ///< Node of each entity, by index in m_entities
+        std::vector<uint8_t> m_world_changed;       ///< Whether each node's world matrix changed this update
+        std::vector<EntityID> m_moved_entities;     ///< Entities whose world matrix changed in the last update
+        bool m_moved_listed;                        ///< Whether m_moved_entities is filled in for the last update
+        uint64_t m_update_count;                    ///< Calls to update()
+        std::size_t m_updated_count;                ///< Matrices recomputed during the last update
+        std::size_t m_parallel_threshold;           ///< Smallest level split across workers
+        uint32_t m_hierarchy_generation;            ///< TransformComponent hierarchy generation the order was built from
+        uint32_t m_change_generation;               ///< TransformComponent change generation of the last update
+        bool m_hierarchy_dirty;                     ///< Set when the system's entities change
+    };
+
+} // namespace gam300
+
+#endif // __TRANSFORM_SYSTEM_H__
@@ -0,0 +1,147 @@
+/**
+ * @file AABB.h
+ * @brief Declaration of the AABB class for the game engine.
+ * @details Axis-aligned bounding box used by the broadphase and physics. The
+ *          operations are defined inline below the class so they can be inlined
+ *          into tree traversals.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __AABB_H__
+#define __AABB_H__
+
+#include <cmath>
+#include "Matrix4.h"
+#include "Vector3D.h"
+
+namespace gam300 {
+
+    class AABB {
+    public:
+        // Corners, min is never above max on any axis for a valid box
+        Vector3D min;
+        Vector3D max;
+
+        // Constructors
+        AABB();                                             // Empty box at the origin
+        AABB(const Vector3D& min, const Vector3D& max);     // Box from its corners
+
+        // Properties
+        Vector3D getCenter() const;                         // Middle of the box
+        Vector3D getHalfExtents() const;                    // Half the size along each axis
+        float getSurfaceArea() const;                       // Total area of the six faces, the cost measure of the tree
+
+        // Tests
+        bool contains(const AABB& other) const;             // Whether other lies entirely inside, faces included
+        bool overlaps(const AABB& other) const;             // Whether the boxes touch or overlap
+        bool intersectRay(const Vector3D& origin, const Vector3D& inverse_direction, float max_distance,
+            float& distance) const;                         // Distance along a ray to the box, 0 if the origin is inside
+
+        // Derived boxes
+        AABB fattened(float margin) const;                  // Grown by margin on every side
+        AABB transformed(const Matrix4& matrix) const;      // Smallest box around this box transformed by an affine matrix
+
+        // Static operations
+        static AABB merge(const AABB& a, const AABB& b);    // Smallest box containing both
+        static AABB fromCenter(const Vector3D& center, const Vector3D& half_extents); // Box from its center and half size
+    };
+
+    // Default constructor
+    inline AABB::AABB() : min(), max() {}
+
+    // Constructor from corners
+    inline AABB::AABB(const Vector3D& min, const Vector3D& max) : min(min), max(max) {}
+
+    // Middle of the box
+    inline Vector3D AABB::getCenter() const {
+        return Vector3D((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f);
+    }
+
+    // Half the size along each axis
+    inline Vector3D AABB::getHalfExtents() const {
+        return Vector3D((max.x - min.x) * 0.5f, (max.y - min.y) * 0.5f, (max.z - min.z) * 0.5f);
+    }
+
+    // Total area of the faces
+    inline float AABB::getSurfaceArea() const {
+        float dx = max.x - min.x;
+        float dy = max.y - min.y;
+        float dz = max.z - min.z;
+        return 2.0f * (dx * dy + dy * dz + dz * dx);
+    }
+
+    // Whether other lies entirely inside
+    inline bool AABB::contains(const AABB& other) const {
+        return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z &&
+            other.max.x <= max.x && other.max.y <= max.y && other.max.z <= max.z;
+    }
+
+    // Whether the boxes touch or overlap
+    inline bool AABB::overlaps(const AABB& other) const {
+        return min.x <= other.max.x && other.min.x <= max.x &&
+            min.y <= other.max.y && other.min.y <= max.y &&
+            min.z <= other.max.z && other.min.z <= max.z;
+    }
+
+    // Slab test, inverse_direction is 1 / direction per axis (infinite for zero components)
+    inline bool AABB::intersectRay(const Vector3D& origin, const Vector3D& inverse_direction, float max_distance,
+        float& distance) const {
+        float enter = 0.0f;
+        float leave = max_distance;
+
+        // Comparisons are written so a NaN from 0 * infinity leaves the interval unchanged
+        const float origins[3] = { origin.x, origin.y, origin.z };
+        const float inverses[3] = { inverse_direction.x, inverse_direction.y, inverse_direction.z };
+        const float lows[3] = { min.x, min.y, min.z };
+        const float highs[3] = { max.x, max.y, max.z };
+        for (int axis = 0; axis < 3; ++axis) {
+            float t1 = (lows[axis] - origins[axis]) * inverses[axis];
+            float t2 = (highs[axis] - origins[axis]) * inverses[axis];
+            float near_t = t1 < t2 ? t1 : t2;
+            float far_t = t1 > t2 ? t1 : t2;
+            enter = near_t > enter ? near_t : enter;
+            leave = far_t < leave ? far_t : leave;
+        }
+
+        if (enter > leave) {
+            return false;
+        }
+        distance = enter;
+        return true;
+    }
+
+    // Grown by margin on every side
+    inline AABB AABB::fattened(float margin) const {
+        return AABB(Vector3D(min.x - margin, min.y - margin, min.z - margin), Vector3D(max.x + margin, max.y + margin, max.z + margin));
+    }
+
+    // Box around the transformed box, each world half extent sums the absolute matrix column contributions
+    inline AABB AABB::transformed(const Matrix4& matrix) const {
+        Vector3D center = matrix.transformPoint(getCenter());
+        Vector3D half = getHalfExtents();
+        Vector3D extent(
+            std::abs(matrix.m[0]) * half.x + std::abs(matrix.m[4]) * half.y + std::abs(matrix.m[8]) * half.z,
+            std::abs(matrix.m[1]) * half.x + std::abs(matrix.m[5]) * half.y + std::abs(matrix.m[9]) * half.z,
+            std::abs(matrix.m[2]) * half.x + std::abs(matrix.m[6]) * half.y + std::abs(matrix.m[10]) * half.z);
+        return AABB(center - extent, center + extent);
+    }
+
+    // Smallest box containing both
+    inline AABB AABB::merge(const AABB& a, const AABB& b) {
+        return AABB(
+            Vector3D(a.min.x < b.min.x ? a.min.x : b.min.x, a.min.y < b.min.y ? a.min.y : b.min.y, a.min.z < b.min.z ? a.min.z : b.min.z),
+            Vector3D(a.max.x > b.max.x ? a.max.x : b.max.x, a.max.y > b.max.y ? a.max.y : b.max.y, a.max.z > b.max.z ? a.max.z : b.max.z));
+    }
+
+    // Box from its center and half size
+    inline AABB AABB::fromCenter(const Vector3D& center, const Vector3D& half_extents) {
+        return AABB(center - half_extents, center + half_extents);
+    }
+
+} // end of namespace gam300
+
+#endif // __AABB_H__
@@ -12,11 +12,24 @@
 
 namespace gam300 {
 
-    // Base path to the assets directory - modify this to match your project structure
-    const std::string BASE_ASSETS_PATH = "C:/GitHub/gam_300/gam_300_engine/gam_300_engine/Assets/";
+    // Base path to the assets directory, relative to the working directory unless
+    // overridden by the "asset_root" engine setting
+    static std::string s_base_assets_path = "Assets/";
 
     std::string getAssetsPath() {
-        return BASE_ASSETS_PATH;
+        return s_base_assets_path;
+    }
+
+    void setAssetsPath(const std::string& path) {
+        s_base_assets_path = path;
+        for (char& c : s_base_assets_path) {
+            if (c == '\\') c = '/';
+        }
+
+        // Make sure the path ends with a slash so file names can be appended
+        if (!s_base_assets_path.empty() && s_base_assets_path.back() != '/') {
+            s_base_assets_path += '/';
+        }
     }
 
     std::string getAssetFilePath(const std::string& relativePath) {
@@ -31,7 +44,7 @@ namespace gam300 {
             formattedPath = formattedPath.substr(1);
         }
 
-        return BASE_ASSETS_PATH + formattedPath;
+        return s_base_assets_path + formattedPath;
     }
 
 } // end of namespace gam300
\ No newline at end of file
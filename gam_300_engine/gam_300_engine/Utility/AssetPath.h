@@ -21,6 +21,13 @@ namespace gam300 {
      */
     std::string getAssetsPath();
 
+    /**
+     * @brief Set the path to the assets directory.
+     * @param path Absolute or working-directory-relative path to the assets directory.
+     * @details A trailing slash is added if missing.
+     */
+    void setAssetsPath(const std::string& path);
+
     /**
      * @brief Get the absolute path to a file in the assets directory.
      * @param relativePath The path relative to the assets directory.
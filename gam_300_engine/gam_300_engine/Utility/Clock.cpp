@@ -16,20 +16,14 @@ namespace gam300 {
     // Constructor - initialize previous_time to current time
     Clock::Clock() {
         // Get current time in microseconds
-        auto now = std::chrono::high_resolution_clock::now();
-        auto now_us = std::chrono::time_point_cast<std::chrono::microseconds>(now);
-        auto epoch = now_us.time_since_epoch();
-        m_previous_time = epoch.count(); // This will now store into int64_t
+        m_previous_time = now();
     }
 
 
     // Return time elapsed since previous call to delta(), reset clock time
     int64_t Clock::delta() { // Changed return type
         // Get current time in microseconds
-        auto now = std::chrono::high_resolution_clock::now();
-        auto now_us = std::chrono::time_point_cast<std::chrono::microseconds>(now);
-        auto epoch = now_us.time_since_epoch();
-        int64_t current_time = epoch.count(); // Changed to int64_t
+        int64_t current_time = now();
 
         // Calculate elapsed time
         int64_t elapsed_time = current_time - m_previous_time; // Changed to int64_t
@@ -49,10 +43,7 @@ namespace gam300 {
     // Return time elapsed since previous call to delta(), don't reset clock time
     int64_t Clock::split() const { // Changed return type
         // Get current time in microseconds
-        auto now = std::chrono::high_resolution_clock::now();
-        auto now_us = std::chrono::time_point_cast<std::chrono::microseconds>(now);
-        auto epoch = now_us.time_since_epoch();
-        int64_t current_time = epoch.count(); // Changed to int64_t
+        int64_t current_time = now();
 
         // Calculate elapsed time
         int64_t elapsed_time = current_time - m_previous_time; // Changed to int64_t
@@ -66,4 +57,12 @@ namespace gam300 {
         return elapsed_time;
     }
 
+    // Return the current time of the monotonic clock in microseconds
+    int64_t Clock::now() {
+        // steady_clock never jumps, so frame pacing is not thrown off by system clock changes
+        auto now = std::chrono::steady_clock::now();
+        auto now_us = std::chrono::time_point_cast<std::chrono::microseconds>(now);
+        return now_us.time_since_epoch().count();
+    }
+
 } // end of namespace gam300
\ No newline at end of file
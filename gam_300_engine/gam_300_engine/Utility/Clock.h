@@ -41,6 +41,13 @@ namespace gam300 {
          * @details Does not reset clock time.
          */
         int64_t split() const; // Changed return type from long int to int64_t
+
+        /**
+         * @brief Return the current time of the monotonic clock.
+         * @return Current time in microseconds since an unspecified epoch.
+         * @details Only meaningful when compared with other values from now().
+         */
+        static int64_t now();
     };
 
 } // end of namespace gam300
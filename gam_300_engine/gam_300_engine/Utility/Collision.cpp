@@ -0,0 +1,566 @@
+/**
+ * @file Collision.cpp
+ * @brief Implementation of the narrowphase tests for the game engine.
+ * @details Spheres and capsules are both segments grown by a radius, so one closest
+ *          point test covers every pair of them. Boxes against those reduce to
+ *          closest points on the box, and box pairs use the separating axis test
+ *          with the incident face clipped against the reference face.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Collision.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <utility>
+
+namespace gam300 {
+
+    namespace {
+        // Squared lengths below this are treated as zero
+        constexpr float COLLISION_EPSILON_SQ = 1e-12f;
+
+        // Box faces win over edges, and the first box's faces over the second's, unless
+        // the other separates by noticeably more, so resting contacts don't flicker
+        constexpr float COLLISION_RELATIVE_TOLERANCE = 0.95f;
+        constexpr float COLLISION_ABSOLUTE_TOLERANCE = 0.01f;
+
+        // Squared sine of the angle below which two capsules count as parallel
+        constexpr float COLLISION_PARALLEL_SINE_SQ = 1e-4f;
+
+        // Steps of the search for the point of a capsule's segment nearest a box
+        constexpr int COLLISION_SEGMENT_BOX_ITERATIONS = 4;
+
+        // Contacts of a capsule on a box join the deepest one when their normals are this close
+        constexpr float COLLISION_SAME_NORMAL_COSINE = 0.95f;
+
+        // Largest polygon face clipping can produce from a quad
+        constexpr int COLLISION_MAX_CLIP_POINTS = 16;
+
+        float clamp(float value, float low, float high) {
+            return value < low ? low : (value > high ? high : value);
+        }
+
+        float component(const Vector3D& v, int axis) {
+            return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+        }
+
+        // Unit vector at right angles to a unit vector
+        Vector3D perpendicular(const Vector3D& v) {
+            return std::abs(v.x) < 0.57735f ? Vector3D::cross(v, Vector3D(1.0f, 0.0f, 0.0f)).normalize()
+                : Vector3D::cross(v, Vector3D(0.0f, 1.0f, 0.0f)).normalize();
+        }
+
+        // Closest points between segments p1-q1 and p2-q2, Ericson's Real-Time Collision Detection 5.1.9
+        void closestSegmentPoints(const Vector3D& p1, const Vector3D& q1, const Vector3D& p2, const Vector3D& q2,
+            Vector3D& c1, Vector3D& c2) {
+            const Vector3D d1 = q1 - p1;
+            const Vector3D d2 = q2 - p2;
+            const Vector3D r = p1 - p2;
+            const float a = Vector3D::dot(d1, d1);
+            const float e = Vector3D::dot(d2, d2);
+            const float f = Vector3D::dot(d2, r);
+
+            float s = 0.0f;
+            float t = 0.0f;
+            if (a <= COLLISION_EPSILON_SQ && e <= COLLISION_EPSILON_SQ) {
+                // Both points
+            }
+            else if (a <= COLLISION_EPSILON_SQ) {
+                t = clamp(f / e, 0.0f, 1.0f);
+            }
+            else {
+                const float c = Vector3D::dot(d1, r);
+                if (e <= COLLISION_EPSILON_SQ) {
+                    s = clamp(-c / a, 0.0f, 1.0f);
+                }
+                else {
+                    const float b = Vector3D::dot(d1, d2);
+                    const float denominator = a * e - b * b;
+                    s = denominator > 0.0f ? clamp((b * f - c * e) / denominator, 0.0f, 1.0f) : 0.0f;
+                    t = (b * s + f) / e;
+                    if (t < 0.0f) {
+                        t = 0.0f;
+                        s = clamp(-c / a, 0.0f, 1.0f);
+                    }
+                    else if (t > 1.0f) {
+                        t = 1.0f;
+                        s = clamp((b - c) / a, 0.0f, 1.0f);
+                    }
+                }
+            }
+            c1 = p1 + d1 * s;
+            c2 = p2 + d2 * t;
+        }
+
+        // Two segments grown by radii, spheres being segments of no length
+        bool collideRounded(const Vector3D& p1, const Vector3D& q1, float radius_a, const Vector3D& p2, const Vector3D& q2,
+            float radius_b, float margin, ContactManifold& manifold) {
+            Vector3D c1;
+            Vector3D c2;
+            closestSegmentPoints(p1, q1, p2, q2, c1, c2);
+            const Vector3D offset = c2 - c1;
+            const float distance_sq = offset.magnitudeSquared();
+            const float reach = radius_a + radius_b + margin;
+            if (distance_sq > reach * reach) {
+                return false;
+            }
+
+            const Vector3D d1 = q1 - p1;
+            const Vector3D d2 = q2 - p2;
+            const float length_sq1 = d1.magnitudeSquared();
+            const float length_sq2 = d2.magnitudeSquared();
+            if (distance_sq > COLLISION_EPSILON_SQ) {
+                manifold.normal = offset / std::sqrt(distance_sq);
+            }
+            else if (length_sq1 > COLLISION_EPSILON_SQ || length_sq2 > COLLISION_EPSILON_SQ) {
+                // Axes cross, push apart at right angles to one of them
+                manifold.normal = perpendicular((length_sq1 > COLLISION_EPSILON_SQ ? d1 : d2).normalize());
+            }
+            else {
+                manifold.normal = Vector3D(0.0f, 1.0f, 0.0f);
+            }
+
+            manifold.count = 0;
+            auto add = [&manifold, radius_a, radius_b, margin](const Vector3D& a, const Vector3D& b) {
+                const float separation = Vector3D::dot(b - a, manifold.normal) - radius_a - radius_b;
+                if (separation <= margin) {
+                    Vector3D surface_a = a + manifold.normal * radius_a;
+                    Vector3D surface_b = b - manifold.normal * radius_b;
+                    manifold.points[manifold.count++] = { (surface_a + surface_b) * 0.5f, -separation };
+                }
+            };
+
+            // Capsules lying side by side touch along a line, its two ends keep them from rolling
+            if (length_sq1 > COLLISION_EPSILON_SQ && length_sq2 > COLLISION_EPSILON_SQ &&
+                Vector3D::cross(d1, d2).magnitudeSquared() <= COLLISION_PARALLEL_SINE_SQ * length_sq1 * length_sq2) {
+                const float inverse_sq1 = 1.0f / length_sq1;
+                const float t_p = Vector3D::dot(p2 - p1, d1) * inverse_sq1;
+                const float t_q = Vector3D::dot(q2 - p1, d1) * inverse_sq1;
+                const float low = std::max(0.0f, std::min(t_p, t_q));
+                const float high = std::min(1.0f, std::max(t_p, t_q));
+                if (high - low > 1e-3f) {
+                    const float inverse_sq2 = 1.0f / length_sq2;
+                    for (float t : { low, high }) {
+                        Vector3D a = p1 + d1 * t;
+                        Vector3D b = p2 + d2 * clamp(Vector3D::dot(a - p2, d2) * inverse_sq2, 0.0f, 1.0f);
+                        add(a, b);
+                    }
+                    if (manifold.count > 0) {
+                        return true;
+                    }
+                }
+            }
+
+            add(c1, c2);
+            return manifold.count > 0;
+        }
+
+        // Sphere against a box, in the box's space, normal from the box to the sphere
+        bool collideBoxPoint(const Vector3D& half, const Vector3D& point, float radius, float margin, Vector3D& normal,
+            ContactPoint& contact) {
+            const Vector3D clamped(clamp(point.x, -half.x, half.x), clamp(point.y, -half.y, half.y),
+                clamp(point.z, -half.z, half.z));
+            const Vector3D offset = point - clamped;
+            const float distance_sq = offset.magnitudeSquared();
+
+            Vector3D surface;
+            if (distance_sq > COLLISION_EPSILON_SQ) {
+                const float reach = radius + margin;
+                if (distance_sq > reach * reach) {
+                    return false;
+                }
+                const float distance = std::sqrt(distance_sq);
+                normal = offset / distance;
+                contact.depth = radius - distance;
+                surface = clamped;
+            }
+            else {
+                // Center inside, out through the nearest face
+                int axis = 0;
+                float best = FLT_MAX;
+                for (int i = 0; i < 3; ++i) {
+                    float gap = component(half, i) - std::abs(component(point, i));
+                    if (gap < best) {
+                        best = gap;
+                        axis = i;
+                    }
+                }
+                const float sign = component(point, axis) < 0.0f ? -1.0f : 1.0f;
+                normal = Vector3D(axis == 0 ? sign : 0.0f, axis == 1 ? sign : 0.0f, axis == 2 ? sign : 0.0f);
+                contact.depth = radius + best;
+                surface = point + normal * best;
+            }
+            contact.position = (surface + (point - normal * radius)) * 0.5f;
+            return true;
+        }
+
+        // A segment grown by a radius against a box, normal from the box to the segment
+        bool collideBoxRounded(const Vector3D& half, const Vector3D& position, const Quaternion& rotation, const Vector3D& p,
+            const Vector3D& q, float radius, float margin, ContactManifold& manifold) {
+            const Quaternion inverse = rotation.conjugate();
+            const Vector3D local_p = inverse.rotate(p - position);
+            const Vector3D local_q = inverse.rotate(q - position);
+
+            // The ends, and the point nearest the box for a capsule lying across an edge
+            Vector3D candidates[3];
+            int candidate_count = 0;
+            candidates[candidate_count++] = local_p;
+            const Vector3D segment = local_q - local_p;
+            const float length_sq = segment.magnitudeSquared();
+            if (length_sq > COLLISION_EPSILON_SQ) {
+                candidates[candidate_count++] = local_q;
+                Vector3D nearest = (local_p + local_q) * 0.5f;
+                for (int i = 0; i < COLLISION_SEGMENT_BOX_ITERATIONS; ++i) {
+                    Vector3D on_box(clamp(nearest.x, -half.x, half.x), clamp(nearest.y, -half.y, half.y),
+                        clamp(nearest.z, -half.z, half.z));
+                    nearest = local_p + segment * clamp(Vector3D::dot(on_box - local_p, segment) / length_sq, 0.0f, 1.0f);
+                }
+                const float distinct_sq = 1e-6f * length_sq;
+                if (Vector3D::distanceSquared(nearest, local_p) > distinct_sq && Vector3D::distanceSquared(nearest, local_q) > distinct_sq) {
+                    candidates[candidate_count++] = nearest;
+                }
+            }
+
+            Vector3D normals[3];
+            ContactPoint contacts[3];
+            bool found[3] = { false, false, false };
+            int deepest = -1;
+            for (int i = 0; i < candidate_count; ++i) {
+                found[i] = collideBoxPoint(half, candidates[i], radius, margin, normals[i], contacts[i]);
+                if (found[i] && (deepest < 0 || contacts[i].depth > contacts[deepest].depth)) {
+                    deepest = i;
+                }
+            }
+            if (deepest < 0) {
+                return false;
+            }
+
+            manifold.normal = rotation.rotate(normals[deepest]);
+            manifold.count = 0;
+            for (int i = 0; i < candidate_count; ++i) {
+                if (found[i] && Vector3D::dot(normals[i], normals[deepest]) >= COLLISION_SAME_NORMAL_COSINE) {
+                    manifold.points[manifold.count++] = { position + rotation.rotate(contacts[i].position), contacts[i].depth };
+                }
+            }
+            return true;
+        }
+
+        // Keep the points of a large contact patch that cover it best
+        void reducePoints(const ContactPoint* points, int count, const Vector3D& normal, ContactManifold& manifold) {
+            if (count <= CONTACT_MAX_POINTS) {
+                manifold.count = count;
+                for (int i = 0; i < count; ++i) {
+                    manifold.points[i] = points[i];
+                }
+                return;
+            }
+
+            // Deepest, farthest from it, then the largest triangles either side of those two
+            int chosen[CONTACT_MAX_POINTS] = { 0, 0, 0, 0 };
+            for (int i = 1; i < count; ++i) {
+                if (points[i].depth > points[chosen[0]].depth) {
+                    chosen[0] = i;
+                }
+            }
+            float best = -1.0f;
+            for (int i = 0; i < count; ++i) {
+                float distance_sq = Vector3D::distanceSquared(points[i].position, points[chosen[0]].position);
+                if (distance_sq > best) {
+                    best = distance_sq;
+                    chosen[1] = i;
+                }
+            }
+            const Vector3D base = points[chosen[0]].position;
+            const Vector3D edge = points[chosen[1]].position - base;
+            float most = -FLT_MAX;
+            float least = FLT_MAX;
+            for (int i = 0; i < count; ++i) {
+                float area = Vector3D::dot(Vector3D::cross(edge, points[i].position - base), normal);
+                if (area > most) {
+                    most = area;
+                    chosen[2] = i;
+                }
+                if (area < least) {
+                    least = area;
+                    chosen[3] = i;
+                }
+            }
+
+            manifold.count = 0;
+            for (int i = 0; i < CONTACT_MAX_POINTS; ++i) {
+                bool repeated = false;
+                for (int j = 0; j < i; ++j) {
+                    repeated = repeated || chosen[j] == chosen[i];
+                }
+                if (!repeated) {
+                    manifold.points[manifold.count++] = points[chosen[i]];
+                }
+            }
+        }
+
+        // Clip a polygon to the side of a plane where dot(normal, x) <= offset
+        int clipPolygon(const Vector3D* input, int count, const Vector3D& normal, float offset, Vector3D* output) {
+            int result = 0;
+            for (int i = 0; i < count; ++i) {
+                const Vector3D& a = input[i];
+                const Vector3D& b = input[(i + 1) % count];
+                const float distance_a = Vector3D::dot(normal, a) - offset;
+                const float distance_b = Vector3D::dot(normal, b) - offset;
+                if (distance_a <= 0.0f) {
+                    output[result++] = a;
+                }
+                if ((distance_a < 0.0f && distance_b > 0.0f) || (distance_a > 0.0f && distance_b < 0.0f)) {
+                    output[result++] = a + (b - a) * (distance_a / (distance_a - distance_b));
+                }
+            }
+            return result;
+        }
+
+        // Two boxes by the separating axis test
+        bool collideBoxBox(const Vector3D& half_a, const Vector3D& position_a, const Quaternion& rotation_a,
+            const Vector3D& half_b, const Vector3D& position_b, const Quaternion& rotation_b, float margin,
+            ContactManifold& manifold) {
+            const Vector3D axes_a[3] = { rotation_a.rotate(Vector3D(1.0f, 0.0f, 0.0f)), rotation_a.rotate(Vector3D(0.0f, 1.0f, 0.0f)),
+                rotation_a.rotate(Vector3D(0.0f, 0.0f, 1.0f)) };
+            const Vector3D axes_b[3] = { rotation_b.rotate(Vector3D(1.0f, 0.0f, 0.0f)), rotation_b.rotate(Vector3D(0.0f, 1.0f, 0.0f)),
+                rotation_b.rotate(Vector3D(0.0f, 0.0f, 1.0f)) };
+            const float ha[3] = { half_a.x, half_a.y, half_a.z };
+            const float hb[3] = { half_b.x, half_b.y, half_b.z };
+            const Vector3D t = position_b - position_a;
+
+            // The small bias keeps near parallel edges from producing a bogus axis
+            float abs_r[3][3];
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    abs_r[i][j] = std::abs(Vector3D::dot(axes_a[i], axes_b[j])) + 1e-6f;
+                }
+            }
+
+            float face_a = -FLT_MAX;
+            int face_a_axis = 0;
+            for (int i = 0; i < 3; ++i) {
+                float separation = std::abs(Vector3D::dot(t, axes_a[i])) -
+                    (ha[i] + hb[0] * abs_r[i][0] + hb[1] * abs_r[i][1] + hb[2] * abs_r[i][2]);
+                if (separation > margin) {
+                    return false;
+                }
+                if (separation > face_a) {
+                    face_a = separation;
+                    face_a_axis = i;
+                }
+            }
+
+            float face_b = -FLT_MAX;
+            int face_b_axis = 0;
+            for (int j = 0; j < 3; ++j) {
+                float separation = std::abs(Vector3D::dot(t, axes_b[j])) -
+                    (hb[j] + ha[0] * abs_r[0][j] + ha[1] * abs_r[1][j] + ha[2] * abs_r[2][j]);
+                if (separation > margin) {
+                    return false;
+                }
+                if (separation > face_b) {
+                    face_b = separation;
+                    face_b_axis = j;
+                }
+            }
+
+            float edge = -FLT_MAX;
+            int edge_a = 0;
+            int edge_b = 0;
+            Vector3D edge_axis;
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    Vector3D axis = Vector3D::cross(axes_a[i], axes_b[j]);
+                    float length_sq = axis.magnitudeSquared();
+                    if (length_sq < 1e-10f) {
+                        continue;
+                    }
+                    axis = axis / std::sqrt(length_sq);
+                    float radius_a = 0.0f;
+                    float radius_b = 0.0f;
+                    for (int k = 0; k < 3; ++k) {
+                        radius_a += ha[k] * std::abs(Vector3D::dot(axes_a[k], axis));
+                        radius_b += hb[k] * std::abs(Vector3D::dot(axes_b[k], axis));
+                    }
+                    float separation = std::abs(Vector3D::dot(t, axis)) - radius_a - radius_b;
+                    if (separation > margin) {
+                        return false;
+                    }
+                    if (separation > edge) {
+                        edge = separation;
+                        edge_a = i;
+                        edge_b = j;
+                        edge_axis = axis;
+                    }
+                }
+            }
+
+            const bool use_b = face_b > COLLISION_RELATIVE_TOLERANCE * face_a + COLLISION_ABSOLUTE_TOLERANCE;
+            const float face = use_b ? face_b : face_a;
+            if (edge > COLLISION_RELATIVE_TOLERANCE * face + COLLISION_ABSOLUTE_TOLERANCE) {
+                // Edge against edge, one point between the closest points of the two edges
+                const Vector3D normal = Vector3D::dot(t, edge_axis) < 0.0f ? -edge_axis : edge_axis;
+                Vector3D center_a = position_a;
+                Vector3D center_b = position_b;
+                for (int k = 0; k < 3; ++k) {
+                    if (k != edge_a) {
+                        center_a += axes_a[k] * (Vector3D::dot(axes_a[k], normal) > 0.0f ? ha[k] : -ha[k]);
+                    }
+                    if (k != edge_b) {
+                        center_b += axes_b[k] * (Vector3D::dot(axes_b[k], normal) > 0.0f ? -hb[k] : hb[k]);
+                    }
+                }
+                Vector3D c1;
+                Vector3D c2;
+                closestSegmentPoints(center_a - axes_a[edge_a] * ha[edge_a], center_a + axes_a[edge_a] * ha[edge_a],
+                    center_b - axes_b[edge_b] * hb[edge_b], center_b + axes_b[edge_b] * hb[edge_b], c1, c2);
+                const float separation = Vector3D::dot(c2 - c1, normal);
+                if (separation > margin) {
+                    return false;
+                }
+                manifold.normal = normal;
+                manifold.points[0] = { (c1 + c2) * 0.5f, -separation };
+                manifold.count = 1;
+                return true;
+            }
+
+            // Face against face, the incident face is clipped to the reference face's sides
+            const Vector3D* reference_axes = use_b ? axes_b : axes_a;
+            const Vector3D* incident_axes = use_b ? axes_a : axes_b;
+            const float* reference_half = use_b ? hb : ha;
+            const float* incident_half = use_b ? ha : hb;
+            const Vector3D& reference_position = use_b ? position_b : position_a;
+            const Vector3D& incident_position = use_b ? position_a : position_b;
+            const int reference_axis = use_b ? face_b_axis : face_a_axis;
+
+            Vector3D normal = reference_axes[reference_axis];
+            if (Vector3D::dot(incident_position - reference_position, normal) < 0.0f) {
+                normal = -normal;
+            }
+
+            int incident_axis = 0;
+            float most_aligned = -1.0f;
+            for (int j = 0; j < 3; ++j) {
+                float alignment = std::abs(Vector3D::dot(incident_axes[j], normal));
+                if (alignment > most_aligned) {
+                    most_aligned = alignment;
+                    incident_axis = j;
+                }
+            }
+            const float facing = Vector3D::dot(incident_axes[incident_axis], normal) > 0.0f ? -1.0f : 1.0f;
+            const Vector3D incident_center = incident_position + incident_axes[incident_axis] * (facing * incident_half[incident_axis]);
+            const int u_axis = (incident_axis + 1) % 3;
+            const int v_axis = (incident_axis + 2) % 3;
+            const Vector3D u = incident_axes[u_axis] * incident_half[u_axis];
+            const Vector3D v = incident_axes[v_axis] * incident_half[v_axis];
+
+            Vector3D polygon[COLLISION_MAX_CLIP_POINTS] = { incident_center + u + v, incident_center - u + v,
+                incident_center - u - v, incident_center + u - v };
+            Vector3D clipped[COLLISION_MAX_CLIP_POINTS];
+            int count = 4;
+            for (int k = 0; k < 3 && count > 0; ++k) {
+                if (k == reference_axis) {
+                    continue;
+                }
+                const Vector3D side = reference_axes[k];
+                const float center = Vector3D::dot(side, reference_position);
+                count = clipPolygon(polygon, count, side, center + reference_half[k], clipped);
+                count = clipPolygon(clipped, count, -side, -center + reference_half[k], polygon);
+            }
+
+            const float face_offset = Vector3D::dot(normal, reference_position) + reference_half[reference_axis];
+            ContactPoint points[COLLISION_MAX_CLIP_POINTS];
+            int point_count = 0;
+            for (int i = 0; i < count; ++i) {
+                const float separation = Vector3D::dot(normal, polygon[i]) - face_offset;
+                if (separation <= margin) {
+                    points[point_count++] = { polygon[i] - normal * (separation * 0.5f), -separation };
+                }
+            }
+            if (point_count == 0) {
+                return false;
+            }
+
+            manifold.normal = use_b ? -normal : normal;
+            reducePoints(points, point_count, manifold.normal, manifold);
+            return true;
+        }
+
+        // Segment of a sphere or capsule in world space
+        void getSegment(const CollisionShape& shape, const Vector3D& position, const Quaternion& rotation, Vector3D& p, Vector3D& q) {
+            if (shape.type == ShapeType::CAPSULE) {
+                const Vector3D axis = rotation.rotate(Vector3D(0.0f, shape.half_height, 0.0f));
+                p = position - axis;
+                q = position + axis;
+            }
+            else {
+                p = position;
+                q = position;
+            }
+        }
+    }
+
+    // Find where two shapes touch
+    bool Collision::collide(const CollisionShape& shape_a, const Vector3D& position_a, const Quaternion& rotation_a,
+        const CollisionShape& shape_b, const Vector3D& position_b, const Quaternion& rotation_b, float margin,
+        ContactManifold& manifold) {
+        manifold.count = 0;
+        const bool box_a = shape_a.type == ShapeType::BOX;
+        const bool box_b = shape_b.type == ShapeType::BOX;
+
+        if (box_a && box_b) {
+            return collideBoxBox(shape_a.half_extents, position_a, rotation_a, shape_b.half_extents, position_b, rotation_b,
+                margin, manifold);
+        }
+
+        Vector3D p;
+        Vector3D q;
+        if (box_a) {
+            getSegment(shape_b, position_b, rotation_b, p, q);
+            return collideBoxRounded(shape_a.half_extents, position_a, rotation_a, p, q, shape_b.radius, margin, manifold);
+        }
+        if (box_b) {
+            getSegment(shape_a, position_a, rotation_a, p, q);
+            if (!collideBoxRounded(shape_b.half_extents, position_b, rotation_b, p, q, shape_a.radius, margin, manifold)) {
+                return false;
+            }
+            manifold.normal = -manifold.normal;
+            return true;
+        }
+
+        Vector3D p2;
+        Vector3D q2;
+        getSegment(shape_a, position_a, rotation_a, p, q);
+        getSegment(shape_b, position_b, rotation_b, p2, q2);
+        return collideRounded(p, q, shape_a.radius, p2, q2, shape_b.radius, margin, manifold);
+    }
+
+    // World box around a shape
+    AABB Collision::computeBounds(const CollisionShape& shape, const Vector3D& position, const Quaternion& rotation) {
+        switch (shape.type) {
+        case ShapeType::SPHERE:
+            return AABB::fromCenter(position, Vector3D(shape.radius, shape.radius, shape.radius));
+
+        case ShapeType::CAPSULE: {
+            const Vector3D axis = rotation.rotate(Vector3D(0.0f, shape.half_height, 0.0f));
+            return AABB::fromCenter(position, Vector3D(std::abs(axis.x) + shape.radius, std::abs(axis.y) + shape.radius,
+                std::abs(axis.z) + shape.radius));
+        }
+
+        case ShapeType::BOX:
+        default: {
+            const Vector3D x = rotation.rotate(Vector3D(shape.half_extents.x, 0.0f, 0.0f));
+            const Vector3D y = rotation.rotate(Vector3D(0.0f, shape.half_extents.y, 0.0f));
+            const Vector3D z = rotation.rotate(Vector3D(0.0f, 0.0f, shape.half_extents.z));
+            return AABB::fromCenter(position, Vector3D(std::abs(x.x) + std::abs(y.x) + std::abs(z.x),
+                std::abs(x.y) + std::abs(y.y) + std::abs(z.y), std::abs(x.z) + std::abs(y.z) + std::abs(z.z)));
+        }
+        }
+    }
+
+} // end of namespace gam300
@@ -0,0 +1,109 @@
+/**
+ * @file Collision.h
+ * @brief Declaration of the collision shapes and narrowphase tests for the game engine.
+ * @details Spheres, boxes and capsules placed by a position and rotation, the
+ *          contact manifolds between them and their bounding boxes. Used by the
+ *          physics to turn broadphase pairs into contact points, and to describe
+ *          the collision events it reports.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __COLLISION_H__
+#define __COLLISION_H__
+
+#include <cstdint>
+#include "AABB.h"
+#include "ECS_Variables.h"
+#include "Quaternion.h"
+#include "Vector3D.h"
+
+namespace gam300 {
+
+    // Kinds of collision shape
+    enum class ShapeType : uint8_t {
+        SPHERE,         // Ball of radius around the origin
+        BOX,            // Box of half_extents around the origin
+        CAPSULE         // Segment along the local Y axis, half_height either side of the origin, grown by radius
+    };
+
+    // Shape in its local space, only the fields its type uses matter
+    struct CollisionShape {
+        ShapeType type = ShapeType::BOX;
+        Vector3D half_extents = Vector3D(0.5f, 0.5f, 0.5f);
+        float radius = 0.5f;
+        float half_height = 0.5f;
+    };
+
+    // Most points a manifold holds, enough for a box resting on a face
+    constexpr int CONTACT_MAX_POINTS = 4;
+
+    // Point where two shapes touch
+    struct ContactPoint {
+        Vector3D position;      // Midway between the two surfaces, in world space
+        float depth;            // How far the shapes overlap along the normal, negative while still apart
+    };
+
+    // Contact points between two shapes sharing one normal
+    struct ContactManifold {
+        Vector3D normal;                                // Unit direction from the first shape to the second
+        ContactPoint points[CONTACT_MAX_POINTS];
+        int count = 0;
+    };
+
+    // What happened between two touching shapes during a step
+    enum class CollisionEventType : uint8_t {
+        ENTER,          // Started touching
+        STAY,           // Still touching, not reported while both sides sleep
+        EXIT            // Stopped touching, or one side was removed
+    };
+
+    // Change in the contact between two entities
+    struct CollisionEvent {
+        EntityID first;                 // Lower entity ID of the pair
+        EntityID second;                // Higher entity ID of the pair
+        CollisionEventType type;
+        float approach_speed;           // Speed the two closed at along the normal before the step, 0 for EXIT
+        Vector3D normal;                // Unit direction from the first entity to the second, as last seen
+        Vector3D point;                 // Deepest contact point in world space, as last seen
+    };
+
+    /**
+     * @brief Narrowphase tests between collision shapes.
+     */
+    class Collision {
+    public:
+        /**
+         * @brief Find where two shapes touch.
+         * @details Shapes closer than margin but not yet touching get points with a
+         *          negative depth, so a solver can stop them before they overlap.
+         * @param shape_a First shape.
+         * @param position_a Position of the first shape.
+         * @param rotation_a Rotation of the first shape, unit length.
+         * @param shape_b Second shape.
+         * @param position_b Position of the second shape.
+         * @param rotation_b Rotation of the second shape, unit length.
+         * @param margin Gap up to which points are reported.
+         * @param manifold Receives the contact points, normal from the first shape to the second.
+         * @return True if any point was found.
+         */
+        static bool collide(const CollisionShape& shape_a, const Vector3D& position_a, const Quaternion& rotation_a,
+            const CollisionShape& shape_b, const Vector3D& position_b, const Quaternion& rotation_b, float margin,
+            ContactManifold& manifold);
+
+        /**
+         * @brief Get the world box around a shape.
+         * @param shape The shape.
+         * @param position Position of the shape.
+         * @param rotation Rotation of the shape, unit length.
+         * @return The smallest axis-aligned box holding the shape.
+         */
+        static AABB computeBounds(const CollisionShape& shape, const Vector3D& position, const Quaternion& rotation);
+    };
+
+} // end of namespace gam300
+
+#endif // __COLLISION_H__
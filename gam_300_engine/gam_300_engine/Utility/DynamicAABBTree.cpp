@@ -0,0 +1,385 @@
+/**
+ * @file DynamicAABBTree.cpp
+ * @brief Implementation of the dynamic AABB tree for the game engine.
+ * @details Insertion follows the surface area heuristic with branch costs as in
+ *          Box2D's b2DynamicTree. Rotations swap a node's child with a grandchild
+ *          when that shrinks the boxes rather than to even out heights, which keeps
+ *          queries several times cheaper at the cost of a somewhat deeper tree.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "DynamicAABBTree.h"
+#include <algorithm>
+
+namespace gam300 {
+
+    namespace {
+
+        // Nodes allocated the first time the pool grows
+        constexpr std::size_t INITIAL_NODE_CAPACITY = 16;
+
+        // Fat boxes more than this many margins bigger than needed on a side get shrunk
+        constexpr float SHRINK_MARGINS = 4.0f;
+
+    } // anonymous namespace
+
+    // Constructor
+    DynamicAABBTree::DynamicAABBTree(float margin) : m_root(AABB_TREE_NULL_NODE), m_free_list(AABB_TREE_NULL_NODE),
+        m_proxy_count(0), m_margin(margin) {
+    }
+
+    // Add an object
+    int32_t DynamicAABBTree::createProxy(const AABB& bounds, EntityID entity) {
+        int32_t proxy = allocateNode();
+        Node& node = m_nodes[proxy];
+        node.bounds = bounds.fattened(m_margin);
+        node.entity = entity;
+        node.height = 0;
+        node.moved = true;
+
+        insertLeaf(proxy);
+        m_moved.push_back(proxy);
+        m_proxy_count++;
+        return proxy;
+    }
+
+    // Remove an object
+    void DynamicAABBTree::destroyProxy(int32_t proxy) {
+        if (m_nodes[proxy].moved) {
+            // Leave a hole rather than shift the list others may be splitting up
+            std::replace(m_moved.begin(), m_moved.end(), proxy, AABB_TREE_NULL_NODE);
+        }
+        removeLeaf(proxy);
+        freeNode(proxy);
+        m_proxy_count--;
+    }
+
+    // Update an object's box
+    bool DynamicAABBTree::moveProxy(int32_t proxy, const AABB& bounds, const Vector3D& displacement) {
+        const AABB fat = fatten(bounds, displacement);
+        const AABB& current = m_nodes[proxy].bounds;
+        if (current.contains(bounds) && fat.fattened(SHRINK_MARGINS * m_margin).contains(current)) {
+            // Still inside and not oversized
+            return false;
+        }
+
+        removeLeaf(proxy);
+        m_nodes[proxy].bounds = fat;
+        insertLeaf(proxy);
+
+        if (!m_nodes[proxy].moved) {
+            m_nodes[proxy].moved = true;
+            m_moved.push_back(proxy);
+        }
+        return true;
+    }
+
+    // Find the proxies whose fat boxes overlap those of some moved proxies
+    void DynamicAABBTree::findPairs(std::span<const int32_t> proxies, std::vector<ProxyPair>& pairs) const {
+        for (int32_t proxy : proxies) {
+            if (proxy == AABB_TREE_NULL_NODE) {
+                continue;
+            }
+            query(m_nodes[proxy].bounds, [this, proxy, &pairs](int32_t other) {
+                // A pair of two moved proxies is reported from the lower one's search
+                if (other == proxy || (m_nodes[other].moved && other < proxy)) {
+                    return true;
+                }
+                pairs.push_back(proxy < other ? ProxyPair{ proxy, other } : ProxyPair{ other, proxy });
+                return true;
+            });
+        }
+    }
+
+    // Forget which proxies moved
+    void DynamicAABBTree::clearMovedProxies() {
+        for (int32_t proxy : m_moved) {
+            if (proxy != AABB_TREE_NULL_NODE) {
+                m_nodes[proxy].moved = false;
+            }
+        }
+        m_moved.clear();
+    }
+
+    // Remove every proxy
+    void DynamicAABBTree::clear() {
+        m_nodes.clear();
+        m_moved.clear();
+        m_root = AABB_TREE_NULL_NODE;
+        m_free_list = AABB_TREE_NULL_NODE;
+        m_proxy_count = 0;
+    }
+
+    // Quality of the tree
+    float DynamicAABBTree::getAreaRatio() const {
+        if (m_root == AABB_TREE_NULL_NODE) {
+            return 0.0f;
+        }
+        float root_area = m_nodes[m_root].bounds.getSurfaceArea();
+        if (root_area <= 0.0f) {
+            return 0.0f;
+        }
+
+        float total = 0.0f;
+        for (const Node& node : m_nodes) {
+            if (node.height > 0) {
+                total += node.bounds.getSurfaceArea();
+            }
+        }
+        return total / root_area;
+    }
+
+    // Check the tree
+    bool DynamicAABBTree::validate() const {
+        if (m_root == AABB_TREE_NULL_NODE) {
+            return m_proxy_count == 0;
+        }
+        if (m_nodes[m_root].parent != AABB_TREE_NULL_NODE) {
+            return false;
+        }
+
+        std::size_t leaves = 0;
+        std::vector<int32_t> stack(1, m_root);
+        while (!stack.empty()) {
+            int32_t index = stack.back();
+            stack.pop_back();
+            const Node& node = m_nodes[index];
+            if (node.isLeaf()) {
+                if (node.height != 0 || node.child2 != AABB_TREE_NULL_NODE) {
+                    return false;
+                }
+                leaves++;
+                continue;
+            }
+
+            const Node& child1 = m_nodes[node.child1];
+            const Node& child2 = m_nodes[node.child2];
+            if (child1.parent != index || child2.parent != index) {
+                return false;
+            }
+            if (node.height != 1 + std::max(child1.height, child2.height)) {
+                return false;
+            }
+            if (!node.bounds.contains(child1.bounds) || !node.bounds.contains(child2.bounds)) {
+                return false;
+            }
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+
+        // Every node is either in the tree or on the free list
+        std::size_t free_nodes = 0;
+        for (int32_t index = m_free_list; index != AABB_TREE_NULL_NODE; index = m_nodes[index].parent) {
+            free_nodes++;
+        }
+        return leaves == m_proxy_count && 2 * leaves - 1 + free_nodes == m_nodes.size();
+    }
+
+    // Take a node off the free list
+    int32_t DynamicAABBTree::allocateNode() {
+        if (m_free_list == AABB_TREE_NULL_NODE) {
+            // Double the pool and chain the new nodes into the free list
+            std::size_t old_size = m_nodes.size();
+            std::size_t new_size = std::max(INITIAL_NODE_CAPACITY, old_size * 2);
+            m_nodes.resize(new_size);
+            for (std::size_t i = old_size; i < new_size; ++i) {
+                m_nodes[i].parent = i + 1 < new_size ? static_cast<int32_t>(i + 1) : AABB_TREE_NULL_NODE;
+                m_nodes[i].height = -1;
+            }
+            m_free_list = static_cast<int32_t>(old_size);
+        }
+
+        int32_t index = m_free_list;
+        Node& node = m_nodes[index];
+        m_free_list = node.parent;
+        node.parent = AABB_TREE_NULL_NODE;
+        node.child1 = AABB_TREE_NULL_NODE;
+        node.child2 = AABB_TREE_NULL_NODE;
+        node.height = 0;
+        node.entity = INVALID_ENTITY_ID;
+        node.moved = false;
+        return index;
+    }
+
+    // Put a node back on the free list
+    void DynamicAABBTree::freeNode(int32_t node) {
+        m_nodes[node].parent = m_free_list;
+        m_nodes[node].height = -1;
+        m_nodes[node].moved = false;
+        m_free_list = node;
+    }
+
+    // Link a leaf into the tree
+    void DynamicAABBTree::insertLeaf(int32_t leaf) {
+        if (m_root == AABB_TREE_NULL_NODE) {
+            m_root = leaf;
+            m_nodes[leaf].parent = AABB_TREE_NULL_NODE;
+            return;
+        }
+
+        // Walk down to the sibling that adds the least area. Making the leaf a sibling
+        // of a node costs the merged box; going further down also grows every box on
+        // the way by what the leaf adds to it.
+        const AABB leaf_bounds = m_nodes[leaf].bounds;
+        int32_t index = m_root;
+        while (!m_nodes[index].isLeaf()) {
+            const Node& node = m_nodes[index];
+            float area = node.bounds.getSurfaceArea();
+            float combined_area = AABB::merge(node.bounds, leaf_bounds).getSurfaceArea();
+
+            float cost = 2.0f * combined_area;
+            float inheritance = 2.0f * (combined_area - area);
+
+            auto descend_cost = [this, &leaf_bounds, inheritance](int32_t child) {
+                const Node& child_node = m_nodes[child];
+                float merged = AABB::merge(leaf_bounds, child_node.bounds).getSurfaceArea();
+                return child_node.isLeaf() ? merged + inheritance : merged - child_node.bounds.getSurfaceArea() + inheritance;
+            };
+            float cost1 = descend_cost(node.child1);
+            float cost2 = descend_cost(node.child2);
+
+            if (cost < cost1 && cost < cost2) {
+                break;
+            }
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+        const int32_t sibling = index;
+
+        // New parent for the sibling and the leaf, in the sibling's place
+        const int32_t old_parent = m_nodes[sibling].parent;
+        const int32_t new_parent = allocateNode();
+        Node& parent = m_nodes[new_parent];
+        parent.parent = old_parent;
+        parent.bounds = AABB::merge(leaf_bounds, m_nodes[sibling].bounds);
+        parent.height = m_nodes[sibling].height + 1;
+        parent.child1 = sibling;
+        parent.child2 = leaf;
+        m_nodes[sibling].parent = new_parent;
+        m_nodes[leaf].parent = new_parent;
+
+        if (old_parent == AABB_TREE_NULL_NODE) {
+            m_root = new_parent;
+        }
+        else if (m_nodes[old_parent].child1 == sibling) {
+            m_nodes[old_parent].child1 = new_parent;
+        }
+        else {
+            m_nodes[old_parent].child2 = new_parent;
+        }
+
+        refitAncestors(old_parent);
+    }
+
+    // Unlink a leaf from the tree
+    void DynamicAABBTree::removeLeaf(int32_t leaf) {
+        if (leaf == m_root) {
+            m_root = AABB_TREE_NULL_NODE;
+            return;
+        }
+
+        // The sibling takes the parent's place
+        const int32_t parent = m_nodes[leaf].parent;
+        const int32_t grandparent = m_nodes[parent].parent;
+        const int32_t sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+        if (grandparent == AABB_TREE_NULL_NODE) {
+            m_root = sibling;
+            m_nodes[sibling].parent = AABB_TREE_NULL_NODE;
+            freeNode(parent);
+            return;
+        }
+
+        if (m_nodes[grandparent].child1 == parent) {
+            m_nodes[grandparent].child1 = sibling;
+        }
+        else {
+            m_nodes[grandparent].child2 = sibling;
+        }
+        m_nodes[sibling].parent = grandparent;
+        freeNode(parent);
+
+        refitAncestors(grandparent);
+    }
+
+    // Recompute boxes and heights up to the root
+    void DynamicAABBTree::refitAncestors(int32_t node) {
+        for (int32_t index = node; index != AABB_TREE_NULL_NODE; index = m_nodes[index].parent) {
+            Node& current = m_nodes[index];
+            const Node& child1 = m_nodes[current.child1];
+            const Node& child2 = m_nodes[current.child2];
+            current.height = 1 + std::max(child1.height, child2.height);
+            current.bounds = AABB::merge(child1.bounds, child2.bounds);
+
+            rotate(index);
+        }
+    }
+
+    // Swap a child with a grandchild when that shrinks the boxes
+    void DynamicAABBTree::rotate(int32_t a_index) {
+        const Node& a = m_nodes[a_index];
+        if (a.height < 2) {
+            return;
+        }
+
+        // Swapping B with a child of C leaves A's box alone and changes only C's, and
+        // the other way round; pick the swap that shrinks that box the most
+        const int32_t b_index = a.child1;
+        const int32_t c_index = a.child2;
+        const Node& b = m_nodes[b_index];
+        const Node& c = m_nodes[c_index];
+
+        float best_saving = 0.0f;
+        int32_t best_child = AABB_TREE_NULL_NODE;
+        int32_t best_grandchild = AABB_TREE_NULL_NODE;
+        auto consider = [&](int32_t child_index, const Node& other, int32_t swapped_index, int32_t kept_index) {
+            float saving = other.bounds.getSurfaceArea() -
+                AABB::merge(m_nodes[child_index].bounds, m_nodes[kept_index].bounds).getSurfaceArea();
+            if (saving > best_saving) {
+                best_saving = saving;
+                best_child = child_index;
+                best_grandchild = swapped_index;
+            }
+        };
+        if (!c.isLeaf()) {
+            consider(b_index, c, c.child1, c.child2);
+            consider(b_index, c, c.child2, c.child1);
+        }
+        if (!b.isLeaf()) {
+            consider(c_index, b, b.child1, b.child2);
+            consider(c_index, b, b.child2, b.child1);
+        }
+        if (best_child == AABB_TREE_NULL_NODE) {
+            return;
+        }
+
+        // The grandchild moves up into the child's place and the child moves down into its place
+        const int32_t parent_index = m_nodes[best_grandchild].parent;
+        Node& parent = m_nodes[parent_index];
+        Node& top = m_nodes[a_index];
+        (top.child1 == best_child ? top.child1 : top.child2) = best_grandchild;
+        (parent.child1 == best_grandchild ? parent.child1 : parent.child2) = best_child;
+        m_nodes[best_grandchild].parent = a_index;
+        m_nodes[best_child].parent = parent_index;
+
+        const Node& child1 = m_nodes[parent.child1];
+        const Node& child2 = m_nodes[parent.child2];
+        parent.bounds = AABB::merge(child1.bounds, child2.bounds);
+        parent.height = 1 + std::max(child1.height, child2.height);
+        top.height = 1 + std::max(m_nodes[top.child1].height, m_nodes[top.child2].height);
+    }
+
+    // Fat box of an object moved by displacement
+    AABB DynamicAABBTree::fatten(const AABB& bounds, const Vector3D& displacement) const {
+        AABB fat = bounds.fattened(m_margin);
+        Vector3D ahead = displacement * AABB_TREE_DISPLACEMENT_MULTIPLIER;
+        (ahead.x < 0.0f ? fat.min.x : fat.max.x) += ahead.x;
+        (ahead.y < 0.0f ? fat.min.y : fat.max.y) += ahead.y;
+        (ahead.z < 0.0f ? fat.min.z : fat.max.z) += ahead.z;
+        return fat;
+    }
+
+} // end of namespace gam300
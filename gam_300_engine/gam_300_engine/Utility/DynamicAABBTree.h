@@ -0,0 +1,419 @@
+/**
+ * @file DynamicAABBTree.h
+ * @brief Declaration of the dynamic AABB tree for the game engine.
+ * @details Bounding volume hierarchy of axis-aligned boxes that supports adding,
+ *          removing and moving boxes one at a time, for broadphase collision and
+ *          scene queries over objects of very different sizes. Each leaf stores a
+ *          fattened copy of its object's box, so small movements leave the tree
+ *          alone; a leaf is only re-inserted once its object leaves the fat box.
+ *          Insertion picks the sibling that adds the least surface area, and
+ *          rotations on the way back up keep the boxes tight.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __DYNAMIC_AABB_TREE_H__
+#define __DYNAMIC_AABB_TREE_H__
+
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+#include "AABB.h"
+#include "ECS_Variables.h"
+#include "RayPacket.h"
+#include "Vector3D.h"
+
+namespace gam300 {
+
+    // Proxy and node index meaning "none"
+    constexpr int32_t AABB_TREE_NULL_NODE = -1;
+
+    // Distance a leaf's fat box extends past its object's box on every side, by default
+    constexpr float AABB_TREE_DEFAULT_MARGIN = 0.1f;
+
+    // How far ahead along its last displacement a moving object's fat box reaches
+    constexpr float AABB_TREE_DISPLACEMENT_MULTIPLIER = 2.0f;
+
+    // Nodes a traversal keeps on the call stack before spilling to the heap, far more
+    // than the tree grows deep in practice
+    constexpr std::size_t AABB_TREE_STACK_CAPACITY = 256;
+
+    // Two proxies whose fat boxes overlap, first < second
+    struct ProxyPair {
+        int32_t first;
+        int32_t second;
+
+        bool operator<(const ProxyPair& other) const {
+            return first != other.first ? first < other.first : second < other.second;
+        }
+        bool operator==(const ProxyPair& other) const {
+            return first == other.first && second == other.second;
+        }
+    };
+
+    /**
+     * @brief Dynamic bounding volume hierarchy of fattened boxes.
+     * @details Objects are referred to by proxy, the index of their leaf, which stays
+     *          the same until the proxy is destroyed. Proxies that were created or
+     *          re-inserted are remembered until clearMovedProxies(), so pairs only
+     *          need to be searched for around them. Not thread safe for writes; any
+     *          number of threads may query at once between writes.
+     */
+    class DynamicAABBTree {
+    public:
+        /**
+         * @brief Construct an empty tree.
+         * @param margin Distance fat boxes extend past their object's box.
+         */
+        explicit DynamicAABBTree(float margin = AABB_TREE_DEFAULT_MARGIN);
+
+        /**
+         * @brief Add an object.
+         * @param bounds The object's box.
+         * @param entity Entity reported with the proxy.
+         * @return The proxy.
+         */
+        int32_t createProxy(const AABB& bounds, EntityID entity);
+
+        /**
+         * @brief Remove an object.
+         * @param proxy A proxy returned by createProxy().
+         */
+        void destroyProxy(int32_t proxy);
+
+        /**
+         * @brief Update an object's box.
+         * @details Leaves the tree alone while the box stays inside the proxy's fat box,
+         *          unless the fat box has become much bigger than it needs to be, e.g.
+         *          after the object shrank.
+         * @param proxy A proxy returned by createProxy().
+         * @param bounds The object's new box.
+         * @param displacement How far the object moved since its last update, stretches
+         *        the new fat box ahead of it.
+         * @return True if the proxy was re-inserted.
+         */
+        bool moveProxy(int32_t proxy, const AABB& bounds, const Vector3D& displacement);
+
+        /**
+         * @brief Get a proxy's fat box.
+         * @param proxy A live proxy.
+         * @return The box stored in the tree.
+         */
+        const AABB& getFatAABB(int32_t proxy) const {
+            return m_nodes[proxy].bounds;
+        }
+
+        /**
+         * @brief Get the entity a proxy was created for.
+         * @param proxy A live proxy.
+         * @return The entity.
+         */
+        EntityID getEntity(int32_t proxy) const {
+            return m_nodes[proxy].entity;
+        }
+
+        /**
+         * @brief Call a function for every proxy whose fat box overlaps a box.
+         * @tparam Func Callable as bool func(int32_t proxy), returning false to stop.
+         * @param bounds The box.
+         * @param func The function.
+         */
+        template<typename Func>
+        void query(const AABB& bounds, Func&& func) const {
+            if (m_root == AABB_TREE_NULL_NODE) {
+                return;
+            }
+
+            TraversalStack<int32_t> stack;
+            stack.push(m_root);
+            while (!stack.empty()) {
+                int32_t index = stack.pop();
+                const Node& node = m_nodes[index];
+                if (!node.bounds.overlaps(bounds)) {
+                    continue;
+                }
+                if (node.isLeaf()) {
+                    if (!func(index)) {
+                        return;
+                    }
+                }
+                else {
+                    stack.push(node.child1);
+                    stack.push(node.child2);
+                }
+            }
+        }
+
+        /**
+         * @brief Call a function for the proxies whose fat box a ray passes through, roughly nearest first.
+         * @details The function returns the distance the rest of the search is limited
+         *          to: the hit distance to only look for closer hits, max_distance to
+         *          keep going, or a negative value to stop.
+         * @tparam Func Callable as float func(int32_t proxy, float max_distance).
+         * @param origin Start of the ray.
+         * @param direction Direction of the ray, distances are in multiples of its length.
+         * @param max_distance Length of the ray.
+         * @param func The function.
+         */
+        template<typename Func>
+        void raycast(const Vector3D& origin, const Vector3D& direction, float max_distance, Func&& func) const {
+            if (m_root == AABB_TREE_NULL_NODE) {
+                return;
+            }
+
+            // Infinite for zero components, the slab test copes with it
+            const Vector3D inverse(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+
+            float entry = 0.0f;
+            if (!m_nodes[m_root].bounds.intersectRay(origin, inverse, max_distance, entry)) {
+                return;
+            }
+
+            TraversalStack<std::pair<int32_t, float>> stack;
+            stack.push({ m_root, entry });
+            while (!stack.empty()) {
+                std::pair<int32_t, float> current = stack.pop();
+                if (current.second > max_distance) {
+                    // The ray was clipped since this node was pushed
+                    continue;
+                }
+
+                const Node& node = m_nodes[current.first];
+                if (node.isLeaf()) {
+                    float limit = func(current.first, max_distance);
+                    if (limit < 0.0f) {
+                        return;
+                    }
+                    max_distance = limit < max_distance ? limit : max_distance;
+                    continue;
+                }
+
+                // Push the farther child first so the nearer one is searched first
+                float entry1 = 0.0f;
+                float entry2 = 0.0f;
+                bool hit1 = m_nodes[node.child1].bounds.intersectRay(origin, inverse, max_distance, entry1);
+                bool hit2 = m_nodes[node.child2].bounds.intersectRay(origin, inverse, max_distance, entry2);
+                if (hit1 && hit2) {
+                    if (entry1 <= entry2) {
+                        stack.push({ node.child2, entry2 });
+                        stack.push({ node.child1, entry1 });
+                    }
+                    else {
+                        stack.push({ node.child1, entry1 });
+                        stack.push({ node.child2, entry2 });
+                    }
+                }
+                else if (hit1) {
+                    stack.push({ node.child1, entry1 });
+                }
+                else if (hit2) {
+                    stack.push({ node.child2, entry2 });
+                }
+            }
+        }
+
+        /**
+         * @brief Call a function for the proxies whose fat box any ray of a packet passes through, roughly nearest first.
+         * @details Every node is tested against all the rays at once, and skipped once no
+         *          ray reaches it within its limit. The function may shorten the packet's
+         *          limits as it finds hits, to only look for closer ones.
+         * @tparam Func Callable as void func(int32_t proxy).
+         * @param packet The rays, with their radius growing every box.
+         * @param func The function.
+         */
+        template<typename Func>
+        void raycastPacket(const RayPacket& packet, Func&& func) const {
+            if (m_root == AABB_TREE_NULL_NODE) {
+                return;
+            }
+
+            float entries1[RAY_PACKET_SIZE];
+            float entries2[RAY_PACKET_SIZE];
+            if (!packet.intersect(m_nodes[m_root].bounds, entries1)) {
+                return;
+            }
+
+            // Nearest entry among the rays of a mask, to search the nearer child first
+            auto nearest = [](uint32_t mask, const float* entries) {
+                float result = FLT_MAX;
+                for (std::size_t lane = 0; lane < RAY_PACKET_SIZE; ++lane) {
+                    if (((mask >> lane) & 1u) && entries[lane] < result) {
+                        result = entries[lane];
+                    }
+                }
+                return result;
+            };
+
+            TraversalStack<int32_t> stack;
+            stack.push(m_root);
+            while (!stack.empty()) {
+                const int32_t index = stack.pop();
+                const Node& node = m_nodes[index];
+                if (node.isLeaf()) {
+                    func(index);
+                    continue;
+                }
+
+                // Children are tested against the limits as they are now, hits found since the parent was pushed count
+                uint32_t hit1 = packet.intersect(m_nodes[node.child1].bounds, entries1);
+                uint32_t hit2 = packet.intersect(m_nodes[node.child2].bounds, entries2);
+                if (hit1 && hit2) {
+                    if (nearest(hit1, entries1) <= nearest(hit2, entries2)) {
+                        stack.push(node.child2);
+                        stack.push(node.child1);
+                    }
+                    else {
+                        stack.push(node.child1);
+                        stack.push(node.child2);
+                    }
+                }
+                else if (hit1) {
+                    stack.push(node.child1);
+                }
+                else if (hit2) {
+                    stack.push(node.child2);
+                }
+            }
+        }
+
+        /**
+         * @brief Get the proxies created or re-inserted since the last clearMovedProxies().
+         * @details Destroyed proxies are left in place as AABB_TREE_NULL_NODE.
+         * @return The proxies.
+         */
+        const std::vector<int32_t>& getMovedProxies() const {
+            return m_moved;
+        }
+
+        /**
+         * @brief Find the proxies whose fat boxes overlap those of some moved proxies.
+         * @details Each pair is reported once across all the moved proxies, so the moved
+         *          list can be split into ranges searched on different threads. Pairs
+         *          come in search order; sort them for a stable order.
+         * @param proxies All or part of getMovedProxies().
+         * @param pairs Receives the pairs, appended.
+         */
+        void findPairs(std::span<const int32_t> proxies, std::vector<ProxyPair>& pairs) const;
+
+        /**
+         * @brief Forget which proxies moved, after their pairs were found.
+         */
+        void clearMovedProxies();
+
+        /**
+         * @brief Remove every proxy.
+         */
+        void clear();
+
+        /**
+         * @brief Get the number of live proxies.
+         * @return Proxies created and not destroyed.
+         */
+        std::size_t getProxyCount() const {
+            return m_proxy_count;
+        }
+
+        /**
+         * @brief Get the height of the tree.
+         * @return 0 for a single leaf, -1 for an empty tree.
+         */
+        int32_t getHeight() const {
+            return m_root == AABB_TREE_NULL_NODE ? -1 : m_nodes[m_root].height;
+        }
+
+        /**
+         * @brief Get the quality of the tree.
+         * @return Summed surface area of the internal nodes over the root's, lower is better.
+         */
+        float getAreaRatio() const;
+
+        /**
+         * @brief Check the links, heights and boxes of the tree.
+         * @return True if the tree is consistent.
+         */
+        bool validate() const;
+
+    private:
+        // Stack of nodes still to visit, on the call stack unless the tree is unusually deep
+        template<typename T>
+        class TraversalStack {
+        public:
+            bool empty() const {
+                return m_count == 0 && m_overflow.empty();
+            }
+            void push(const T& value) {
+                if (m_count < AABB_TREE_STACK_CAPACITY) {
+                    m_items[m_count++] = value;
+                }
+                else {
+                    m_overflow.push_back(value);
+                }
+            }
+            T pop() {
+                if (!m_overflow.empty()) {
+                    T value = m_overflow.back();
+                    m_overflow.pop_back();
+                    return value;
+                }
+                return m_items[--m_count];
+            }
+
+        private:
+            T m_items[AABB_TREE_STACK_CAPACITY];
+            std::size_t m_count = 0;
+            std::vector<T> m_overflow;
+        };
+
+        // Leaf or internal node, free nodes are chained through parent
+        struct Node {
+            AABB bounds;            // Fat box of a leaf, union of the children of an internal node
+            int32_t parent;         // Parent node, or next free node
+            int32_t child1;         // First child, AABB_TREE_NULL_NODE for a leaf
+            int32_t child2;         // Second child
+            int32_t height;         // 0 for a leaf, -1 for a free node
+            EntityID entity;        // Entity of a leaf
+            bool moved;             // Leaf is in m_moved
+
+            bool isLeaf() const {
+                return child1 == AABB_TREE_NULL_NODE;
+            }
+        };
+
+        // Take a node off the free list, growing the pool if needed
+        int32_t allocateNode();
+
+        // Put a node back on the free list
+        void freeNode(int32_t node);
+
+        // Link a leaf into the tree next to the sibling that costs the least area
+        void insertLeaf(int32_t leaf);
+
+        // Unlink a leaf from the tree
+        void removeLeaf(int32_t leaf);
+
+        // Swap a child of a node with a grandchild when that shrinks the boxes
+        void rotate(int32_t node);
+
+        // Recompute boxes and heights from a node up to the root, rotating on the way
+        void refitAncestors(int32_t node);
+
+        // Fat box of an object moved by displacement
+        AABB fatten(const AABB& bounds, const Vector3D& displacement) const;
+
+        std::vector<Node> m_nodes;      // Node pool, proxies index into it
+        std::vector<int32_t> m_moved;   // Proxies created or re-inserted since clearMovedProxies()
+        int32_t m_root;                 // Root node
+        int32_t m_free_list;            // First free node
+        std::size_t m_proxy_count;      // Live proxies
+        float m_margin;                 // Fat box margin
+    };
+
+} // end of namespace gam300
+
+#endif // __DYNAMIC_AABB_TREE_H__
@@ -0,0 +1,186 @@
+/**
+ * @file EntitySparseSet.h
+ * @brief Set of entity IDs with constant time membership tests.
+ * @details Keeps the entities in a dense vector for iteration and a paged sparse
+ *          array from entity ID to position in that vector, so adding, removing and
+ *          testing an entity never scans the set.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __ENTITY_SPARSE_SET_H__
+#define __ENTITY_SPARSE_SET_H__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "ECS_Variables.h"
+
+namespace gam300 {
+
+    /**
+     * @brief Sparse set of entity IDs.
+     * @details Entity IDs are never reused, so the sparse side is split into pages that
+     *          are only allocated for ID ranges holding members and released again when
+     *          their last member leaves. Removing swaps the last member into the hole,
+     *          so iteration order is not insertion order.
+     */
+    class EntitySparseSet {
+    public:
+        // Entity IDs covered by one page of the sparse array, a power of two
+        static constexpr std::size_t PAGE_SIZE = 4096;
+
+        using const_iterator = std::vector<EntityID>::const_iterator;
+
+        /**
+         * @brief Add an entity.
+         * @param entity_id The entity to add.
+         * @return False if the entity was already a member.
+         */
+        bool insert(EntityID entity_id) {
+            std::size_t page_index = entity_id / PAGE_SIZE;
+            if (page_index >= m_pages.size()) {
+                m_pages.resize(page_index + 1);
+            }
+
+            Page& page = m_pages[page_index];
+            if (!page.slots) {
+                page.slots = std::make_unique<uint32_t[]>(PAGE_SIZE);
+                std::fill(page.slots.get(), page.slots.get() + PAGE_SIZE, EMPTY_SLOT);
+            }
+
+            uint32_t& slot = page.slots[entity_id & (PAGE_SIZE - 1)];
+            if (slot != EMPTY_SLOT) {
+                return false;
+            }
+
+            slot = static_cast<uint32_t>(m_dense.size());
+            page.count++;
+            m_dense.push_back(entity_id);
+            m_version++;
+            return true;
+        }
+
+        /**
+         * @brief Remove an entity.
+         * @param entity_id The entity to remove.
+         * @return False if the entity was not a member.
+         */
+        bool erase(EntityID entity_id) {
+            uint32_t* slot = find_slot(entity_id);
+            if (!slot || *slot == EMPTY_SLOT) {
+                return false;
+            }
+
+            // Move the last member into the hole
+            uint32_t index = *slot;
+            EntityID last = m_dense.back();
+            m_dense[index] = last;
+            *find_slot(last) = index;
+            m_dense.pop_back();
+            *slot = EMPTY_SLOT;
+
+            Page& page = m_pages[entity_id / PAGE_SIZE];
+            if (--page.count == 0) {
+                page.slots.reset();
+            }
+            m_version++;
+            return true;
+        }
+
+        /**
+         * @brief Check whether an entity is a member.
+         * @param entity_id The entity to check.
+         * @return True if the entity is in the set.
+         */
+        bool contains(EntityID entity_id) const {
+            std::size_t page_index = entity_id / PAGE_SIZE;
+            return page_index < m_pages.size() && m_pages[page_index].slots &&
+                m_pages[page_index].slots[entity_id & (PAGE_SIZE - 1)] != EMPTY_SLOT;
+        }
+
+        /**
+         * @brief Get the position of an entity in the dense list.
+         * @param entity_id The entity to look up.
+         * @return Index into dense(), or size() if the entity is not a member.
+         */
+        std::size_t index_of(EntityID entity_id) const {
+            std::size_t page_index = entity_id / PAGE_SIZE;
+            if (page_index >= m_pages.size() || !m_pages[page_index].slots) {
+                return m_dense.size();
+            }
+            uint32_t slot = m_pages[page_index].slots[entity_id & (PAGE_SIZE - 1)];
+            return slot == EMPTY_SLOT ? m_dense.size() : slot;
+        }
+
+        /**
+         * @brief Remove every entity and release the sparse pages.
+         */
+        void clear() {
+            m_dense.clear();
+            m_pages.clear();
+            m_version++;
+        }
+
+        /**
+         * @brief Reorder the members.
+         * @tparam Compare Strict weak ordering of two entity IDs.
+         * @param compare The ordering.
+         */
+        template<typename Compare>
+        void sort(Compare compare) {
+            std::sort(m_dense.begin(), m_dense.end(), compare);
+            for (std::size_t i = 0; i < m_dense.size(); ++i) {
+                *find_slot(m_dense[i]) = static_cast<uint32_t>(i);
+            }
+            m_version++;
+        }
+
+        /**
+         * @brief Get a counter that changes whenever members are added, removed or reordered.
+         * @return The current version.
+         */
+        uint32_t version() const { return m_version; }
+
+        /**
+         * @brief Get the members as a contiguous list.
+         * @return The members in iteration order.
+         */
+        const std::vector<EntityID>& dense() const { return m_dense; }
+
+        std::size_t size() const { return m_dense.size(); }
+        bool empty() const { return m_dense.empty(); }
+        const_iterator begin() const { return m_dense.begin(); }
+        const_iterator end() const { return m_dense.end(); }
+
+    private:
+        // Marks a sparse slot with no member
+        static constexpr uint32_t EMPTY_SLOT = 0xFFFFFFFFu;
+
+        // Positions in m_dense for one range of entity IDs
+        struct Page {
+            std::unique_ptr<uint32_t[]> slots;  // PAGE_SIZE slots, EMPTY_SLOT if not a member
+            uint32_t count = 0;                 // Members in this page
+        };
+
+        // Get the sparse slot of an entity, nullptr if its page isn't allocated
+        uint32_t* find_slot(EntityID entity_id) {
+            std::size_t page_index = entity_id / PAGE_SIZE;
+            if (page_index >= m_pages.size() || !m_pages[page_index].slots) {
+                return nullptr;
+            }
+            return &m_pages[page_index].slots[entity_id & (PAGE_SIZE - 1)];
+        }
+
+        std::vector<EntityID> m_dense;          ///< Members, contiguous for iteration
+        std::vector<Page> m_pages;              ///< Sparse array from entity ID to position in m_dense
+        uint32_t m_version = 0;                 ///< Bumped by every change to m_dense
+    };
+
+} // end of namespace gam300
+#endif // __ENTITY_SPARSE_SET_H__
@@ -0,0 +1,125 @@
+/**
+ * @file InputEventQueue.h
+ * @brief Timestamped input events and the lock-free queue that carries them.
+ * @details Window callbacks push events as they arrive and the InputManager drains
+ *          them once per frame, so events keep their order inside a frame and their
+ *          arrival time can be compared with the time the simulation consumed them.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __INPUT_EVENT_QUEUE_H__
+#define __INPUT_EVENT_QUEUE_H__
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace gam300 {
+
+    // Number of events the queue holds between two updates, must be a power of two
+    constexpr std::size_t INPUT_EVENT_QUEUE_CAPACITY = 1024;
+
+    static_assert((INPUT_EVENT_QUEUE_CAPACITY & (INPUT_EVENT_QUEUE_CAPACITY - 1)) == 0,
+        "INPUT_EVENT_QUEUE_CAPACITY must be a power of two");
+
+    // Kinds of input event
+    enum class InputEventType : uint8_t {
+        KEY,            // code is a GLFW key code, action is GLFW_PRESS or GLFW_RELEASE
+        MOUSE_BUTTON,   // code is a GLFW mouse button, action is GLFW_PRESS or GLFW_RELEASE
+        CURSOR,         // x and y are the new cursor position
+        SCROLL          // x and y are the scroll offsets
+    };
+
+    // A single input event
+    struct InputEvent {
+        int64_t timestamp = 0;                      // Clock::now() when the event was received, in microseconds
+        double x = 0.0;                             // Cursor position or scroll offset
+        double y = 0.0;                             // Cursor position or scroll offset
+        int32_t code = 0;                           // Key or mouse button code
+        int32_t action = 0;                         // GLFW_PRESS or GLFW_RELEASE
+        InputEventType type = InputEventType::KEY;  // Kind of event
+    };
+
+    /**
+     * @brief Fixed size single-producer single-consumer queue of input events.
+     * @details The storage is allocated with the queue and never grows. One thread may
+     *          push while another pops without locking; events pushed while the queue
+     *          is full are dropped and counted.
+     */
+    class InputEventQueue {
+    public:
+        /**
+         * @brief Constructor for InputEventQueue.
+         */
+        InputEventQueue() : m_events{}, m_head(0), m_tail(0), m_dropped(0) {}
+
+        /**
+         * @brief Add an event to the back of the queue. Producer side only.
+         * @param event The event to add.
+         * @return False if the queue was full and the event was dropped.
+         */
+        bool push(const InputEvent& event) {
+            uint32_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_head.load(std::memory_order_acquire) >= INPUT_EVENT_QUEUE_CAPACITY) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            m_events[tail & (INPUT_EVENT_QUEUE_CAPACITY - 1)] = event;
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Take the event at the front of the queue. Consumer side only.
+         * @param event Receives the event.
+         * @return False if the queue was empty.
+         */
+        bool pop(InputEvent& event) {
+            uint32_t head = m_head.load(std::memory_order_relaxed);
+            if (head == m_tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            event = m_events[head & (INPUT_EVENT_QUEUE_CAPACITY - 1)];
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Discard every queued event. Consumer side only.
+         */
+        void clear() {
+            m_head.store(m_tail.load(std::memory_order_acquire), std::memory_order_release);
+        }
+
+        /**
+         * @brief Get the number of queued events.
+         * @return Number of events waiting to be popped.
+         */
+        std::size_t size() const {
+            return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Get and reset the number of events dropped because the queue was full.
+         * @return Number of dropped events since the last call.
+         */
+        uint32_t takeDropped() {
+            return m_dropped.exchange(0, std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<InputEvent, INPUT_EVENT_QUEUE_CAPACITY> m_events; // Ring buffer storage
+        alignas(64) std::atomic<uint32_t> m_head;   // Next event to pop, written by the consumer
+        alignas(64) std::atomic<uint32_t> m_tail;   // Next slot to push, written by the producer
+        std::atomic<uint32_t> m_dropped;            // Events lost to a full queue
+    };
+
+} // end of namespace gam300
+#endif // __INPUT_EVENT_QUEUE_H__
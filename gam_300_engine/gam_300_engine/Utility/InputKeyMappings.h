@@ -18,11 +18,10 @@
 namespace gam300 {
 
     /**
-     * @brief Convert a string key name to GLFW key code.
-     * @param keyName The name of the key (e.g., "A", "SPACE", "LEFT_SHIFT")
-     * @return The GLFW key code, or GLFW_KEY_UNKNOWN if not found.
+     * @brief Get the table of key names to GLFW key codes.
+     * @return Reference to the key name map.
      */
-    const std::unordered_map<std::string, int>& getKeyNameMap() {
+    inline const std::unordered_map<std::string, int>& getKeyNameMap() {
         static const std::unordered_map<std::string, int> keyMap = {
             // Letters
             {"A", GLFW_KEY_A}, {"B", GLFW_KEY_B}, {"C", GLFW_KEY_C}, {"D", GLFW_KEY_D},
@@ -60,11 +59,10 @@ namespace gam300 {
     }
 
     /**
-     * @brief Convert a string mouse button name to GLFW mouse button code.
-     * @param buttonName The name of the mouse button (e.g., "LEFT", "RIGHT", "MIDDLE")
-     * @return The GLFW mouse button code, or -1 if not found.
+     * @brief Get the table of mouse button names to GLFW mouse button codes.
+     * @return Reference to the mouse button name map.
      */
-    const std::unordered_map<std::string, int>& getMouseButtonNameMap() {
+    inline const std::unordered_map<std::string, int>& getMouseButtonNameMap() {
         static const std::unordered_map<std::string, int> buttonMap = {
             {"LEFT", GLFW_MOUSE_BUTTON_LEFT},
             {"RIGHT", GLFW_MOUSE_BUTTON_RIGHT},
@@ -79,5 +77,27 @@ namespace gam300 {
         return buttonMap;
     }
 
+    /**
+     * @brief Convert a string key name to GLFW key code.
+     * @param keyName The name of the key (e.g., "A", "SPACE", "LEFT_SHIFT")
+     * @return The GLFW key code, or GLFW_KEY_UNKNOWN if not found.
+     */
+    inline int getKeyCodeFromName(const std::string& keyName) {
+        const auto& keyMap = getKeyNameMap();
+        auto it = keyMap.find(keyName);
+        return it != keyMap.end() ? it->second : GLFW_KEY_UNKNOWN;
+    }
+
+    /**
+     * @brief Convert a string mouse button name to GLFW mouse button code.
+     * @param buttonName The name of the mouse button (e.g., "LEFT", "RIGHT", "MIDDLE")
+     * @return The GLFW mouse button code, or -1 if not found.
+     */
+    inline int getMouseButtonFromName(const std::string& buttonName) {
+        const auto& buttonMap = getMouseButtonNameMap();
+        auto it = buttonMap.find(buttonName);
+        return it != buttonMap.end() ? it->second : -1;
+    }
+
 } // end of namespace gam300
 #endif // __INPUT_KEY_MAPPINGS_H__
\ No newline at end of file
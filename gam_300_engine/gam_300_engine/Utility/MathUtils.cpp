@@ -10,14 +10,138 @@
  */
 
 #include "MathUtils.h"
-#include <random>
+#include "Simd.h"
+#include <atomic>
+#include <cstdint>
 #include <ctime>
 
 namespace gam300 {
 
-    // Static random engine
-    static std::mt19937 randomEngine;
-    static bool hasBeenSeeded = false;
+    // Seed of the streams of threads that haven't drawn a number yet, the clock until seedRandom() is called
+    static std::atomic<uint64_t> baseSeed(static_cast<uint64_t>(std::time(nullptr)));
+
+    // Threads whose stream was created, so each one starts from a different seed
+    static std::atomic<uint64_t> streamCount(0);
+
+    // Precision of the trig, exp and inverse square root functions
+    static std::atomic<MathPrecision> precisionMode(MathPrecision::EXACT);
+
+    namespace {
+
+        // pi/2 split so that j * PIO2_HI is exact for |j| < 2^16 (Cody-Waite reduction)
+        constexpr float TWO_OVER_PI = 0.636619772367581343f;
+        constexpr float PIO2_HI = 1.5703125f;
+        constexpr float PIO2_MID = 4.837512969970703125e-4f;
+        constexpr float PIO2_LO = 7.54978995489188216e-8f;
+
+        // Minimax sine and cosine on [-pi/4, pi/4] (Cephes sinf/cosf)
+        constexpr float SIN_C1 = -1.6666654611e-1f;
+        constexpr float SIN_C2 = 8.3321608736e-3f;
+        constexpr float SIN_C3 = -1.9515295891e-4f;
+        constexpr float COS_C1 = 4.166664568298827e-2f;
+        constexpr float COS_C2 = -1.388731625493765e-3f;
+        constexpr float COS_C3 = 2.443315711809948e-5f;
+
+        // atan(a) / a on [0, 1] as a polynomial in a^2 (Abramowitz and Stegun 4.4.49)
+        constexpr float ATAN_C2 = -0.3333314528f;
+        constexpr float ATAN_C4 = 0.1999355085f;
+        constexpr float ATAN_C6 = -0.1420889944f;
+        constexpr float ATAN_C8 = 0.1065626393f;
+        constexpr float ATAN_C10 = -0.0752896400f;
+        constexpr float ATAN_C12 = 0.0429096138f;
+        constexpr float ATAN_C14 = -0.0161657367f;
+        constexpr float ATAN_C16 = 0.0028662257f;
+
+        // exp(x) = 2^n * exp(r) with ln 2 split for an exact n * LN2_HI (Cephes expf)
+        constexpr float LOG2_E = 1.44269504088896341f;
+        constexpr float LN2_HI = 0.693359375f;
+        constexpr float LN2_LO = -2.12194440e-4f;
+        constexpr float EXP_MIN = -87.3f;
+        constexpr float EXP_MAX = 88.3f;
+        constexpr float EXP_C1 = 5.0000001201e-1f;
+        constexpr float EXP_C2 = 1.6666665459e-1f;
+        constexpr float EXP_C3 = 4.1665795894e-2f;
+        constexpr float EXP_C4 = 8.3334519073e-3f;
+        constexpr float EXP_C5 = 1.3981999507e-3f;
+        constexpr float EXP_C6 = 1.9875691500e-4f;
+
+        // The kernels are templates over float and simd::Lanes, so the batched remainder
+        // loops and the scalar functions give the same results as the SIMD lanes
+
+        // Sine and cosine: reduce to [-pi/4, pi/4] by whole quarter turns j, evaluate both
+        // polynomials, then swap and negate them by the quadrant j mod 4
+        template<typename V>
+        inline void sinCosKernel(V x, V& sine, V& cosine) {
+            using namespace simd;
+            V j = round_nearest(mul(x, broadcast<V>(TWO_OVER_PI)));
+            V y = sub(sub(sub(x, mul(j, broadcast<V>(PIO2_HI))), mul(j, broadcast<V>(PIO2_MID))), mul(j, broadcast<V>(PIO2_LO)));
+            V z = mul(y, y);
+
+            V sin_poly = add(broadcast<V>(SIN_C2), mul(z, broadcast<V>(SIN_C3)));
+            sin_poly = add(broadcast<V>(SIN_C1), mul(z, sin_poly));
+            sin_poly = add(y, mul(mul(y, z), sin_poly));
+
+            V cos_poly = add(broadcast<V>(COS_C2), mul(z, broadcast<V>(COS_C3)));
+            cos_poly = add(broadcast<V>(COS_C1), mul(z, cos_poly));
+            cos_poly = add(sub(broadcast<V>(1.0f), mul(broadcast<V>(0.5f), z)), mul(mul(z, z), cos_poly));
+
+            // j mod 2 and floor(j / 2) mod 2 with float arithmetic, AVX has no integer lanes
+            V half = round_nearest(sub(mul(j, broadcast<V>(0.5f)), broadcast<V>(0.25f)));
+            V odd = sub(j, add(half, half));
+            V quarter = round_nearest(sub(mul(half, broadcast<V>(0.5f)), broadcast<V>(0.25f)));
+            V high = sub(half, add(quarter, quarter));
+
+            // Quadrants 1 and 3 swap the polynomials, sine is negative in 2 and 3, cosine in 1 and 2
+            V swap = sub(odd, broadcast<V>(0.5f));
+            V sine_sign = sub(broadcast<V>(1.0f), add(high, high));
+            V cosine_negative = sub(add(odd, high), mul(broadcast<V>(2.0f), mul(odd, high)));
+            V cosine_sign = sub(broadcast<V>(1.0f), add(cosine_negative, cosine_negative));
+            sine = mul(select_positive(swap, cos_poly, sin_poly), sine_sign);
+            cosine = mul(select_positive(swap, sin_poly, cos_poly), cosine_sign);
+        }
+
+        // atan2: atan of the smaller over the larger magnitude, then mirrored into the right octant
+        template<typename V>
+        inline V atan2Kernel(V y, V x) {
+            using namespace simd;
+            V ax = abs(x);
+            V ay = abs(y);
+            V largest = max(ax, ay);
+            V ratio = select_positive(largest, div(min(ax, ay), largest), broadcast<V>(0.0f));
+            V s = mul(ratio, ratio);
+
+            V poly = add(broadcast<V>(ATAN_C14), mul(s, broadcast<V>(ATAN_C16)));
+            poly = add(broadcast<V>(ATAN_C12), mul(s, poly));
+            poly = add(broadcast<V>(ATAN_C10), mul(s, poly));
+            poly = add(broadcast<V>(ATAN_C8), mul(s, poly));
+            poly = add(broadcast<V>(ATAN_C6), mul(s, poly));
+            poly = add(broadcast<V>(ATAN_C4), mul(s, poly));
+            poly = add(broadcast<V>(ATAN_C2), mul(s, poly));
+            V angle = add(ratio, mul(mul(ratio, s), poly));
+
+            angle = select_positive(sub(ay, ax), sub(broadcast<V>(MathUtils::HALF_PI), angle), angle);
+            angle = select_positive(sub(broadcast<V>(0.0f), x), sub(broadcast<V>(MathUtils::PI), angle), angle);
+            return select_positive(sub(broadcast<V>(0.0f), y), sub(broadcast<V>(0.0f), angle), angle);
+        }
+
+        // exp: whole powers of two from the exponent bits, the rest from a polynomial on [-ln2/2, ln2/2]
+        template<typename V>
+        inline V expKernel(V x) {
+            using namespace simd;
+            x = min(max(x, broadcast<V>(EXP_MIN)), broadcast<V>(EXP_MAX));
+            V n = round_nearest(mul(x, broadcast<V>(LOG2_E)));
+            V r = sub(sub(x, mul(n, broadcast<V>(LN2_HI))), mul(n, broadcast<V>(LN2_LO)));
+
+            V poly = add(broadcast<V>(EXP_C5), mul(r, broadcast<V>(EXP_C6)));
+            poly = add(broadcast<V>(EXP_C4), mul(r, poly));
+            poly = add(broadcast<V>(EXP_C3), mul(r, poly));
+            poly = add(broadcast<V>(EXP_C2), mul(r, poly));
+            poly = add(broadcast<V>(EXP_C1), mul(r, poly));
+            V exp_r = add(add(mul(mul(poly, r), r), r), broadcast<V>(1.0f));
+            return mul(exp_r, pow2i(n));
+        }
+
+    } // anonymous namespace
 
     // Angle conversion
     float MathUtils::toRadians(float degrees) {
@@ -65,37 +189,224 @@ namespace gam300 {
 
     // Seed the random number generator
     void MathUtils::seedRandom(unsigned int seed) {
-        randomEngine.seed(seed);
-        hasBeenSeeded = true;
+        baseSeed.store(seed, std::memory_order_relaxed);
+        streamCount.store(1, std::memory_order_relaxed);
+        getRandomStream().seed(seed);
+    }
+
+    // The calling thread's stream
+    RandomStream& MathUtils::getRandomStream() {
+        // Seeded once, when the thread first draws, instead of checking on every call
+        thread_local RandomStream stream(baseSeed.load(std::memory_order_relaxed) +
+            streamCount.fetch_add(1, std::memory_order_relaxed) * 0x9e3779b97f4a7c15ull);
+        return stream;
     }
 
     // Random [0.0, 1.0)
     float MathUtils::random() {
-        if (!hasBeenSeeded) {
-            seedRandom(static_cast<unsigned int>(std::time(nullptr)));
-        }
-
-        std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
-        return distribution(randomEngine);
+        return getRandomStream().nextFloat();
     }
 
     // Random [min, max)
     float MathUtils::random(float min, float max) {
-        if (!hasBeenSeeded) {
-            seedRandom(static_cast<unsigned int>(std::time(nullptr)));
-        }
-
-        std::uniform_real_distribution<float> distribution(min, max);
-        return distribution(randomEngine);
+        return getRandomStream().nextFloat(min, max);
     }
 
     // Random integer [min, max]
     int MathUtils::randomInt(int min, int max) {
-        if (!hasBeenSeeded) {
-            seedRandom(static_cast<unsigned int>(std::time(nullptr)));
+        return getRandomStream().nextInt(min, max);
+    }
+
+    // Random [min, max) for every element
+    void MathUtils::fillUniform(std::span<float> out, float min, float max) {
+        getRandomStream().fillUniform(out, min, max);
+    }
+
+    // Set the precision of the trig, exp and inverse square root functions
+    void MathUtils::setPrecision(MathPrecision precision) {
+        precisionMode.store(precision, std::memory_order_relaxed);
+    }
+
+    // Get the precision of the trig, exp and inverse square root functions
+    MathPrecision MathUtils::getPrecision() {
+        return precisionMode.load(std::memory_order_relaxed);
+    }
+
+    // Parse a precision name
+    bool MathUtils::parsePrecision(const std::string& name, MathPrecision& precision) {
+        if (name == "exact") {
+            precision = MathPrecision::EXACT;
+            return true;
+        }
+        if (name == "fast") {
+            precision = MathPrecision::FAST;
+            return true;
+        }
+        return false;
+    }
+
+    // Wave functions
+    float MathUtils::sin(float radians) {
+        return getPrecision() == MathPrecision::FAST ? fastSin(radians) : std::sin(radians);
+    }
+
+    float MathUtils::cos(float radians) {
+        return getPrecision() == MathPrecision::FAST ? fastCos(radians) : std::cos(radians);
+    }
+
+    float MathUtils::tan(float radians) {
+        if (getPrecision() == MathPrecision::FAST) {
+            float sine, cosine;
+            fastSinCos(radians, sine, cosine);
+            return sine / cosine;
+        }
+        return std::tan(radians);
+    }
+
+    float MathUtils::sinDeg(float degrees) {
+        return sin(degrees * DEG_TO_RAD);
+    }
+
+    float MathUtils::cosDeg(float degrees) {
+        return cos(degrees * DEG_TO_RAD);
+    }
+
+    float MathUtils::tanDeg(float degrees) {
+        return tan(degrees * DEG_TO_RAD);
+    }
+
+    void MathUtils::sinCos(float radians, float& sine, float& cosine) {
+        if (getPrecision() == MathPrecision::FAST) {
+            fastSinCos(radians, sine, cosine);
+            return;
+        }
+        sine = std::sin(radians);
+        cosine = std::cos(radians);
+    }
+
+    float MathUtils::atan2(float y, float x) {
+        return getPrecision() == MathPrecision::FAST ? fastAtan2(y, x) : std::atan2(y, x);
+    }
+
+    float MathUtils::invSqrt(float value) {
+        return getPrecision() == MathPrecision::FAST ? fastInvSqrt(value) : 1.0f / std::sqrt(value);
+    }
+
+    float MathUtils::exp(float value) {
+        return getPrecision() == MathPrecision::FAST ? fastExp(value) : std::exp(value);
+    }
+
+    // Batched sine and cosine
+    void MathUtils::sinCos(std::span<const float> radians, std::span<float> sines, std::span<float> cosines) {
+        const std::size_t count = std::min(radians.size(), std::min(sines.size(), cosines.size()));
+        std::size_t i = 0;
+        if (getPrecision() == MathPrecision::FAST) {
+#if defined(GAM300_SIMD_LANES)
+            for (; i + simd::WIDTH <= count; i += simd::WIDTH) {
+                simd::Lanes sine, cosine;
+                sinCosKernel(simd::load(radians.data() + i), sine, cosine);
+                simd::store(sines.data() + i, sine);
+                simd::store(cosines.data() + i, cosine);
+            }
+#endif
+            for (; i < count; ++i) {
+                sinCosKernel(radians[i], sines[i], cosines[i]);
+            }
+            return;
+        }
+        for (; i < count; ++i) {
+            float x = radians[i];
+            sines[i] = std::sin(x);
+            cosines[i] = std::cos(x);
         }
+    }
+
+    // Batched atan2
+    void MathUtils::atan2(std::span<const float> y, std::span<const float> x, std::span<float> out) {
+        const std::size_t count = std::min(out.size(), std::min(y.size(), x.size()));
+        std::size_t i = 0;
+        if (getPrecision() == MathPrecision::FAST) {
+#if defined(GAM300_SIMD_LANES)
+            for (; i + simd::WIDTH <= count; i += simd::WIDTH) {
+                simd::store(out.data() + i, atan2Kernel(simd::load(y.data() + i), simd::load(x.data() + i)));
+            }
+#endif
+            for (; i < count; ++i) {
+                out[i] = atan2Kernel(y[i], x[i]);
+            }
+            return;
+        }
+        for (; i < count; ++i) {
+            out[i] = std::atan2(y[i], x[i]);
+        }
+    }
+
+    // Batched inverse square root
+    void MathUtils::invSqrt(std::span<const float> values, std::span<float> out) {
+        const std::size_t count = std::min(values.size(), out.size());
+        std::size_t i = 0;
+        if (getPrecision() == MathPrecision::FAST) {
+#if defined(GAM300_SIMD_LANES)
+            for (; i + simd::WIDTH <= count; i += simd::WIDTH) {
+                simd::store(out.data() + i, simd::rsqrt(simd::load(values.data() + i)));
+            }
+#endif
+            for (; i < count; ++i) {
+                out[i] = simd::rsqrt(values[i]);
+            }
+            return;
+        }
+        for (; i < count; ++i) {
+            out[i] = 1.0f / std::sqrt(values[i]);
+        }
+    }
+
+    // Batched exp
+    void MathUtils::exp(std::span<const float> values, std::span<float> out) {
+        const std::size_t count = std::min(values.size(), out.size());
+        std::size_t i = 0;
+        if (getPrecision() == MathPrecision::FAST) {
+#if defined(GAM300_SIMD_LANES)
+            for (; i + simd::WIDTH <= count; i += simd::WIDTH) {
+                simd::store(out.data() + i, expKernel(simd::load(values.data() + i)));
+            }
+#endif
+            for (; i < count; ++i) {
+                out[i] = expKernel(values[i]);
+            }
+            return;
+        }
+        for (; i < count; ++i) {
+            out[i] = std::exp(values[i]);
+        }
+    }
+
+    // Approximations
+    float MathUtils::fastSin(float radians) {
+        float sine, cosine;
+        sinCosKernel(radians, sine, cosine);
+        return sine;
+    }
+
+    float MathUtils::fastCos(float radians) {
+        float sine, cosine;
+        sinCosKernel(radians, sine, cosine);
+        return cosine;
+    }
+
+    void MathUtils::fastSinCos(float radians, float& sine, float& cosine) {
+        sinCosKernel(radians, sine, cosine);
+    }
+
+    float MathUtils::fastAtan2(float y, float x) {
+        return atan2Kernel(y, x);
+    }
+
+    float MathUtils::fastInvSqrt(float value) {
+        return simd::rsqrt(value);
+    }
 
-        std::uniform_int_distribution<int> distribution(min, max);
-        return distribution(randomEngine);
+    float MathUtils::fastExp(float value) {
+        return expKernel(value);
     }
 }
\ No newline at end of file
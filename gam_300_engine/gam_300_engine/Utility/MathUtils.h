@@ -15,9 +15,18 @@
 
 #include <cmath>
 #include <algorithm> // For min, max, clamp
+#include <span>
+#include <string>
+#include "Random.h"
 
 namespace gam300 {
 
+    // How the trig, exp and inverse square root functions are evaluated
+    enum class MathPrecision {
+        EXACT,      // The standard library, correctly rounded or close to it
+        FAST        // The polynomial approximations below, several times faster
+    };
+
     class MathUtils {
     public:
         // Mathematical constants
@@ -41,19 +50,45 @@ namespace gam300 {
         static float smoothStep(float a, float b, float t);
         static bool approximatelyEqual(float a, float b, float epsilon = EPSILON);
 
-        // Random number functions
-        static void seedRandom(unsigned int seed);
+        // Random number functions, each thread draws from its own stream
+        static void seedRandom(unsigned int seed);              // Seed this thread's stream and those of threads that haven't drawn yet
+        static RandomStream& getRandomStream();                 // This thread's stream
         static float random();                                  // Random [0.0, 1.0)
         static float random(float min, float max);              // Random [min, max)
         static int randomInt(int min, int max);                 // Random integer [min, max]
+        static void fillUniform(std::span<float> out, float min = 0.0f, float max = 1.0f); // Random [min, max) for every element
+
+        // Precision of the functions below, EXACT by default. Set it before worker threads use them.
+        static void setPrecision(MathPrecision precision);
+        static MathPrecision getPrecision();
+        static bool parsePrecision(const std::string& name, MathPrecision& precision); // "exact" or "fast"
 
-        // Wave functions
+        // Wave and exponential functions, following the precision setting
         static float sin(float radians);
         static float cos(float radians);
         static float tan(float radians);
         static float sinDeg(float degrees);
         static float cosDeg(float degrees);
         static float tanDeg(float degrees);
+        static void sinCos(float radians, float& sine, float& cosine);
+        static float atan2(float y, float x);
+        static float invSqrt(float value);                      // 1 / sqrt(value)
+        static float exp(float value);
+
+        // Batched versions, following the precision setting. Outputs may be the same arrays as the inputs.
+        static void sinCos(std::span<const float> radians, std::span<float> sines, std::span<float> cosines);
+        static void atan2(std::span<const float> y, std::span<const float> x, std::span<float> out);
+        static void invSqrt(std::span<const float> values, std::span<float> out);
+        static void exp(std::span<const float> values, std::span<float> out);
+
+        // Approximations used by FAST, whatever the precision setting. Worst errors
+        // against the double precision result, measured by the math benchmarks:
+        static float fastSin(float radians);                    // |radians| <= 8192: 9.2e-8 absolute
+        static float fastCos(float radians);                    // |radians| <= 8192: 9.2e-8 absolute
+        static void fastSinCos(float radians, float& sine, float& cosine);
+        static float fastAtan2(float y, float x);               // Finite inputs: 2.9e-7 radians; -0 counts as +0, atan2(0, 0) = 0
+        static float fastInvSqrt(float value);                  // value > 0: 2.5e-7 relative, depends on the CPU's estimate
+        static float fastExp(float value);                      // [-87, 88]: 8.0e-8 relative, clamped to [-87.3, 88.3]
     };
 
 } // end of namespace gam300
@@ -0,0 +1,242 @@
+/**
+ * @file Matrix4.h
+ * @brief Declaration of the Matrix4 class for the game engine.
+ * @details Provides 4x4 matrices for transforms. Elements are stored column-major,
+ *          the same layout as glm::mat4 and OpenGL, so conversions are plain copies
+ *          and a matrix can be uploaded as is. Multiplication uses SSE2 when the
+ *          engine is built for it.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __MATRIX4_H__
+#define __MATRIX4_H__
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <glm/ext/matrix_float4x4.hpp>
+#include "Quaternion.h"
+#include "Simd.h"
+#include "Vector3D.h"
+
+namespace gam300 {
+
+    class Matrix4 {
+    public:
+        // Elements in column-major order, element (row, col) is m[col * 4 + row]
+        alignas(16) float m[16];
+
+        // Constructors
+        Matrix4();                                  // Identity matrix
+        explicit Matrix4(const float* elements);    // Copy 16 elements in column-major order
+        explicit Matrix4(const glm::mat4& mat);     // Construct from a glm matrix
+
+        // Conversion to a glm matrix
+        glm::mat4 toGlm() const;
+
+        // Element access
+        float& operator()(int row, int col);
+        float operator()(int row, int col) const;
+        Vector3D getTranslation() const;            // Translation part of an affine matrix
+
+        // Multiplication, (a * b) applies b first and then a
+        Matrix4 operator*(const Matrix4& other) const;
+        Matrix4& operator*=(const Matrix4& other);
+
+        // Comparison
+        bool operator==(const Matrix4& other) const;
+        bool operator!=(const Matrix4& other) const;
+
+        // Matrix operations
+        Vector3D transformPoint(const Vector3D& point) const;          // Transform with w = 1, ignores the projective row
+        Vector3D transformDirection(const Vector3D& direction) const;  // Transform with w = 0
+        Matrix4 transpose() const;                                     // Swap rows and columns
+        Matrix4 inverse() const;                                       // Inverse, identity if the matrix is singular
+
+        // Construction from transforms
+        static Matrix4 translation(const Vector3D& offset);
+        static Matrix4 scale(const Vector3D& factors);
+        static Matrix4 rotation(const Quaternion& rotation);            // The quaternion must be unit length
+        static Matrix4 compose(const Vector3D& position, const Quaternion& rotation, const Vector3D& scale); // Translation * rotation * scale
+
+        // Common matrices
+        static const Matrix4 IDENTITY;
+    };
+
+    // Stream operators for easy printing
+    std::ostream& operator<<(std::ostream& os, const Matrix4& mat);
+
+    static_assert(sizeof(glm::mat4) == sizeof(Matrix4), "Matrix4 must match the glm::mat4 layout");
+
+    // Default constructor
+    inline Matrix4::Matrix4() : m{ 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f } {}
+
+    // Constructor from elements
+    inline Matrix4::Matrix4(const float* elements) {
+        std::memcpy(m, elements, sizeof(m));
+    }
+
+    // Construct from a glm matrix
+    inline Matrix4::Matrix4(const glm::mat4& mat) {
+        std::memcpy(m, &mat[0][0], sizeof(m));
+    }
+
+    // Convert to a glm matrix
+    inline glm::mat4 Matrix4::toGlm() const {
+        glm::mat4 result;
+        std::memcpy(&result[0][0], m, sizeof(m));
+        return result;
+    }
+
+    // Element access
+    inline float& Matrix4::operator()(int row, int col) {
+        return m[col * 4 + row];
+    }
+
+    // Element access
+    inline float Matrix4::operator()(int row, int col) const {
+        return m[col * 4 + row];
+    }
+
+    // Translation part
+    inline Vector3D Matrix4::getTranslation() const {
+        return Vector3D(m[12], m[13], m[14]);
+    }
+
+    // Multiplication
+    inline Matrix4 Matrix4::operator*(const Matrix4& other) const {
+        Matrix4 result;
+#if defined(GAM300_SIMD_SSE2)
+        // Each result column is this matrix's columns weighted by a column of other
+        __m128 c0 = _mm_load_ps(m);
+        __m128 c1 = _mm_load_ps(m + 4);
+        __m128 c2 = _mm_load_ps(m + 8);
+        __m128 c3 = _mm_load_ps(m + 12);
+        for (int col = 0; col < 4; ++col) {
+            const float* b = other.m + col * 4;
+            __m128 sum = _mm_mul_ps(c0, _mm_set1_ps(b[0]));
+            sum = _mm_add_ps(sum, _mm_mul_ps(c1, _mm_set1_ps(b[1])));
+            sum = _mm_add_ps(sum, _mm_mul_ps(c2, _mm_set1_ps(b[2])));
+            sum = _mm_add_ps(sum, _mm_mul_ps(c3, _mm_set1_ps(b[3])));
+            _mm_store_ps(result.m + col * 4, sum);
+        }
+#else
+        for (int col = 0; col < 4; ++col) {
+            const float* b = other.m + col * 4;
+            for (int row = 0; row < 4; ++row) {
+                result.m[col * 4 + row] = m[row] * b[0] + m[4 + row] * b[1] + m[8 + row] * b[2] + m[12 + row] * b[3];
+            }
+        }
+#endif
+        return result;
+    }
+
+    // Compound multiplication
+    inline Matrix4& Matrix4::operator*=(const Matrix4& other) {
+        *this = *this * other;
+        return *this;
+    }
+
+    // Equality
+    inline bool Matrix4::operator==(const Matrix4& other) const {
+        // Use epsilon comparison for floating-point values
+        const float EPSILON = 0.000001f;
+        for (int i = 0; i < 16; ++i) {
+            if (std::abs(m[i] - other.m[i]) >= EPSILON) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Inequality
+    inline bool Matrix4::operator!=(const Matrix4& other) const {
+        return !(*this == other);
+    }
+
+    // Transform a point
+    inline Vector3D Matrix4::transformPoint(const Vector3D& point) const {
+        return Vector3D(
+            m[0] * point.x + m[4] * point.y + m[8] * point.z + m[12],
+            m[1] * point.x + m[5] * point.y + m[9] * point.z + m[13],
+            m[2] * point.x + m[6] * point.y + m[10] * point.z + m[14]
+        );
+    }
+
+    // Transform a direction
+    inline Vector3D Matrix4::transformDirection(const Vector3D& direction) const {
+        return Vector3D(
+            m[0] * direction.x + m[4] * direction.y + m[8] * direction.z,
+            m[1] * direction.x + m[5] * direction.y + m[9] * direction.z,
+            m[2] * direction.x + m[6] * direction.y + m[10] * direction.z
+        );
+    }
+
+    // Transpose
+    inline Matrix4 Matrix4::transpose() const {
+        Matrix4 result;
+        for (int col = 0; col < 4; ++col) {
+            for (int row = 0; row < 4; ++row) {
+                result.m[row * 4 + col] = m[col * 4 + row];
+            }
+        }
+        return result;
+    }
+
+    // Translation matrix
+    inline Matrix4 Matrix4::translation(const Vector3D& offset) {
+        Matrix4 result;
+        result.m[12] = offset.x;
+        result.m[13] = offset.y;
+        result.m[14] = offset.z;
+        return result;
+    }
+
+    // Scale matrix
+    inline Matrix4 Matrix4::scale(const Vector3D& factors) {
+        Matrix4 result;
+        result.m[0] = factors.x;
+        result.m[5] = factors.y;
+        result.m[10] = factors.z;
+        return result;
+    }
+
+    // Rotation matrix
+    inline Matrix4 Matrix4::rotation(const Quaternion& rotation) {
+        return compose(Vector3D::ZERO, rotation, Vector3D::ONE);
+    }
+
+    // Translation * rotation * scale
+    inline Matrix4 Matrix4::compose(const Vector3D& position, const Quaternion& rotation, const Vector3D& scale) {
+        // TransformBatch::composeMatrices evaluates the same expressions
+        float xx = rotation.x * rotation.x, yy = rotation.y * rotation.y, zz = rotation.z * rotation.z;
+        float xy = rotation.x * rotation.y, xz = rotation.x * rotation.z, yz = rotation.y * rotation.z;
+        float wx = rotation.w * rotation.x, wy = rotation.w * rotation.y, wz = rotation.w * rotation.z;
+
+        Matrix4 result;
+        result.m[0] = (1.0f - 2.0f * (yy + zz)) * scale.x;
+        result.m[1] = (2.0f * (xy + wz)) * scale.x;
+        result.m[2] = (2.0f * (xz - wy)) * scale.x;
+        result.m[3] = 0.0f;
+        result.m[4] = (2.0f * (xy - wz)) * scale.y;
+        result.m[5] = (1.0f - 2.0f * (xx + zz)) * scale.y;
+        result.m[6] = (2.0f * (yz + wx)) * scale.y;
+        result.m[7] = 0.0f;
+        result.m[8] = (2.0f * (xz + wy)) * scale.z;
+        result.m[9] = (2.0f * (yz - wx)) * scale.z;
+        result.m[10] = (1.0f - 2.0f * (xx + yy)) * scale.z;
+        result.m[11] = 0.0f;
+        result.m[12] = position.x;
+        result.m[13] = position.y;
+        result.m[14] = position.z;
+        result.m[15] = 1.0f;
+        return result;
+    }
+
+} // end of namespace gam300
+
+#endif // __MATRIX4_H__
@@ -0,0 +1,38 @@
+/**
+ * @file Prefetch.h
+ * @brief Software prefetch hint.
+ * @details Lets loops that chase pointers ask for the data of an upcoming iteration
+ *          while the current one is processed.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __PREFETCH_H__
+#define __PREFETCH_H__
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
+namespace gam300 {
+
+    /**
+     * @brief Hint that the cache line holding an address will be read soon.
+     * @details Only a hint: it never faults, so null or stale addresses are harmless.
+     * @param address Address to fetch.
+     */
+    inline void prefetch(const void* address) {
+#if defined(_MSC_VER)
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 0, 3);
+#else
+        (void)address;
+#endif
+    }
+
+} // end of namespace gam300
+#endif // __PREFETCH_H__
@@ -0,0 +1,25 @@
+/**
+ * @file Quaternion.cpp
+ * @brief Implementation of the Quaternion class for the game engine.
+ * @details Defines the constant quaternions and the stream operator, the operations are inline in Quaternion.h.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Quaternion.h"
+
+namespace gam300 {
+
+    // Initialize static constants
+    const Quaternion Quaternion::IDENTITY(0.0f, 0.0f, 0.0f, 1.0f);
+
+    // Stream operator
+    std::ostream& operator<<(std::ostream& os, const Quaternion& quat) {
+        os << "Quaternion(" << quat.x << ", " << quat.y << ", " << quat.z << ", " << quat.w << ")";
+        return os;
+    }
+
+} // end of namespace gam300
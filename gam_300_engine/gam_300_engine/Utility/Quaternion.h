@@ -0,0 +1,224 @@
+/**
+ * @file Quaternion.h
+ * @brief Declaration of the Quaternion class for the game engine.
+ * @details Provides rotations as unit quaternions. The operations are defined inline
+ *          below the class like Vector3D, and conversions to and from glm::quat are
+ *          plain component copies.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __QUATERNION_H__
+#define __QUATERNION_H__
+
+#include <cmath>
+#include <iostream>
+#include <glm/ext/quaternion_float.hpp>
+#include "Vector3D.h"
+
+namespace gam300 {
+
+    class Quaternion {
+    public:
+        // Components, (x, y, z) is the vector part and w the scalar part
+        float x;
+        float y;
+        float z;
+        float w;
+
+        // Constructors
+        Quaternion();                                   // Identity rotation
+        Quaternion(float x, float y, float z, float w); // Constructor with components
+        explicit Quaternion(const glm::quat& quat);     // Construct from a glm quaternion
+
+        // Conversion to a glm quaternion
+        glm::quat toGlm() const;
+
+        // Construction from rotations
+        static Quaternion fromAxisAngle(const Vector3D& axis, float radians); // Rotation about an axis
+        static Quaternion fromEuler(const Vector3D& radians);  // Pitch (x), yaw (y), roll (z), same order as glm
+
+        // Composition, (a * b) rotates by b first and then by a
+        Quaternion operator*(const Quaternion& other) const;
+        Quaternion& operator*=(const Quaternion& other);
+
+        // Comparison
+        bool operator==(const Quaternion& other) const;
+        bool operator!=(const Quaternion& other) const;
+
+        // Quaternion operations
+        float magnitude() const;                    // Length of the quaternion
+        float magnitudeSquared() const;             // Squared length
+        Quaternion normalize() const;               // Returns a unit quaternion
+        void normalizeInPlace();                    // Normalizes this quaternion in place
+        Quaternion conjugate() const;               // Same as inverse() for unit quaternions
+        Quaternion inverse() const;                 // Reverse rotation
+        Vector3D rotate(const Vector3D& vec) const; // Rotate a vector, the quaternion must be unit length
+
+        // Static quaternion operations
+        static float dot(const Quaternion& a, const Quaternion& b);                    // Dot product
+        static Quaternion slerp(const Quaternion& a, const Quaternion& b, float t);    // Spherical interpolation along the shorter arc
+
+        // Common quaternions
+        static const Quaternion IDENTITY;
+    };
+
+    // Stream operators for easy printing
+    std::ostream& operator<<(std::ostream& os, const Quaternion& quat);
+
+    // Default constructor
+    inline Quaternion::Quaternion() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+
+    // Constructor with components
+    inline Quaternion::Quaternion(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+
+    // Construct from a glm quaternion
+    inline Quaternion::Quaternion(const glm::quat& quat) : x(quat.x), y(quat.y), z(quat.z), w(quat.w) {}
+
+    // Convert to a glm quaternion, which takes w first
+    inline glm::quat Quaternion::toGlm() const {
+        return glm::quat(w, x, y, z);
+    }
+
+    // Rotation about an axis
+    inline Quaternion Quaternion::fromAxisAngle(const Vector3D& axis, float radians) {
+        Vector3D unit = axis.normalize();
+        float half = radians * 0.5f;
+        float s = std::sin(half);
+        return Quaternion(unit.x * s, unit.y * s, unit.z * s, std::cos(half));
+    }
+
+    // Rotation from Euler angles
+    inline Quaternion Quaternion::fromEuler(const Vector3D& radians) {
+        float cx = std::cos(radians.x * 0.5f), sx = std::sin(radians.x * 0.5f);
+        float cy = std::cos(radians.y * 0.5f), sy = std::sin(radians.y * 0.5f);
+        float cz = std::cos(radians.z * 0.5f), sz = std::sin(radians.z * 0.5f);
+        return Quaternion(
+            sx * cy * cz - cx * sy * sz,
+            cx * sy * cz + sx * cy * sz,
+            cx * cy * sz - sx * sy * cz,
+            cx * cy * cz + sx * sy * sz
+        );
+    }
+
+    // Composition
+    inline Quaternion Quaternion::operator*(const Quaternion& other) const {
+        return Quaternion(
+            w * other.x + x * other.w + y * other.z - z * other.y,
+            w * other.y + y * other.w + z * other.x - x * other.z,
+            w * other.z + z * other.w + x * other.y - y * other.x,
+            w * other.w - x * other.x - y * other.y - z * other.z
+        );
+    }
+
+    // Compound composition
+    inline Quaternion& Quaternion::operator*=(const Quaternion& other) {
+        *this = *this * other;
+        return *this;
+    }
+
+    // Equality
+    inline bool Quaternion::operator==(const Quaternion& other) const {
+        // Use epsilon comparison for floating-point values
+        const float EPSILON = 0.000001f;
+        return (std::abs(x - other.x) < EPSILON &&
+            std::abs(y - other.y) < EPSILON &&
+            std::abs(z - other.z) < EPSILON &&
+            std::abs(w - other.w) < EPSILON);
+    }
+
+    // Inequality
+    inline bool Quaternion::operator!=(const Quaternion& other) const {
+        return !(*this == other);
+    }
+
+    // Magnitude (length)
+    inline float Quaternion::magnitude() const {
+        return std::sqrt(x * x + y * y + z * z + w * w);
+    }
+
+    // Squared magnitude
+    inline float Quaternion::magnitudeSquared() const {
+        return x * x + y * y + z * z + w * w;
+    }
+
+    // Normalize (return a unit quaternion)
+    inline Quaternion Quaternion::normalize() const {
+        float mag = magnitude();
+        if (mag > 0.0f) {
+            float invMag = 1.0f / mag;
+            return Quaternion(x * invMag, y * invMag, z * invMag, w * invMag);
+        }
+        return *this; // Return original quaternion if magnitude is zero
+    }
+
+    // Normalize in place
+    inline void Quaternion::normalizeInPlace() {
+        *this = normalize();
+    }
+
+    // Conjugate
+    inline Quaternion Quaternion::conjugate() const {
+        return Quaternion(-x, -y, -z, w);
+    }
+
+    // Inverse
+    inline Quaternion Quaternion::inverse() const {
+        float magSq = magnitudeSquared();
+        if (magSq > 0.0f) {
+            float invMagSq = 1.0f / magSq;
+            return Quaternion(-x * invMagSq, -y * invMagSq, -z * invMagSq, w * invMagSq);
+        }
+        return *this; // Return original quaternion if magnitude is zero
+    }
+
+    // Rotate a vector
+    inline Vector3D Quaternion::rotate(const Vector3D& vec) const {
+        // v' = v + w * t + q x t, with t = 2 (q x v)
+        Vector3D q(x, y, z);
+        Vector3D t = Vector3D::cross(q, vec) * 2.0f;
+        return vec + t * w + Vector3D::cross(q, t);
+    }
+
+    // Dot product
+    inline float Quaternion::dot(const Quaternion& a, const Quaternion& b) {
+        return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+    }
+
+    // Spherical linear interpolation
+    inline Quaternion Quaternion::slerp(const Quaternion& a, const Quaternion& b, float t) {
+        // Clamp t to [0, 1]
+        t = (t < 0.0f) ? 0.0f : ((t > 1.0f) ? 1.0f : t);
+
+        // q and -q are the same rotation, flip b to take the shorter arc
+        float cosTheta = dot(a, b);
+        Quaternion end = b;
+        if (cosTheta < 0.0f) {
+            end = Quaternion(-b.x, -b.y, -b.z, -b.w);
+            cosTheta = -cosTheta;
+        }
+
+        // Nearly parallel, fall back to a normalized linear interpolation
+        float wa = 1.0f - t;
+        float wb = t;
+        if (cosTheta < 0.9995f) {
+            float theta = std::acos(cosTheta);
+            float invSinTheta = 1.0f / std::sin(theta);
+            wa = std::sin(wa * theta) * invSinTheta;
+            wb = std::sin(wb * theta) * invSinTheta;
+        }
+
+        return Quaternion(
+            a.x * wa + end.x * wb,
+            a.y * wa + end.y * wb,
+            a.z * wa + end.z * wb,
+            a.w * wa + end.w * wb
+        ).normalize();
+    }
+
+} // end of namespace gam300
+
+#endif // __QUATERNION_H__
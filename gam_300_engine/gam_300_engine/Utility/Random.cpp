@@ -0,0 +1,229 @@
+/**
+ * @file Random.cpp
+ * @brief Implementation of the seedable random number streams for the game engine.
+ * @details The generators are xoshiro256** and xoshiro128+ by Blackman and Vigna,
+ *          seeded through splitmix64 so that any seed, including 0, gives a good
+ *          starting state.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Random.h"
+#include "Simd.h"
+#include <algorithm>
+
+namespace gam300 {
+
+    namespace {
+
+        // Scale from a 24-bit integer to [0, 1)
+        constexpr float UNIT_FLOAT_SCALE = 1.0f / 16777216.0f;
+
+        // Next value of a splitmix64 sequence
+        inline uint64_t splitMix64(uint64_t& state) {
+            uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            return z ^ (z >> 31);
+        }
+
+        inline uint64_t rotl64(uint64_t x, int k) {
+            return (x << k) | (x >> (64 - k));
+        }
+
+        inline uint32_t rotl32(uint32_t x, int k) {
+            return (x << k) | (x >> (32 - k));
+        }
+
+#if defined(GAM300_SIMD_SSE2)
+        // Four xoshiro128+ generators, one per 32-bit lane
+        struct LaneGroup {
+            __m128i s0, s1, s2, s3;
+
+            // Step every generator, returning their outputs
+            __m128i next() {
+                __m128i result = _mm_add_epi32(s0, s3);
+                __m128i t = _mm_slli_epi32(s1, 9);
+                s2 = _mm_xor_si128(s2, s0);
+                s3 = _mm_xor_si128(s3, s1);
+                s1 = _mm_xor_si128(s1, s2);
+                s0 = _mm_xor_si128(s0, s3);
+                s2 = _mm_xor_si128(s2, t);
+                s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+                return result;
+            }
+        };
+
+        // Turn generator outputs into floats in [min, min + range), same arithmetic as the scalar path
+        inline __m128 toUniform(__m128i bits, __m128 min, __m128 range) {
+            __m128 unit = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(bits, 8)), _mm_set1_ps(UNIT_FLOAT_SCALE));
+            return _mm_add_ps(min, _mm_mul_ps(range, unit));
+        }
+#endif
+
+    } // anonymous namespace
+
+    // Constructor
+    RandomStream::RandomStream(uint64_t seed) {
+        this->seed(seed);
+    }
+
+    // Restart the stream from a seed
+    void RandomStream::seed(uint64_t seed) {
+        m_seed = seed;
+        uint64_t mix = seed;
+        for (uint64_t& word : m_state) {
+            word = splitMix64(mix);
+        }
+        seedLanes(splitMix64(mix));
+    }
+
+    // Next 64 random bits, xoshiro256**
+    uint64_t RandomStream::nextU64() {
+        const uint64_t result = rotl64(m_state[1] * 5, 7) * 9;
+        const uint64_t t = m_state[1] << 17;
+
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = rotl64(m_state[3], 45);
+
+        return result;
+    }
+
+    // Next integer in [min, max]
+    int RandomStream::nextInt(int min, int max) {
+        // Range size minus one fits in 32 bits for any pair of ints
+        const uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(max) - static_cast<int64_t>(min)) + 1;
+
+        // Multiply-shift maps 32 random bits onto the range, rejecting the few
+        // values that would make the low end more likely
+        uint64_t product = static_cast<uint64_t>(nextU32()) * span;
+        uint32_t low = static_cast<uint32_t>(product);
+        if (low < span) {
+            const uint32_t threshold = static_cast<uint32_t>((uint64_t(1) << 32) % span);
+            while (low < threshold) {
+                product = static_cast<uint64_t>(nextU32()) * span;
+                low = static_cast<uint32_t>(product);
+            }
+        }
+        return static_cast<int>(static_cast<int64_t>(min) + static_cast<int64_t>(product >> 32));
+    }
+
+    // Fill an array with floats in [0, 1)
+    void RandomStream::fillUniform(std::span<float> out) {
+        fillUniform(out, 0.0f, 1.0f);
+    }
+
+    // Fill an array with floats in [min, max)
+    void RandomStream::fillUniform(std::span<float> out, float min, float max) {
+        const float range = max - min;
+        float* data = out.data();
+        const std::size_t count = out.size();
+        std::size_t i = 0;
+
+#if defined(GAM300_SIMD_SSE2)
+        LaneGroup a = {
+            _mm_load_si128(reinterpret_cast<const __m128i*>(m_lanes[0])),
+            _mm_load_si128(reinterpret_cast<const __m128i*>(m_lanes[1])),
+            _mm_load_si128(reinterpret_cast<const __m128i*>(m_lanes[2])),
+            _mm_load_si128(reinterpret_cast<const __m128i*>(m_lanes[3])) };
+        LaneGroup b = {
+            _mm_load_si128(reinterpret_cast<const __m128i*>(m_lanes[0] + 4)),
+            _mm_load_si128(reinterpret_cast<const __m128i*>(m_lanes[1] + 4)),
+            _mm_load_si128(reinterpret_cast<const __m128i*>(m_lanes[2] + 4)),
+            _mm_load_si128(reinterpret_cast<const __m128i*>(m_lanes[3] + 4)) };
+        const __m128 min_lanes = _mm_set1_ps(min);
+        const __m128 range_lanes = _mm_set1_ps(range);
+
+        for (; i + RANDOM_FILL_LANES <= count; i += RANDOM_FILL_LANES) {
+            _mm_storeu_ps(data + i, toUniform(a.next(), min_lanes, range_lanes));
+            _mm_storeu_ps(data + i + 4, toUniform(b.next(), min_lanes, range_lanes));
+        }
+        if (i < count) {
+            // The last step still advances every lane, the extra values are dropped
+            alignas(16) float tail[RANDOM_FILL_LANES];
+            _mm_store_ps(tail, toUniform(a.next(), min_lanes, range_lanes));
+            _mm_store_ps(tail + 4, toUniform(b.next(), min_lanes, range_lanes));
+            std::copy(tail, tail + (count - i), data + i);
+        }
+
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_lanes[0]), a.s0);
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_lanes[1]), a.s1);
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_lanes[2]), a.s2);
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_lanes[3]), a.s3);
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_lanes[0] + 4), b.s0);
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_lanes[1] + 4), b.s1);
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_lanes[2] + 4), b.s2);
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_lanes[3] + 4), b.s3);
+#else
+        for (; i < count; i += RANDOM_FILL_LANES) {
+            for (std::size_t lane = 0; lane < RANDOM_FILL_LANES; ++lane) {
+                uint32_t& s0 = m_lanes[0][lane];
+                uint32_t& s1 = m_lanes[1][lane];
+                uint32_t& s2 = m_lanes[2][lane];
+                uint32_t& s3 = m_lanes[3][lane];
+
+                // xoshiro128+
+                const uint32_t result = s0 + s3;
+                const uint32_t t = s1 << 9;
+                s2 ^= s0;
+                s3 ^= s1;
+                s1 ^= s2;
+                s0 ^= s3;
+                s2 ^= t;
+                s3 = rotl32(s3, 11);
+
+                if (i + lane < count) {
+                    float unit = static_cast<float>(static_cast<int32_t>(result >> 8)) * UNIT_FLOAT_SCALE;
+                    data[i + lane] = min + range * unit;
+                }
+            }
+        }
+#endif
+    }
+
+    // Skip 2^128 values of the main generator
+    void RandomStream::jump() {
+        static const uint64_t JUMP[] = { 0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull, 0xa9582618e03fc9aaull, 0x39abdc4529b1661cull };
+
+        uint64_t jumped[4] = { 0, 0, 0, 0 };
+        for (uint64_t polynomial : JUMP) {
+            for (int bit = 0; bit < 64; ++bit) {
+                if (polynomial & (uint64_t(1) << bit)) {
+                    for (int w = 0; w < 4; ++w) {
+                        jumped[w] ^= m_state[w];
+                    }
+                }
+                nextU64();
+            }
+        }
+        std::copy(jumped, jumped + 4, m_state);
+
+        // The lanes would otherwise repeat the unjumped stream's fills
+        uint64_t mix = m_state[0] ^ m_state[2];
+        seedLanes(splitMix64(mix));
+    }
+
+    // Reseed the fill lanes
+    void RandomStream::seedLanes(uint64_t value) {
+        uint64_t mix = value;
+        for (std::size_t lane = 0; lane < RANDOM_FILL_LANES; ++lane) {
+            for (std::size_t w = 0; w < 4; w += 2) {
+                uint64_t bits = splitMix64(mix);
+                m_lanes[w][lane] = static_cast<uint32_t>(bits);
+                m_lanes[w + 1][lane] = static_cast<uint32_t>(bits >> 32);
+            }
+            // An all-zero state would only ever produce zeros
+            if ((m_lanes[0][lane] | m_lanes[1][lane] | m_lanes[2][lane] | m_lanes[3][lane]) == 0) {
+                m_lanes[0][lane] = 1;
+            }
+        }
+    }
+
+} // end of namespace gam300
@@ -0,0 +1,134 @@
+/**
+ * @file Random.h
+ * @brief Declaration of the seedable random number streams for the game engine.
+ * @details A RandomStream is a small xoshiro256** generator with its own state, so
+ *          each thread or subsystem can own one and replay the same sequence from
+ *          the same seed. Bulk fills of floats use eight extra xoshiro128+ lanes
+ *          stepped together with SSE2, for particle and procedural workloads that
+ *          need thousands of values at once.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __RANDOM_H__
+#define __RANDOM_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace gam300 {
+
+    // Generators stepped together by RandomStream::fillUniform()
+    constexpr std::size_t RANDOM_FILL_LANES = 8;
+
+    /**
+     * @brief Deterministic stream of pseudo-random numbers.
+     * @details Not thread safe; give each thread its own stream, e.g. with
+     *          MathUtils::getRandomStream(). Two streams built from the same seed
+     *          produce the same values on every platform and instruction set.
+     */
+    class RandomStream {
+    public:
+        /**
+         * @brief Construct a stream.
+         * @param seed Any value, including 0.
+         */
+        explicit RandomStream(uint64_t seed = 0);
+
+        /**
+         * @brief Restart the stream from a seed.
+         * @param seed Any value, including 0.
+         */
+        void seed(uint64_t seed);
+
+        /**
+         * @brief Get the seed the stream was last started from.
+         * @return The seed.
+         */
+        uint64_t getSeed() const {
+            return m_seed;
+        }
+
+        /**
+         * @brief Next 64 random bits.
+         * @return Uniformly distributed value.
+         */
+        uint64_t nextU64();
+
+        /**
+         * @brief Next 32 random bits.
+         * @return Uniformly distributed value.
+         */
+        uint32_t nextU32() {
+            return static_cast<uint32_t>(nextU64() >> 32);
+        }
+
+        /**
+         * @brief Next float in [0, 1).
+         * @return Uniformly distributed value, a multiple of 2^-24.
+         */
+        float nextFloat() {
+            return static_cast<float>(nextU64() >> 40) * (1.0f / 16777216.0f);
+        }
+
+        /**
+         * @brief Next float in [min, max).
+         * @param min Lower bound.
+         * @param max Upper bound.
+         * @return Uniformly distributed value.
+         */
+        float nextFloat(float min, float max) {
+            return min + (max - min) * nextFloat();
+        }
+
+        /**
+         * @brief Next integer in [min, max].
+         * @details Unbiased for every range.
+         * @param min Lower bound.
+         * @param max Upper bound, must not be below min.
+         * @return Uniformly distributed value.
+         */
+        int nextInt(int min, int max);
+
+        /**
+         * @brief Fill an array with floats in [0, 1).
+         * @details Element i comes from lane i % RANDOM_FILL_LANES, so filling a
+         *          shorter array from the same state gives a prefix of the longer
+         *          fill. Uses the fill lanes only, nextU64() and friends are not
+         *          affected.
+         * @param out Receives the values.
+         */
+        void fillUniform(std::span<float> out);
+
+        /**
+         * @brief Fill an array with floats in [min, max).
+         * @param out Receives the values.
+         * @param min Lower bound.
+         * @param max Upper bound.
+         */
+        void fillUniform(std::span<float> out, float min, float max);
+
+        /**
+         * @brief Skip 2^128 values of the main generator.
+         * @details Streams made by seeding copies of a stream and jumping each one a
+         *          different number of times never overlap. The fill lanes are
+         *          reseeded from the jumped state.
+         */
+        void jump();
+
+    private:
+        // Reseed the fill lanes from a 64-bit value
+        void seedLanes(uint64_t value);
+
+        uint64_t m_state[4];                                        // xoshiro256** state
+        alignas(16) uint32_t m_lanes[4][RANDOM_FILL_LANES];         // xoshiro128+ state of each fill lane, word-major
+        uint64_t m_seed;                                            // Seed passed to seed()
+    };
+
+} // end of namespace gam300
+
+#endif // __RANDOM_H__
@@ -0,0 +1,174 @@
+/**
+ * @file RayPacket.cpp
+ * @brief Implementation of ray packets for the game engine.
+ * @details Contains implementations for the member functions declared in RayPacket.h
+ *          that aren't defined inline.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "RayPacket.h"
+#include <algorithm>
+#include <cmath>
+
+namespace gam300 {
+
+    namespace {
+
+        // Directions closer than this to the axis of a capsule, relative to their lengths, miss its side
+        constexpr float RAY_PARALLEL_EPSILON = 1e-6f;
+
+        // Distance along a ray to a sphere, 0 if the ray starts inside
+        bool raySphere(const Vector3D& origin, const Vector3D& direction, const Vector3D& center, float radius,
+            float max_distance, float& distance) {
+            const Vector3D m = origin - center;
+            const float c = Vector3D::dot(m, m) - radius * radius;
+            if (c <= 0.0f) {
+                distance = 0.0f;
+                return true;
+            }
+            const float b = Vector3D::dot(m, direction);
+            if (b > 0.0f) {
+                // Outside and heading away
+                return false;
+            }
+            const float a = Vector3D::dot(direction, direction);
+            const float discriminant = b * b - a * c;
+            if (discriminant < 0.0f || a <= 0.0f) {
+                return false;
+            }
+            const float t = (-b - std::sqrt(discriminant)) / a;
+            if (t > max_distance) {
+                return false;
+            }
+            distance = std::max(t, 0.0f);
+            return true;
+        }
+
+        // Distance along a ray to a capsule from start to end, 0 if the ray starts inside
+        bool rayCapsule(const Vector3D& origin, const Vector3D& direction, const Vector3D& start, const Vector3D& end,
+            float radius, float max_distance, float& distance) {
+            bool hit = false;
+            float best = max_distance;
+            float t = 0.0f;
+            if (raySphere(origin, direction, start, radius, best, t)) {
+                best = t;
+                hit = true;
+            }
+            if (raySphere(origin, direction, end, radius, best, t)) {
+                best = t;
+                hit = true;
+            }
+
+            // Side of the cylinder, the caps are the spheres above
+            const Vector3D axis = end - start;
+            const Vector3D m = origin - start;
+            const float axis_length_sq = Vector3D::dot(axis, axis);
+            const float md = Vector3D::dot(m, axis);
+            const float nd = Vector3D::dot(direction, axis);
+            const float nn = Vector3D::dot(direction, direction);
+            const float a = axis_length_sq * nn - nd * nd;
+            const float c = axis_length_sq * (Vector3D::dot(m, m) - radius * radius) - md * md;
+            if (c <= 0.0f && md >= 0.0f && md <= axis_length_sq) {
+                // Starts inside the cylinder
+                distance = 0.0f;
+                return true;
+            }
+            if (c > 0.0f && a > RAY_PARALLEL_EPSILON * axis_length_sq * nn) {
+                const float b = axis_length_sq * Vector3D::dot(m, direction) - nd * md;
+                const float discriminant = b * b - a * c;
+                if (discriminant >= 0.0f) {
+                    t = (-b - std::sqrt(discriminant)) / a;
+                    const float along = md + t * nd;
+                    if (t >= 0.0f && t <= best && along >= 0.0f && along <= axis_length_sq) {
+                        best = t;
+                        hit = true;
+                    }
+                }
+            }
+
+            if (hit) {
+                distance = best;
+            }
+            return hit;
+        }
+    }
+
+    // Load the rays
+    RayPacket::RayPacket(std::span<const Ray> rays) : count(std::min(rays.size(), RAY_PACKET_SIZE)) {
+        for (std::size_t i = 0; i < RAY_PACKET_SIZE; ++i) {
+            if (i < count) {
+                const Ray& ray = rays[i];
+                origin_x[i] = ray.origin.x;
+                origin_y[i] = ray.origin.y;
+                origin_z[i] = ray.origin.z;
+                inverse_x[i] = 1.0f / ray.direction.x;
+                inverse_y[i] = 1.0f / ray.direction.y;
+                inverse_z[i] = 1.0f / ray.direction.z;
+                radius[i] = ray.radius;
+                limit[i] = ray.max_distance;
+            }
+            else {
+                // A negative limit ends every interval before it starts
+                origin_x[i] = origin_y[i] = origin_z[i] = 0.0f;
+                inverse_x[i] = inverse_y[i] = inverse_z[i] = 1.0f;
+                radius[i] = 0.0f;
+                limit[i] = -1.0f;
+            }
+        }
+    }
+
+    // Sweep a sphere against a box, after Ericson's moving sphere against AABB test
+    bool RayPacket::sweepSphere(const AABB& box, const Vector3D& origin, const Vector3D& direction, float radius,
+        float max_distance, float& distance) {
+        // Entering the box grown by the radius is a lower bound, and exact where the sphere meets a face
+        const Vector3D inverse(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+        float t = 0.0f;
+        if (!box.fattened(radius).intersectRay(origin, inverse, max_distance, t)) {
+            return false;
+        }
+
+        // Which side of the box the center is on along each axis where it enters the grown box
+        const Vector3D p = origin + direction * t;
+        const float point[3] = { p.x, p.y, p.z };
+        const float lows[3] = { box.min.x, box.min.y, box.min.z };
+        const float highs[3] = { box.max.x, box.max.y, box.max.z };
+        int outside = 0;
+        float corner[3];
+        for (int axis = 0; axis < 3; ++axis) {
+            corner[axis] = point[axis] < lows[axis] ? lows[axis] : highs[axis];
+            outside += point[axis] < lows[axis] || point[axis] > highs[axis];
+        }
+        if (outside <= 1) {
+            distance = t;
+            return true;
+        }
+
+        // Near an edge or a corner the grown box is rounded: test the capsules along the edges there
+        const Vector3D vertex(corner[0], corner[1], corner[2]);
+        bool hit = false;
+        float best = max_distance;
+        for (int axis = 0; axis < 3; ++axis) {
+            const bool edge_axis = !(point[axis] < lows[axis] || point[axis] > highs[axis]);
+            if (outside == 2 && !edge_axis) {
+                continue;
+            }
+            // The edge leaving the vertex along this axis
+            float other[3] = { corner[0], corner[1], corner[2] };
+            other[axis] = corner[axis] == lows[axis] ? highs[axis] : lows[axis];
+            float edge_t = 0.0f;
+            if (rayCapsule(origin, direction, vertex, Vector3D(other[0], other[1], other[2]), radius, best, edge_t)) {
+                best = edge_t;
+                hit = true;
+            }
+        }
+        if (hit) {
+            distance = best;
+        }
+        return hit;
+    }
+
+} // end of namespace gam300
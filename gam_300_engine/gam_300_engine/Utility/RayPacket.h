@@ -0,0 +1,157 @@
+/**
+ * @file RayPacket.h
+ * @brief Declaration of rays, ray hits and ray packets for the game engine.
+ * @details Rays and sphere casts as submitted to batched scene queries, and the
+ *          packet that carries a few of them through a tree together: every
+ *          box is tested against all the rays of a packet at once with the lane
+ *          helpers in Simd.h. The packet test is defined inline below the class
+ *          so it can be inlined into tree traversals.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __RAY_PACKET_H__
+#define __RAY_PACKET_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "AABB.h"
+#include "ECS_Variables.h"
+#include "Simd.h"
+#include "Vector3D.h"
+
+namespace gam300 {
+
+    // Rays per packet, one per SIMD lane
+#if defined(GAM300_SIMD_LANES)
+    constexpr std::size_t RAY_PACKET_SIZE = simd::WIDTH;
+#else
+    constexpr std::size_t RAY_PACKET_SIZE = 4;
+#endif
+
+    // Ray, or sphere swept along it when radius is above zero
+    struct Ray {
+        Vector3D origin;                // Start of the ray, the center of the sphere
+        Vector3D direction;             // Distances are in multiples of its length
+        float max_distance = 1.0f;      // Length of the ray
+        float radius = 0.0f;            // Radius of the swept sphere, 0 for a thin ray
+    };
+
+    // First thing a ray hit
+    struct RayHit {
+        EntityID entity = INVALID_ENTITY_ID;    // INVALID_ENTITY_ID if nothing was hit
+        float distance = 0.0f;                  // Distance along the ray, 0 if it started inside
+    };
+
+    /**
+     * @brief Up to RAY_PACKET_SIZE rays tested against boxes together.
+     * @details Stored one array per component so each test is a handful of lane
+     *          operations. Each ray has a limit, the distance past which boxes are
+     *          ignored, that starts at its length and is shortened as hits are found.
+     */
+    class RayPacket {
+    public:
+        alignas(32) float origin_x[RAY_PACKET_SIZE];
+        alignas(32) float origin_y[RAY_PACKET_SIZE];
+        alignas(32) float origin_z[RAY_PACKET_SIZE];
+        alignas(32) float inverse_x[RAY_PACKET_SIZE];   // 1 / direction, infinite for zero components
+        alignas(32) float inverse_y[RAY_PACKET_SIZE];
+        alignas(32) float inverse_z[RAY_PACKET_SIZE];
+        alignas(32) float radius[RAY_PACKET_SIZE];
+        alignas(32) float limit[RAY_PACKET_SIZE];       // Negative for lanes without a ray
+        std::size_t count;                              // Rays in the packet
+
+        /**
+         * @brief Load up to RAY_PACKET_SIZE rays, the lanes past them stay empty.
+         * @param rays The rays.
+         */
+        explicit RayPacket(std::span<const Ray> rays);
+
+        /**
+         * @brief Test a box, grown by each ray's radius, against every ray.
+         * @details Uses the same slab test as AABB::intersectRay(), with each ray
+         *          ending at its limit.
+         * @param box The box.
+         * @param entries Receives the distance each ray enters the box at, 0 if it starts inside.
+         * @return Bit i set if ray i reaches the box.
+         */
+        uint32_t intersect(const AABB& box, float* entries) const;
+
+        /**
+         * @brief Sweep a sphere along a ray against a box.
+         * @details Exact: tests the box with rounded edges and corners that the
+         *          sphere's center touches the box on.
+         * @param box The box.
+         * @param origin Start of the ray.
+         * @param direction Direction of the ray, distances are in multiples of its length.
+         * @param radius Radius of the sphere.
+         * @param max_distance Length of the ray.
+         * @param distance Set to the distance at which the sphere first touches the box, 0 if it starts touching.
+         * @return True if the sphere touches the box within max_distance.
+         */
+        static bool sweepSphere(const AABB& box, const Vector3D& origin, const Vector3D& direction, float radius,
+            float max_distance, float& distance);
+    };
+
+    // Slab test of every lane, comparisons ordered so a NaN from 0 * infinity leaves the interval unchanged
+    inline uint32_t RayPacket::intersect(const AABB& box, float* entries) const {
+        uint32_t mask = 0;
+#if defined(GAM300_SIMD_LANES)
+        const simd::Lanes zero = simd::splat(0.0f);
+        for (std::size_t i = 0; i < RAY_PACKET_SIZE; i += simd::WIDTH) {
+            const simd::Lanes r = simd::load(radius + i);
+            simd::Lanes enter = zero;
+            simd::Lanes leave = simd::load(limit + i);
+
+            const simd::Lanes ox = simd::load(origin_x + i);
+            const simd::Lanes ix = simd::load(inverse_x + i);
+            simd::Lanes t1 = simd::mul(simd::sub(simd::sub(simd::splat(box.min.x), r), ox), ix);
+            simd::Lanes t2 = simd::mul(simd::sub(simd::add(simd::splat(box.max.x), r), ox), ix);
+            enter = simd::max(simd::min(t1, t2), enter);
+            leave = simd::min(simd::max(t1, t2), leave);
+
+            const simd::Lanes oy = simd::load(origin_y + i);
+            const simd::Lanes iy = simd::load(inverse_y + i);
+            t1 = simd::mul(simd::sub(simd::sub(simd::splat(box.min.y), r), oy), iy);
+            t2 = simd::mul(simd::sub(simd::add(simd::splat(box.max.y), r), oy), iy);
+            enter = simd::max(simd::min(t1, t2), enter);
+            leave = simd::min(simd::max(t1, t2), leave);
+
+            const simd::Lanes oz = simd::load(origin_z + i);
+            const simd::Lanes iz = simd::load(inverse_z + i);
+            t1 = simd::mul(simd::sub(simd::sub(simd::splat(box.min.z), r), oz), iz);
+            t2 = simd::mul(simd::sub(simd::add(simd::splat(box.max.z), r), oz), iz);
+            enter = simd::max(simd::min(t1, t2), enter);
+            leave = simd::min(simd::max(t1, t2), leave);
+
+            simd::store(entries + i, enter);
+            mask |= simd::mask_less_equal(enter, leave) << i;
+        }
+#else
+        for (std::size_t i = 0; i < RAY_PACKET_SIZE; ++i) {
+            float enter = 0.0f;
+            float leave = limit[i];
+            const float origins[3] = { origin_x[i], origin_y[i], origin_z[i] };
+            const float inverses[3] = { inverse_x[i], inverse_y[i], inverse_z[i] };
+            const float lows[3] = { box.min.x - radius[i], box.min.y - radius[i], box.min.z - radius[i] };
+            const float highs[3] = { box.max.x + radius[i], box.max.y + radius[i], box.max.z + radius[i] };
+            for (int axis = 0; axis < 3; ++axis) {
+                float t1 = (lows[axis] - origins[axis]) * inverses[axis];
+                float t2 = (highs[axis] - origins[axis]) * inverses[axis];
+                enter = simd::max(simd::min(t1, t2), enter);
+                leave = simd::min(simd::max(t1, t2), leave);
+            }
+            entries[i] = enter;
+            mask |= static_cast<uint32_t>(enter <= leave) << i;
+        }
+#endif
+        return mask;
+    }
+
+} // end of namespace gam300
+
+#endif // __RAY_PACKET_H__
@@ -0,0 +1,212 @@
+/**
+ * @file Simd.h
+ * @brief SIMD helpers shared by the batch math.
+ * @details Picks the widest instruction set the engine is built for and wraps it
+ *          in a small set of lane operations, so batch loops are written once for
+ *          AVX and SSE2. GAM300_SIMD_LANES is defined when the helpers exist; code
+ *          must keep a scalar path for targets without them. AVX is only used when
+ *          the compiler targets it (GAM300_ENABLE_AVX in the CMake build). The float
+ *          overloads let a kernel be written once as a template over float and Lanes.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __SIMD_H__
+#define __SIMD_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX__)
+#define GAM300_SIMD_AVX
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GAM300_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(GAM300_SIMD_AVX) || defined(GAM300_SIMD_SSE2)
+#define GAM300_SIMD_LANES
+#endif
+
+namespace gam300 {
+
+    namespace simd {
+
+#if defined(GAM300_SIMD_AVX)
+        // Eight floats per instruction
+        using Lanes = __m256;
+        constexpr std::size_t WIDTH = 8;
+
+        inline Lanes load(const float* p) { return _mm256_loadu_ps(p); }
+        inline void store(float* p, Lanes v) { _mm256_storeu_ps(p, v); }
+        inline Lanes splat(float v) { return _mm256_set1_ps(v); }
+        inline Lanes add(Lanes a, Lanes b) { return _mm256_add_ps(a, b); }
+        inline Lanes sub(Lanes a, Lanes b) { return _mm256_sub_ps(a, b); }
+        inline Lanes mul(Lanes a, Lanes b) { return _mm256_mul_ps(a, b); }
+        inline Lanes div(Lanes a, Lanes b) { return _mm256_div_ps(a, b); }
+        inline Lanes sqrt(Lanes a) { return _mm256_sqrt_ps(a); }
+        inline Lanes min(Lanes a, Lanes b) { return _mm256_min_ps(a, b); }
+        inline Lanes max(Lanes a, Lanes b) { return _mm256_max_ps(a, b); }
+        inline Lanes abs(Lanes a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+
+        // 1 / sqrt(a) from the hardware estimate and one Newton step
+        inline Lanes rsqrt(Lanes a) {
+            Lanes e = _mm256_rsqrt_ps(a);
+            Lanes half_a_ee = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), a), _mm256_mul_ps(e, e));
+            return _mm256_mul_ps(e, _mm256_sub_ps(_mm256_set1_ps(1.5f), half_a_ee));
+        }
+
+        // 2^n for whole numbers n in [-126, 127], AVX has no 256-bit integer shifts so each half is built with SSE2
+        inline Lanes pow2i(Lanes n) {
+            __m256i exponent = _mm256_cvtps_epi32(n);
+            __m128i low = _mm_slli_epi32(_mm_add_epi32(_mm256_castsi256_si128(exponent), _mm_set1_epi32(127)), 23);
+            __m128i high = _mm_slli_epi32(_mm_add_epi32(_mm256_extractf128_si256(exponent, 1), _mm_set1_epi32(127)), 23);
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_castsi128_ps(low)), _mm_castsi128_ps(high), 1);
+        }
+
+        // Lanes of 'value' where 'test' > 0, lanes of 'fallback' elsewhere
+        inline Lanes select_positive(Lanes test, Lanes value, Lanes fallback) {
+            Lanes mask = _mm256_cmp_ps(test, _mm256_setzero_ps(), _CMP_GT_OQ);
+            return _mm256_blendv_ps(fallback, value, mask);
+        }
+
+        // Bit i set where a[i] <= b[i], false for NaN
+        inline uint32_t mask_less_equal(Lanes a, Lanes b) {
+            return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LE_OQ)));
+        }
+#elif defined(GAM300_SIMD_SSE2)
+        // Four floats per instruction
+        using Lanes = __m128;
+        constexpr std::size_t WIDTH = 4;
+
+        inline Lanes load(const float* p) { return _mm_loadu_ps(p); }
+        inline void store(float* p, Lanes v) { _mm_storeu_ps(p, v); }
+        inline Lanes splat(float v) { return _mm_set1_ps(v); }
+        inline Lanes add(Lanes a, Lanes b) { return _mm_add_ps(a, b); }
+        inline Lanes sub(Lanes a, Lanes b) { return _mm_sub_ps(a, b); }
+        inline Lanes mul(Lanes a, Lanes b) { return _mm_mul_ps(a, b); }
+        inline Lanes div(Lanes a, Lanes b) { return _mm_div_ps(a, b); }
+        inline Lanes sqrt(Lanes a) { return _mm_sqrt_ps(a); }
+        inline Lanes min(Lanes a, Lanes b) { return _mm_min_ps(a, b); }
+        inline Lanes max(Lanes a, Lanes b) { return _mm_max_ps(a, b); }
+        inline Lanes abs(Lanes a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+
+        // 1 / sqrt(a) from the hardware estimate and one Newton step
+        inline Lanes rsqrt(Lanes a) {
+            Lanes e = _mm_rsqrt_ps(a);
+            Lanes half_a_ee = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), a), _mm_mul_ps(e, e));
+            return _mm_mul_ps(e, _mm_sub_ps(_mm_set1_ps(1.5f), half_a_ee));
+        }
+
+        // 2^n for whole numbers n in [-126, 127]
+        inline Lanes pow2i(Lanes n) {
+            __m128i exponent = _mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127));
+            return _mm_castsi128_ps(_mm_slli_epi32(exponent, 23));
+        }
+
+        // Lanes of 'value' where 'test' > 0, lanes of 'fallback' elsewhere
+        inline Lanes select_positive(Lanes test, Lanes value, Lanes fallback) {
+            Lanes mask = _mm_cmpgt_ps(test, _mm_setzero_ps());
+            return _mm_or_ps(_mm_and_ps(mask, value), _mm_andnot_ps(mask, fallback));
+        }
+
+        // Bit i set where a[i] <= b[i], false for NaN
+        inline uint32_t mask_less_equal(Lanes a, Lanes b) {
+            return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(a, b)));
+        }
+#endif
+
+#if defined(GAM300_SIMD_LANES)
+        // Round to the nearest whole number, for |a| < 2^22
+        inline Lanes round_nearest(Lanes a) {
+            Lanes magic = splat(12582912.0f);
+            return sub(add(a, magic), magic);
+        }
+#endif
+
+        // The same operations on single floats, so a kernel written as a template over
+        // the lane type runs its remainder loop with exactly the arithmetic of the lanes
+        inline float add(float a, float b) { return a + b; }
+        inline float sub(float a, float b) { return a - b; }
+        inline float mul(float a, float b) { return a * b; }
+        inline float div(float a, float b) { return a / b; }
+        inline float min(float a, float b) { return a < b ? a : b; }
+        inline float max(float a, float b) { return a > b ? a : b; }
+        inline float abs(float a) { return a < 0.0f ? -a : a; }
+        inline float select_positive(float test, float value, float fallback) { return test > 0.0f ? value : fallback; }
+
+        // Round to the nearest whole number, for |a| < 2^22
+        inline float round_nearest(float a) {
+            const float magic = 12582912.0f;
+            return (a + magic) - magic;
+        }
+
+        // 1 / sqrt(a), same precision as the lanes
+        inline float rsqrt(float a) {
+#if defined(GAM300_SIMD_SSE2)
+            float e = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a)));
+            return e * (1.5f - 0.5f * a * (e * e));
+#else
+            // Bit-level first guess, three Newton steps make up for it being coarser than the hardware estimate
+            uint32_t bits;
+            std::memcpy(&bits, &a, sizeof(bits));
+            bits = 0x5f375a86u - (bits >> 1);
+            float e;
+            std::memcpy(&e, &bits, sizeof(e));
+            e = e * (1.5f - 0.5f * a * (e * e));
+            e = e * (1.5f - 0.5f * a * (e * e));
+            return e * (1.5f - 0.5f * a * (e * e));
+#endif
+        }
+
+        // 2^n for whole numbers n in [-126, 127]
+        inline float pow2i(float n) {
+            uint32_t bits = static_cast<uint32_t>(static_cast<int32_t>(n) + 127) << 23;
+            float result;
+            std::memcpy(&result, &bits, sizeof(result));
+            return result;
+        }
+
+        /**
+         * @brief Broadcast a constant to the lane type of a kernel template.
+         * @tparam V float or Lanes.
+         * @param v The constant.
+         * @return v in every lane.
+         */
+        template<typename V>
+        inline V broadcast(float v);
+
+        template<>
+        inline float broadcast<float>(float v) { return v; }
+
+#if defined(GAM300_SIMD_LANES)
+        template<>
+        inline Lanes broadcast<Lanes>(float v) { return splat(v); }
+#endif
+
+        /**
+         * @brief Get the instruction set the lane helpers use.
+         * @return "AVX", "SSE2" or "scalar".
+         */
+        inline const char* instruction_set() {
+#if defined(GAM300_SIMD_AVX)
+            return "AVX";
+#elif defined(GAM300_SIMD_SSE2)
+            return "SSE2";
+#else
+            return "scalar";
+#endif
+        }
+
+    } // namespace simd
+
+} // end of namespace gam300
+
+#endif // __SIMD_H__
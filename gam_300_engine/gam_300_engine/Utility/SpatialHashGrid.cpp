@@ -0,0 +1,462 @@
+/**
+ * @file SpatialHashGrid.cpp
+ * @brief Implementation of the spatial hash grid for the game engine.
+ * @details Contains implementations for all member functions declared in SpatialHashGrid.h.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "SpatialHashGrid.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace gam300 {
+
+    namespace {
+
+        // Largest cell coordinate, positions further out share the outermost cells
+        constexpr float CELL_COORDINATE_LIMIT = 1073741824.0f;
+
+        // Empty cells kept on top of one per occupied cell before they are released
+        constexpr std::size_t MIN_EMPTY_CELLS_KEPT = 1024;
+
+        // Smallest hash table
+        constexpr std::size_t MIN_TABLE_SIZE = 16;
+
+        // Bucket of a cell in the hash table, before masking
+        inline uint32_t hashCell(int32_t x, int32_t y, int32_t z) {
+            uint32_t h = static_cast<uint32_t>(x) * 0x8da6b343u ^ static_cast<uint32_t>(y) * 0xd8163841u ^
+                static_cast<uint32_t>(z) * 0xcb1ab31fu;
+            // Spread the bits so neighbouring cells land in unrelated buckets
+            h ^= h >> 16;
+            h *= 0x85ebca6bu;
+            h ^= h >> 13;
+            h *= 0xc2b2ae35u;
+            h ^= h >> 16;
+            return h;
+        }
+
+        // Distance along one axis from a value to the span of a cell, 0 inside it
+        inline float axisGap(float value, int64_t cell, float cell_size) {
+            float low = static_cast<float>(cell) * cell_size;
+            float high = low + cell_size;
+            return value < low ? low - value : (value > high ? value - high : 0.0f);
+        }
+
+    } // anonymous namespace
+
+    // Constructor
+    SpatialHashGrid::SpatialHashGrid(float cell_size) : m_occupied_cells(0),
+        m_cell_size(cell_size > 0.0f ? cell_size : SPATIAL_HASH_DEFAULT_CELL_SIZE),
+        m_inverse_cell_size(1.0f / m_cell_size) {
+    }
+
+    // Change the cell edge length
+    void SpatialHashGrid::setCellSize(float cell_size) {
+        if (!(cell_size > 0.0f) || cell_size == m_cell_size) {
+            return;
+        }
+
+        // Entities in slot order, then bucketed again from scratch
+        std::vector<Entry> entries;
+        entries.reserve(m_slots.size());
+        for (const Slot& slot : m_slots) {
+            entries.push_back(m_cells[slot.cell].entries[slot.entry]);
+        }
+
+        m_cell_size = cell_size;
+        m_inverse_cell_size = 1.0f / cell_size;
+        m_cells.clear();
+        m_table.clear();
+        m_occupied_cells = 0;
+        for (std::size_t slot = 0; slot < entries.size(); ++slot) {
+            const Entry& entry = entries[slot];
+            addToCell(findOrAddCell(cellCoordinate(entry.x), cellCoordinate(entry.y), cellCoordinate(entry.z)), slot, entry);
+        }
+    }
+
+    // Add an entity or move it
+    bool SpatialHashGrid::setPosition(EntityID entity_id, const Vector3D& position) {
+        const Entry entry = { position.x, position.y, position.z, entity_id };
+        const int32_t x = cellCoordinate(position.x);
+        const int32_t y = cellCoordinate(position.y);
+        const int32_t z = cellCoordinate(position.z);
+
+        std::size_t slot = m_members.index_of(entity_id);
+        if (slot == m_slots.size()) {
+            m_members.insert(entity_id);
+            m_slots.push_back({ NO_CELL, 0 });
+            addToCell(findOrAddCell(x, y, z), slot, entry);
+            return true;
+        }
+
+        // Staying in the same cell only updates the stored position
+        Cell& current = m_cells[m_slots[slot].cell];
+        if (current.x == x && current.y == y && current.z == z) {
+            current.entries[m_slots[slot].entry] = entry;
+            return false;
+        }
+
+        removeFromCell(slot);
+        addToCell(findOrAddCell(x, y, z), slot, entry);
+        releaseEmptyCells();
+        return true;
+    }
+
+    // Get the position an entity was last given
+    bool SpatialHashGrid::getPosition(EntityID entity_id, Vector3D& position) const {
+        std::size_t slot = m_members.index_of(entity_id);
+        if (slot == m_slots.size()) {
+            return false;
+        }
+        const Entry& entry = m_cells[m_slots[slot].cell].entries[m_slots[slot].entry];
+        position = Vector3D(entry.x, entry.y, entry.z);
+        return true;
+    }
+
+    // Remove an entity
+    bool SpatialHashGrid::remove(EntityID entity_id) {
+        std::size_t slot = m_members.index_of(entity_id);
+        if (slot == m_slots.size()) {
+            return false;
+        }
+
+        removeFromCell(slot);
+
+        // The member set moves its last entity into the hole, the slots follow it
+        m_slots[slot] = m_slots.back();
+        m_slots.pop_back();
+        m_members.erase(entity_id);
+
+        releaseEmptyCells();
+        return true;
+    }
+
+    // Remove every entity
+    void SpatialHashGrid::clear() {
+        m_members.clear();
+        m_slots.clear();
+        m_cells.clear();
+        m_table.clear();
+        m_occupied_cells = 0;
+    }
+
+    // Find the entities within a distance of a point
+    void SpatialHashGrid::queryRadius(const Vector3D& center, float radius, std::vector<EntityID>& results) const {
+        results.clear();
+        if (!(radius >= 0.0f) || m_slots.empty()) {
+            return;
+        }
+
+        const float radius_squared = radius * radius;
+        auto search = [&center, radius_squared, &results](const Cell& cell) {
+            for (const Entry& entry : cell.entries) {
+                float dx = entry.x - center.x;
+                float dy = entry.y - center.y;
+                float dz = entry.z - center.z;
+                if (dx * dx + dy * dy + dz * dz <= radius_squared) {
+                    results.push_back(entry.entity);
+                }
+            }
+        };
+
+        const int32_t x0 = cellCoordinate(center.x - radius), x1 = cellCoordinate(center.x + radius);
+        const int32_t y0 = cellCoordinate(center.y - radius), y1 = cellCoordinate(center.y + radius);
+        const int32_t z0 = cellCoordinate(center.z - radius), z1 = cellCoordinate(center.z + radius);
+
+        // A sphere covering more cells than exist is cheaper to answer from the cell list
+        double covered = (x1 - x0 + 1.0) * (y1 - y0 + 1.0) * (z1 - z0 + 1.0);
+        if (covered > static_cast<double>(m_cells.size())) {
+            for (const Cell& cell : m_cells) {
+                if (cell.x >= x0 && cell.x <= x1 && cell.y >= y0 && cell.y <= y1 && cell.z >= z0 && cell.z <= z1) {
+                    search(cell);
+                }
+            }
+            return;
+        }
+
+        // Rows and cells of the covering box that the sphere misses are skipped
+        for (int64_t z = z0; z <= z1; ++z) {
+            float gap_z = axisGap(center.z, z, m_cell_size);
+            float gap_z_squared = gap_z * gap_z;
+            for (int64_t y = y0; y <= y1; ++y) {
+                float gap_y = axisGap(center.y, y, m_cell_size);
+                float gap_yz_squared = gap_z_squared + gap_y * gap_y;
+                if (gap_yz_squared > radius_squared) {
+                    continue;
+                }
+                for (int64_t x = x0; x <= x1; ++x) {
+                    float gap_x = axisGap(center.x, x, m_cell_size);
+                    if (gap_yz_squared + gap_x * gap_x > radius_squared) {
+                        continue;
+                    }
+                    uint32_t cell = findCell(static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(z));
+                    if (cell != NO_CELL) {
+                        search(m_cells[cell]);
+                    }
+                }
+            }
+        }
+    }
+
+    // Find the entities inside an axis-aligned box
+    void SpatialHashGrid::queryAABB(const Vector3D& min, const Vector3D& max, std::vector<EntityID>& results) const {
+        results.clear();
+        if (!(min.x <= max.x && min.y <= max.y && min.z <= max.z) || m_slots.empty()) {
+            return;
+        }
+
+        auto search = [&min, &max, &results](const Cell& cell) {
+            for (const Entry& entry : cell.entries) {
+                if (entry.x >= min.x && entry.x <= max.x && entry.y >= min.y && entry.y <= max.y &&
+                    entry.z >= min.z && entry.z <= max.z) {
+                    results.push_back(entry.entity);
+                }
+            }
+        };
+
+        const int32_t x0 = cellCoordinate(min.x), x1 = cellCoordinate(max.x);
+        const int32_t y0 = cellCoordinate(min.y), y1 = cellCoordinate(max.y);
+        const int32_t z0 = cellCoordinate(min.z), z1 = cellCoordinate(max.z);
+
+        double covered = (x1 - x0 + 1.0) * (y1 - y0 + 1.0) * (z1 - z0 + 1.0);
+        if (covered > static_cast<double>(m_cells.size())) {
+            for (const Cell& cell : m_cells) {
+                if (cell.x >= x0 && cell.x <= x1 && cell.y >= y0 && cell.y <= y1 && cell.z >= z0 && cell.z <= z1) {
+                    search(cell);
+                }
+            }
+            return;
+        }
+
+        for (int64_t z = z0; z <= z1; ++z) {
+            for (int64_t y = y0; y <= y1; ++y) {
+                for (int64_t x = x0; x <= x1; ++x) {
+                    uint32_t cell = findCell(static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(z));
+                    if (cell != NO_CELL) {
+                        search(m_cells[cell]);
+                    }
+                }
+            }
+        }
+    }
+
+    // Find the entities closest to a point
+    void SpatialHashGrid::queryNearest(const Vector3D& center, std::size_t count, std::vector<EntityID>& results) const {
+        results.clear();
+        if (count == 0 || m_slots.empty()) {
+            return;
+        }
+        const std::size_t wanted = std::min(count, m_slots.size());
+
+        // Max-heap of the best entities so far, ordered by squared distance then ID
+        std::vector<std::pair<float, EntityID>> best;
+        best.reserve(wanted);
+        std::size_t seen = 0;
+        auto search = [&center, &best, &seen, wanted](const Cell& cell) {
+            for (const Entry& entry : cell.entries) {
+                float dx = entry.x - center.x;
+                float dy = entry.y - center.y;
+                float dz = entry.z - center.z;
+                std::pair<float, EntityID> candidate(dx * dx + dy * dy + dz * dz, entry.entity);
+                if (best.size() < wanted) {
+                    best.push_back(candidate);
+                    std::push_heap(best.begin(), best.end());
+                }
+                else if (candidate < best.front()) {
+                    std::pop_heap(best.begin(), best.end());
+                    best.back() = candidate;
+                    std::push_heap(best.begin(), best.end());
+                }
+            }
+            seen += cell.entries.size();
+        };
+
+        const int64_t cx = cellCoordinate(center.x);
+        const int64_t cy = cellCoordinate(center.y);
+        const int64_t cz = cellCoordinate(center.z);
+        const int64_t limit = static_cast<int64_t>(CELL_COORDINATE_LIMIT);
+
+        for (int64_t ring = 0;; ++ring) {
+            // Once the searched cube spans more cells than exist, finish from the cell list
+            double side = 2.0 * static_cast<double>(ring) + 1.0;
+            if (side * side * side > static_cast<double>(m_cells.size())) {
+                for (const Cell& cell : m_cells) {
+                    int64_t distance = std::max({ std::abs(cell.x - cx), std::abs(cell.y - cy), std::abs(cell.z - cz) });
+                    if (distance >= ring) {
+                        search(cell);
+                    }
+                }
+                break;
+            }
+
+            // Cells of the shell at Chebyshev distance 'ring' from the center cell
+            for (int64_t z = cz - ring; z <= cz + ring; ++z) {
+                for (int64_t y = cy - ring; y <= cy + ring; ++y) {
+                    if (z < -limit || z > limit || y < -limit || y > limit) {
+                        continue;
+                    }
+                    bool face = z == cz - ring || z == cz + ring || y == cy - ring || y == cy + ring;
+                    int64_t step = face || ring == 0 ? 1 : 2 * ring;
+                    for (int64_t x = cx - ring; x <= cx + ring; x += step) {
+                        if (x < -limit || x > limit) {
+                            continue;
+                        }
+                        uint32_t cell = findCell(static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(z));
+                        if (cell != NO_CELL) {
+                            search(m_cells[cell]);
+                        }
+                    }
+                }
+            }
+
+            if (seen == m_slots.size()) {
+                break;
+            }
+            if (best.size() == wanted) {
+                // Nearest anything outside the searched cube can be, less a little for
+                // the rounding of the multiply that buckets positions
+                float gap = std::min({
+                    center.x - static_cast<float>(cx - ring) * m_cell_size, static_cast<float>(cx + ring + 1) * m_cell_size - center.x,
+                    center.y - static_cast<float>(cy - ring) * m_cell_size, static_cast<float>(cy + ring + 1) * m_cell_size - center.y,
+                    center.z - static_cast<float>(cz - ring) * m_cell_size, static_cast<float>(cz + ring + 1) * m_cell_size - center.z });
+                gap -= m_cell_size * 1e-5f;
+                if (gap > 0.0f && best.front().first <= gap * gap) {
+                    break;
+                }
+            }
+        }
+
+        std::sort_heap(best.begin(), best.end());
+        results.reserve(best.size());
+        for (const std::pair<float, EntityID>& candidate : best) {
+            results.push_back(candidate.second);
+        }
+    }
+
+    // Cell coordinate of a position along one axis
+    int32_t SpatialHashGrid::cellCoordinate(float value) const {
+        float cell = std::floor(value * m_inverse_cell_size);
+        // Written so NaN ends up in the lowest cell rather than in an undefined conversion
+        if (!(cell >= -CELL_COORDINATE_LIMIT)) {
+            cell = -CELL_COORDINATE_LIMIT;
+        }
+        if (cell > CELL_COORDINATE_LIMIT) {
+            cell = CELL_COORDINATE_LIMIT;
+        }
+        return static_cast<int32_t>(cell);
+    }
+
+    // Find a cell
+    uint32_t SpatialHashGrid::findCell(int32_t x, int32_t y, int32_t z) const {
+        if (m_table.empty()) {
+            return NO_CELL;
+        }
+        const std::size_t mask = m_table.size() - 1;
+        for (std::size_t i = hashCell(x, y, z) & mask;; i = (i + 1) & mask) {
+            const TableSlot& slot = m_table[i];
+            if (slot.cell == NO_CELL || (slot.x == x && slot.y == y && slot.z == z)) {
+                return slot.cell;
+            }
+        }
+    }
+
+    // Find a cell, creating it if it doesn't exist
+    uint32_t SpatialHashGrid::findOrAddCell(int32_t x, int32_t y, int32_t z) {
+        uint32_t found = findCell(x, y, z);
+        if (found != NO_CELL) {
+            return found;
+        }
+
+        // Keep the table at most half full so probes stay short
+        if ((m_cells.size() + 1) * 2 > m_table.size()) {
+            rebuildTable((m_cells.size() + 1) * 2);
+        }
+
+        uint32_t cell = static_cast<uint32_t>(m_cells.size());
+        m_cells.push_back({ x, y, z, {} });
+        const std::size_t mask = m_table.size() - 1;
+        std::size_t i = hashCell(x, y, z) & mask;
+        while (m_table[i].cell != NO_CELL) {
+            i = (i + 1) & mask;
+        }
+        m_table[i] = { x, y, z, cell };
+        return cell;
+    }
+
+    // Add an entity to a cell
+    void SpatialHashGrid::addToCell(uint32_t cell, std::size_t slot, const Entry& entry) {
+        std::vector<Entry>& entries = m_cells[cell].entries;
+        if (entries.empty()) {
+            m_occupied_cells++;
+        }
+        m_slots[slot] = { cell, static_cast<uint32_t>(entries.size()) };
+        entries.push_back(entry);
+    }
+
+    // Take an entity out of its cell
+    void SpatialHashGrid::removeFromCell(std::size_t slot) {
+        const Slot removed = m_slots[slot];
+        std::vector<Entry>& entries = m_cells[removed.cell].entries;
+
+        // Move the cell's last entity into the hole
+        if (removed.entry + 1 != entries.size()) {
+            entries[removed.entry] = entries.back();
+            m_slots[m_members.index_of(entries[removed.entry].entity)].entry = removed.entry;
+        }
+        entries.pop_back();
+        if (entries.empty()) {
+            m_occupied_cells--;
+        }
+    }
+
+    // Rebuild the hash table
+    void SpatialHashGrid::rebuildTable(std::size_t min_capacity) {
+        std::size_t capacity = MIN_TABLE_SIZE;
+        while (capacity < min_capacity) {
+            capacity *= 2;
+        }
+
+        m_table.assign(capacity, { 0, 0, 0, NO_CELL });
+        const std::size_t mask = capacity - 1;
+        for (std::size_t cell = 0; cell < m_cells.size(); ++cell) {
+            const Cell& current = m_cells[cell];
+            std::size_t i = hashCell(current.x, current.y, current.z) & mask;
+            while (m_table[i].cell != NO_CELL) {
+                i = (i + 1) & mask;
+            }
+            m_table[i] = { current.x, current.y, current.z, static_cast<uint32_t>(cell) };
+        }
+    }
+
+    // Drop the empty cells once they outnumber the occupied ones
+    void SpatialHashGrid::releaseEmptyCells() {
+        if (m_cells.size() - m_occupied_cells <= m_occupied_cells + MIN_EMPTY_CELLS_KEPT) {
+            return;
+        }
+
+        // Pack the occupied cells to the front, remembering where each went
+        std::vector<uint32_t> moved_to(m_cells.size(), NO_CELL);
+        std::size_t kept = 0;
+        for (std::size_t cell = 0; cell < m_cells.size(); ++cell) {
+            if (m_cells[cell].entries.empty()) {
+                continue;
+            }
+            if (cell != kept) {
+                m_cells[kept] = std::move(m_cells[cell]);
+            }
+            moved_to[cell] = static_cast<uint32_t>(kept++);
+        }
+        m_cells.erase(m_cells.begin() + kept, m_cells.end());
+
+        for (Slot& slot : m_slots) {
+            slot.cell = moved_to[slot.cell];
+        }
+        rebuildTable(m_cells.size() * 2);
+    }
+
+} // end of namespace gam300
@@ -0,0 +1,203 @@
+/**
+ * @file SpatialHashGrid.h
+ * @brief Declaration of the spatial hash grid for the game engine.
+ * @details Buckets entity positions into cubic cells found through a hash table of
+ *          cell coordinates, so proximity queries only look at the cells they
+ *          overlap instead of every entity. Moving an entity within its cell only
+ *          rewrites its stored position; it changes bucket only when it crosses into
+ *          another cell.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __SPATIAL_HASH_GRID_H__
+#define __SPATIAL_HASH_GRID_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ECS_Variables.h"
+#include "EntitySparseSet.h"
+#include "Vector3D.h"
+
+namespace gam300 {
+
+    // Cell edge length of a grid built without one
+    constexpr float SPATIAL_HASH_DEFAULT_CELL_SIZE = 4.0f;
+
+    /**
+     * @brief Uniform grid of entity positions in a hash table.
+     * @details Only cells holding entities take memory, so the world has no bounds.
+     *          Each cell keeps its entities' positions next to their IDs in one
+     *          array, so a query reads a few contiguous runs of memory. Cells that
+     *          empty out are kept for entities moving back in and released in bulk
+     *          once they outnumber the occupied ones. Query results come in no
+     *          particular order, apart from queryNearest(). Not thread safe for
+     *          writes; any number of threads may query at once between writes.
+     */
+    class SpatialHashGrid {
+    public:
+        /**
+         * @brief Construct an empty grid.
+         * @param cell_size Cell edge length, ideally about the radius of typical queries.
+         */
+        explicit SpatialHashGrid(float cell_size = SPATIAL_HASH_DEFAULT_CELL_SIZE);
+
+        /**
+         * @brief Change the cell edge length, re-bucketing every entity.
+         * @param cell_size New edge length, ignored unless positive.
+         */
+        void setCellSize(float cell_size);
+
+        /**
+         * @brief Get the cell edge length.
+         * @return The edge length.
+         */
+        float getCellSize() const {
+            return m_cell_size;
+        }
+
+        /**
+         * @brief Add an entity or move it to a new position.
+         * @param entity_id The entity.
+         * @param position Its position.
+         * @return True if the entity was added or changed cell, false if it stayed in its cell.
+         */
+        bool setPosition(EntityID entity_id, const Vector3D& position);
+
+        /**
+         * @brief Get the position an entity was last given.
+         * @param entity_id The entity.
+         * @param position Receives the position.
+         * @return False if the entity isn't in the grid.
+         */
+        bool getPosition(EntityID entity_id, Vector3D& position) const;
+
+        /**
+         * @brief Remove an entity.
+         * @param entity_id The entity.
+         * @return False if the entity wasn't in the grid.
+         */
+        bool remove(EntityID entity_id);
+
+        /**
+         * @brief Check whether an entity is in the grid.
+         * @param entity_id The entity.
+         * @return True if it is.
+         */
+        bool contains(EntityID entity_id) const {
+            return m_members.contains(entity_id);
+        }
+
+        /**
+         * @brief Remove every entity and release the cells.
+         */
+        void clear();
+
+        /**
+         * @brief Get the number of entities.
+         * @return Entities in the grid.
+         */
+        std::size_t size() const {
+            return m_slots.size();
+        }
+
+        /**
+         * @brief Get the number of cells holding at least one entity.
+         * @return Occupied cells.
+         */
+        std::size_t getCellCount() const {
+            return m_occupied_cells;
+        }
+
+        /**
+         * @brief Find the entities within a distance of a point.
+         * @param center Center of the sphere.
+         * @param radius Distance, entities exactly on the surface are included.
+         * @param results Replaced with the entities found.
+         */
+        void queryRadius(const Vector3D& center, float radius, std::vector<EntityID>& results) const;
+
+        /**
+         * @brief Find the entities inside an axis-aligned box.
+         * @param min Smallest corner.
+         * @param max Largest corner, entities on the faces are included.
+         * @param results Replaced with the entities found.
+         */
+        void queryAABB(const Vector3D& min, const Vector3D& max, std::vector<EntityID>& results) const;
+
+        /**
+         * @brief Find the entities closest to a point.
+         * @details Searches outwards one shell of cells at a time and stops as soon as
+         *          no unsearched cell can hold anything closer than the k-th entity
+         *          found. Ties in distance go to the lower entity ID.
+         * @param center The point.
+         * @param count Number of entities wanted.
+         * @param results Replaced with up to count entities, nearest first.
+         */
+        void queryNearest(const Vector3D& center, std::size_t count, std::vector<EntityID>& results) const;
+
+    private:
+        // Entity in a cell, with the position it was last given
+        struct Entry {
+            float x, y, z;
+            EntityID entity;
+        };
+
+        // Coordinates of a cell and the entities in it
+        struct Cell {
+            int32_t x, y, z;
+            std::vector<Entry> entries;
+        };
+
+        // Hash table slot pointing at a cell
+        struct TableSlot {
+            int32_t x, y, z;
+            uint32_t cell;
+        };
+
+        // Where each entity is stored
+        struct Slot {
+            uint32_t cell;
+            uint32_t entry;
+        };
+
+        // Cell coordinate of a position along one axis
+        int32_t cellCoordinate(float value) const;
+
+        // Find a cell, returning NO_CELL if it doesn't exist
+        uint32_t findCell(int32_t x, int32_t y, int32_t z) const;
+
+        // Find a cell, creating it if it doesn't exist
+        uint32_t findOrAddCell(int32_t x, int32_t y, int32_t z);
+
+        // Add an entity to a cell, recording where it went in its slot
+        void addToCell(uint32_t cell, std::size_t slot, const Entry& entry);
+
+        // Take an entity out of its cell
+        void removeFromCell(std::size_t slot);
+
+        // Rebuild the hash table at a size fitting the cells
+        void rebuildTable(std::size_t min_capacity);
+
+        // Drop the empty cells once they outnumber the occupied ones
+        void releaseEmptyCells();
+
+        // Empty hash table slot and missing cell
+        static constexpr uint32_t NO_CELL = UINT32_MAX;
+
+        EntitySparseSet m_members;          // Entities in the grid, dense index is the slot
+        std::vector<Slot> m_slots;          // Cell and entry of each member
+        std::vector<Cell> m_cells;          // Cells that have held entities, some may be empty
+        std::vector<TableSlot> m_table;     // Open addressed hash table of m_cells, a power of two in size
+        std::size_t m_occupied_cells;       // Cells holding at least one entity
+        float m_cell_size;                  // Cell edge length
+        float m_inverse_cell_size;          // 1 / m_cell_size
+    };
+
+} // end of namespace gam300
+
+#endif // __SPATIAL_HASH_GRID_H__
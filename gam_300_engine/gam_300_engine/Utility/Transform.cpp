@@ -0,0 +1,114 @@
+/**
+ * @file Transform.cpp
+ * @brief Implementation of the Transform class and batched transform composition.
+ * @details Defines the constant transforms and the TransformBatch operations. The
+ *          SIMD composition computes each matrix element for a group of transforms
+ *          in one register, then transposes the groups into per-matrix columns.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "Transform.h"
+#include "Simd.h"
+
+namespace gam300 {
+
+    // Initialize static constants
+    const Transform Transform::IDENTITY;
+
+    namespace {
+
+#if defined(GAM300_SIMD_SSE2)
+        // Write column 'column' of four matrices, row register r holds element (r, column) of each matrix
+        inline void storeColumn(Matrix4* out, int column, __m128 row0, __m128 row1, __m128 row2, __m128 row3) {
+            _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+            _mm_store_ps(out[0].m + column * 4, row0);
+            _mm_store_ps(out[1].m + column * 4, row1);
+            _mm_store_ps(out[2].m + column * 4, row2);
+            _mm_store_ps(out[3].m + column * 4, row3);
+        }
+#endif
+
+#if defined(GAM300_SIMD_AVX)
+        // Write column 'column' of eight matrices, as two groups of four
+        inline void storeColumn(Matrix4* out, int column, __m256 row0, __m256 row1, __m256 row2, __m256 row3) {
+            storeColumn(out, column, _mm256_castps256_ps128(row0), _mm256_castps256_ps128(row1),
+                _mm256_castps256_ps128(row2), _mm256_castps256_ps128(row3));
+            storeColumn(out + 4, column, _mm256_extractf128_ps(row0, 1), _mm256_extractf128_ps(row1, 1),
+                _mm256_extractf128_ps(row2, 1), _mm256_extractf128_ps(row3, 1));
+        }
+#endif
+
+    } // anonymous namespace
+
+    // Build the matrices of transforms stored as component arrays
+    void TransformBatch::composeMatrices(ConstVector3Array positions, ConstQuaternionArray rotations,
+        ConstVector3Array scales, Matrix4* out, std::size_t count) {
+        std::size_t i = 0;
+#if defined(GAM300_SIMD_LANES)
+        simd::Lanes zero = simd::splat(0.0f);
+        simd::Lanes one = simd::splat(1.0f);
+        simd::Lanes two = simd::splat(2.0f);
+        for (; i + simd::WIDTH <= count; i += simd::WIDTH) {
+            simd::Lanes x = simd::load(rotations.x + i);
+            simd::Lanes y = simd::load(rotations.y + i);
+            simd::Lanes z = simd::load(rotations.z + i);
+            simd::Lanes w = simd::load(rotations.w + i);
+
+            // Same expressions as Matrix4::compose
+            simd::Lanes xx = simd::mul(x, x), yy = simd::mul(y, y), zz = simd::mul(z, z);
+            simd::Lanes xy = simd::mul(x, y), xz = simd::mul(x, z), yz = simd::mul(y, z);
+            simd::Lanes wx = simd::mul(w, x), wy = simd::mul(w, y), wz = simd::mul(w, z);
+
+            simd::Lanes sx = simd::load(scales.x + i);
+            simd::Lanes sy = simd::load(scales.y + i);
+            simd::Lanes sz = simd::load(scales.z + i);
+
+            storeColumn(out + i, 0,
+                simd::mul(simd::sub(one, simd::mul(two, simd::add(yy, zz))), sx),
+                simd::mul(simd::mul(two, simd::add(xy, wz)), sx),
+                simd::mul(simd::mul(two, simd::sub(xz, wy)), sx),
+                zero);
+            storeColumn(out + i, 1,
+                simd::mul(simd::mul(two, simd::sub(xy, wz)), sy),
+                simd::mul(simd::sub(one, simd::mul(two, simd::add(xx, zz))), sy),
+                simd::mul(simd::mul(two, simd::add(yz, wx)), sy),
+                zero);
+            storeColumn(out + i, 2,
+                simd::mul(simd::mul(two, simd::add(xz, wy)), sz),
+                simd::mul(simd::mul(two, simd::sub(yz, wx)), sz),
+                simd::mul(simd::sub(one, simd::mul(two, simd::add(xx, yy))), sz),
+                zero);
+            storeColumn(out + i, 3,
+                simd::load(positions.x + i),
+                simd::load(positions.y + i),
+                simd::load(positions.z + i),
+                one);
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = Matrix4::compose(
+                Vector3D(positions.x[i], positions.y[i], positions.z[i]),
+                Quaternion(rotations.x[i], rotations.y[i], rotations.z[i], rotations.w[i]),
+                Vector3D(scales.x[i], scales.y[i], scales.z[i]));
+        }
+    }
+
+    // Build the matrices of an array of transforms
+    void TransformBatch::composeMatrices(const Transform* transforms, Matrix4* out, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = transforms[i].toMatrix();
+        }
+    }
+
+    // Multiply pairs of matrices
+    void TransformBatch::multiplyMatrices(const Matrix4* a, const Matrix4* b, Matrix4* out, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = a[i] * b[i];
+        }
+    }
+
+} // end of namespace gam300
@@ -0,0 +1,116 @@
+/**
+ * @file Transform.h
+ * @brief Declaration of the Transform class and batched transform composition.
+ * @details A Transform is a position, rotation and scale applied in the order scale,
+ *          rotate, translate. TransformBatch builds the matrices of many transforms
+ *          stored as separate component arrays, several transforms per SIMD
+ *          instruction, for systems that compute world matrices every frame.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __TRANSFORM_H__
+#define __TRANSFORM_H__
+
+#include <cstddef>
+#include "Matrix4.h"
+#include "Quaternion.h"
+#include "Vector3D.h"
+#include "VectorBatch.h"
+
+namespace gam300 {
+
+    class Transform {
+    public:
+        // Components
+        Vector3D position;
+        Quaternion rotation;
+        Vector3D scale;
+
+        // Constructors
+        Transform();                                                                // No translation, rotation or scaling
+        Transform(const Vector3D& position, const Quaternion& rotation, const Vector3D& scale);
+
+        // Conversion to a matrix, translation * rotation * scale
+        Matrix4 toMatrix() const;
+
+        // Transform operations
+        Vector3D transformPoint(const Vector3D& point) const;         // Scale, rotate and translate a point
+        Vector3D transformDirection(const Vector3D& direction) const; // Rotate a direction
+
+        // Common transforms
+        static const Transform IDENTITY;
+    };
+
+    // Component arrays of many quaternions, quaternion i is (x[i], y[i], z[i], w[i])
+    struct ConstQuaternionArray {
+        const float* x;
+        const float* y;
+        const float* z;
+        const float* w;
+    };
+
+    /**
+     * @brief Operations over arrays of transforms.
+     */
+    class TransformBatch {
+    public:
+        /**
+         * @brief out[i] = Matrix4::compose(positions[i], rotations[i], scales[i])
+         * @details Rotations must be unit length. Builds WIDTH matrices per iteration
+         *          and transposes them into place, the remainder uses Matrix4::compose.
+         * @param positions Translations.
+         * @param rotations Rotations.
+         * @param scales Scale factors.
+         * @param out Receives the matrices.
+         * @param count Number of transforms.
+         */
+        static void composeMatrices(ConstVector3Array positions, ConstQuaternionArray rotations,
+            ConstVector3Array scales, Matrix4* out, std::size_t count);
+
+        /**
+         * @brief out[i] = transforms[i].toMatrix()
+         * @param transforms Transforms to convert.
+         * @param out Receives the matrices.
+         * @param count Number of transforms.
+         */
+        static void composeMatrices(const Transform* transforms, Matrix4* out, std::size_t count);
+
+        /**
+         * @brief out[i] = a[i] * b[i]
+         * @param a Left-hand matrices, e.g. parent world matrices.
+         * @param b Right-hand matrices, e.g. local matrices.
+         * @param out Receives the products, may be the same array as a or b.
+         * @param count Number of matrices.
+         */
+        static void multiplyMatrices(const Matrix4* a, const Matrix4* b, Matrix4* out, std::size_t count);
+    };
+
+    // Default constructor
+    inline Transform::Transform() : position(0.0f, 0.0f, 0.0f), rotation(), scale(1.0f, 1.0f, 1.0f) {}
+
+    // Constructor with components
+    inline Transform::Transform(const Vector3D& position, const Quaternion& rotation, const Vector3D& scale)
+        : position(position), rotation(rotation), scale(scale) {}
+
+    // Convert to a matrix
+    inline Matrix4 Transform::toMatrix() const {
+        return Matrix4::compose(position, rotation, scale);
+    }
+
+    // Transform a point
+    inline Vector3D Transform::transformPoint(const Vector3D& point) const {
+        return rotation.rotate(Vector3D(point.x * scale.x, point.y * scale.y, point.z * scale.z)) + position;
+    }
+
+    // Transform a direction
+    inline Vector3D Transform::transformDirection(const Vector3D& direction) const {
+        return rotation.rotate(direction);
+    }
+
+} // end of namespace gam300
+
+#endif // __TRANSFORM_H__
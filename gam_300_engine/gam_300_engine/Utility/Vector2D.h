@@ -3,6 +3,8 @@
  * @file Vector2D.h
  * @brief Declaration of the Vector2D class for the game engine.
  * @details Provides 2D vector mathematics functionality for positions, velocities, and directions.
+ *          The operations are defined inline below the class so they can be inlined
+ *          into the systems that use them.
  * @author
  * @date
  * Copyright (C) 2025 DigiPen Institute of Technology.
@@ -27,10 +29,10 @@ namespace gam300 {
         // Constructors
         Vector2D();                            // Default constructor (0,0)
         Vector2D(float x, float y);            // Constructor with components
-        Vector2D(const Vector2D& other);       // Copy constructor
+        Vector2D(const Vector2D& other) = default; // Copy constructor
 
         // Assignment
-        Vector2D& operator=(const Vector2D& other);
+        Vector2D& operator=(const Vector2D& other) = default;
 
         // Basic arithmetic operations
         Vector2D operator+(const Vector2D& other) const;
@@ -75,6 +77,148 @@ namespace gam300 {
     // Global scalar multiplication
     Vector2D operator*(float scalar, const Vector2D& vec);
 
+    // Default constructor
+    inline Vector2D::Vector2D() : x(0.0f), y(0.0f) {}
+
+    // Constructor with components
+    inline Vector2D::Vector2D(float x, float y) : x(x), y(y) {}
+
+    // Addition
+    inline Vector2D Vector2D::operator+(const Vector2D& other) const {
+        return Vector2D(x + other.x, y + other.y);
+    }
+
+    // Subtraction
+    inline Vector2D Vector2D::operator-(const Vector2D& other) const {
+        return Vector2D(x - other.x, y - other.y);
+    }
+
+    // Scalar multiplication
+    inline Vector2D Vector2D::operator*(float scalar) const {
+        return Vector2D(x * scalar, y * scalar);
+    }
+
+    // Scalar division
+    inline Vector2D Vector2D::operator/(float scalar) const {
+        // Check for division by zero
+        if (scalar != 0.0f) {
+            float invScalar = 1.0f / scalar;
+            return Vector2D(x * invScalar, y * invScalar);
+        }
+        return *this; // Return original vector on division by zero
+    }
+
+    // Compound addition
+    inline Vector2D& Vector2D::operator+=(const Vector2D& other) {
+        x += other.x;
+        y += other.y;
+        return *this;
+    }
+
+    // Compound subtraction
+    inline Vector2D& Vector2D::operator-=(const Vector2D& other) {
+        x -= other.x;
+        y -= other.y;
+        return *this;
+    }
+
+    // Compound scalar multiplication
+    inline Vector2D& Vector2D::operator*=(float scalar) {
+        x *= scalar;
+        y *= scalar;
+        return *this;
+    }
+
+    // Compound scalar division
+    inline Vector2D& Vector2D::operator/=(float scalar) {
+        // Check for division by zero
+        if (scalar != 0.0f) {
+            float invScalar = 1.0f / scalar;
+            x *= invScalar;
+            y *= invScalar;
+        }
+        return *this;
+    }
+
+    // Negation
+    inline Vector2D Vector2D::operator-() const {
+        return Vector2D(-x, -y);
+    }
+
+    // Equality
+    inline bool Vector2D::operator==(const Vector2D& other) const {
+        // Use epsilon comparison for floating-point values
+        const float EPSILON = 0.000001f;
+        return (std::abs(x - other.x) < EPSILON && std::abs(y - other.y) < EPSILON);
+    }
+
+    // Inequality
+    inline bool Vector2D::operator!=(const Vector2D& other) const {
+        return !(*this == other);
+    }
+
+    // Magnitude (length)
+    inline float Vector2D::magnitude() const {
+        return std::sqrt(x * x + y * y);
+    }
+
+    // Squared magnitude
+    inline float Vector2D::magnitudeSquared() const {
+        return x * x + y * y;
+    }
+
+    // Normalize (return a unit vector)
+    inline Vector2D Vector2D::normalize() const {
+        float mag = magnitude();
+        if (mag > 0.0f) {
+            float invMag = 1.0f / mag;
+            return Vector2D(x * invMag, y * invMag);
+        }
+        return *this; // Return original vector if magnitude is zero
+    }
+
+    // Normalize in place
+    inline void Vector2D::normalizeInPlace() {
+        float mag = magnitude();
+        if (mag > 0.0f) {
+            float invMag = 1.0f / mag;
+            x *= invMag;
+            y *= invMag;
+        }
+    }
+
+    // Dot product
+    inline float Vector2D::dot(const Vector2D& a, const Vector2D& b) {
+        return a.x * b.x + a.y * b.y;
+    }
+
+    // 2D cross product (returns scalar)
+    inline float Vector2D::cross(const Vector2D& a, const Vector2D& b) {
+        return a.x * b.y - a.y * b.x;
+    }
+
+    // Distance between vectors
+    inline float Vector2D::distance(const Vector2D& a, const Vector2D& b) {
+        return (b - a).magnitude();
+    }
+
+    // Squared distance
+    inline float Vector2D::distanceSquared(const Vector2D& a, const Vector2D& b) {
+        return (b - a).magnitudeSquared();
+    }
+
+    // Linear interpolation
+    inline Vector2D Vector2D::lerp(const Vector2D& a, const Vector2D& b, float t) {
+        // Clamp t to [0, 1]
+        t = (t < 0.0f) ? 0.0f : ((t > 1.0f) ? 1.0f : t);
+        return a + (b - a) * t;
+    }
+
+    // Global scalar multiplication
+    inline Vector2D operator*(float scalar, const Vector2D& vec) {
+        return vec * scalar;
+    }
+
 } // end of namespace gam300
 
 #endif // __VECTOR2D_H__
\ No newline at end of file
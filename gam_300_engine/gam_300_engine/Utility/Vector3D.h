@@ -3,6 +3,9 @@
  * @file Vector3D.h
  * @brief Declaration of the Vector3D class for the game engine.
  * @details Provides 3D vector mathematics functionality for positions, velocities, and directions.
+ *          The operations are defined inline below the class so they can be inlined
+ *          into the systems that use them. VectorBatch.h has the same operations over
+ *          arrays of components for code that transforms many vectors at once.
  * @author
  * @date
  * Copyright (C) 2025 DigiPen Institute of Technology.
@@ -29,14 +32,14 @@ namespace gam300 {
         // Constructors
         Vector3D();                              // Default constructor (0,0,0)
         Vector3D(float x, float y, float z);     // Constructor with components
-        Vector3D(const Vector3D& other);         // Copy constructor
+        Vector3D(const Vector3D& other) = default; // Copy constructor
         Vector3D(const Vector2D& vec2, float z); // Construct from Vector2D + z component
 
         // Conversion to Vector2D (drops z component)
         Vector2D toVector2D() const;
 
         // Assignment
-        Vector3D& operator=(const Vector3D& other);
+        Vector3D& operator=(const Vector3D& other) = default;
 
         // Basic arithmetic operations
         Vector3D operator+(const Vector3D& other) const;
@@ -90,6 +93,188 @@ namespace gam300 {
     // Global scalar multiplication
     Vector3D operator*(float scalar, const Vector3D& vec);
 
+    // Default constructor
+    inline Vector3D::Vector3D() : x(0.0f), y(0.0f), z(0.0f) {}
+
+    // Constructor with components
+    inline Vector3D::Vector3D(float x, float y, float z) : x(x), y(y), z(z) {}
+
+    // Construct from Vector2D + z component
+    inline Vector3D::Vector3D(const Vector2D& vec2, float z) : x(vec2.x), y(vec2.y), z(z) {}
+
+    // Convert to Vector2D (drop z)
+    inline Vector2D Vector3D::toVector2D() const {
+        return Vector2D(x, y);
+    }
+
+    // Addition
+    inline Vector3D Vector3D::operator+(const Vector3D& other) const {
+        return Vector3D(x + other.x, y + other.y, z + other.z);
+    }
+
+    // Subtraction
+    inline Vector3D Vector3D::operator-(const Vector3D& other) const {
+        return Vector3D(x - other.x, y - other.y, z - other.z);
+    }
+
+    // Scalar multiplication
+    inline Vector3D Vector3D::operator*(float scalar) const {
+        return Vector3D(x * scalar, y * scalar, z * scalar);
+    }
+
+    // Scalar division
+    inline Vector3D Vector3D::operator/(float scalar) const {
+        // Check for division by zero
+        if (scalar != 0.0f) {
+            float invScalar = 1.0f / scalar;
+            return Vector3D(x * invScalar, y * invScalar, z * invScalar);
+        }
+        return *this; // Return original vector on division by zero
+    }
+
+    // Compound addition
+    inline Vector3D& Vector3D::operator+=(const Vector3D& other) {
+        x += other.x;
+        y += other.y;
+        z += other.z;
+        return *this;
+    }
+
+    // Compound subtraction
+    inline Vector3D& Vector3D::operator-=(const Vector3D& other) {
+        x -= other.x;
+        y -= other.y;
+        z -= other.z;
+        return *this;
+    }
+
+    // Compound scalar multiplication
+    inline Vector3D& Vector3D::operator*=(float scalar) {
+        x *= scalar;
+        y *= scalar;
+        z *= scalar;
+        return *this;
+    }
+
+    // Compound scalar division
+    inline Vector3D& Vector3D::operator/=(float scalar) {
+        // Check for division by zero
+        if (scalar != 0.0f) {
+            float invScalar = 1.0f / scalar;
+            x *= invScalar;
+            y *= invScalar;
+            z *= invScalar;
+        }
+        return *this;
+    }
+
+    // Negation
+    inline Vector3D Vector3D::operator-() const {
+        return Vector3D(-x, -y, -z);
+    }
+
+    // Equality
+    inline bool Vector3D::operator==(const Vector3D& other) const {
+        // Use epsilon comparison for floating-point values
+        const float EPSILON = 0.000001f;
+        return (std::abs(x - other.x) < EPSILON &&
+            std::abs(y - other.y) < EPSILON &&
+            std::abs(z - other.z) < EPSILON);
+    }
+
+    // Inequality
+    inline bool Vector3D::operator!=(const Vector3D& other) const {
+        return !(*this == other);
+    }
+
+    // Magnitude (length)
+    inline float Vector3D::magnitude() const {
+        return std::sqrt(x * x + y * y + z * z);
+    }
+
+    // Squared magnitude
+    inline float Vector3D::magnitudeSquared() const {
+        return x * x + y * y + z * z;
+    }
+
+    // Normalize (return a unit vector)
+    inline Vector3D Vector3D::normalize() const {
+        float mag = magnitude();
+        if (mag > 0.0f) {
+            float invMag = 1.0f / mag;
+            return Vector3D(x * invMag, y * invMag, z * invMag);
+        }
+        return *this; // Return original vector if magnitude is zero
+    }
+
+    // Normalize in place
+    inline void Vector3D::normalizeInPlace() {
+        float mag = magnitude();
+        if (mag > 0.0f) {
+            float invMag = 1.0f / mag;
+            x *= invMag;
+            y *= invMag;
+            z *= invMag;
+        }
+    }
+
+    // Dot product
+    inline float Vector3D::dot(const Vector3D& a, const Vector3D& b) {
+        return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+
+    // Cross product
+    inline Vector3D Vector3D::cross(const Vector3D& a, const Vector3D& b) {
+        return Vector3D(
+            a.y * b.z - a.z * b.y,
+            a.z * b.x - a.x * b.z,
+            a.x * b.y - a.y * b.x
+        );
+    }
+
+    // Distance between vectors
+    inline float Vector3D::distance(const Vector3D& a, const Vector3D& b) {
+        return (b - a).magnitude();
+    }
+
+    // Squared distance
+    inline float Vector3D::distanceSquared(const Vector3D& a, const Vector3D& b) {
+        return (b - a).magnitudeSquared();
+    }
+
+    // Linear interpolation
+    inline Vector3D Vector3D::lerp(const Vector3D& a, const Vector3D& b, float t) {
+        // Clamp t to [0, 1]
+        t = (t < 0.0f) ? 0.0f : ((t > 1.0f) ? 1.0f : t);
+        return a + (b - a) * t;
+    }
+
+    // Project v onto 'onto'
+    inline Vector3D Vector3D::project(const Vector3D& v, const Vector3D& onto) {
+        float magnitudeSq = onto.magnitudeSquared();
+        if (magnitudeSq < 0.000001f) {
+            return Vector3D::ZERO; // Avoid division by zero
+        }
+
+        float dotProduct = dot(v, onto);
+        float scale = dotProduct / magnitudeSq;
+        return onto * scale;
+    }
+
+    // Reflect v about normal
+    inline Vector3D Vector3D::reflect(const Vector3D& v, const Vector3D& normal) {
+        // Make sure normal is normalized
+        Vector3D normalizedNormal = normal.normalize();
+
+        // r = v - 2(v.n)n
+        return v - normalizedNormal * (2.0f * dot(v, normalizedNormal));
+    }
+
+    // Global scalar multiplication
+    inline Vector3D operator*(float scalar, const Vector3D& vec) {
+        return vec * scalar;
+    }
+
 } // end of namespace gam300
 
 #endif // __VECTOR3D_H__
\ No newline at end of file
@@ -0,0 +1,150 @@
+/**
+ * @file VectorBatch.cpp
+ * @brief Implementation of batch vector operations for the game engine.
+ * @details Each operation runs a SIMD loop over as many whole groups of vectors as
+ *          fit in the arrays and finishes the remainder with the Vector3D operation.
+ *          The SIMD loops use the same operation order as Vector3D so both give the
+ *          same results.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+#include "VectorBatch.h"
+#include "Simd.h"
+
+namespace gam300 {
+
+    namespace {
+
+        // Read vector i of a batch
+        inline Vector3D loadVector(ConstVector3Array a, std::size_t i) {
+            return Vector3D(a.x[i], a.y[i], a.z[i]);
+        }
+
+        // Write vector i of a batch
+        inline void storeVector(Vector3Array out, std::size_t i, const Vector3D& v) {
+            out.x[i] = v.x;
+            out.y[i] = v.y;
+            out.z[i] = v.z;
+        }
+
+    } // anonymous namespace
+
+    // Get the instruction set the operations were built for
+    const char* VectorBatch::getInstructionSet() {
+        return simd::instruction_set();
+    }
+
+    // Add two batches of vectors
+    void VectorBatch::add(ConstVector3Array a, ConstVector3Array b, Vector3Array out, std::size_t count) {
+        std::size_t i = 0;
+#if defined(GAM300_SIMD_LANES)
+        for (; i + simd::WIDTH <= count; i += simd::WIDTH) {
+            simd::store(out.x + i, simd::add(simd::load(a.x + i), simd::load(b.x + i)));
+            simd::store(out.y + i, simd::add(simd::load(a.y + i), simd::load(b.y + i)));
+            simd::store(out.z + i, simd::add(simd::load(a.z + i), simd::load(b.z + i)));
+        }
+#endif
+        for (; i < count; ++i) {
+            storeVector(out, i, loadVector(a, i) + loadVector(b, i));
+        }
+    }
+
+    // Scale a batch of vectors
+    void VectorBatch::scale(ConstVector3Array a, float scalar, Vector3Array out, std::size_t count) {
+        std::size_t i = 0;
+#if defined(GAM300_SIMD_LANES)
+        simd::Lanes s = simd::splat(scalar);
+        for (; i + simd::WIDTH <= count; i += simd::WIDTH) {
+            simd::store(out.x + i, simd::mul(simd::load(a.x + i), s));
+            simd::store(out.y + i, simd::mul(simd::load(a.y + i), s));
+            simd::store(out.z + i, simd::mul(simd::load(a.z + i), s));
+        }
+#endif
+        for (; i < count; ++i) {
+            storeVector(out, i, loadVector(a, i) * scalar);
+        }
+    }
+
+    // Add a scaled batch of vectors to another
+    void VectorBatch::addScaled(ConstVector3Array a, ConstVector3Array b, float scalar, Vector3Array out, std::size_t count) {
+        std::size_t i = 0;
+#if defined(GAM300_SIMD_LANES)
+        simd::Lanes s = simd::splat(scalar);
+        for (; i + simd::WIDTH <= count; i += simd::WIDTH) {
+            simd::store(out.x + i, simd::add(simd::load(a.x + i), simd::mul(simd::load(b.x + i), s)));
+            simd::store(out.y + i, simd::add(simd::load(a.y + i), simd::mul(simd::load(b.y + i), s)));
+            simd::store(out.z + i, simd::add(simd::load(a.z + i), simd::mul(simd::load(b.z + i), s)));
+        }
+#endif
+        for (; i < count; ++i) {
+            storeVector(out, i, loadVector(a, i) + loadVector(b, i) * scalar);
+        }
+    }
+
+    // Dot products of two batches of vectors
+    void VectorBatch::dot(ConstVector3Array a, ConstVector3Array b, float* out, std::size_t count) {
+        std::size_t i = 0;
+#if defined(GAM300_SIMD_LANES)
+        for (; i + simd::WIDTH <= count; i += simd::WIDTH) {
+            simd::Lanes result = simd::mul(simd::load(a.x + i), simd::load(b.x + i));
+            result = simd::add(result, simd::mul(simd::load(a.y + i), simd::load(b.y + i)));
+            result = simd::add(result, simd::mul(simd::load(a.z + i), simd::load(b.z + i)));
+            simd::store(out + i, result);
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = Vector3D::dot(loadVector(a, i), loadVector(b, i));
+        }
+    }
+
+    // Normalize a batch of vectors
+    void VectorBatch::normalize(ConstVector3Array a, Vector3Array out, std::size_t count) {
+        std::size_t i = 0;
+#if defined(GAM300_SIMD_LANES)
+        simd::Lanes one = simd::splat(1.0f);
+        for (; i + simd::WIDTH <= count; i += simd::WIDTH) {
+            simd::Lanes x = simd::load(a.x + i);
+            simd::Lanes y = simd::load(a.y + i);
+            simd::Lanes z = simd::load(a.z + i);
+            simd::Lanes length_sq = simd::add(simd::add(simd::mul(x, x), simd::mul(y, y)), simd::mul(z, z));
+            simd::Lanes length = simd::sqrt(length_sq);
+            simd::Lanes inv_length = simd::div(one, length);
+
+            // Zero vectors keep their value, like Vector3D::normalize
+            simd::store(out.x + i, simd::select_positive(length, simd::mul(x, inv_length), x));
+            simd::store(out.y + i, simd::select_positive(length, simd::mul(y, inv_length), y));
+            simd::store(out.z + i, simd::select_positive(length, simd::mul(z, inv_length), z));
+        }
+#endif
+        for (; i < count; ++i) {
+            storeVector(out, i, loadVector(a, i).normalize());
+        }
+    }
+
+    // Interpolate between two batches of vectors
+    void VectorBatch::lerp(ConstVector3Array a, ConstVector3Array b, float t, Vector3Array out, std::size_t count) {
+        // Clamp t to [0, 1]
+        t = (t < 0.0f) ? 0.0f : ((t > 1.0f) ? 1.0f : t);
+
+        std::size_t i = 0;
+#if defined(GAM300_SIMD_LANES)
+        simd::Lanes factor = simd::splat(t);
+        for (; i + simd::WIDTH <= count; i += simd::WIDTH) {
+            simd::Lanes ax = simd::load(a.x + i);
+            simd::Lanes ay = simd::load(a.y + i);
+            simd::Lanes az = simd::load(a.z + i);
+            simd::store(out.x + i, simd::add(ax, simd::mul(simd::sub(simd::load(b.x + i), ax), factor)));
+            simd::store(out.y + i, simd::add(ay, simd::mul(simd::sub(simd::load(b.y + i), ay), factor)));
+            simd::store(out.z + i, simd::add(az, simd::mul(simd::sub(simd::load(b.z + i), az), factor)));
+        }
+#endif
+        for (; i < count; ++i) {
+            storeVector(out, i, Vector3D::lerp(loadVector(a, i), loadVector(b, i), t));
+        }
+    }
+
+} // end of namespace gam300
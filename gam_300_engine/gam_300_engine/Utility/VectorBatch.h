@@ -0,0 +1,162 @@
+/**
+ * @file VectorBatch.h
+ * @brief Declaration of batch vector operations for the game engine.
+ * @details Applies the Vector3D operations to many vectors stored as separate x, y
+ *          and z arrays (structure of arrays), processing several vectors per SIMD
+ *          instruction. AVX is used when the engine is built with it enabled, SSE2
+ *          otherwise, and plain loops on targets with neither. Every variant gives
+ *          the same results as the matching Vector3D operation.
+ * @author
+ * @date
+ * Copyright (C) 2025 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef __VECTOR_BATCH_H__
+#define __VECTOR_BATCH_H__
+
+#include <cstddef>
+#include <vector>
+#include "Vector3D.h"
+
+namespace gam300 {
+
+    // Component arrays of many vectors, vector i is (x[i], y[i], z[i])
+    struct Vector3Array {
+        float* x;
+        float* y;
+        float* z;
+    };
+
+    // Read-only component arrays of many vectors
+    struct ConstVector3Array {
+        const float* x;
+        const float* y;
+        const float* z;
+
+        ConstVector3Array(const float* x, const float* y, const float* z) : x(x), y(y), z(z) {}
+        ConstVector3Array(const Vector3Array& other) : x(other.x), y(other.y), z(other.z) {}
+    };
+
+    /**
+     * @brief Operations over arrays of 3D vectors.
+     * @details The output arrays may be the same as an input, so operations can run
+     *          in place. Arrays need no particular alignment.
+     */
+    class VectorBatch {
+    public:
+        /**
+         * @brief Get the instruction set the operations were built for.
+         * @return "AVX", "SSE2" or "scalar".
+         */
+        static const char* getInstructionSet();
+
+        /**
+         * @brief out[i] = a[i] + b[i]
+         * @param a First vectors.
+         * @param b Second vectors.
+         * @param out Receives the sums.
+         * @param count Number of vectors.
+         */
+        static void add(ConstVector3Array a, ConstVector3Array b, Vector3Array out, std::size_t count);
+
+        /**
+         * @brief out[i] = a[i] * scalar
+         * @param a Vectors to scale.
+         * @param scalar Scale factor.
+         * @param out Receives the scaled vectors.
+         * @param count Number of vectors.
+         */
+        static void scale(ConstVector3Array a, float scalar, Vector3Array out, std::size_t count);
+
+        /**
+         * @brief out[i] = a[i] + b[i] * scalar, e.g. position + velocity * dt
+         * @param a Base vectors.
+         * @param b Vectors to scale and add.
+         * @param scalar Scale factor for b.
+         * @param out Receives the results.
+         * @param count Number of vectors.
+         */
+        static void addScaled(ConstVector3Array a, ConstVector3Array b, float scalar, Vector3Array out, std::size_t count);
+
+        /**
+         * @brief out[i] = Vector3D::dot(a[i], b[i])
+         * @param a First vectors.
+         * @param b Second vectors.
+         * @param out Receives one dot product per vector.
+         * @param count Number of vectors.
+         */
+        static void dot(ConstVector3Array a, ConstVector3Array b, float* out, std::size_t count);
+
+        /**
+         * @brief out[i] = a[i].normalize(), zero vectors are copied unchanged
+         * @param a Vectors to normalize.
+         * @param out Receives the unit vectors.
+         * @param count Number of vectors.
+         */
+        static void normalize(ConstVector3Array a, Vector3Array out, std::size_t count);
+
+        /**
+         * @brief out[i] = Vector3D::lerp(a[i], b[i], t), t is clamped to [0, 1]
+         * @param a Vectors at t = 0.
+         * @param b Vectors at t = 1.
+         * @param t Interpolation factor.
+         * @param out Receives the interpolated vectors.
+         * @param count Number of vectors.
+         */
+        static void lerp(ConstVector3Array a, ConstVector3Array b, float t, Vector3Array out, std::size_t count);
+    };
+
+    /**
+     * @brief Owning storage for many 3D vectors in the layout VectorBatch works on.
+     */
+    class Vector3Buffer {
+    public:
+        Vector3Buffer() = default;
+        explicit Vector3Buffer(std::size_t count) { resize(count); }
+
+        /**
+         * @brief Change the number of vectors, new vectors are zero.
+         * @param count The new number of vectors.
+         */
+        void resize(std::size_t count) {
+            m_x.resize(count, 0.0f);
+            m_y.resize(count, 0.0f);
+            m_z.resize(count, 0.0f);
+        }
+
+        /**
+         * @brief Get one vector.
+         * @param index Index of the vector.
+         * @return A copy of the vector.
+         */
+        Vector3D get(std::size_t index) const { return Vector3D(m_x[index], m_y[index], m_z[index]); }
+
+        /**
+         * @brief Overwrite one vector.
+         * @param index Index of the vector.
+         * @param value The new value.
+         */
+        void set(std::size_t index, const Vector3D& value) {
+            m_x[index] = value.x;
+            m_y[index] = value.y;
+            m_z[index] = value.z;
+        }
+
+        // Component arrays to pass to VectorBatch
+        Vector3Array view() { return { m_x.data(), m_y.data(), m_z.data() }; }
+        ConstVector3Array view() const { return { m_x.data(), m_y.data(), m_z.data() }; }
+
+        std::size_t size() const { return m_x.size(); }
+        bool empty() const { return m_x.empty(); }
+
+    private:
+        std::vector<float> m_x;     ///< x components
+        std::vector<float> m_y;     ///< y components
+        std::vector<float> m_z;     ///< z components
+    };
+
+} // end of namespace gam300
+
+#endif // __VECTOR_BATCH_H__